@@ -0,0 +1,123 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Audio/AudioMixer.hpp"
+#include "Engine/Audio/AudioOutput.hpp"
+#include "Engine/Audio/Wav.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <numbers>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr std::array<std::size_t, 4> voice_counts{1u, 16u, 64u, 256u};
+//One second of output per timed run.
+constexpr std::size_t block_count = 100u;
+constexpr std::size_t repeat_count = 5u;
+
+template<typename T>
+void WriteValue(std::ofstream& file, T value) noexcept {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+//Two seconds of a sine, written as a .wav so the mixer reads it the way it reads game assets.
+template<typename Sample>
+[[nodiscard]] bool WriteSineWav(const std::filesystem::path& path, std::uint32_t sampleRate, std::uint16_t channelCount) noexcept {
+    const auto frame_count = static_cast<std::size_t>(sampleRate) * 2u;
+    auto samples = std::vector<Sample>(frame_count * channelCount);
+    for(std::size_t i = 0u; i < frame_count; ++i) {
+        const auto value = 0.25 * std::sin(2.0 * std::numbers::pi * 440.0 * static_cast<double>(i) / sampleRate);
+        for(std::size_t c = 0u; c < channelCount; ++c) {
+            if constexpr(std::is_same_v<Sample, float>) {
+                samples[i * channelCount + c] = static_cast<float>(value);
+            } else {
+                samples[i * channelCount + c] = static_cast<std::int16_t>(value * 32767.0);
+            }
+        }
+    }
+    constexpr std::uint16_t format_id = std::is_same_v<Sample, float> ? 3u : 1u;
+    const auto block_align = static_cast<std::uint16_t>(channelCount * sizeof(Sample));
+    const auto data_length = static_cast<std::uint32_t>(samples.size() * sizeof(Sample));
+    std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    file.write("RIFF", 4);
+    WriteValue(file, static_cast<std::uint32_t>(36u + data_length));
+    file.write("WAVEfmt ", 8);
+    WriteValue(file, std::uint32_t{16u});
+    WriteValue(file, format_id);
+    WriteValue(file, channelCount);
+    WriteValue(file, sampleRate);
+    WriteValue(file, static_cast<std::uint32_t>(sampleRate * block_align));
+    WriteValue(file, block_align);
+    WriteValue(file, static_cast<std::uint16_t>(sizeof(Sample) * 8u));
+    file.write("data", 4);
+    WriteValue(file, data_length);
+    file.write(reinterpret_cast<const char*>(samples.data()), data_length);
+    return static_cast<bool>(file);
+}
+
+//Starts voiceCount looping voices of wav, each panned and pitched a little differently, and mixes block_count
+//blocks straight through MixBlock so only the mixing is timed, not the output's pacing.
+void ReportVoices(std::string_view label, const FileUtils::Wav& wav, std::size_t voiceCount) noexcept {
+    const auto format = AudioMixerFormat{};
+    AudioMixer mixer{std::make_unique<NullAudioOutput>(AudioOutputPacing::Unthrottled), format, voiceCount};
+    for(std::size_t i = 0u; i < voiceCount; ++i) {
+        auto desc = AudioVoiceDesc{};
+        desc.volume = 1.0f / static_cast<float>(voiceCount);
+        desc.frequency = 0.9f + 0.2f * static_cast<float>(i) / static_cast<float>(voiceCount);
+        desc.loop_count = AudioVoiceDesc::infinite_loops;
+        const auto voice = mixer.Play(wav, desc);
+        const auto angle = static_cast<float>(i) / static_cast<float>(voiceCount) * std::numbers::pi_v<float> * 0.5f;
+        mixer.SetVoicePan(voice, AudioPan{{std::cos(angle), std::sin(angle)}, 1.0f});
+    }
+    auto block = std::vector<float>(format.GetBlockSampleCount());
+    //The first block applies the queued plays; keep it out of the timing.
+    mixer.MixBlock(block);
+    if(mixer.GetPlayingVoiceCount() != voiceCount) {
+        Benchmarks::Report(std::format("{}, {} voices, voices that started", label, voiceCount), static_cast<double>(mixer.GetPlayingVoiceCount()), "voices");
+        return;
+    }
+    const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        for(std::size_t i = 0u; i < block_count; ++i) {
+            mixer.MixBlock(block);
+            Benchmarks::DoNotOptimize(block.data());
+        }
+    });
+    const auto mixed_ms = static_cast<double>(block_count * format.block_frames) * 1.0e3 / format.sample_rate;
+    const auto cpu_ms = seconds * 1.0e3;
+    Benchmarks::Report(std::format("{}, {} voices, per 10 ms block", label, voiceCount), cpu_ms / block_count * 1.0e3, "us");
+    //Milliseconds of voice output mixed per millisecond of CPU: how many such voices one core keeps up with.
+    Benchmarks::Report(std::format("{}, {} voices, voices mixed per ms", label, voiceCount), static_cast<double>(voiceCount) * mixed_ms / cpu_ms, "voices");
+}
+
+} // namespace
+
+BENCHMARK_CASE("AudioMixer: voices mixed per ms of CPU, 48 kHz stereo output") {
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto resampled_path = directory / "mixer_benchmark_44k_int16_stereo.wav";
+    const auto native_path = directory / "mixer_benchmark_48k_float_mono.wav";
+    FileUtils::Wav resampled{};
+    FileUtils::Wav native{};
+    if(!WriteSineWav<std::int16_t>(resampled_path, 44100u, 2u) || resampled.Load(resampled_path) != FileUtils::Wav::WAV_SUCCESS
+       || !WriteSineWav<float>(native_path, 48000u, 1u) || native.Load(native_path) != FileUtils::Wav::WAV_SUCCESS) {
+        Benchmarks::Report("could not write the source .wav files", 0.0, "");
+        return;
+    }
+    for(const auto voices : voice_counts) {
+        //The common asset: 16-bit stereo at 44.1 kHz, converted and resampled to the output rate.
+        ReportVoices("44.1 kHz int16 stereo", resampled, voices);
+        ReportVoices("48 kHz float mono", native, voices);
+    }
+    std::error_code ec{};
+    std::filesystem::remove(resampled_path, ec);
+    std::filesystem::remove(native_path, ec);
+}
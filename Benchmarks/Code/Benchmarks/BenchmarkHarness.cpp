@@ -0,0 +1,50 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+namespace Benchmarks {
+
+Registrar::Registrar(std::string_view name, BenchmarkFunction function) noexcept {
+    GetRegistry().push_back(BenchmarkCase{name, function});
+}
+
+std::vector<BenchmarkCase>& GetRegistry() noexcept {
+    //Function-local so registration works regardless of the order translation units are initialized in.
+    static std::vector<BenchmarkCase> registry{};
+    return registry;
+}
+
+void Report(std::string_view label, double value, std::string_view unit) noexcept {
+    std::printf("    %-56.*s %14.2f %.*s\n", static_cast<int>(label.size()), label.data(), value, static_cast<int>(unit.size()), unit.data());
+}
+
+//Publishing through an atomic makes the value observable, so the work that produced it has to happen.
+void DoNotOptimize(std::uint64_t value) noexcept {
+    static std::atomic<std::uint64_t> sink{0u};
+    sink.store(value, std::memory_order_relaxed);
+}
+
+void DoNotOptimize(const void* p) noexcept {
+    static std::atomic<const void*> sink{nullptr};
+    sink.store(p, std::memory_order_relaxed);
+}
+
+void RunAll(std::string_view filter /*= std::string_view{}*/) noexcept {
+    int run = 0;
+    for(const auto& benchmark : GetRegistry()) {
+        if(!filter.empty() && benchmark.name.find(filter) == std::string_view::npos) {
+            continue;
+        }
+        ++run;
+        std::printf("[%.*s]\n", static_cast<int>(benchmark.name.size()), benchmark.name.data());
+        const auto start = std::chrono::steady_clock::now();
+        benchmark.function();
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+        std::printf("    (%.1f s)\n", elapsed.count());
+    }
+    std::printf("%d benchmarks run.\n", run);
+}
+
+} // namespace Benchmarks
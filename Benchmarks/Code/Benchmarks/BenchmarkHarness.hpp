@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+//Minimal self-registering benchmark runner, the counterpart of the Tests runner for throughput numbers.
+//Each BENCHMARK_CASE adds itself to the registry during static initialization; Main runs them all and
+//every case prints its own rows through Report.
+namespace Benchmarks {
+
+using BenchmarkFunction = void (*)();
+
+struct BenchmarkCase {
+    std::string_view name{};
+    BenchmarkFunction function{nullptr};
+};
+
+class Registrar {
+public:
+    Registrar(std::string_view name, BenchmarkFunction function) noexcept;
+};
+
+[[nodiscard]] std::vector<BenchmarkCase>& GetRegistry() noexcept;
+
+//Prints one labelled result row under the running benchmark.
+void Report(std::string_view label, double value, std::string_view unit) noexcept;
+
+//Keeps the optimizer from discarding work whose result is otherwise unused.
+void DoNotOptimize(std::uint64_t value) noexcept;
+void DoNotOptimize(const void* p) noexcept;
+
+//Runs fn repeatCount times and returns the fastest run in seconds.
+//The minimum is the run least disturbed by the rest of the machine, so it is the most repeatable figure.
+template<typename Fn>
+[[nodiscard]] double TimeBest(std::size_t repeatCount, Fn&& fn) noexcept {
+    auto best = (std::numeric_limits<double>::max)();
+    for(std::size_t i = 0u; i < repeatCount; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = (std::min)(best, elapsed);
+    }
+    return best;
+}
+
+//Runs every benchmark whose name contains filter.
+void RunAll(std::string_view filter = std::string_view{}) noexcept;
+
+} // namespace Benchmarks
+
+#define BENCHMARKS_CONCAT_IMPL(a, b) a##b
+#define BENCHMARKS_CONCAT(a, b) BENCHMARKS_CONCAT_IMPL(a, b)
+
+#define BENCHMARK_CASE(name)                                                                                                       \
+    static void BENCHMARKS_CONCAT(benchmark_case_, __LINE__)();                                                                     \
+    static const Benchmarks::Registrar BENCHMARKS_CONCAT(benchmark_registrar_, __LINE__){name, &BENCHMARKS_CONCAT(benchmark_case_, __LINE__)}; \
+    static void BENCHMARKS_CONCAT(benchmark_case_, __LINE__)()
@@ -0,0 +1,117 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/BinaryLog.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//Half a thread's ring, so a burst never drops while the drainer is descheduled.
+constexpr std::size_t burst_size = 512u;
+constexpr std::size_t burst_count = 200u;
+constexpr std::array<std::size_t, 3> producer_counts{1u, 2u, 4u};
+
+//Sleeps on the drain signal and empties the rings, as the FileLogger worker does.
+class Drainer {
+public:
+    Drainer() noexcept {
+        BinaryLog::SetDrainSignal(&m_signal);
+        m_thread = std::jthread([this](std::stop_token stop) {
+            auto records = std::vector<BinaryLogRecord>(256u);
+            while(!stop.stop_requested()) {
+                const auto epoch = m_signal.load();
+                while(const auto count = BinaryLog::Drain(records)) {
+                    m_drained.fetch_add(count, std::memory_order_release);
+                }
+                m_signal.wait(epoch);
+            }
+        });
+    }
+    ~Drainer() noexcept {
+        m_thread.request_stop();
+        ++m_signal;
+        m_signal.notify_all();
+        m_thread.join();
+        BinaryLog::SetDrainSignal(nullptr);
+    }
+
+    void WaitFor(std::uint64_t expected) const noexcept {
+        while(m_drained.load(std::memory_order_acquire) + BinaryLog::GetDroppedCount() < expected) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    std::atomic<std::uint64_t> m_signal{0u};
+    std::atomic<std::uint64_t> m_drained{0u};
+    std::jthread m_thread{};
+};
+
+//Times only the log calls. Each producer logs a burst, then waits for the drainer to catch up before the next.
+//The first burst registers each thread's ring and is not timed.
+template<typename LogFn>
+[[nodiscard]] double TimeBursts(std::size_t producerCount, LogFn&& log) noexcept {
+    Drainer drainer{};
+    const auto base = BinaryLog::GetDroppedCount();
+    auto nanoseconds = std::atomic<std::uint64_t>{0u};
+    {
+        auto producers = std::vector<std::jthread>{};
+        for(std::size_t p = 0u; p < producerCount; ++p) {
+            producers.emplace_back([&, producerCount]() {
+                for(std::size_t burst = 0u; burst <= burst_count; ++burst) {
+                    const auto start = std::chrono::steady_clock::now();
+                    for(std::size_t i = 0u; i < burst_size; ++i) {
+                        log(burst * burst_size + i);
+                    }
+                    const auto elapsed = std::chrono::steady_clock::now() - start;
+                    if(burst != 0u) {
+                        nanoseconds.fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+                    }
+                    drainer.WaitFor(base + (burst + 1u) * producerCount * burst_size);
+                }
+            });
+        }
+    }
+    return static_cast<double>(nanoseconds.load()) / static_cast<double>(producerCount * burst_size * burst_count);
+}
+
+} // namespace
+
+BENCHMARK_CASE("BinaryLog: LOG_STRUCTURED ns per call vs formatting the line") {
+    for(const auto producers : producer_counts) {
+        const auto dropped_before = BinaryLog::GetDroppedCount();
+        const auto ns = TimeBursts(producers, [](std::size_t i) {
+            LOG_STRUCTURED("Loaded {} in {:.2f} ms ({} bytes)", "Data/Images/test.png", static_cast<double>(i) * 0.25, i);
+        });
+        Benchmarks::Report(std::format("LOG_STRUCTURED, {} producers", producers), ns, "ns/log");
+        Benchmarks::Report(std::format("LOG_STRUCTURED, {} producers, dropped", producers), static_cast<double>(BinaryLog::GetDroppedCount() - dropped_before), "records");
+    }
+    {
+        //Each record is stamped with steady_clock, so the clock read is a floor under the per-call cost.
+        constexpr std::size_t call_count = burst_size * burst_count;
+        const auto seconds = Benchmarks::TimeBest(3u, []() {
+            for(std::size_t i = 0u; i < call_count; ++i) {
+                Benchmarks::DoNotOptimize(static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+            }
+        });
+        Benchmarks::Report("steady_clock::now alone", seconds / call_count * 1.0e9, "ns/call");
+    }
+    {
+        //What the text path pays on the calling thread before the message is even queued.
+        constexpr std::size_t call_count = burst_size * burst_count;
+        const auto seconds = Benchmarks::TimeBest(3u, []() {
+            for(std::size_t i = 0u; i < call_count; ++i) {
+                auto line = std::format("Loaded {} in {:.2f} ms ({} bytes)\n", "Data/Images/test.png", static_cast<double>(i) * 0.25, i);
+                Benchmarks::DoNotOptimize(line.data());
+            }
+        });
+        Benchmarks::Report("std::format of the same line, 1 producer", seconds / call_count * 1.0e9, "ns/log");
+    }
+}
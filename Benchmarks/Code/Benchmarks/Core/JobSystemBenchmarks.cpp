@@ -0,0 +1,195 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/ThreadSafeQueue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t flat_job_count = 100'000u;
+constexpr unsigned int fork_depth = 16u;
+constexpr std::size_t repeat_count = 5u;
+
+//The generic path as it was before work stealing: one locked queue shared by every worker, a heap-allocated
+//job with a std::function per dispatch, and notify_all on every push. Workers drain the queue while still
+//holding the lock they waited on, exactly as JobConsumer::ConsumeAll was called from GenericJobWorker.
+class LockedQueueScheduler {
+public:
+    explicit LockedQueueScheduler(std::size_t workerCount) noexcept {
+        for(std::size_t i = 0u; i < workerCount; ++i) {
+            m_threads.emplace_back(&LockedQueueScheduler::Worker, this);
+        }
+    }
+    ~LockedQueueScheduler() noexcept {
+        m_is_running = false;
+        m_signal.notify_all();
+        for(auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void Run(std::function<void()> work) noexcept {
+        m_queue.push(new job_t{std::move(work)});
+        m_signal.notify_all();
+    }
+
+private:
+    struct job_t {
+        std::function<void()> work{};
+    };
+
+    void Worker() noexcept {
+        while(m_is_running) {
+            std::unique_lock<std::mutex> lock(m_cs);
+            m_signal.wait(lock, [this]() -> bool { return !m_is_running || !m_queue.empty(); });
+            job_t* job = nullptr;
+            while(m_queue.try_pop(job)) {
+                job->work();
+                delete job;
+            }
+        }
+    }
+
+    ThreadSafeQueue<job_t*> m_queue{};
+    std::condition_variable m_signal{};
+    std::mutex m_cs{};
+    std::vector<std::jthread> m_threads{};
+    std::atomic_bool m_is_running{true};
+};
+
+//A few dozen instructions: enough that a job is not free, small enough that scheduling overhead dominates.
+std::uint32_t SmallWork(std::uint32_t seed) noexcept {
+    for(int i = 0; i < 32; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+    }
+    return seed;
+}
+
+std::vector<std::size_t> GetThreadCounts() noexcept {
+    const auto hardware_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    auto counts = std::vector<std::size_t>{};
+    for(std::size_t count = 1u; count < hardware_threads; count *= 2u) {
+        counts.push_back(count);
+    }
+    counts.push_back(hardware_threads);
+    return counts;
+}
+
+//threadCount counts every thread running jobs. The work-stealing system gets threadCount - 1 workers
+//because the main thread helps while it waits; the locked queue's main thread only waits, so it gets all of them.
+std::unique_ptr<JobSystem> MakeJobSystem(std::size_t threadCount) noexcept {
+    const auto hardware_threads = static_cast<int>((std::max)(std::thread::hardware_concurrency(), 1u));
+    const auto generic_count = static_cast<int>(threadCount) - hardware_threads;
+    return std::make_unique<JobSystem>(generic_count, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>());
+}
+
+void WaitFor(JobSystem& js, const std::atomic<std::size_t>& done, std::size_t expected) noexcept {
+    while(done.load(std::memory_order_acquire) != expected) {
+        if(!js.TryRunPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void WaitFor(const std::atomic<std::size_t>& done, std::size_t expected) noexcept {
+    while(done.load(std::memory_order_acquire) != expected) {
+        std::this_thread::yield();
+    }
+}
+
+struct fork_context_t {
+    JobSystem* js{};
+    std::atomic<std::size_t>* done{};
+};
+
+void ForkWorkStealing(fork_context_t* context, unsigned int depth) noexcept {
+    if(depth == 0u) {
+        Benchmarks::DoNotOptimize(SmallWork(static_cast<std::uint32_t>(context->done->load(std::memory_order_relaxed))));
+        context->done->fetch_add(1u, std::memory_order_acq_rel);
+        return;
+    }
+    context->js->Run(JobType::Generic, [context, depth](void*) { ForkWorkStealing(context, depth - 1u); }, nullptr);
+    ForkWorkStealing(context, depth - 1u);
+}
+
+void ForkLockedQueue(LockedQueueScheduler* scheduler, std::atomic<std::size_t>* done, unsigned int depth) noexcept {
+    if(depth == 0u) {
+        Benchmarks::DoNotOptimize(SmallWork(static_cast<std::uint32_t>(done->load(std::memory_order_relaxed))));
+        done->fetch_add(1u, std::memory_order_acq_rel);
+        return;
+    }
+    scheduler->Run([scheduler, done, depth]() { ForkLockedQueue(scheduler, done, depth - 1u); });
+    ForkLockedQueue(scheduler, done, depth - 1u);
+}
+
+} // namespace
+
+//Every job is submitted by the main thread, the case the old design was built for.
+BENCHMARK_CASE("JobSystem: flat submission, jobs/sec") {
+    for(const auto thread_count : GetThreadCounts()) {
+        {
+            auto js = MakeJobSystem(thread_count);
+            const auto seconds = Benchmarks::TimeBest(repeat_count, [&js]() {
+                std::atomic<std::size_t> done{0u};
+                for(std::size_t i = 0u; i < flat_job_count; ++i) {
+                    js->Run(JobType::Generic, [&done, i](void*) {
+                        Benchmarks::DoNotOptimize(SmallWork(static_cast<std::uint32_t>(i)));
+                        done.fetch_add(1u, std::memory_order_acq_rel);
+                    }, nullptr);
+                }
+                WaitFor(*js, done, flat_job_count);
+            });
+            Benchmarks::Report(std::format("work-stealing, {} threads", thread_count), flat_job_count / seconds / 1.0e6, "Mjobs/s");
+        }
+        {
+            auto scheduler = LockedQueueScheduler{thread_count};
+            const auto seconds = Benchmarks::TimeBest(repeat_count, [&scheduler]() {
+                std::atomic<std::size_t> done{0u};
+                for(std::size_t i = 0u; i < flat_job_count; ++i) {
+                    scheduler.Run([&done, i]() {
+                        Benchmarks::DoNotOptimize(SmallWork(static_cast<std::uint32_t>(i)));
+                        done.fetch_add(1u, std::memory_order_acq_rel);
+                    });
+                }
+                WaitFor(done, flat_job_count);
+            });
+            Benchmarks::Report(std::format("locked queue,  {} threads", thread_count), flat_job_count / seconds / 1.0e6, "Mjobs/s");
+        }
+    }
+}
+
+//Jobs spawn jobs from worker threads, the fork-join shape ParallelFor and the task graph produce.
+BENCHMARK_CASE("JobSystem: recursive fork, jobs/sec") {
+    constexpr auto leaf_count = std::size_t{1u} << fork_depth;
+    for(const auto thread_count : GetThreadCounts()) {
+        {
+            auto js = MakeJobSystem(thread_count);
+            const auto seconds = Benchmarks::TimeBest(repeat_count, [&js]() {
+                std::atomic<std::size_t> done{0u};
+                auto context = fork_context_t{js.get(), &done};
+                js->Run(JobType::Generic, [&context](void*) { ForkWorkStealing(&context, fork_depth); }, nullptr);
+                WaitFor(*js, done, leaf_count);
+            });
+            Benchmarks::Report(std::format("work-stealing, {} threads", thread_count), leaf_count / seconds / 1.0e6, "Mjobs/s");
+        }
+        {
+            auto scheduler = LockedQueueScheduler{thread_count};
+            const auto seconds = Benchmarks::TimeBest(repeat_count, [&scheduler]() {
+                std::atomic<std::size_t> done{0u};
+                scheduler.Run([&scheduler, &done]() { ForkLockedQueue(&scheduler, &done, fork_depth); });
+                WaitFor(done, leaf_count);
+            });
+            Benchmarks::Report(std::format("locked queue,  {} threads", thread_count), leaf_count / seconds / 1.0e6, "Mjobs/s");
+        }
+    }
+}
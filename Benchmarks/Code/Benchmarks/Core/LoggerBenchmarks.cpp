@@ -0,0 +1,192 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/MpscQueue.hpp"
+#include "Engine/Core/ThreadSafeQueue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t message_count = 200'000u;
+constexpr std::size_t repeat_count = 3u;
+constexpr std::array<std::size_t, 4> producer_counts{1u, 2u, 4u, 8u};
+
+[[nodiscard]] std::filesystem::path GetLogPath() noexcept {
+    return std::filesystem::temp_directory_path() / "logger_benchmark.log";
+}
+
+//FileLogger before the MPSC queue: every Log takes the logger lock and the queue's own lock and notifies the worker,
+//which holds the logger lock while it pops and writes one message at a time.
+class MutexLogger {
+public:
+    MutexLogger() noexcept {
+        m_worker = std::jthread([this]() { Worker(); });
+    }
+    ~MutexLogger() noexcept {
+        {
+            std::scoped_lock<std::mutex> lock(m_cs);
+            m_is_running = false;
+        }
+        m_signal.notify_all();
+    }
+
+    void Log(const std::string& msg) noexcept {
+        {
+            std::scoped_lock<std::mutex> lock(m_cs);
+            m_queue.push(msg);
+        }
+        m_signal.notify_all();
+    }
+
+    [[nodiscard]] std::size_t GetWritten() const noexcept {
+        return m_written.load(std::memory_order_acquire);
+    }
+
+private:
+    void Worker() noexcept {
+        for(;;) {
+            std::unique_lock<std::mutex> lock(m_cs);
+            m_signal.wait(lock, [this]() { return !m_is_running || !m_queue.empty(); });
+            if(!m_is_running) {
+                break;
+            }
+            if(std::string str{}; m_queue.try_pop(str)) {
+                m_stream << str;
+                m_written.fetch_add(1u, std::memory_order_release);
+            }
+        }
+    }
+
+    std::mutex m_cs{};
+    std::condition_variable m_signal{};
+    ThreadSafeQueue<std::string> m_queue{};
+    std::ofstream m_stream{GetLogPath()};
+    std::atomic<std::size_t> m_written{0u};
+    bool m_is_running{true};
+    std::jthread m_worker{};
+};
+
+//FileLogger's queue and wake path as it is now. FileLogger itself writes into the game's log folder, rotates the logs
+//already there and redirects std::cout, which the harness reports through, so the benchmark runs the same loop on a temp file.
+class MpscLogger {
+public:
+    MpscLogger() noexcept {
+        m_worker = std::jthread([this]() { Worker(); });
+    }
+    ~MpscLogger() noexcept {
+        m_is_running = false;
+        ++m_wake_epoch;
+        m_wake_epoch.notify_all();
+    }
+
+    void Log(const std::string& msg) noexcept {
+        while(!m_queue.try_push(msg)) {
+            Wake();
+            std::this_thread::yield();
+        }
+        Wake();
+    }
+
+    [[nodiscard]] std::size_t GetWritten() const noexcept {
+        return m_written.load(std::memory_order_acquire);
+    }
+
+private:
+    void Wake() noexcept {
+        ++m_wake_epoch;
+        if(m_worker_sleeping.load() && m_worker_sleeping.exchange(false)) {
+            m_wake_epoch.notify_one();
+        }
+    }
+
+    void Worker() noexcept {
+        std::array<std::string, 64> batch{};
+        for(;;) {
+            const auto epoch = m_wake_epoch.load();
+            if(!m_is_running) {
+                break;
+            }
+            while(const auto count = m_queue.try_pop_n(batch)) {
+                for(std::size_t i = 0u; i < count; ++i) {
+                    m_stream << batch[i];
+                }
+                m_written.fetch_add(count, std::memory_order_release);
+            }
+            m_worker_sleeping = true;
+            m_wake_epoch.wait(epoch);
+            m_worker_sleeping = false;
+        }
+    }
+
+    MpscQueue<std::string> m_queue{4096u};
+    std::ofstream m_stream{GetLogPath()};
+    std::atomic<std::uint64_t> m_wake_epoch{0u};
+    std::atomic_bool m_worker_sleeping{false};
+    std::atomic_bool m_is_running{true};
+    std::atomic<std::size_t> m_written{0u};
+    std::jthread m_worker{};
+};
+
+//Formatted up front so the producers time the queue rather than std::format.
+[[nodiscard]] std::vector<std::string> MakeMessages() noexcept {
+    auto messages = std::vector<std::string>{};
+    messages.reserve(message_count);
+    for(std::size_t i = 0u; i < message_count; ++i) {
+        messages.push_back(std::format("[12:34:56.789][log] message {} from a producer thread\n", i));
+    }
+    return messages;
+}
+
+//Splits the messages across producerCount threads. Reports the wall time per message until every producer
+//has returned from Log, and the rate until the worker has written everything.
+template<typename Logger>
+void ReportProducers(std::string_view label, const std::vector<std::string>& messages, std::size_t producerCount) noexcept {
+    double producer_seconds = 0.0;
+    const auto drained_seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        Logger logger{};
+        const auto start = std::chrono::steady_clock::now();
+        {
+            auto producers = std::vector<std::jthread>{};
+            for(std::size_t p = 0u; p < producerCount; ++p) {
+                producers.emplace_back([&logger, &messages, p, producerCount]() {
+                    for(std::size_t i = p; i < message_count; i += producerCount) {
+                        logger.Log(messages[i]);
+                    }
+                });
+            }
+        }
+        const auto produced = std::chrono::steady_clock::now();
+        while(logger.GetWritten() != message_count) {
+            std::this_thread::yield();
+        }
+        const auto seconds = std::chrono::duration<double>(produced - start).count();
+        producer_seconds = producer_seconds == 0.0 ? seconds : (std::min)(producer_seconds, seconds);
+    });
+    Benchmarks::Report(std::format("{}, {} producers, logged", label, producerCount), producer_seconds / message_count * 1.0e9, "ns");
+    Benchmarks::Report(std::format("{}, {} producers, written", label, producerCount), message_count / drained_seconds * 1.0e-6, "Mmsgs/s");
+}
+
+} // namespace
+
+BENCHMARK_CASE("FileLogger: mutex queue vs MPSC queue, 200k messages from N producers") {
+    const auto messages = MakeMessages();
+    for(const auto producers : producer_counts) {
+        ReportProducers<MutexLogger>("mutex", messages, producers);
+        ReportProducers<MpscLogger>("mpsc ", messages, producers);
+    }
+    std::error_code ec{};
+    std::filesystem::remove(GetLogPath(), ec);
+}
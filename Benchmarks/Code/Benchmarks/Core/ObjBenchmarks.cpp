@@ -0,0 +1,142 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/Obj.hpp"
+
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace {
+
+//A 600x600 quad grid: 361k positions, 720k triangles, about 70 MB of text.
+constexpr std::size_t grid_size = 600u;
+constexpr std::size_t repeat_count = 3u;
+
+//Writes a grid with positions, texcoords and normals, and faces that index all three, as exporters do.
+class ObjFile {
+public:
+    ObjFile() noexcept {
+        std::error_code ec{};
+        std::filesystem::create_directories(m_path.parent_path(), ec);
+        std::string text{};
+        const auto row = grid_size + 1u;
+        for(std::size_t y = 0u; y < row; ++y) {
+            for(std::size_t x = 0u; x < row; ++x) {
+                const auto u = static_cast<float>(x) / grid_size;
+                const auto v = static_cast<float>(y) / grid_size;
+                text += std::format("v {:.6f} {:.6f} {:.6f}\nvt {:.6f} {:.6f}\nvn 0.000000 0.000000 1.000000\n", u * 100.0f, v * 100.0f, (u - v) * 0.5f, u, v);
+            }
+        }
+        const auto append_face = [&text](std::size_t a, std::size_t b, std::size_t c) {
+            text += std::format("f {}/{}/{} {}/{}/{} {}/{}/{}\n", a, a, a, b, b, b, c, c, c);
+        };
+        for(std::size_t y = 0u; y < grid_size; ++y) {
+            for(std::size_t x = 0u; x < grid_size; ++x) {
+                const auto a = y * row + x + 1u;
+                const auto b = a + 1u;
+                const auto c = a + row + 1u;
+                const auto d = a + row;
+                append_face(a, b, c);
+                append_face(a, c, d);
+            }
+        }
+        std::ofstream{m_path, std::ios::binary}.write(text.data(), static_cast<std::streamsize>(text.size()));
+        m_size = text.size();
+    }
+    ~ObjFile() noexcept {
+        std::error_code ec{};
+        std::filesystem::remove_all(m_path.parent_path(), ec);
+    }
+
+    [[nodiscard]] const std::filesystem::path& GetPath() const noexcept {
+        return m_path;
+    }
+
+    [[nodiscard]] std::size_t GetSize() const noexcept {
+        return m_size;
+    }
+
+private:
+    std::filesystem::path m_path{std::filesystem::temp_directory_path() / "obj_benchmark" / "grid.obj"};
+    std::size_t m_size{};
+};
+
+//Obj asks the service locator for the job system, so one must be provided even for the serial run.
+//The null service outlives every scope because the locator keeps pointing at it after a revoke.
+class ScopedJobSystemService {
+public:
+    explicit ScopedJobSystemService(bool withWorkers) noexcept {
+        if(withWorkers) {
+            m_jobs = std::make_unique<JobSystem>(-1, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>());
+            ServiceLocator::provide(*static_cast<IJobSystemService*>(m_jobs.get()), GetNullJobs());
+        } else {
+            ServiceLocator::provide(*static_cast<IJobSystemService*>(&GetNullJobs()), GetNullJobs());
+        }
+    }
+    ~ScopedJobSystemService() noexcept {
+        if(m_jobs) {
+            m_jobs->Shutdown();
+        }
+        ServiceLocator::revoke<IJobSystemService>();
+    }
+
+private:
+    [[nodiscard]] static NullJobSystemService& GetNullJobs() noexcept {
+        static NullJobSystemService null_jobs{};
+        return null_jobs;
+    }
+    std::unique_ptr<JobSystem> m_jobs{};
+};
+
+//Deletes the .mesh cache before every load so each one parses the text.
+void ReportParse(std::string_view label, const ObjFile& file) noexcept {
+    std::size_t triangles = 0u;
+    const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        std::error_code ec{};
+        std::filesystem::remove(FileUtils::Obj::GetCachePath(file.GetPath()), ec);
+        FileUtils::Obj obj{};
+        if(obj.Load(file.GetPath())) {
+            triangles = obj.GetIbo().size() / 3u;
+        }
+    });
+    Benchmarks::Report(std::format("{}, parse and write cache", label), seconds * 1.0e3, "ms");
+    Benchmarks::Report(std::format("{}, parse and write cache", label), static_cast<double>(file.GetSize()) / seconds / (1024.0 * 1024.0), "MB/s");
+    Benchmarks::Report(std::format("{}, triangles", label), static_cast<double>(triangles), "");
+}
+
+} // namespace
+
+BENCHMARK_CASE("Obj: parse a 70 MB OBJ and reload it from the .mesh cache") {
+    const ObjFile file{};
+    Benchmarks::Report("source size", static_cast<double>(file.GetSize()) / (1024.0 * 1024.0), "MB");
+    {
+        ScopedJobSystemService services{false};
+        ReportParse("serial", file);
+    }
+    {
+        //Files past the parallel threshold are split into chunks, one per thread.
+        ScopedJobSystemService services{true};
+        ReportParse(std::format("chunked over {} threads", (std::max)(std::thread::hardware_concurrency(), 1u)), file);
+    }
+    {
+        //The previous load left a fresh cache behind, so these loads never parse.
+        ScopedJobSystemService services{false};
+        const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+            FileUtils::Obj obj{};
+            Benchmarks::DoNotOptimize(obj.Load(file.GetPath()) ? obj.GetVbo().data() : nullptr);
+        });
+        Benchmarks::Report("cached", seconds * 1.0e3, "ms");
+        Benchmarks::Report("cached, source MB per second", static_cast<double>(file.GetSize()) / seconds / (1024.0 * 1024.0), "MB/s");
+    }
+}
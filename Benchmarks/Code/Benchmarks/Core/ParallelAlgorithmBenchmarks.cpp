@@ -0,0 +1,101 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count = std::size_t{1u} << 22u;
+constexpr std::size_t sort_count = std::size_t{1u} << 21u;
+constexpr std::size_t repeat_count = 5u;
+
+std::vector<std::size_t> GetThreadCounts() noexcept {
+    const auto hardware_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    auto counts = std::vector<std::size_t>{};
+    for(std::size_t count = 1u; count < hardware_threads; count *= 2u) {
+        counts.push_back(count);
+    }
+    counts.push_back(hardware_threads);
+    return counts;
+}
+
+//threadCount includes the calling thread, which works on the range alongside threadCount - 1 workers.
+std::unique_ptr<JobSystem> MakeJobSystem(std::size_t threadCount) noexcept {
+    const auto hardware_threads = static_cast<int>((std::max)(std::thread::hardware_concurrency(), 1u));
+    const auto generic_count = static_cast<int>(threadCount) - hardware_threads;
+    return std::make_unique<JobSystem>(generic_count, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>());
+}
+
+//Prints the time at each thread count and the speedup over the single-threaded run.
+template<typename RunFn>
+void ReportSpeedupCurve(RunFn&& run) noexcept {
+    auto single_thread_seconds = 0.0;
+    for(const auto thread_count : GetThreadCounts()) {
+        auto js = MakeJobSystem(thread_count);
+        const auto seconds = Benchmarks::TimeBest(repeat_count, [&js, &run]() { run(*js); });
+        if(thread_count == 1u) {
+            single_thread_seconds = seconds;
+        }
+        Benchmarks::Report(std::format("{} threads", thread_count), seconds * 1.0e3, "ms");
+        Benchmarks::Report(std::format("{} threads, speedup", thread_count), single_thread_seconds / seconds, "x");
+    }
+}
+
+} // namespace
+
+BENCHMARK_CASE("ParallelFor: speedup curve, 4M transcendental updates") {
+    auto values = std::vector<float>(element_count, 1.0f);
+    ReportSpeedupCurve([&values](JobSystem& js) {
+        js.ParallelFor(0u, values.size(), 0u, [&values](std::size_t first, std::size_t last) {
+            for(auto i = first; i < last; ++i) {
+                values[i] = std::sqrt(values[i] + std::sin(static_cast<float>(i)));
+            }
+        });
+        Benchmarks::DoNotOptimize(values.data());
+    });
+}
+
+BENCHMARK_CASE("ParallelReduce: speedup curve, 4M element sum") {
+    auto values = std::vector<std::uint32_t>(element_count);
+    std::iota(std::begin(values), std::end(values), 0u);
+    ReportSpeedupCurve([&values](JobSystem& js) {
+        const auto sum = js.ParallelReduce(0u, values.size(), 0u, std::uint64_t{0u}, [&values](std::size_t first, std::size_t last) {
+            auto partial = std::uint64_t{0u};
+            for(auto i = first; i < last; ++i) {
+                partial += values[i];
+            }
+            return partial;
+        }, std::plus<>{});
+        Benchmarks::DoNotOptimize(sum);
+    });
+}
+
+BENCHMARK_CASE("ParallelSort: speedup curve, 2M ints") {
+    auto source = std::vector<int>(sort_count);
+    std::mt19937 rng{42u};
+    std::generate(std::begin(source), std::end(source), [&rng]() { return static_cast<int>(rng()); });
+    auto values = source;
+    {
+        const auto seconds = Benchmarks::TimeBest(repeat_count, [&values, &source]() {
+            values = source;
+            std::sort(std::begin(values), std::end(values));
+        });
+        Benchmarks::Report("std::sort, for reference", seconds * 1.0e3, "ms");
+    }
+    ReportSpeedupCurve([&values, &source](JobSystem& js) {
+        values = source;
+        js.ParallelSort(std::begin(values), std::end(values));
+        Benchmarks::DoNotOptimize(values.data());
+    });
+}
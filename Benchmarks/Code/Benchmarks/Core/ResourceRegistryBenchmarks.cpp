@@ -0,0 +1,121 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/ResourceRegistry.hpp"
+#include "Engine/Core/StringId.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t texture_count = 10'000u;
+constexpr std::size_t repeat_count = 5u;
+
+struct texture_t {
+    std::size_t id{};
+};
+
+//Real files, because the old lookup asked the filesystem about every name it was given.
+class TextureFiles {
+public:
+    TextureFiles() noexcept {
+        std::error_code ec{};
+        std::filesystem::create_directories(m_root, ec);
+        m_paths.reserve(texture_count);
+        for(std::size_t i = 0u; i < texture_count; ++i) {
+            auto path = m_root / std::format("texture_{:05}.png", i);
+            std::ofstream{path};
+            path.make_preferred();
+            m_paths.push_back(path.string());
+        }
+    }
+    ~TextureFiles() noexcept {
+        std::error_code ec{};
+        std::filesystem::remove_all(m_root, ec);
+    }
+
+    [[nodiscard]] const std::vector<std::string>& GetPaths() const noexcept {
+        return m_paths;
+    }
+
+private:
+    std::filesystem::path m_root{std::filesystem::temp_directory_path() / "resource_registry_benchmark"};
+    std::vector<std::string> m_paths{};
+};
+
+using old_registry_t = std::vector<std::pair<std::string, std::unique_ptr<texture_t>>>;
+
+//Renderer::GetTexture as it was: exists and canonical on the argument, then a linear scan with string compares.
+[[nodiscard]] texture_t* FindOld(const old_registry_t& textures, const std::string& nameOrFile) noexcept {
+    namespace FS = std::filesystem;
+    FS::path p{nameOrFile};
+    std::error_code ec{};
+    if(FS::exists(p, ec)) {
+        p = FS::canonical(p, ec);
+    }
+    p.make_preferred();
+    const auto key = p.string();
+    const auto found = std::find_if(std::begin(textures), std::end(textures), [&key](const auto& entry) { return entry.first == key; });
+    return found != std::end(textures) ? found->second.get() : nullptr;
+}
+
+//Renderer::FindByNormalizedName: a hit costs one hash of the name, a miss normalizes lexically and tries again.
+[[nodiscard]] texture_t* FindNormalized(const ResourceRegistry<texture_t>& textures, const std::string& nameOrFile) noexcept {
+    if(auto* found = textures.Find(StringId{nameOrFile}); found != nullptr) {
+        return found;
+    }
+    auto p = std::filesystem::path{nameOrFile}.lexically_normal();
+    p.make_preferred();
+    return textures.Find(StringId{p.string()});
+}
+
+template<typename FindFn>
+void ReportLookups(std::string_view label, std::size_t lookup_count, FindFn&& find) noexcept {
+    std::size_t found = 0u;
+    const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        found = 0u;
+        for(std::size_t i = 0u; i < lookup_count; ++i) {
+            found += find(i) != nullptr ? 1u : 0u;
+        }
+    });
+    Benchmarks::DoNotOptimize(found);
+    Benchmarks::Report(std::format("{}, total", label), seconds * 1.0e3, "ms");
+    Benchmarks::Report(std::format("{}, per lookup", label), seconds / static_cast<double>(lookup_count) * 1.0e9, "ns");
+    Benchmarks::Report(std::format("{}, found", label), static_cast<double>(found), "textures");
+}
+
+} // namespace
+
+BENCHMARK_CASE("Resource registry: 10k texture lookups by name vs the old linear path") {
+    const TextureFiles files{};
+    const auto& paths = files.GetPaths();
+
+    old_registry_t old_textures{};
+    ResourceRegistry<texture_t> textures{};
+    auto ids = std::vector<StringId>{};
+    for(std::size_t i = 0u; i < paths.size(); ++i) {
+        std::error_code ec{};
+        old_textures.emplace_back(std::filesystem::canonical(paths[i], ec).make_preferred().string(), std::make_unique<texture_t>(texture_t{i}));
+        textures.Register(paths[i], std::make_unique<texture_t>(texture_t{i}));
+        ids.push_back(StringId{paths[i]});
+    }
+    //A different spelling of each path, which misses the first probe and is normalized.
+    auto respelled = std::vector<std::string>{};
+    for(const auto& path : paths) {
+        const auto p = std::filesystem::path{path};
+        respelled.push_back((p.parent_path() / "." / p.filename()).string());
+    }
+
+    ReportLookups("old: exists, canonical and linear scan", paths.size(), [&](std::size_t i) { return FindOld(old_textures, paths[i]); });
+    ReportLookups("registry, by name", paths.size(), [&](std::size_t i) { return FindNormalized(textures, paths[i]); });
+    ReportLookups("registry, by precomputed StringId", ids.size(), [&](std::size_t i) { return textures.Find(ids[i]); });
+    ReportLookups("registry, by unnormalized name", respelled.size(), [&](std::size_t i) { return FindNormalized(textures, respelled[i]); });
+}
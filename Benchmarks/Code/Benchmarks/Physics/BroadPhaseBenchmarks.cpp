@@ -0,0 +1,126 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Physics/DynamicAABBTree.hpp"
+
+#include <cstdint>
+#include <format>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr float world_size = 4096.0f;
+constexpr float body_half_extent = 4.0f;
+constexpr float max_speed = 2.0f;
+constexpr std::size_t step_count = 60u;
+constexpr std::size_t repeat_count = 3u;
+
+struct body_t {
+    Vector2 position{};
+    Vector2 velocity{};
+    int proxy{DynamicAABBTree<body_t>::null_node};
+};
+
+[[nodiscard]] AABB2 GetBounds(const body_t& body) noexcept {
+    return AABB2{body.position - Vector2{body_half_extent, body_half_extent}, body.position + Vector2{body_half_extent, body_half_extent}};
+}
+
+[[nodiscard]] std::vector<body_t> MakeBodies(std::size_t count) noexcept {
+    std::mt19937 rng{7u};
+    std::uniform_real_distribution<float> position{0.0f, world_size};
+    std::uniform_real_distribution<float> speed{-max_speed, max_speed};
+    auto bodies = std::vector<body_t>(count);
+    for(auto& body : bodies) {
+        body.position = Vector2{position(rng), position(rng)};
+        body.velocity = Vector2{speed(rng), speed(rng)};
+    }
+    return bodies;
+}
+
+//Moves every body one step and bounces it off the world edges.
+void Step(std::vector<body_t>& bodies) noexcept {
+    for(auto& body : bodies) {
+        body.position += body.velocity;
+        if(body.position.x < 0.0f || world_size < body.position.x) {
+            body.velocity.x = -body.velocity.x;
+        }
+        if(body.position.y < 0.0f || world_size < body.position.y) {
+            body.velocity.y = -body.velocity.y;
+        }
+    }
+}
+
+//The broad phase as it was before the tree: every body against every other body, every step.
+[[nodiscard]] std::size_t CountPairsAllPairs(const std::vector<body_t>& bodies) noexcept {
+    std::size_t pairs = 0u;
+    for(std::size_t i = 0u; i < bodies.size(); ++i) {
+        const auto bounds_i = GetBounds(bodies[i]);
+        for(std::size_t j = i + 1u; j < bodies.size(); ++j) {
+            if(MathUtils::DoAABBsOverlap(bounds_i, GetBounds(bodies[j]))) {
+                ++pairs;
+            }
+        }
+    }
+    return pairs;
+}
+
+//Moves the proxies and queries only those that were reinserted, as PhysicsSystem's broad phase does.
+[[nodiscard]] std::size_t UpdateTree(DynamicAABBTree<body_t>& tree, std::vector<body_t>& bodies, std::size_t& reinserted) noexcept {
+    std::size_t candidates = 0u;
+    for(auto& body : bodies) {
+        if(!tree.MoveProxy(body.proxy, GetBounds(body), body.velocity)) {
+            continue;
+        }
+        ++reinserted;
+        tree.Query(tree.GetFatBounds(body.proxy), [&candidates, &body](int proxy) {
+            if(proxy != body.proxy) {
+                ++candidates;
+            }
+            return true;
+        });
+    }
+    return candidates;
+}
+
+} // namespace
+
+BENCHMARK_CASE("Broad phase: dynamic AABB tree churn vs all pairs") {
+    for(const auto body_count : {std::size_t{1'000u}, std::size_t{4'000u}, std::size_t{16'000u}}) {
+        {
+            auto bodies = MakeBodies(body_count);
+            DynamicAABBTree<body_t> tree{};
+            for(auto& body : bodies) {
+                body.proxy = tree.CreateProxy(GetBounds(body), &body);
+            }
+            std::size_t reinserted = 0u;
+            std::size_t candidates = 0u;
+            const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+                reinserted = 0u;
+                for(std::size_t step = 0u; step < step_count; ++step) {
+                    Step(bodies);
+                    candidates += UpdateTree(tree, bodies, reinserted);
+                }
+            });
+            Benchmarks::DoNotOptimize(candidates);
+            Benchmarks::Report(std::format("tree, {} bodies, per step", body_count), seconds / step_count * 1.0e6, "us");
+            Benchmarks::Report(std::format("tree, {} bodies, reinserted per step", body_count), static_cast<double>(reinserted) / step_count, "proxies");
+        }
+        {
+            std::size_t pairs = 0u;
+            //All pairs is quadratic; a handful of steps is enough to time it.
+            constexpr std::size_t all_pairs_steps = 2u;
+            const auto seconds = Benchmarks::TimeBest(1u, [&]() {
+                auto bodies = MakeBodies(body_count);
+                for(std::size_t step = 0u; step < all_pairs_steps; ++step) {
+                    Step(bodies);
+                    pairs += CountPairsAllPairs(bodies);
+                }
+            });
+            Benchmarks::DoNotOptimize(pairs);
+            Benchmarks::Report(std::format("all pairs, {} bodies, per step", body_count), seconds / all_pairs_steps * 1.0e6, "us");
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Physics/Collider.hpp"
+#include "Engine/Physics/NarrowPhase.hpp"
+#include "Engine/Physics/PhysicsTypes.hpp"
+#include "Engine/Physics/PhysicsUtils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t pair_count = 4096u;
+constexpr std::size_t repeat_count = 5u;
+constexpr std::size_t pass_count = 16u;
+
+using collider_pair_t = std::pair<std::unique_ptr<Collider>, std::unique_ptr<Collider>>;
+
+//Pairs whose centers sit within two half extents of each other, so roughly half of them touch,
+//as the pairs that survive the broad phase's fat bounds do.
+template<typename MakeFn>
+[[nodiscard]] std::vector<collider_pair_t> MakePairs(MakeFn&& make) noexcept {
+    std::mt19937 rng{99u};
+    std::uniform_real_distribution<float> position{-100.0f, 100.0f};
+    std::uniform_real_distribution<float> offset{-2.0f, 2.0f};
+    std::uniform_real_distribution<float> angle{0.0f, 360.0f};
+    auto pairs = std::vector<collider_pair_t>{};
+    pairs.reserve(pair_count);
+    for(std::size_t i = 0u; i < pair_count; ++i) {
+        const auto center = Vector2{position(rng), position(rng)};
+        pairs.emplace_back(make(center, angle(rng)), make(center + Vector2{offset(rng), offset(rng)}, angle(rng)));
+    }
+    return pairs;
+}
+
+//The path every pair took before the batches: GJK, then EPA on a hit.
+[[nodiscard]] std::size_t CollideWithGJK(const std::vector<collider_pair_t>& pairs) noexcept {
+    std::size_t hits = 0u;
+    for(const auto& [a, b] : pairs) {
+        if(const auto gjk = PhysicsUtils::GJK(*a, *b); gjk.collides) {
+            const auto epa = PhysicsUtils::EPA(gjk, *a, *b);
+            hits += epa.distance > 0.0f ? 1u : 0u;
+        }
+    }
+    return hits;
+}
+
+[[nodiscard]] std::size_t CountHits(const NarrowPhase::ContactResults& results) noexcept {
+    std::size_t hits = 0u;
+    for(const auto collides : results.collides) {
+        hits += collides;
+    }
+    return hits;
+}
+
+//Gathering a batch from the colliders is part of the cost, so it is timed along with the kernel.
+template<typename FillFn, typename CollideFn>
+void ReportBatchAgainstGJK(const std::vector<collider_pair_t>& pairs, FillFn&& fill, CollideFn&& collide) noexcept {
+    NarrowPhase::ContactResults results{};
+    std::size_t batch_hits = 0u;
+    const auto batch_seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        for(std::size_t pass = 0u; pass < pass_count; ++pass) {
+            fill(pairs);
+            collide(results);
+            batch_hits = CountHits(results);
+        }
+    });
+    std::size_t gjk_hits = 0u;
+    const auto gjk_seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        for(std::size_t pass = 0u; pass < pass_count; ++pass) {
+            gjk_hits = CollideWithGJK(pairs);
+        }
+    });
+    const auto pairs_tested = static_cast<double>(pairs.size() * pass_count);
+    Benchmarks::Report("batch, gather and collide", pairs_tested / batch_seconds * 1.0e-6, "Mpairs/s");
+    Benchmarks::Report("GJK and EPA per pair", pairs_tested / gjk_seconds * 1.0e-6, "Mpairs/s");
+    Benchmarks::Report("speedup", gjk_seconds / batch_seconds, "x");
+    Benchmarks::Report("contacts found, batch / GJK", static_cast<double>(batch_hits) / static_cast<double>((std::max)(gjk_hits, std::size_t{1u})), "ratio");
+}
+
+} // namespace
+
+BENCHMARK_CASE("Narrow phase: circle batch vs GJK, 4096 pairs") {
+    const auto pairs = MakePairs([](const Vector2& center, float) -> std::unique_ptr<Collider> { return std::make_unique<ColliderCircle>(Position{center}, 1.0f); });
+    NarrowPhase::CircleBatch batch{};
+    ReportBatchAgainstGJK(
+    pairs, [&batch](const std::vector<collider_pair_t>& pairs) {
+        batch.Clear();
+        for(const auto& [a, b] : pairs) {
+            batch.Add(a->CalcCenter(), a->GetHalfExtents().x, b->CalcCenter(), b->GetHalfExtents().x);
+        }
+    },
+    [&batch](NarrowPhase::ContactResults& results) { NarrowPhase::CollideCircles(batch, results); });
+}
+
+//GJK finds fewer AABB contacts than the batch: ColliderAABB's support polygon is its box turned 45 degrees,
+//which sits inside the half extents the batch (and PhysicsSystem) tests.
+BENCHMARK_CASE("Narrow phase: AABB batch vs GJK, 4096 pairs") {
+    const auto pairs = MakePairs([](const Vector2& center, float) -> std::unique_ptr<Collider> { return std::make_unique<ColliderAABB>(center, Vector2{1.0f, 0.5f}); });
+    NarrowPhase::AABBBatch batch{};
+    ReportBatchAgainstGJK(
+    pairs, [&batch](const std::vector<collider_pair_t>& pairs) {
+        batch.Clear();
+        for(const auto& [a, b] : pairs) {
+            batch.Add(a->CalcCenter(), a->GetHalfExtents(), b->CalcCenter(), b->GetHalfExtents());
+        }
+    },
+    [&batch](NarrowPhase::ContactResults& results) { NarrowPhase::CollideAABBs(batch, results); });
+}
+
+BENCHMARK_CASE("Narrow phase: OBB batch vs GJK, 4096 pairs") {
+    const auto pairs = MakePairs([](const Vector2& center, float degrees) -> std::unique_ptr<Collider> {
+        auto obb = std::make_unique<ColliderOBB>(center, Vector2{1.0f, 0.5f});
+        obb->SetOrientationDegrees(degrees);
+        return obb;
+    });
+    NarrowPhase::OBBBatch batch{};
+    ReportBatchAgainstGJK(
+    pairs, [&batch](const std::vector<collider_pair_t>& pairs) {
+        batch.Clear();
+        for(const auto& [a, b] : pairs) {
+            const auto bounds_a = a->GetBounds();
+            const auto bounds_b = b->GetBounds();
+            batch.Add(a->CalcCenter(), a->GetHalfExtents(), bounds_a.GetRight(), bounds_a.GetUp(), b->CalcCenter(), b->GetHalfExtents(), bounds_b.GetRight(), bounds_b.GetUp());
+        }
+    },
+    [&batch](NarrowPhase::ContactResults& results) { NarrowPhase::CollideOBBs(batch, results); });
+}
@@ -0,0 +1,154 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector4.hpp"
+#include "Engine/Physics/Particles/ParticlePool.hpp"
+#include "Engine/Renderer/Vertex3DInstanced.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t particle_count = 1'000'000u;
+constexpr std::size_t frame_count = 10u;
+constexpr std::size_t repeat_count = 3u;
+constexpr float frame_seconds = 1.0f / 60.0f;
+//Long enough that nothing dies while timing, so every frame touches every particle.
+constexpr float lifetime_seconds = 1.0e6f;
+
+[[nodiscard]] ParticleAppearance MakeAppearance() noexcept {
+    auto appearance = ParticleAppearance{};
+    appearance.start_color = Vector4{1.0f, 0.5f, 0.25f, 1.0f};
+    appearance.end_color = Vector4{0.0f, 0.0f, 0.0f, 0.0f};
+    appearance.start_scale = Vector3::One;
+    appearance.end_scale = Vector3{0.1f, 0.1f, 0.1f};
+    return appearance;
+}
+
+[[nodiscard]] Vector3 RandomVector(std::mt19937& rng) noexcept {
+    std::uniform_real_distribution<float> d{-10.0f, 10.0f};
+    return Vector3{d(rng), d(rng), d(rng)};
+}
+
+void FillPool(ParticlePool& pool) noexcept {
+    std::mt19937 rng{3u};
+    pool.Reserve(particle_count);
+    for(std::size_t i = 0u; i < particle_count; ++i) {
+        pool.Spawn(RandomVector(rng), RandomVector(rng), lifetime_seconds);
+    }
+}
+
+//The layout and per-frame work of the emitter before the pool: every particle carries its own
+//render state, integrates through a std::function and the whole array is sorted by alpha each frame.
+struct aos_particle_t {
+    Vector3 position{};
+    Vector3 velocity{};
+    float age{};
+    float lifetime{};
+    Vector4 start_color{};
+    Vector4 end_color{};
+    Vector4 color{};
+    Vector3 start_scale{};
+    Vector3 end_scale{};
+    Vector3 scale{};
+    void* material{};
+};
+
+[[nodiscard]] std::vector<aos_particle_t> MakeAoSParticles() noexcept {
+    std::mt19937 rng{3u};
+    const auto appearance = MakeAppearance();
+    auto particles = std::vector<aos_particle_t>(particle_count);
+    for(auto& p : particles) {
+        p.position = RandomVector(rng);
+        p.velocity = RandomVector(rng);
+        p.age = lifetime_seconds;
+        p.lifetime = lifetime_seconds;
+        p.start_color = appearance.start_color;
+        p.end_color = appearance.end_color;
+        p.start_scale = appearance.start_scale;
+        p.end_scale = appearance.end_scale;
+    }
+    return particles;
+}
+
+void UpdateAoS(std::vector<aos_particle_t>& particles, const std::function<void(aos_particle_t&, float)>& integrate) noexcept {
+    for(auto& p : particles) {
+        integrate(p, frame_seconds);
+        const auto t = 1.0f - p.age / p.lifetime;
+        p.color = p.start_color + (p.end_color - p.start_color) * t;
+        p.scale = p.start_scale + (p.end_scale - p.start_scale) * t;
+    }
+    std::sort(std::begin(particles), std::end(particles), [](const aos_particle_t& a, const aos_particle_t& b) { return a.color.w < b.color.w; });
+}
+
+[[nodiscard]] std::unique_ptr<JobSystem> MakeJobSystem() noexcept {
+    return std::make_unique<JobSystem>(-1, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>());
+}
+
+void ReportFrame(std::string_view label, double seconds) noexcept {
+    const auto per_frame = seconds / frame_count;
+    Benchmarks::Report(std::format("{}, per frame", label), per_frame * 1.0e3, "ms");
+    Benchmarks::Report(std::format("{}, throughput", label), static_cast<double>(particle_count) / per_frame * 1.0e-6, "Mparticles/s");
+}
+
+} // namespace
+
+BENCHMARK_CASE("Particles: SoA kernel vs per-particle structs, 1M particles") {
+    const auto appearance = MakeAppearance();
+    {
+        ParticlePool pool{};
+        FillPool(pool);
+        auto instances = std::vector<Vertex3DInstanced>(pool.size());
+        const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+            for(std::size_t frame = 0u; frame < frame_count; ++frame) {
+                pool.Update(0u, pool.size(), frame_seconds, appearance, instances);
+                pool.RemoveDead(instances);
+            }
+        });
+        Benchmarks::DoNotOptimize(instances.data());
+        ReportFrame("SoA kernel, 1 thread", seconds);
+    }
+    {
+        //The grain ParticleEmitter::UpdateParticles uses.
+        constexpr std::size_t grain = 4096u;
+        auto js = MakeJobSystem();
+        ParticlePool pool{};
+        FillPool(pool);
+        auto instances = std::vector<Vertex3DInstanced>(pool.size());
+        const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+            for(std::size_t frame = 0u; frame < frame_count; ++frame) {
+                js->ParallelFor(0u, pool.size(), grain, [&](std::size_t first, std::size_t last) {
+                    pool.Update(first, last, frame_seconds, appearance, instances);
+                });
+                pool.RemoveDead(instances);
+            }
+        });
+        Benchmarks::DoNotOptimize(instances.data());
+        ReportFrame(std::format("SoA kernel, ParallelFor on {} threads", (std::max)(std::thread::hardware_concurrency(), 1u)), seconds);
+        js->Shutdown();
+    }
+    {
+        auto particles = MakeAoSParticles();
+        const auto integrate = std::function<void(aos_particle_t&, float)>{[](aos_particle_t& p, float deltaSeconds) {
+            p.position += p.velocity * deltaSeconds;
+            p.age -= deltaSeconds;
+        }};
+        const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+            for(std::size_t frame = 0u; frame < frame_count; ++frame) {
+                UpdateAoS(particles, integrate);
+            }
+        });
+        Benchmarks::DoNotOptimize(particles.data());
+        ReportFrame("per-particle structs, sorted by alpha", seconds);
+    }
+}
@@ -0,0 +1,171 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/ThreadUtils.hpp"
+#include "Engine/Profiling/Instrumentor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//Half a thread's ring, so a burst never drops while the flusher is still on its 50 ms wait.
+constexpr std::size_t burst_size = 4096u;
+constexpr std::size_t burst_count = 20u;
+constexpr std::size_t idle_scope_count = 1'000'000u;
+constexpr std::array<std::size_t, 2> thread_counts{1u, 4u};
+
+[[nodiscard]] std::filesystem::path GetTracePath() noexcept {
+    return std::filesystem::temp_directory_path() / "instrumentor_benchmark.json";
+}
+
+//Instrumentor before the per-thread rings: every scope reads steady_clock twice, streams its thread id into
+//a string to parse it back, takes the session lock and formats its JSON event on the calling thread.
+class LockedInstrumentor {
+public:
+    LockedInstrumentor() noexcept {
+        m_stream << "{\"otherData\": {},\"traceEvents\":[";
+    }
+    ~LockedInstrumentor() noexcept {
+        m_stream << "]}";
+    }
+
+    void WriteProfile(const char* name, long long start, long long end, std::thread::id threadId) noexcept {
+        std::scoped_lock lock(m_cs);
+        if(m_count++ > 0) {
+            m_stream << ",";
+        }
+        auto str = std::string{name};
+        const auto tid = [threadId]() -> unsigned int { std::ostringstream ss; ss << threadId; return static_cast<unsigned int>(std::stoull(ss.str())); }();
+        std::replace(std::begin(str), std::end(str), '"', '\'');
+        constexpr auto fmt = R"({{"cat":"function","dur":{},"name":"{:s}","ph":"X","pid": {},"tid":{},"ts":{}}})";
+        const auto duration = end - start;
+        const auto pid = ThreadUtils::GetProcessId();
+        m_stream << std::vformat(fmt, std::make_format_args(duration, str, pid, tid, start));
+    }
+
+private:
+    std::mutex m_cs{};
+    std::ofstream m_stream{GetTracePath()};
+    int m_count{0};
+};
+
+class LockedTimer {
+public:
+    LockedTimer(LockedInstrumentor& instrumentor, const char* name) noexcept
+    : m_instrumentor(instrumentor)
+    , m_name(name)
+    , m_start(std::chrono::steady_clock::now())
+    {
+        /* DO NOTHING */
+    }
+    ~LockedTimer() noexcept {
+        const auto end = std::chrono::steady_clock::now();
+        const auto start_us = std::chrono::time_point_cast<std::chrono::microseconds>(m_start).time_since_epoch().count();
+        const auto end_us = std::chrono::time_point_cast<std::chrono::microseconds>(end).time_since_epoch().count();
+        m_instrumentor.WriteProfile(m_name, start_us, end_us, std::this_thread::get_id());
+    }
+
+private:
+    LockedInstrumentor& m_instrumentor;
+    const char* m_name;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+//Times only the scopes. Each thread records a burst, then sleeps past a flush interval so the flusher empties its ring.
+template<typename ScopeFn>
+[[nodiscard]] double TimeScopeBursts(std::size_t threadCount, ScopeFn&& scope) noexcept {
+    auto nanoseconds = std::atomic<std::uint64_t>{0u};
+    {
+        auto threads = std::vector<std::jthread>{};
+        for(std::size_t t = 0u; t < threadCount; ++t) {
+            threads.emplace_back([&]() {
+                for(std::size_t burst = 0u; burst < burst_count; ++burst) {
+                    const auto start = std::chrono::steady_clock::now();
+                    for(std::size_t i = 0u; i < burst_size; ++i) {
+                        scope(i);
+                    }
+                    const auto elapsed = std::chrono::steady_clock::now() - start;
+                    nanoseconds.fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+                    std::this_thread::sleep_for(std::chrono::milliseconds{60});
+                }
+            });
+        }
+    }
+    return static_cast<double>(nanoseconds.load()) / static_cast<double>(threadCount * burst_size * burst_count);
+}
+
+} // namespace
+
+BENCHMARK_CASE("Instrumentor: self-overhead per profiled scope") {
+    {
+        //No session: the timer loads the active instrumentor, finds none and never reads the counter.
+        const auto seconds = Benchmarks::TimeBest(3u, []() {
+            for(std::size_t i = 0u; i < idle_scope_count; ++i) {
+                InstrumentationTimer timer{"idle scope"};
+                Benchmarks::DoNotOptimize(i);
+            }
+        });
+        Benchmarks::Report("no session", seconds / idle_scope_count * 1.0e9, "ns/scope");
+    }
+    {
+        //Every recorded scope reads the counter twice, so two reads are the floor under the per-scope cost.
+        const auto seconds = Benchmarks::TimeBest(3u, []() {
+            for(std::size_t i = 0u; i < idle_scope_count; ++i) {
+                Benchmarks::DoNotOptimize(Instrumentor::ReadTicks());
+            }
+        });
+        Benchmarks::Report("Instrumentor::ReadTicks alone", seconds / idle_scope_count * 1.0e9, "ns/call");
+    }
+    {
+        const auto seconds = Benchmarks::TimeBest(3u, []() {
+            for(std::size_t i = 0u; i < idle_scope_count; ++i) {
+                Benchmarks::DoNotOptimize(static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+            }
+        });
+        Benchmarks::Report("steady_clock::now alone", seconds / idle_scope_count * 1.0e9, "ns/call");
+    }
+    //The same loop with the two counter reads and nothing recorded; what the rings add is the difference.
+    Instrumentor::Get().BeginSession("benchmark", GetTracePath());
+    const auto reads_ns = TimeScopeBursts(1u, [](std::size_t i) {
+        const auto start = Instrumentor::ReadTicks();
+        Benchmarks::DoNotOptimize(i);
+        Benchmarks::DoNotOptimize(Instrumentor::ReadTicks() - start);
+    });
+    Instrumentor::Get().EndSession();
+    Benchmarks::Report("counter reads only, 1 threads", reads_ns, "ns/scope");
+    for(const auto threads : thread_counts) {
+        Instrumentor::Get().BeginSession("benchmark", GetTracePath());
+        const auto ns = TimeScopeBursts(threads, [](std::size_t i) {
+            InstrumentationTimer timer{"recorded scope"};
+            Benchmarks::DoNotOptimize(i);
+        });
+        Instrumentor::Get().EndSession();
+        Benchmarks::Report(std::format("per-thread rings, {} threads", threads), ns, "ns/scope");
+        Benchmarks::Report(std::format("per-thread rings, {} threads, over the counter reads", threads), ns - reads_ns, "ns/scope");
+    }
+    for(const auto threads : thread_counts) {
+        auto ns = 0.0;
+        {
+            LockedInstrumentor instrumentor{};
+            ns = TimeScopeBursts(threads, [&instrumentor](std::size_t i) {
+                LockedTimer timer{instrumentor, "recorded scope"};
+                Benchmarks::DoNotOptimize(i);
+            });
+        }
+        Benchmarks::Report(std::format("old: locked vformat, {} threads", threads), ns, "ns/scope");
+    }
+    std::error_code ec{};
+    std::filesystem::remove(GetTracePath(), ec);
+}
@@ -0,0 +1,214 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Core/IFont.hpp"
+#include "Engine/Core/KerningFont.hpp"
+#include "Engine/Core/KerningTable.hpp"
+#include "Engine/Core/Rgba.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Renderer/TextLayoutCache.hpp"
+#include "Engine/Renderer/Vertex3D.hpp"
+
+#include <cstdint>
+#include <format>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+//A full console: 300 lines of 80 printable characters, redrawn every frame.
+constexpr std::size_t line_count = 300u;
+constexpr std::size_t line_length = 80u;
+constexpr std::size_t frame_count = 20u;
+constexpr std::size_t repeat_count = 5u;
+constexpr std::size_t glyphs_per_frame = line_count * line_length;
+
+using CharDef = KerningFont::CharDef;
+
+//Metrics of a 32px font with a 512x512 page; the values only have to vary per glyph.
+[[nodiscard]] CharDef MakeCharDef(int id) noexcept {
+    auto def = CharDef{};
+    def.id = id;
+    def.position = IntVector2{(id % 16) * 32, (id / 16) * 32};
+    def.dimensions = IntVector2{10 + id % 14, 18 + id % 9};
+    def.offsets = IntVector2{id % 3, 4 + id % 5};
+    def.xadvance = 12 + id % 11;
+    return def;
+}
+
+//About 1800 pairs over the printable range, as a kerned text face ships with.
+[[nodiscard]] std::vector<KerningTable::Pair> MakeKerningPairs() noexcept {
+    auto pairs = std::vector<KerningTable::Pair>{};
+    for(int first = 32; first < 127; ++first) {
+        for(int second = 32; second < 127; ++second) {
+            if((first * 31 + second * 17) % 5 == 0) {
+                pairs.push_back(KerningTable::Pair{first, second, -(first + second) % 4});
+            }
+        }
+    }
+    return pairs;
+}
+
+//Answers the IFont glyph queries through the given lookups, so the same shaping loops run against
+//the tree-based tables KerningFont used to search per query and against the flat ones it builds now.
+template<typename Lookup>
+class BenchmarkFont : public a2de::IFont {
+public:
+    float CalculateTextWidth(const std::string& /*text*/, float /*scale*/) const noexcept override { return 0.0f; }
+    float CalculateTextHeight(float /*scale*/) const noexcept override { return 32.0f; }
+    Vector2 CalculateTextDimensions(const std::string& /*text*/, float /*scale*/) const noexcept override { return Vector2::Zero; }
+    AABB2 CalculateTextArea(const std::string& /*text*/, float /*scale*/) const noexcept override { return AABB2{}; }
+    float GetLineHeight() const noexcept override { return 32.0f; }
+    float GetLineHeightAsUV() const noexcept override { return 32.0f / 512.0f; }
+    bool LoadFromFile(std::filesystem::path /*filepath*/) noexcept override { return true; }
+    bool LoadFromBuffer(std::span<const uint8_t> /*buffer*/) noexcept override { return true; }
+    Material* GetMaterial() const noexcept override { return nullptr; }
+    void SetMaterial(Material* /*mat*/) noexcept override { /* DO NOTHING */ }
+    const std::string& GetName() const noexcept override { return m_name; }
+    const std::filesystem::path& GetFilePath() const noexcept override { return m_path; }
+    int GetEmSize() const noexcept override { return 32; }
+    bool IsLoaded() const noexcept override { return true; }
+
+    int GetKerningValue(unsigned long first, unsigned long second) const noexcept override {
+        return m_lookup.Kerning(static_cast<int>(first), static_cast<int>(second));
+    }
+    AABB2 GetGlyphUVs(int c) const noexcept override {
+        const auto& def = m_lookup.Char(c);
+        const auto left = def.position.x / 512.0f;
+        const auto top = def.position.y / 512.0f;
+        return AABB2{left, top, left + def.dimensions.x / 512.0f, top + def.dimensions.y / 512.0f};
+    }
+    Vector2 GetGlyphOffsets(int c) const noexcept override { return Vector2(m_lookup.Char(c).offsets); }
+    Vector2 GetGlyphDimensions(int c) const noexcept override { return Vector2(m_lookup.Char(c).dimensions); }
+    int GetGlyphAdvance(int c) const noexcept override { return m_lookup.Char(c).xadvance; }
+
+private:
+    Lookup m_lookup{};
+    std::string m_name{"benchmark"};
+    std::filesystem::path m_path{};
+};
+
+//KerningFont before the flat tables: every glyph query searched a std::map, falling back to char -1.
+struct MapLookup {
+    MapLookup() noexcept {
+        chars.emplace(-1, MakeCharDef(0));
+        for(int id = 32; id < 127; ++id) {
+            chars.emplace(id, MakeCharDef(id));
+        }
+        for(const auto& pair : MakeKerningPairs()) {
+            kerning.emplace(std::make_pair(pair.first, pair.second), pair.amount);
+        }
+    }
+    [[nodiscard]] const CharDef& Char(int c) const noexcept {
+        if(const auto found = chars.find(c); found != std::end(chars)) {
+            return found->second;
+        }
+        return chars.find(-1)->second;
+    }
+    [[nodiscard]] int Kerning(int first, int second) const noexcept {
+        const auto found = kerning.find(std::make_pair(first, second));
+        return found != std::end(kerning) ? found->second : 0;
+    }
+    std::map<int, CharDef> chars{};
+    std::map<std::pair<int, int>, int> kerning{};
+};
+
+//KerningFont now: a dense array for ids 0-255 and a perfect-hash kerning table.
+struct FlatLookup {
+    FlatLookup() noexcept {
+        chars.resize(256u, MakeCharDef(0));
+        for(int id = 32; id < 127; ++id) {
+            chars[static_cast<std::size_t>(id)] = MakeCharDef(id);
+        }
+        kerning.Build(MakeKerningPairs());
+    }
+    [[nodiscard]] const CharDef& Char(int c) const noexcept {
+        return chars[static_cast<std::size_t>(c) & 0xFFu];
+    }
+    [[nodiscard]] int Kerning(int first, int second) const noexcept {
+        return kerning.Find(first, second);
+    }
+    std::vector<CharDef> chars{};
+    KerningTable kerning{};
+};
+
+[[nodiscard]] std::vector<std::string> MakeLines() noexcept {
+    auto lines = std::vector<std::string>(line_count);
+    for(std::size_t i = 0u; i < line_count; ++i) {
+        for(std::size_t c = 0u; c < line_length; ++c) {
+            lines[i].push_back(static_cast<char>(32u + (i * 7u + c * (13u + i / 95u)) % 95u));
+        }
+    }
+    return lines;
+}
+
+//Renderer::AppendMultiLineTextBuffer before the cache: every glyph is shaped from the font on every call.
+void AppendUncachedOld(const a2de::IFont& font, const std::string& text, const Vector2& start_position, const Rgba& color, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) noexcept {
+    float cursor_x = start_position.x;
+    const float cursor_y = start_position.y;
+    for(auto text_iter = text.begin(); text_iter != text.end(); /* DO NOTHING */) {
+        const int c = *text_iter;
+        const auto uvs = font.GetGlyphUVs(c);
+        const auto offsets = font.GetGlyphOffsets(c);
+        const auto dimensions = font.GetGlyphDimensions(c);
+        const float quad_top = cursor_y - offsets.y;
+        const float quad_bottom = quad_top + dimensions.y;
+        const float quad_left = cursor_x - offsets.x;
+        const float quad_right = quad_left + dimensions.x;
+        vbo.emplace_back(Vector3(quad_left, quad_bottom, 0.0f), color, Vector2(uvs.mins.x, uvs.maxs.y));
+        vbo.emplace_back(Vector3(quad_left, quad_top, 0.0f), color, Vector2(uvs.mins.x, uvs.mins.y));
+        vbo.emplace_back(Vector3(quad_right, quad_top, 0.0f), color, Vector2(uvs.maxs.x, uvs.mins.y));
+        vbo.emplace_back(Vector3(quad_right, quad_bottom, 0.0f), color, Vector2(uvs.maxs.x, uvs.maxs.y));
+        const auto s = static_cast<unsigned int>(vbo.size());
+        ibo.insert(std::end(ibo), {s - 4u, s - 3u, s - 2u, s - 4u, s - 2u, s - 1u});
+        if(const auto previous_char = text_iter++; text_iter != text.end()) {
+            cursor_x += font.GetGlyphAdvance(c) + font.GetKerningValue(static_cast<unsigned long>(*previous_char), static_cast<unsigned long>(*text_iter));
+        }
+    }
+}
+
+//Runs frame_count frames of appendLine over every line, reusing the buffers the way the console does.
+template<typename AppendFn>
+void ReportFrames(std::string_view label, const std::vector<std::string>& lines, AppendFn&& appendLine) noexcept {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    const auto seconds = Benchmarks::TimeBest(repeat_count, [&]() {
+        for(std::size_t frame = 0u; frame < frame_count; ++frame) {
+            vbo.clear();
+            ibo.clear();
+            auto y = 0.0f;
+            for(const auto& line : lines) {
+                appendLine(line, Vector2{0.0f, y}, vbo, ibo);
+                y += 32.0f;
+            }
+            Benchmarks::DoNotOptimize(vbo.data());
+        }
+    });
+    const auto per_frame = seconds / frame_count;
+    Benchmarks::Report(std::format("{}, per frame", label), per_frame * 1.0e3, "ms");
+    Benchmarks::Report(std::format("{}, throughput", label), glyphs_per_frame / per_frame * 1.0e-6, "Mglyphs/s");
+}
+
+} // namespace
+
+BENCHMARK_CASE("Text layout: 300 console lines of 80 glyphs per frame") {
+    const auto lines = MakeLines();
+    const BenchmarkFont<MapLookup> map_font{};
+    const BenchmarkFont<FlatLookup> flat_font{};
+    ReportFrames("old: per-glyph map lookups", lines, [&](const std::string& line, const Vector2& position, auto& vbo, auto& ibo) {
+        AppendUncachedOld(map_font, line, position, Rgba::White, vbo, ibo);
+    });
+    ReportFrames("flat tables, shaped every frame", lines, [&](const std::string& line, const Vector2& position, auto& vbo, auto& ibo) {
+        TextLayoutCache::AppendQuads(TextLayoutCache::Shape(flat_font, line, 1.0f, GlyphOffsetX::Subtract), position, Rgba::White, vbo, ibo);
+    });
+    {
+        //Steady state: the lines were shaped on an earlier frame and only position and color are applied.
+        TextLayoutCache cache{};
+        ReportFrames("layout cache hits", lines, [&](const std::string& line, const Vector2& position, auto& vbo, auto& ibo) {
+            TextLayoutCache::AppendQuads(cache.Get(flat_font, line, 1.0f, GlyphOffsetX::Subtract), position, Rgba::White, vbo, ibo);
+        });
+        Benchmarks::Report("layout cache hits, miss count", static_cast<double>(cache.GetStats().misses), "layouts");
+    }
+}
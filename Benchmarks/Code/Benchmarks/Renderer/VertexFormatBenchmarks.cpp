@@ -0,0 +1,78 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector4.hpp"
+#include "Engine/Renderer/Mesh.hpp"
+#include "Engine/Renderer/Vertex3D.hpp"
+#include "Engine/Renderer/Vertex3DCompact.hpp"
+#include "Engine/Renderer/VertexSprite2D.hpp"
+
+#include <cstdint>
+#include <format>
+#include <string_view>
+
+namespace {
+
+//512x512 quads: 1M vertices.
+constexpr std::size_t grid_size = 512u;
+constexpr std::size_t repeat_count = 5u;
+
+//Every quad sets all five attributes, as a lit, normal-mapped grid does. Formats without a
+//tangent frame or with packed colors pay only for what their layout keeps.
+template<typename VertexT>
+void BuildGrid(Mesh::BasicBuilder<VertexT>& builder) noexcept {
+    builder.Begin(PrimitiveType::Triangles);
+    for(std::size_t y = 0u; y < grid_size; ++y) {
+        for(std::size_t x = 0u; x < grid_size; ++x) {
+            const auto fx = static_cast<float>(x);
+            const auto fy = static_cast<float>(y);
+            builder.SetColor(Vector4{fx / grid_size, fy / grid_size, 0.5f, 1.0f});
+            builder.SetNormal(Vector3{0.0f, 0.0f, -1.0f});
+            builder.SetTangent(Vector3{1.0f, 0.0f, 0.0f});
+            builder.SetBitangent(Vector3{0.0f, 1.0f, 0.0f});
+            builder.SetUV(Vector2{0.0f, 1.0f});
+            builder.AddVertex(Vector3{fx, fy + 1.0f, 0.0f});
+            builder.SetUV(Vector2{0.0f, 0.0f});
+            builder.AddVertex(Vector3{fx, fy, 0.0f});
+            builder.SetUV(Vector2{1.0f, 0.0f});
+            builder.AddVertex(Vector3{fx + 1.0f, fy, 0.0f});
+            builder.SetUV(Vector2{1.0f, 1.0f});
+            builder.AddVertex(Vector3{fx + 1.0f, fy + 1.0f, 0.0f});
+            builder.AddIndicies(Mesh::BuilderPrimitive::Quad);
+        }
+    }
+    builder.End();
+}
+
+//A first build grows the vectors as it goes; a reused builder is cleared and keeps its capacity,
+//which is how per-frame builders run.
+template<typename VertexT>
+void ReportBuilder(std::string_view label) noexcept {
+    const auto first_seconds = Benchmarks::TimeBest(repeat_count, []() {
+        Mesh::BasicBuilder<VertexT> builder{};
+        BuildGrid(builder);
+        Benchmarks::DoNotOptimize(builder.verticies.data());
+    });
+    Mesh::BasicBuilder<VertexT> builder{};
+    BuildGrid(builder);
+    const auto reused_seconds = Benchmarks::TimeBest(repeat_count, [&builder]() {
+        builder.Clear();
+        BuildGrid(builder);
+        Benchmarks::DoNotOptimize(builder.verticies.data());
+    });
+    const auto vertex_count = static_cast<double>(builder.verticies.size());
+    Benchmarks::Report(std::format("{}, vertex size", label), static_cast<double>(sizeof(VertexT)), "bytes");
+    Benchmarks::Report(std::format("{}, vertex upload", label), vertex_count * sizeof(VertexT) / (1024.0 * 1024.0), "MB");
+    Benchmarks::Report(std::format("{}, first build", label), first_seconds * 1.0e3, "ms");
+    Benchmarks::Report(std::format("{}, reused builder", label), reused_seconds * 1.0e3, "ms");
+    Benchmarks::Report(std::format("{}, reused builder", label), vertex_count / reused_seconds * 1.0e-6, "Mverts/s");
+}
+
+} // namespace
+
+BENCHMARK_CASE("Vertex formats: Mesh::Builder throughput, 1M vertices") {
+    ReportBuilder<Vertex3D>("Vertex3D");
+    ReportBuilder<Vertex3DCompact>("Vertex3DCompact");
+    ReportBuilder<VertexSprite2D>("VertexSprite2D");
+}
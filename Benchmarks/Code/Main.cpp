@@ -0,0 +1,11 @@
+#include "Benchmarks/BenchmarkHarness.hpp"
+
+#include <string_view>
+
+//Benchmarks [name filter]
+//Numbers are only meaningful from an optimized configuration (Release or FinalBuild).
+int main(int argc, char* argv[]) {
+    const auto filter = argc > 1 ? std::string_view{argv[1]} : std::string_view{};
+    Benchmarks::RunAll(filter);
+    return 0;
+}
@@ -2,12 +2,16 @@
 
 #if defined(PLATFORM_WINDOWS)
 
+#include "Engine/Core/BinaryLog.hpp"
+#include "Engine/Core/Config.hpp"
 #include "Engine/Core/EngineBase.hpp"
+#include "Engine/Core/KeyValueParser.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Platform/Win.hpp"
 
 #include "Editor/Editor.hpp"
 
+#include <filesystem>
 #include <string>
 
 #if defined(_MSC_VER)
@@ -18,6 +22,14 @@
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine, int nCmdShow);
 
 int WINAPI wWinMain(HINSTANCE /*hInstance*/, HINSTANCE /*hPrevInstance*/, PWSTR /*pCmdLine*/, int /*nCmdShow*/) {
+    //decodelog=<file.blog> [decodelogoutput=<file.txt>]: renders a binary structured log and exits without starting the engine.
+    if(const auto args = Config{KeyValueParser{StringUtils::ConvertUnicodeToMultiByte(GetCommandLineArgs())}}; args.HasKey("decodelog")) {
+        std::string input{};
+        args.GetValue("decodelog", input);
+        std::string output{};
+        args.GetValueOr("decodelogoutput", output, std::filesystem::path{input}.replace_extension(".txt").string());
+        return BinaryLog::Decode(input, output) ? 0 : 1;
+    }
     Engine<Editor>::Initialize(std::string{"Abrams Game Engine 2022"});
     Engine<Editor>::Run();
     Engine<Editor>::Shutdown();
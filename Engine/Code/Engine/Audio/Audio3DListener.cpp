@@ -33,26 +33,6 @@ Vector3& Audio3DListener::GetConeUp() noexcept {
     return m_coneUp;
 }
 
-const X3DAUDIO_LISTENER& Audio3DListener::GetX3DAudioListener() const noexcept {
-    return m_x3dAudioListener;
-}
-
-const X3DAUDIO_CONE& Audio3DListener::GetX3DAudioCone() const noexcept {
-    return m_x3dCone;
-}
-
-void Audio3DListener::UpdateX3DAudio() noexcept {
-    m_x3dAudioListener.OrientFront = X3DAUDIO_VECTOR{GetConeForward().GetAsFloatArray()};
-    m_x3dAudioListener.OrientTop = X3DAUDIO_VECTOR{GetConeUp().GetAsFloatArray()};
-    m_x3dAudioListener.Position = X3DAUDIO_VECTOR{position.GetAsFloatArray()};
-    m_x3dAudioListener.Velocity = X3DAUDIO_VECTOR{velocity.GetAsFloatArray()};
-    m_x3dAudioListener.pCone = IsOmniDirectional() ? nullptr : &m_x3dCone;
-}
-
-void Audio3DListener::UpdateX3DCone() noexcept {
-    m_x3dCone = Audio3DConeToX3DAudioCone(GetCone());
-}
-
 const Vector3& Audio3DListener::GetConeForward() const noexcept {
     return m_coneForward;
 }
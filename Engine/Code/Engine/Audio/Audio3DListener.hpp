@@ -1,7 +1,6 @@
 #pragma once
 
 #include "Engine/Audio/Audio3DCone.hpp"
-#include "Engine/Audio/XAudio.hpp"
 
 #include "Engine/Math/Vector3.hpp"
 
@@ -22,18 +21,10 @@ public:
     const Vector3& GetConeUp() const noexcept;
     Vector3& GetConeUp() noexcept;
 
-    const X3DAUDIO_LISTENER& GetX3DAudioListener() const noexcept;
-    const X3DAUDIO_CONE& GetX3DAudioCone() const noexcept;
-
     Vector3 position{};
     Vector3 velocity{};
 protected:
 private:
-    void UpdateX3DAudio() noexcept;
-    void UpdateX3DCone() noexcept;
-
-    X3DAUDIO_LISTENER m_x3dAudioListener{};
-    X3DAUDIO_CONE m_x3dCone{};
     Audio3DCone m_cone{Audio3DCone::DefaultDirectionalCone};
     Vector3 m_coneForward{};
     Vector3 m_coneUp{};
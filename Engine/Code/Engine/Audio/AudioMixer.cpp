@@ -0,0 +1,588 @@
+#include "Engine/Audio/AudioMixer.hpp"
+
+#include "Engine/Audio/Audio3DEmitter.hpp"
+#include "Engine/Audio/Audio3DListener.hpp"
+#include "Engine/Audio/AudioSampleConversion.hpp"
+#include "Engine/Audio/AudioStream.hpp"
+#include "Engine/Audio/Wav.hpp"
+
+#include "Engine/Core/ThreadUtils.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include "Engine/Profiling/Metrics.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace {
+
+constexpr std::uint16_t wav_format_pcm = 1u;
+constexpr std::uint16_t wav_format_ieee_float = 3u;
+constexpr std::uint16_t wav_format_extensible = 0xFFFEu;
+constexpr float speed_of_sound = 343.5f;
+
+//Linear interpolation between neighbouring source frames, accumulated into the output with a per-frame gain ramp.
+//source holds interleaved frames sourceStride floats apart; position is relative to its first frame.
+//Templated on the channel layouts so the inner loop has no per-sample branches.
+template<bool StereoSource, bool StereoOutput>
+void ResampleAndAccumulate(const float* source, std::size_t sourceStride, double position, double step, std::size_t count, float* destination, std::array<float, 2> gains, const std::array<float, 2>& gainSteps) noexcept {
+    for(std::size_t i = 0u; i < count; ++i) {
+        const double p = position + static_cast<double>(i) * step;
+        const auto index = static_cast<std::size_t>(p);
+        const auto fraction = static_cast<float>(p - static_cast<double>(index));
+        const float* a = source + index * sourceStride;
+        const float* b = a + sourceStride;
+        const float left = a[0] + (b[0] - a[0]) * fraction;
+        float right = left;
+        if constexpr(StereoSource) {
+            right = a[1] + (b[1] - a[1]) * fraction;
+        }
+        if constexpr(StereoOutput) {
+            destination[0] += left * gains[0];
+            destination[1] += right * gains[1];
+            destination += 2;
+        } else {
+            destination[0] += 0.5f * (left * gains[0] + right * gains[1]);
+            destination += 1;
+        }
+        gains[0] += gainSteps[0];
+        gains[1] += gainSteps[1];
+    }
+}
+
+Vector3 NormalizeOr(const Vector3& v, const Vector3& fallback) noexcept {
+    const auto length = v.CalcLength();
+    return length > 0.0001f ? v / length : fallback;
+}
+
+//Volume for a direction that is angleRadians off the cone's axis. The cone stores full angles.
+float CalcConeVolume(const Audio3DCone& cone, float angleRadians) noexcept {
+    const auto half_angles = cone.GetInnerOuterAnglesRadians() * 0.5f;
+    const auto volumes = cone.GetInnerOuterVolumeLevels();
+    if(angleRadians <= half_angles.x) {
+        return volumes.x;
+    }
+    if(angleRadians >= half_angles.y || half_angles.y <= half_angles.x) {
+        return volumes.y;
+    }
+    const auto t = (angleRadians - half_angles.x) / (half_angles.y - half_angles.x);
+    return volumes.x + (volumes.y - volumes.x) * t;
+}
+
+float CalcAngleBetween(const Vector3& a, const Vector3& b) noexcept {
+    return std::acos(std::clamp(MathUtils::DotProduct(a, b), -1.0f, 1.0f));
+}
+
+} // namespace
+
+AudioMixer::AudioMixer(std::unique_ptr<IAudioOutput> output, const AudioMixerFormat& format /*= AudioMixerFormat{}*/, std::size_t maxVoices /*= 64u*/) noexcept
+: m_output(std::move(output))
+, m_format(format)
+, m_commands(1024u)
+, m_finished((std::max)(std::size_t{16u}, maxVoices * 2u))
+{
+    m_format.channel_count = std::clamp(m_format.channel_count, 1u, static_cast<std::uint32_t>(max_output_channels));
+    m_format.sample_rate = (std::max)(m_format.sample_rate, 1u);
+    m_format.block_frames = (std::max)(m_format.block_frames, 1u);
+    m_voices.resize((std::max)(maxVoices, std::size_t{1u}));
+    //Two extra frames: the interpolation partner of the last frame and rounding slack.
+    m_scratch.resize((scratch_frames + 2u) * max_source_channels);
+    m_command_batch.resize(m_commands.capacity());
+}
+
+AudioMixer::~AudioMixer() noexcept {
+    Stop();
+}
+
+bool AudioMixer::Start() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    if(m_running) {
+        return true;
+    }
+    if(!m_output) {
+        return false;
+    }
+    auto opened = std::promise<bool>{};
+    auto open_result = opened.get_future();
+    m_thread = std::jthread([this, opened = std::move(opened)](std::stop_token stopToken) mutable { MixerThread(stopToken, opened); });
+    ThreadUtils::SetThreadDescription(m_thread, std::string{"Audio Mixer"});
+    m_running = open_result.get();
+    if(!m_running) {
+        m_thread.join();
+    }
+    return m_running;
+}
+
+void AudioMixer::Stop() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    if(m_thread.joinable()) {
+        m_thread.request_stop();
+        m_thread.join();
+    }
+    m_running = false;
+}
+
+bool AudioMixer::IsRunning() const noexcept {
+    return m_running;
+}
+
+void AudioMixer::SetSuspended(bool suspended) noexcept {
+    m_suspended = suspended;
+}
+
+void AudioMixer::MixerThread(std::stop_token stopToken, std::promise<bool>& opened) noexcept {
+    if(!m_output->Open(m_format)) {
+        opened.set_value(false);
+        return;
+    }
+    opened.set_value(true);
+    auto block = std::vector<float>(m_format.GetBlockSampleCount());
+    while(m_output->WaitForBlock(stopToken)) {
+        MixBlock(block);
+        m_output->SubmitBlock(block);
+    }
+    m_output->Close();
+}
+
+AudioMixer::VoiceId AudioMixer::Play(const FileUtils::Wav& wav, const AudioVoiceDesc& desc /*= AudioVoiceDesc{}*/) noexcept {
+    const auto& format = wav.GetFormatChunk();
+    if(!IsSupportedFormat(format) || wav.GetDataBufferSize() < format.dataBlockSize) {
+        return invalid_voice;
+    }
+    auto id = ++m_next_voice_id;
+    if(id == invalid_voice) {
+        id = ++m_next_voice_id;
+    }
+    Command command{};
+    command.type = CommandType::Play;
+    command.voice = id;
+    command.wav = &wav;
+    command.desc = desc;
+    Submit(command);
+    return id;
+}
+
+AudioMixer::VoiceId AudioMixer::Play(std::shared_ptr<AudioStream> stream, const AudioVoiceDesc& desc /*= AudioVoiceDesc{}*/) noexcept {
+    if(!stream || !IsSupportedFormat(stream->GetFormatChunk())) {
+        return invalid_voice;
+    }
+    //Starting here rather than on the mixer thread gets the first reads going before the voice is even queued.
+    stream->Start(desc);
+    auto id = ++m_next_voice_id;
+    if(id == invalid_voice) {
+        id = ++m_next_voice_id;
+    }
+    Command command{};
+    command.type = CommandType::Play;
+    command.voice = id;
+    command.stream = std::move(stream);
+    command.desc = desc;
+    //The stream unrolls the loops into its ring; to the voice it is one long sound.
+    command.desc.loop_count = 0u;
+    Submit(command);
+    return id;
+}
+
+void AudioMixer::StopVoice(VoiceId voice) noexcept {
+    Command command{};
+    command.type = CommandType::Stop;
+    command.voice = voice;
+    Submit(command);
+}
+
+void AudioMixer::PauseVoice(VoiceId voice) noexcept {
+    Command command{};
+    command.type = CommandType::Pause;
+    command.voice = voice;
+    Submit(command);
+}
+
+void AudioMixer::ResumeVoice(VoiceId voice) noexcept {
+    Command command{};
+    command.type = CommandType::Resume;
+    command.voice = voice;
+    Submit(command);
+}
+
+void AudioMixer::SetVoiceVolume(VoiceId voice, float volume) noexcept {
+    Command command{};
+    command.type = CommandType::SetVolume;
+    command.voice = voice;
+    command.value = volume;
+    Submit(command);
+}
+
+void AudioMixer::SetVoiceFrequency(VoiceId voice, float frequency) noexcept {
+    Command command{};
+    command.type = CommandType::SetFrequency;
+    command.voice = voice;
+    command.value = frequency;
+    Submit(command);
+}
+
+void AudioMixer::SetVoicePan(VoiceId voice, const AudioPan& pan) noexcept {
+    Command command{};
+    command.type = CommandType::SetPan;
+    command.voice = voice;
+    command.pan = pan;
+    Submit(command);
+}
+
+void AudioMixer::StopAllVoices() noexcept {
+    Command command{};
+    command.type = CommandType::StopAll;
+    Submit(command);
+}
+
+bool AudioMixer::TryPopFinishedVoice(VoiceId& voice) noexcept {
+    return m_finished.try_pop(voice);
+}
+
+void AudioMixer::Submit(const Command& command) noexcept {
+    //A full queue drains within a block while the mixer runs. Without a running mixer nothing would drain it,
+    //so the command is dropped rather than waiting forever.
+    while(!m_commands.try_push(command)) {
+        if(!m_running) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+void AudioMixer::ApplyCommands() noexcept {
+    const auto count = m_commands.try_pop_n(std::span<Command>{m_command_batch});
+    for(std::size_t i = 0u; i < count; ++i) {
+        ApplyCommand(m_command_batch[i]);
+        //Do not keep a stopped stream alive in the batch until the slot is reused.
+        m_command_batch[i].stream.reset();
+    }
+}
+
+void AudioMixer::ApplyCommand(const Command& command) noexcept {
+    if(command.type == CommandType::Play) {
+        StartVoice(command);
+        return;
+    }
+    if(command.type == CommandType::StopAll) {
+        for(auto& voice : m_voices) {
+            if(voice.id != invalid_voice) {
+                FinishVoice(voice, false);
+            }
+        }
+        return;
+    }
+    auto* voice = FindVoice(command.voice);
+    if(!voice) {
+        return;
+    }
+    switch(command.type) {
+    case CommandType::Stop: FinishVoice(*voice, false); break;
+    case CommandType::Pause: voice->paused = true; break;
+    case CommandType::Resume: voice->paused = false; break;
+    case CommandType::SetVolume: voice->volume = (std::max)(command.value, 0.0f); break;
+    case CommandType::SetFrequency: voice->frequency = (std::max)(command.value, 0.0f); break;
+    case CommandType::SetPan: voice->pan = command.pan; break;
+    default: break;
+    }
+}
+
+AudioMixer::Voice* AudioMixer::FindVoice(VoiceId voice) noexcept {
+    if(voice == invalid_voice) {
+        return nullptr;
+    }
+    const auto found = std::find_if(std::begin(m_voices), std::end(m_voices), [voice](const Voice& v) { return v.id == voice; });
+    return found != std::end(m_voices) ? &*found : nullptr;
+}
+
+void AudioMixer::StartVoice(const Command& command) noexcept {
+    const auto free_slot = std::find_if(std::begin(m_voices), std::end(m_voices), [](const Voice& v) { return v.id == invalid_voice; });
+    if(free_slot == std::end(m_voices)) {
+        (void)m_finished.try_push(command.voice);
+        return;
+    }
+    const auto& format = command.stream ? command.stream->GetFormatChunk() : command.wav->GetFormatChunk();
+    auto& voice = *free_slot;
+    voice = Voice{};
+    voice.id = command.voice;
+    (void)TryGetSampleType(format, voice.sample_type);
+    voice.channel_count = format.channelCount;
+    voice.bytes_per_frame = format.dataBlockSize;
+    voice.sample_rate = format.samplesPerSecond;
+    voice.volume = (std::max)(command.desc.volume, 0.0f);
+    voice.frequency = (std::max)(command.desc.frequency, 0.0f);
+    voice.applied_gains = {voice.volume * voice.pan.gains[0], voice.volume * voice.pan.gains[1]};
+    if(command.stream) {
+        voice.stream = command.stream;
+        return;
+    }
+    voice.data = command.wav->GetDataBuffer();
+    voice.frame_count = command.wav->GetDataBufferSize() / format.dataBlockSize;
+    voice.has_loop = command.desc.loop_count > 0u;
+    voice.loops_remaining = command.desc.loop_count;
+    voice.stop_at_loop_end = command.desc.stop_at_loop_end;
+    const auto to_frames = [&voice](float seconds) {
+        return static_cast<std::uint32_t>((std::max)(0.0, static_cast<double>(seconds) * voice.sample_rate));
+    };
+    voice.loop_begin = (std::min)(to_frames(command.desc.loop_begin_seconds), voice.frame_count - 1u);
+    voice.loop_end = voice.frame_count;
+    if(command.desc.loop_end_seconds > 0.0f) {
+        voice.loop_end = std::clamp(to_frames(command.desc.loop_end_seconds), voice.loop_begin + 1u, voice.frame_count);
+    }
+}
+
+void AudioMixer::FinishVoice(Voice& voice, bool reportFinished) noexcept {
+    if(reportFinished) {
+        (void)m_finished.try_push(voice.id);
+    }
+    voice.id = invalid_voice;
+    voice.data = nullptr;
+    voice.stream.reset();
+}
+
+void AudioMixer::MixBlock(std::span<float> out) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    static auto& mix_block_time = Metrics::GetHistogram("audio.mix_block [ns]");
+    static auto& voice_count = Metrics::GetGauge("audio.voices");
+    const auto start = std::chrono::steady_clock::now();
+
+    ApplyCommands();
+    std::fill(std::begin(out), std::end(out), 0.0f);
+    if(out.size() < m_format.GetBlockSampleCount()) {
+        return;
+    }
+    const auto block = out.first(m_format.GetBlockSampleCount());
+    std::size_t playing = 0u;
+    for(auto& voice : m_voices) {
+        if(voice.id == invalid_voice) {
+            continue;
+        }
+        if(voice.paused || m_suspended) {
+            ++playing;
+            continue;
+        }
+        if(MixVoice(voice, block)) {
+            ++playing;
+        } else {
+            FinishVoice(voice, true);
+        }
+    }
+    m_playing_voices.store(playing, std::memory_order_relaxed);
+    voice_count.Set(static_cast<double>(playing));
+    mix_block_time.Record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+}
+
+bool AudioMixer::MixVoice(Voice& voice, std::span<float> out) noexcept {
+    static auto& stream_underruns = Metrics::GetCounter("audio.stream_underruns");
+    const auto block_frames = static_cast<std::size_t>(m_format.block_frames);
+    const auto stereo_output = m_format.channel_count == 2u;
+    const auto target_gains = std::array<float, 2>{voice.volume * voice.pan.gains[0], voice.volume * voice.pan.gains[1]};
+    const auto start_gains = voice.applied_gains;
+    //Gains slide from last block's values to this block's over the whole block so volume and pan changes do not click.
+    const auto gain_steps = std::array<float, 2>{(target_gains[0] - start_gains[0]) / static_cast<float>(block_frames), (target_gains[1] - start_gains[1]) / static_cast<float>(block_frames)};
+    voice.applied_gains = target_gains;
+
+    const double step = static_cast<double>(voice.sample_rate) / m_format.sample_rate * voice.frequency * (std::max)(voice.pan.doppler, 0.0f);
+    if(step <= 0.0) {
+        return true;
+    }
+    //Furthest output frames one pass can cover before its source frames overflow the scratch buffer.
+    const auto max_frames_per_pass = static_cast<std::size_t>(static_cast<double>(scratch_frames - 2u) / step) + 1u;
+    const auto channels = static_cast<std::size_t>(voice.channel_count);
+    float* scratch = m_scratch.data();
+
+    std::size_t frames_done = 0u;
+    while(frames_done < block_frames) {
+        const bool looping = voice.loops_remaining > 0u;
+        std::uint32_t region_end = (looping || (voice.has_loop && voice.stop_at_loop_end)) ? voice.loop_end : voice.frame_count;
+        std::uint32_t frames_readable = region_end;
+        if(voice.stream) {
+            //Ask about the end first: once it is set, the buffered count is final.
+            const bool stream_ended = voice.stream->IsEndOfStream();
+            //Read before the count too: a stream primed after the count was taken has not underrun.
+            const bool stream_primed = voice.stream->IsPrimed();
+            frames_readable = static_cast<std::uint32_t>(voice.stream->GetBufferedFrameCount());
+            //Until the stream has ended, hold back the newest frame so there is always one to interpolate towards.
+            region_end = (stream_ended || frames_readable == 0u) ? frames_readable : frames_readable - 1u;
+            if(voice.position >= static_cast<double>(region_end)) {
+                if(stream_ended) {
+                    return false;
+                }
+                if(stream_primed) {
+                    stream_underruns.Add();
+                }
+                break;
+            }
+        }
+        if(voice.position >= static_cast<double>(region_end)) {
+            if(!looping) {
+                return false;
+            }
+            const double loop_length = static_cast<double>(voice.loop_end - voice.loop_begin);
+            voice.position = voice.loop_begin + std::fmod(voice.position - region_end, loop_length);
+            if(voice.loops_remaining != AudioVoiceDesc::infinite_loops) {
+                --voice.loops_remaining;
+            }
+            continue;
+        }
+        const auto first = static_cast<std::uint32_t>(voice.position);
+        const double remaining = static_cast<double>(region_end) - voice.position;
+        auto count = (std::min)(block_frames - frames_done, static_cast<std::size_t>(std::ceil(remaining / step)));
+        count = (std::min)(count, max_frames_per_pass);
+        const auto last = static_cast<std::uint32_t>(voice.position + static_cast<double>(count - 1u) * step);
+        //Every frame the pass reads, plus the frame after the last one to interpolate towards.
+        const auto needed = last - first + 2u;
+        const auto available = (std::min)(needed, frames_readable - first);
+        ConvertFrames(voice, first, available, scratch);
+        if(available < needed) {
+            float* partner = scratch + available * channels;
+            if(looping) {
+                ConvertFrames(voice, voice.loop_begin, 1u, partner);
+            } else {
+                std::copy_n(partner - channels, channels, partner);
+            }
+        }
+
+        const double position = voice.position - first;
+        float* destination = out.data() + frames_done * m_format.channel_count;
+        const auto gains = std::array<float, 2>{start_gains[0] + gain_steps[0] * frames_done, start_gains[1] + gain_steps[1] * frames_done};
+        if(channels == 1u) {
+            if(stereo_output) {
+                ResampleAndAccumulate<false, true>(scratch, channels, position, step, count, destination, gains, gain_steps);
+            } else {
+                ResampleAndAccumulate<false, false>(scratch, channels, position, step, count, destination, gains, gain_steps);
+            }
+        } else {
+            if(stereo_output) {
+                ResampleAndAccumulate<true, true>(scratch, channels, position, step, count, destination, gains, gain_steps);
+            } else {
+                ResampleAndAccumulate<true, false>(scratch, channels, position, step, count, destination, gains, gain_steps);
+            }
+        }
+        voice.position += static_cast<double>(count) * step;
+        frames_done += count;
+    }
+    if(voice.stream) {
+        voice.position -= static_cast<double>(voice.stream->ReleaseFramesBefore(static_cast<std::size_t>(voice.position)));
+    }
+    return true;
+}
+
+void AudioMixer::ConvertFrames(const Voice& voice, std::uint32_t first, std::uint32_t count, float* destination) const noexcept {
+    if(voice.stream) {
+        //Buffered frames sit in separate blocks; convert the run one block at a time.
+        std::size_t converted = 0u;
+        while(converted < count) {
+            auto run = static_cast<std::size_t>(count) - converted;
+            const auto* bytes = voice.stream->GetFrames(first + converted, run);
+            if(!bytes) {
+                std::fill_n(destination + converted * voice.channel_count, (count - converted) * voice.channel_count, 0.0f);
+                return;
+            }
+            ConvertSamples(voice.sample_type, bytes, run * voice.channel_count, destination + converted * voice.channel_count);
+            converted += run;
+        }
+        return;
+    }
+    ConvertSamples(voice.sample_type, voice.data + static_cast<std::size_t>(first) * voice.bytes_per_frame, static_cast<std::size_t>(count) * voice.channel_count, destination);
+}
+
+void AudioMixer::ConvertSamples(SampleType type, const std::uint8_t* bytes, std::size_t sampleCount, float* destination) noexcept {
+    switch(type) {
+    case SampleType::UInt8: AudioSampleConversion::UInt8ToFloat(bytes, destination, sampleCount); break;
+    case SampleType::Int16: AudioSampleConversion::Int16ToFloat(reinterpret_cast<const std::int16_t*>(bytes), destination, sampleCount); break;
+    case SampleType::Int24: AudioSampleConversion::Int24ToFloat(bytes, destination, sampleCount); break;
+    case SampleType::Int32: AudioSampleConversion::Int32ToFloat(reinterpret_cast<const std::int32_t*>(bytes), destination, sampleCount); break;
+    case SampleType::Float32: std::memcpy(destination, bytes, sampleCount * sizeof(float)); break;
+    default: std::fill_n(destination, sampleCount, 0.0f); break;
+    }
+}
+
+const AudioMixerFormat& AudioMixer::GetFormat() const noexcept {
+    return m_format;
+}
+
+std::size_t AudioMixer::GetPlayingVoiceCount() const noexcept {
+    return m_playing_voices.load(std::memory_order_relaxed);
+}
+
+bool AudioMixer::IsSupportedFormat(const FileUtils::detail::WavFormatChunk& format) noexcept {
+    auto type = SampleType::Int16;
+    return TryGetSampleType(format, type);
+}
+
+bool AudioMixer::TryGetSampleType(const FileUtils::detail::WavFormatChunk& format, SampleType& type) noexcept {
+    if(format.channelCount == 0u || format.channelCount > max_source_channels || format.samplesPerSecond == 0u) {
+        return false;
+    }
+    //Frames must be tightly packed for the bulk conversions to walk them.
+    if(format.dataBlockSize == 0u || format.dataBlockSize != format.channelCount * format.bitsPerSample / 8u) {
+        return false;
+    }
+    //WAVE_FORMAT_EXTENSIBLE keeps the real format code in the first bytes of its sub-format GUID.
+    const auto format_id = format.formatId == wav_format_extensible ? static_cast<std::uint16_t>(format.subFormat[0] & 0xFFFFu) : format.formatId;
+    if(format_id == wav_format_ieee_float) {
+        type = SampleType::Float32;
+        return format.bitsPerSample == 32u;
+    }
+    if(format_id != wav_format_pcm) {
+        return false;
+    }
+    switch(format.bitsPerSample) {
+    case 8u: type = SampleType::UInt8; return true;
+    case 16u: type = SampleType::Int16; return true;
+    case 24u: type = SampleType::Int24; return true;
+    case 32u: type = SampleType::Int32; return true;
+    default: return false;
+    }
+}
+
+AudioPan AudioMixer::CalculatePan(const Audio3DEmitter& emitter, const Audio3DListener& listener) noexcept {
+    AudioPan pan{};
+    const auto to_emitter = emitter.position - listener.position;
+    const auto distance = to_emitter.CalcLength();
+    const auto direction = distance > 0.0001f ? to_emitter / distance : Vector3::Zero;
+
+    //Inverse distance: full volume inside the reference distance, halving every time the distance doubles past it.
+    const auto reference_distance = (std::max)(1.0f, emitter.GetInnerRadius());
+    auto volume = distance <= reference_distance ? 1.0f : reference_distance / distance;
+    if(!emitter.IsOmniDirectional() && distance > 0.0001f) {
+        volume *= CalcConeVolume(emitter.Get3DCone(), CalcAngleBetween(NormalizeOr(emitter.GetConeForward(), Vector3::Z_Axis), -direction));
+    }
+    const auto forward = NormalizeOr(listener.GetConeForward(), Vector3::Z_Axis);
+    if(!listener.IsOmniDirectional() && distance > 0.0001f) {
+        volume *= CalcConeVolume(listener.GetCone(), CalcAngleBetween(forward, direction));
+    }
+
+    //Left-handed, like the renderer: right is up cross forward.
+    const auto up = NormalizeOr(listener.GetConeUp(), Vector3::Y_Axis);
+    const auto right = NormalizeOr(MathUtils::CrossProduct(up, forward), Vector3::X_Axis);
+    const auto side = std::clamp(MathUtils::DotProduct(direction, right), -1.0f, 1.0f);
+    //Equal-power pan: the total power stays constant as the source moves across.
+    const auto pan_angle = (side + 1.0f) * MathUtils::M_PI_4;
+    pan.gains = {std::cos(pan_angle) * volume, std::sin(pan_angle) * volume};
+
+    //Positive components move towards the other party and raise the pitch.
+    const auto max_speed = speed_of_sound * 0.5f;
+    const auto listener_speed = std::clamp(MathUtils::DotProduct(listener.velocity, direction), -max_speed, max_speed);
+    const auto emitter_speed = std::clamp(MathUtils::DotProduct(emitter.velocity, -direction), -max_speed, max_speed);
+    pan.doppler = std::clamp((speed_of_sound + listener_speed) / (speed_of_sound - emitter_speed), 0.5f, 2.0f);
+    return pan;
+}
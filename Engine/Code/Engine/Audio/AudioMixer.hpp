@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Engine/Audio/AudioOutput.hpp"
+
+#include "Engine/Core/MpscQueue.hpp"
+#include "Engine/Core/SpscRingBuffer.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace FileUtils {
+class Wav;
+namespace detail {
+struct WavFormatChunk;
+}
+} // namespace FileUtils
+
+class Audio3DEmitter;
+class Audio3DListener;
+class AudioStream;
+
+struct AudioVoiceDesc {
+    static constexpr std::uint32_t infinite_loops = (std::numeric_limits<std::uint32_t>::max)();
+
+    float volume{1.0f};
+    float frequency{1.0f};           //Playback rate multiplier: 2.0 plays twice as fast and an octave up.
+    std::uint32_t loop_count{0u};    //Times playback jumps back to loop_begin; infinite_loops repeats until stopped.
+    float loop_begin_seconds{0.0f};
+    float loop_end_seconds{0.0f};    //0 means the end of the sound.
+    bool stop_at_loop_end{false};    //End at the last loop's end instead of playing the rest of the sound.
+};
+
+//Per-output-channel gains and a pitch factor, usually from AudioMixer::CalculatePan.
+struct AudioPan {
+    std::array<float, 2> gains{1.0f, 1.0f};
+    float doppler{1.0f};
+};
+
+//Software mixer: mixes any number of FileUtils::Wav sources, each in its own sample format and rate, into
+//fixed-size float blocks on a dedicated thread and hands them to an IAudioOutput.
+//Voice calls may come from any thread. They are queued and applied together at the start of the next block,
+//so a burst of changes made in one frame is heard in the same block.
+class AudioMixer {
+public:
+    using VoiceId = std::uint32_t;
+    static constexpr VoiceId invalid_voice = 0u;
+    static constexpr std::size_t max_output_channels = 2u;
+    static constexpr std::size_t max_source_channels = 8u;
+
+    //format.channel_count is clamped to 1 or 2; a stereo mix is upmixed by the device for larger speaker layouts.
+    explicit AudioMixer(std::unique_ptr<IAudioOutput> output, const AudioMixerFormat& format = AudioMixerFormat{}, std::size_t maxVoices = 64u) noexcept;
+    AudioMixer(const AudioMixer& other) = delete;
+    AudioMixer(AudioMixer&& other) = delete;
+    AudioMixer& operator=(const AudioMixer& other) = delete;
+    AudioMixer& operator=(AudioMixer&& other) = delete;
+    ~AudioMixer() noexcept;
+
+    //Opens the output on the mixer thread. Returns false if it could not be opened.
+    [[nodiscard]] bool Start() noexcept;
+    void Stop() noexcept;
+    [[nodiscard]] bool IsRunning() const noexcept;
+    //While suspended the output receives silence and voices hold their place.
+    void SetSuspended(bool suspended) noexcept;
+
+    //wav must stay loaded until the voice finishes or is stopped.
+    //Returns invalid_voice if wav is empty or in a format the mixer cannot read. When every voice is busy the
+    //play is dropped and the id is reported through TryPopFinishedVoice like any other voice that ended.
+    [[nodiscard]] VoiceId Play(const FileUtils::Wav& wav, const AudioVoiceDesc& desc = AudioVoiceDesc{}) noexcept;
+    //Plays a stream that has not been started yet; the stream applies desc's loop settings as it reads ahead.
+    //If the stream falls behind, the voice goes quiet and holds its place until data arrives.
+    [[nodiscard]] VoiceId Play(std::shared_ptr<AudioStream> stream, const AudioVoiceDesc& desc = AudioVoiceDesc{}) noexcept;
+    void StopVoice(VoiceId voice) noexcept;
+    void PauseVoice(VoiceId voice) noexcept;
+    void ResumeVoice(VoiceId voice) noexcept;
+    void SetVoiceVolume(VoiceId voice, float volume) noexcept;
+    void SetVoiceFrequency(VoiceId voice, float frequency) noexcept;
+    void SetVoicePan(VoiceId voice, const AudioPan& pan) noexcept;
+    void StopAllVoices() noexcept;
+
+    //Voices that reached their end on their own. Stopped voices are not reported. Single consumer.
+    [[nodiscard]] bool TryPopFinishedVoice(VoiceId& voice) noexcept;
+
+    //Applies queued voice calls and mixes one block into out, which must hold format.GetBlockSampleCount() samples.
+    //The mixer thread calls this; tests and benchmarks may call it directly on a mixer that was never started.
+    void MixBlock(std::span<float> out) noexcept;
+
+    [[nodiscard]] const AudioMixerFormat& GetFormat() const noexcept;
+    [[nodiscard]] std::size_t GetPlayingVoiceCount() const noexcept;
+
+    [[nodiscard]] static bool IsSupportedFormat(const FileUtils::detail::WavFormatChunk& format) noexcept;
+    //Distance attenuation, emitter and listener cones, equal-power stereo placement and doppler, without X3DAudio.
+    [[nodiscard]] static AudioPan CalculatePan(const Audio3DEmitter& emitter, const Audio3DListener& listener) noexcept;
+
+protected:
+private:
+    // clang-format off
+    enum class SampleType : std::uint8_t {
+        UInt8
+        ,Int16
+        ,Int24
+        ,Int32
+        ,Float32
+    };
+
+    enum class CommandType : std::uint8_t {
+        Play
+        ,Stop
+        ,Pause
+        ,Resume
+        ,SetVolume
+        ,SetFrequency
+        ,SetPan
+        ,StopAll
+    };
+    // clang-format on
+
+    struct Command {
+        CommandType type{CommandType::Play};
+        VoiceId voice{invalid_voice};
+        const FileUtils::Wav* wav{nullptr};
+        std::shared_ptr<AudioStream> stream{};
+        AudioVoiceDesc desc{};
+        AudioPan pan{};
+        float value{0.0f};
+    };
+
+    struct Voice {
+        VoiceId id{invalid_voice};
+        const std::uint8_t* data{nullptr};
+        std::shared_ptr<AudioStream> stream{}; //Set instead of data for streamed voices. position then counts from the stream's oldest buffered frame.
+        SampleType sample_type{SampleType::Int16};
+        std::uint32_t channel_count{1u};
+        std::uint32_t bytes_per_frame{2u};
+        std::uint32_t frame_count{0u};
+        std::uint32_t sample_rate{44100u};
+        double position{0.0}; //In source frames; the fraction drives interpolation.
+        float volume{1.0f};
+        float frequency{1.0f};
+        AudioPan pan{};
+        std::array<float, max_output_channels> applied_gains{}; //Where last block's gain ramp ended.
+        std::uint32_t loops_remaining{0u};
+        std::uint32_t loop_begin{0u};
+        std::uint32_t loop_end{0u};
+        bool has_loop{false};
+        bool stop_at_loop_end{false};
+        bool paused{false};
+    };
+
+    [[nodiscard]] static bool TryGetSampleType(const FileUtils::detail::WavFormatChunk& format, SampleType& type) noexcept;
+
+    void MixerThread(std::stop_token stopToken, std::promise<bool>& opened) noexcept;
+    void Submit(const Command& command) noexcept;
+    void ApplyCommands() noexcept;
+    void ApplyCommand(const Command& command) noexcept;
+    [[nodiscard]] Voice* FindVoice(VoiceId voice) noexcept;
+    void StartVoice(const Command& command) noexcept;
+    void FinishVoice(Voice& voice, bool reportFinished) noexcept;
+    //Returns false once the voice has played to its end.
+    [[nodiscard]] bool MixVoice(Voice& voice, std::span<float> out) noexcept;
+    //Converts source frames [first, first + count) of voice into destination as interleaved floats.
+    void ConvertFrames(const Voice& voice, std::uint32_t first, std::uint32_t count, float* destination) const noexcept;
+    static void ConvertSamples(SampleType type, const std::uint8_t* bytes, std::size_t sampleCount, float* destination) noexcept;
+
+    //Source frames converted per pass; bounds how far one output block can reach into a sped-up source before splitting.
+    static constexpr std::size_t scratch_frames = 4096u;
+
+    std::unique_ptr<IAudioOutput> m_output{};
+    AudioMixerFormat m_format{};
+    std::vector<Voice> m_voices{};
+    std::vector<float> m_scratch{};
+    std::vector<Command> m_command_batch{};
+    MpscQueue<Command> m_commands;
+    SpscRingBuffer<VoiceId> m_finished;
+    std::jthread m_thread{};
+    std::atomic<VoiceId> m_next_voice_id{invalid_voice};
+    std::atomic<std::size_t> m_playing_voices{0u};
+    std::atomic_bool m_running{false};
+    std::atomic_bool m_suspended{false};
+};
@@ -0,0 +1,137 @@
+#include "Engine/Audio/AudioOutput.hpp"
+
+#include "Engine/Audio/AudioSampleConversion.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace {
+
+//Sleeps until the next block is due, in slices short enough to notice a stop request promptly.
+bool WaitUntilBlockDue(std::chrono::steady_clock::time_point& next_block, std::chrono::nanoseconds block_duration, std::stop_token& stopToken) noexcept {
+    constexpr auto max_slice = std::chrono::milliseconds{5};
+    for(;;) {
+        if(stopToken.stop_requested()) {
+            return false;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if(now >= next_block) {
+            break;
+        }
+        std::this_thread::sleep_for((std::min)(std::chrono::duration_cast<std::chrono::nanoseconds>(next_block - now), std::chrono::nanoseconds{max_slice}));
+    }
+    next_block += block_duration;
+    //After a stall (a debugger break, a suspended process) restart the schedule instead of racing to catch up.
+    if(const auto now = std::chrono::steady_clock::now(); next_block < now) {
+        next_block = now + block_duration;
+    }
+    return true;
+}
+
+template<typename T>
+void WriteValue(std::ostream& stream, const T& value) noexcept {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+NullAudioOutput::NullAudioOutput(AudioOutputPacing pacing /*= AudioOutputPacing::RealTime*/) noexcept
+: m_pacing(pacing) {
+    /* DO NOTHING */
+}
+
+bool NullAudioOutput::Open(const AudioMixerFormat& format) noexcept {
+    m_format = format;
+    m_next_block = std::chrono::steady_clock::now();
+    m_blocks_submitted = 0u;
+    return true;
+}
+
+bool NullAudioOutput::WaitForBlock(std::stop_token stopToken) noexcept {
+    if(m_pacing == AudioOutputPacing::Unthrottled) {
+        return !stopToken.stop_requested();
+    }
+    return WaitUntilBlockDue(m_next_block, m_format.GetBlockDuration(), stopToken);
+}
+
+void NullAudioOutput::SubmitBlock([[maybe_unused]] std::span<const float> samples) noexcept {
+    ++m_blocks_submitted;
+}
+
+void NullAudioOutput::Close() noexcept {
+    /* DO NOTHING */
+}
+
+std::uint64_t NullAudioOutput::GetBlocksSubmitted() const noexcept {
+    return m_blocks_submitted;
+}
+
+WavFileAudioOutput::WavFileAudioOutput(std::filesystem::path filepath, AudioOutputPacing pacing /*= AudioOutputPacing::RealTime*/) noexcept
+: m_filepath(std::move(filepath))
+, m_pacing(pacing) {
+    /* DO NOTHING */
+}
+
+WavFileAudioOutput::~WavFileAudioOutput() noexcept {
+    Close();
+}
+
+bool WavFileAudioOutput::Open(const AudioMixerFormat& format) noexcept {
+    m_format = format;
+    m_stream.open(m_filepath, std::ios_base::binary | std::ios_base::trunc);
+    if(!m_stream.is_open()) {
+        return false;
+    }
+    m_data_bytes = 0u;
+    m_pcm.resize(format.GetBlockSampleCount());
+    WriteHeader(0u);
+    m_next_block = std::chrono::steady_clock::now();
+    return static_cast<bool>(m_stream);
+}
+
+bool WavFileAudioOutput::WaitForBlock(std::stop_token stopToken) noexcept {
+    if(m_pacing == AudioOutputPacing::Unthrottled) {
+        return !stopToken.stop_requested();
+    }
+    return WaitUntilBlockDue(m_next_block, m_format.GetBlockDuration(), stopToken);
+}
+
+void WavFileAudioOutput::SubmitBlock(std::span<const float> samples) noexcept {
+    if(!m_stream.is_open()) {
+        return;
+    }
+    m_pcm.resize(samples.size());
+    AudioSampleConversion::FloatToInt16(samples.data(), m_pcm.data(), samples.size());
+    const auto bytes = static_cast<std::uint32_t>(m_pcm.size() * sizeof(std::int16_t));
+    m_stream.write(reinterpret_cast<const char*>(m_pcm.data()), bytes);
+    m_data_bytes += bytes;
+}
+
+void WavFileAudioOutput::Close() noexcept {
+    if(!m_stream.is_open()) {
+        return;
+    }
+    m_stream.seekp(0);
+    WriteHeader(m_data_bytes);
+    m_stream.close();
+}
+
+void WavFileAudioOutput::WriteHeader(std::uint32_t dataBytes) noexcept {
+    constexpr std::uint16_t pcm_format_id = 1u;
+    constexpr std::uint16_t bits_per_sample = 16u;
+    const auto channel_count = static_cast<std::uint16_t>(m_format.channel_count);
+    const auto block_align = static_cast<std::uint16_t>(channel_count * bits_per_sample / 8u);
+    m_stream.write("RIFF", 4);
+    WriteValue(m_stream, static_cast<std::uint32_t>(36u + dataBytes));
+    m_stream.write("WAVEfmt ", 8);
+    WriteValue(m_stream, std::uint32_t{16u});
+    WriteValue(m_stream, pcm_format_id);
+    WriteValue(m_stream, channel_count);
+    WriteValue(m_stream, m_format.sample_rate);
+    WriteValue(m_stream, static_cast<std::uint32_t>(m_format.sample_rate * block_align));
+    WriteValue(m_stream, block_align);
+    WriteValue(m_stream, bits_per_sample);
+    m_stream.write("data", 4);
+    WriteValue(m_stream, dataBytes);
+}
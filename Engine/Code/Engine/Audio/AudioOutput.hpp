@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stop_token>
+#include <vector>
+
+//What the mixer produces: interleaved 32-bit float frames, block_frames at a time.
+struct AudioMixerFormat {
+    std::uint32_t sample_rate{48000u};
+    std::uint32_t channel_count{2u};
+    std::uint32_t block_frames{480u}; //10 ms at 48 kHz.
+
+    [[nodiscard]] std::size_t GetBlockSampleCount() const noexcept {
+        return static_cast<std::size_t>(block_frames) * channel_count;
+    }
+    [[nodiscard]] std::chrono::nanoseconds GetBlockDuration() const noexcept {
+        return std::chrono::nanoseconds{std::chrono::seconds{block_frames}} / sample_rate;
+    }
+};
+
+//Where mixed blocks go. AudioMixer calls every method from its own thread, in the order
+//Open, then WaitForBlock/SubmitBlock pairs, then Close.
+class IAudioOutput {
+public:
+    virtual ~IAudioOutput() noexcept = default;
+
+    //Returns false if the device cannot play format; the mixer then does not start.
+    [[nodiscard]] virtual bool Open(const AudioMixerFormat& format) noexcept = 0;
+    //Blocks until the device can take another block. Returns false once stopToken is triggered.
+    [[nodiscard]] virtual bool WaitForBlock(std::stop_token stopToken) noexcept = 0;
+    //samples is exactly one block, format.GetBlockSampleCount() long.
+    virtual void SubmitBlock(std::span<const float> samples) noexcept = 0;
+    virtual void Close() noexcept = 0;
+
+protected:
+private:
+};
+
+// clang-format off
+enum class AudioOutputPacing {
+    RealTime     //Asks for a block every block duration, like a sound card would.
+    ,Unthrottled //Asks for blocks as fast as the mixer can fill them. For offline rendering and benchmarks.
+};
+// clang-format on
+
+//Discards every block. Lets audio run on machines with no sound device, such as headless test runs.
+class NullAudioOutput : public IAudioOutput {
+public:
+    explicit NullAudioOutput(AudioOutputPacing pacing = AudioOutputPacing::RealTime) noexcept;
+
+    [[nodiscard]] bool Open(const AudioMixerFormat& format) noexcept override;
+    [[nodiscard]] bool WaitForBlock(std::stop_token stopToken) noexcept override;
+    void SubmitBlock(std::span<const float> samples) noexcept override;
+    void Close() noexcept override;
+
+    [[nodiscard]] std::uint64_t GetBlocksSubmitted() const noexcept;
+
+protected:
+private:
+    AudioMixerFormat m_format{};
+    AudioOutputPacing m_pacing{AudioOutputPacing::RealTime};
+    std::chrono::steady_clock::time_point m_next_block{};
+    std::uint64_t m_blocks_submitted{0u};
+};
+
+//Writes every block to a 16-bit PCM .wav file, so a test can compare what was heard against a reference.
+class WavFileAudioOutput : public IAudioOutput {
+public:
+    explicit WavFileAudioOutput(std::filesystem::path filepath, AudioOutputPacing pacing = AudioOutputPacing::RealTime) noexcept;
+    ~WavFileAudioOutput() noexcept;
+
+    [[nodiscard]] bool Open(const AudioMixerFormat& format) noexcept override;
+    [[nodiscard]] bool WaitForBlock(std::stop_token stopToken) noexcept override;
+    void SubmitBlock(std::span<const float> samples) noexcept override;
+    //Fills in the RIFF and data chunk sizes; the file is not a valid .wav until this runs.
+    void Close() noexcept override;
+
+protected:
+private:
+    void WriteHeader(std::uint32_t dataBytes) noexcept;
+
+    std::filesystem::path m_filepath{};
+    std::ofstream m_stream{};
+    AudioMixerFormat m_format{};
+    AudioOutputPacing m_pacing{AudioOutputPacing::RealTime};
+    std::chrono::steady_clock::time_point m_next_block{};
+    std::vector<std::int16_t> m_pcm{};
+    std::uint32_t m_data_bytes{0u};
+};
+
@@ -0,0 +1,98 @@
+#include "Engine/Audio/AudioSampleConversion.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AUDIO_SAMPLE_CONVERSION_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace AudioSampleConversion {
+
+void UInt8ToFloat(const std::uint8_t* source, float* destination, std::size_t count) noexcept {
+    constexpr auto scale = 1.0f / 128.0f;
+    std::size_t i = 0u;
+#ifdef AUDIO_SAMPLE_CONVERSION_SSE2
+    const auto zero = _mm_setzero_si128();
+    const auto bias = _mm_set1_epi16(128);
+    const auto scale4 = _mm_set1_ps(scale);
+    for(; i + 16u <= count; i += 16u) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        const auto lo16 = _mm_sub_epi16(_mm_unpacklo_epi8(bytes, zero), bias);
+        const auto hi16 = _mm_sub_epi16(_mm_unpackhi_epi8(bytes, zero), bias);
+        //Sign-extends each 16-bit lane to 32 bits by placing it in the high half and shifting back down.
+        _mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(zero, lo16), 16)), scale4));
+        _mm_storeu_ps(destination + i + 4u, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(zero, lo16), 16)), scale4));
+        _mm_storeu_ps(destination + i + 8u, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(zero, hi16), 16)), scale4));
+        _mm_storeu_ps(destination + i + 12u, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(zero, hi16), 16)), scale4));
+    }
+#endif
+    for(; i < count; ++i) {
+        destination[i] = (static_cast<float>(source[i]) - 128.0f) * scale;
+    }
+}
+
+void Int16ToFloat(const std::int16_t* source, float* destination, std::size_t count) noexcept {
+    constexpr auto scale = 1.0f / 32768.0f;
+    std::size_t i = 0u;
+#ifdef AUDIO_SAMPLE_CONVERSION_SSE2
+    const auto zero = _mm_setzero_si128();
+    const auto scale4 = _mm_set1_ps(scale);
+    for(; i + 8u <= count; i += 8u) {
+        const auto words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(zero, words), 16)), scale4));
+        _mm_storeu_ps(destination + i + 4u, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(zero, words), 16)), scale4));
+    }
+#endif
+    for(; i < count; ++i) {
+        destination[i] = static_cast<float>(source[i]) * scale;
+    }
+}
+
+void Int24ToFloat(const std::uint8_t* source, float* destination, std::size_t count) noexcept {
+    //Three-byte lanes do not map onto SSE2 loads without a shuffle it lacks; the shift below is already cheap.
+    constexpr auto scale = 1.0f / 2147483648.0f;
+    for(std::size_t i = 0u; i < count; ++i) {
+        const auto* bytes = source + i * 3u;
+        const auto value = static_cast<std::int32_t>((static_cast<std::uint32_t>(bytes[0]) << 8u) | (static_cast<std::uint32_t>(bytes[1]) << 16u) | (static_cast<std::uint32_t>(bytes[2]) << 24u));
+        destination[i] = static_cast<float>(value) * scale;
+    }
+}
+
+void Int32ToFloat(const std::int32_t* source, float* destination, std::size_t count) noexcept {
+    constexpr auto scale = 1.0f / 2147483648.0f;
+    std::size_t i = 0u;
+#ifdef AUDIO_SAMPLE_CONVERSION_SSE2
+    const auto scale4 = _mm_set1_ps(scale);
+    for(; i + 4u <= count; i += 4u) {
+        const auto ints = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(ints), scale4));
+    }
+#endif
+    for(; i < count; ++i) {
+        destination[i] = static_cast<float>(source[i]) * scale;
+    }
+}
+
+void FloatToInt16(const float* source, std::int16_t* destination, std::size_t count) noexcept {
+    std::size_t i = 0u;
+#ifdef AUDIO_SAMPLE_CONVERSION_SSE2
+    const auto scale4 = _mm_set1_ps(32767.0f);
+    const auto lowest = _mm_set1_ps(-1.0f);
+    const auto highest = _mm_set1_ps(1.0f);
+    //Clamped before scaling: cvtps turns anything past the int32 range into INT_MIN, which packs would keep as full negative.
+    const auto convert = [&](const float* lane) { return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(lane), lowest), highest), scale4)); };
+    for(; i + 8u <= count; i += 8u) {
+        const auto lo = convert(source + i);
+        const auto hi = convert(source + i + 4u);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+    for(; i < count; ++i) {
+        const auto scaled = std::clamp(source[i], -1.0f, 1.0f) * 32767.0f;
+        destination[i] = static_cast<std::int16_t>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+    }
+}
+
+} // namespace AudioSampleConversion
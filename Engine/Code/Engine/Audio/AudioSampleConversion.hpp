@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+//Bulk conversions between the PCM sample formats .wav files use and the float samples the mixer works in.
+//Each handles any count; SSE2 does the bulk where the target has it and the tail is done one sample at a time.
+namespace AudioSampleConversion {
+
+void UInt8ToFloat(const std::uint8_t* source, float* destination, std::size_t count) noexcept;
+void Int16ToFloat(const std::int16_t* source, float* destination, std::size_t count) noexcept;
+//Packed little-endian, three bytes per sample.
+void Int24ToFloat(const std::uint8_t* source, float* destination, std::size_t count) noexcept;
+void Int32ToFloat(const std::int32_t* source, float* destination, std::size_t count) noexcept;
+//Saturates anything outside [-1, 1].
+void FloatToInt16(const float* source, std::int16_t* destination, std::size_t count) noexcept;
+
+} // namespace AudioSampleConversion
@@ -0,0 +1,204 @@
+#include "Engine/Audio/AudioStream.hpp"
+
+#include "Engine/Audio/AudioMixer.hpp"
+
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+
+std::shared_ptr<AudioStream> AudioStream::Open(std::filesystem::path filepath) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto info = FileUtils::detail::WavStreamInfo{};
+    if(FileUtils::Wav::LoadStreamInfo(filepath, info) != FileUtils::Wav::WAV_SUCCESS) {
+        return nullptr;
+    }
+    const auto bytes_per_frame = static_cast<std::uint32_t>(info.fmt.dataBlockSize);
+    if(bytes_per_frame == 0u || bytes_per_frame > block_bytes || info.dataLength < bytes_per_frame) {
+        return nullptr;
+    }
+    auto stream = std::shared_ptr<AudioStream>(new AudioStream());
+    stream->m_file.open(filepath, std::ios_base::binary);
+    if(!stream->m_file.is_open()) {
+        return nullptr;
+    }
+    stream->m_filepath = std::move(filepath);
+    stream->m_info = info;
+    stream->m_bytes_per_frame = bytes_per_frame;
+    stream->m_frame_count = info.dataLength / bytes_per_frame;
+    stream->m_frames_per_block = static_cast<std::uint32_t>(block_bytes / bytes_per_frame);
+    stream->m_blocks = std::make_unique<Block[]>(block_count);
+    return stream;
+}
+
+const FileUtils::detail::WavFormatChunk& AudioStream::GetFormatChunk() const noexcept {
+    return m_info.fmt;
+}
+
+std::uint32_t AudioStream::GetFrameCount() const noexcept {
+    return m_frame_count;
+}
+
+const std::filesystem::path& AudioStream::GetFilepath() const noexcept {
+    return m_filepath;
+}
+
+void AudioStream::Start(const AudioVoiceDesc& desc) noexcept {
+    const auto to_frames = [this](float seconds) {
+        return static_cast<std::uint32_t>((std::max)(0.0, static_cast<double>(seconds) * m_info.fmt.samplesPerSecond));
+    };
+    m_read_cursor = 0u;
+    m_has_loop = desc.loop_count > 0u;
+    m_loops_remaining = desc.loop_count;
+    m_stop_at_loop_end = desc.stop_at_loop_end;
+    m_loop_begin = (std::min)(to_frames(desc.loop_begin_seconds), m_frame_count - 1u);
+    m_loop_end = m_frame_count;
+    if(desc.loop_end_seconds > 0.0f) {
+        m_loop_end = std::clamp(to_frames(desc.loop_end_seconds), m_loop_begin + 1u, m_frame_count);
+    }
+    if(auto* js = ServiceLocator::get<IJobSystemService>(); !js || !js->IsRunning()) {
+        //Start runs on the thread asking to play, never the mixer's, so this is the one place a read may block.
+        m_fill_scheduled.store(true, std::memory_order_relaxed);
+        Fill();
+        return;
+    }
+    RequestFill();
+}
+
+std::size_t AudioStream::GetBufferedFrameCount() const noexcept {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    std::size_t frames = 0u;
+    for(auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+        frames += m_blocks[head % block_count].frame_count;
+    }
+    return frames;
+}
+
+bool AudioStream::IsEndOfStream() const noexcept {
+    return m_end_of_stream.load(std::memory_order_acquire);
+}
+
+bool AudioStream::IsPrimed() const noexcept {
+    return m_tail.load(std::memory_order_acquire) != 0u;
+}
+
+const std::uint8_t* AudioStream::GetFrames(std::size_t first, std::size_t& count) const noexcept {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    for(auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+        const auto& block = m_blocks[head % block_count];
+        if(first < block.frame_count) {
+            count = (std::min)(count, block.frame_count - first);
+            return block.bytes.data() + first * m_bytes_per_frame;
+        }
+        first -= block.frame_count;
+    }
+    count = 0u;
+    return nullptr;
+}
+
+std::size_t AudioStream::ReleaseFramesBefore(std::size_t frame) noexcept {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    auto head = m_head.load(std::memory_order_relaxed);
+    std::size_t released = 0u;
+    while(head != tail) {
+        const auto block_frames = m_blocks[head % block_count].frame_count;
+        if(released + block_frames > frame) {
+            break;
+        }
+        released += block_frames;
+        ++head;
+    }
+    if(released != 0u) {
+        m_head.store(head, std::memory_order_release);
+        RequestFill();
+    }
+    return released;
+}
+
+void AudioStream::RequestFill() noexcept {
+    if(m_fill_scheduled.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    if(!js || !js->IsRunning()) {
+        //Refills are requested from the mixer thread, which must not wait on the disk. With nowhere to run the
+        //read, end the stream after the frames already buffered instead of stalling the voice forever.
+        //m_fill_scheduled stays set so nothing asks again.
+        m_end_of_stream.store(true, std::memory_order_release);
+        return;
+    }
+    //The job keeps the stream alive if its voice is stopped while a read is in flight.
+    js->Run(JobType::Io, [stream = shared_from_this()](void*) { stream->Fill(); }, nullptr);
+}
+
+void AudioStream::Fill() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    for(;;) {
+        while(FillNextBlock()) {
+            /* DO NOTHING */
+        }
+        m_fill_scheduled.store(false, std::memory_order_release);
+        //A block released after the last FillNextBlock but before the flag cleared did not schedule a fill; take it now.
+        if(IsEndOfStream() || !HasFreeBlock()) {
+            return;
+        }
+        if(m_fill_scheduled.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+}
+
+bool AudioStream::FillNextBlock() noexcept {
+    if(IsEndOfStream() || !HasFreeBlock()) {
+        return false;
+    }
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    auto& block = m_blocks[tail % block_count];
+    block.frame_count = 0u;
+    //Keep reading across loop seams until the block is full, so even a very short loop fills whole blocks.
+    while(block.frame_count < m_frames_per_block) {
+        const bool looping = m_loops_remaining > 0u;
+        const auto region_end = (looping || (m_has_loop && m_stop_at_loop_end)) ? m_loop_end : m_frame_count;
+        if(m_read_cursor >= region_end) {
+            if(!looping) {
+                break;
+            }
+            m_read_cursor = m_loop_begin;
+            if(m_loops_remaining != AudioVoiceDesc::infinite_loops) {
+                --m_loops_remaining;
+            }
+            continue;
+        }
+        const auto frames = (std::min)(m_frames_per_block - block.frame_count, region_end - m_read_cursor);
+        m_file.seekg(static_cast<std::streamoff>(m_info.dataOffset + static_cast<std::uint64_t>(m_read_cursor) * m_bytes_per_frame));
+        if(!m_file.read(reinterpret_cast<char*>(block.bytes.data() + block.frame_count * m_bytes_per_frame), static_cast<std::streamsize>(frames) * m_bytes_per_frame)) {
+            //A failed read ends the stream here rather than playing whatever the block held before.
+            m_file.clear();
+            break;
+        }
+        block.frame_count += frames;
+        m_read_cursor += frames;
+    }
+    const bool finished = block.frame_count < m_frames_per_block;
+    if(block.frame_count != 0u) {
+        m_tail.store(tail + 1u, std::memory_order_release);
+    }
+    if(finished) {
+        //Set after the last block is published, so a reader that sees the end also sees every frame.
+        m_end_of_stream.store(true, std::memory_order_release);
+        return false;
+    }
+    return true;
+}
+
+bool AudioStream::HasFreeBlock() const noexcept {
+    return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_acquire) < block_count;
+}
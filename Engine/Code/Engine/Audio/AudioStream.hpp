@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Engine/Audio/Wav.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+struct AudioVoiceDesc;
+
+//Plays a .wav file from disk instead of from memory. Open reads only the header; samples are read on the Io job
+//category into a ring of block_count fixed-size blocks kept just ahead of the mixer, so a stream holds
+//GetResidentBytes() of sample data however long the file is.
+//Without a running job system only Start reads: the stream plays what that first fill holds and then ends,
+//since the mixer thread never reads from disk itself.
+//Loops are unrolled while the ring is filled. The mixer sees one unbroken run of frames, so loop seams play
+//without a gap. One stream feeds one voice: open the file again to play it twice at once.
+class AudioStream : public std::enable_shared_from_this<AudioStream> {
+public:
+    static constexpr std::size_t block_count = 4u;
+    static constexpr std::size_t block_bytes = 64u * 1024u; //About 370 ms of 16-bit stereo at 44.1 kHz.
+
+    //Returns nullptr if filepath cannot be read as a .wav file.
+    [[nodiscard]] static std::shared_ptr<AudioStream> Open(std::filesystem::path filepath) noexcept;
+
+    AudioStream(const AudioStream& other) = delete;
+    AudioStream(AudioStream&& other) = delete;
+    AudioStream& operator=(const AudioStream& other) = delete;
+    AudioStream& operator=(AudioStream&& other) = delete;
+    ~AudioStream() noexcept = default;
+
+    [[nodiscard]] const FileUtils::detail::WavFormatChunk& GetFormatChunk() const noexcept;
+    [[nodiscard]] std::uint32_t GetFrameCount() const noexcept;
+    [[nodiscard]] const std::filesystem::path& GetFilepath() const noexcept;
+    [[nodiscard]] static constexpr std::size_t GetResidentBytes() noexcept;
+
+    //Takes the loop settings from desc and starts filling the ring. Call once, before the mixer reads anything.
+    //Fills the ring on the calling thread when no job system is running.
+    void Start(const AudioVoiceDesc& desc) noexcept;
+
+    //The rest is called from the mixer thread only. Frame numbers count from the oldest frame still buffered.
+
+    //Frames ready to read. Check IsEndOfStream first: once it is true the count stops growing.
+    [[nodiscard]] std::size_t GetBufferedFrameCount() const noexcept;
+    [[nodiscard]] bool IsEndOfStream() const noexcept;
+    //True once the first block has been read. Until then an empty ring means the read is still in flight, not that the mixer fell behind.
+    [[nodiscard]] bool IsPrimed() const noexcept;
+    //Points at frame first and shrinks count to the frames stored contiguously from there.
+    [[nodiscard]] const std::uint8_t* GetFrames(std::size_t first, std::size_t& count) const noexcept;
+    //Gives back every block that ends at or before frame and queues a refill. Returns how many frames were
+    //dropped; every frame number shifts down by that much.
+    [[nodiscard]] std::size_t ReleaseFramesBefore(std::size_t frame) noexcept;
+
+protected:
+private:
+    struct Block {
+        std::array<std::uint8_t, block_bytes> bytes{};
+        std::uint32_t frame_count{0u};
+    };
+
+    AudioStream() noexcept = default;
+
+    void RequestFill() noexcept;
+    void Fill() noexcept;
+    [[nodiscard]] bool FillNextBlock() noexcept;
+    [[nodiscard]] bool HasFreeBlock() const noexcept;
+
+    std::filesystem::path m_filepath{};
+    FileUtils::detail::WavStreamInfo m_info{};
+    std::ifstream m_file{};
+    std::unique_ptr<Block[]> m_blocks{};
+    std::uint32_t m_bytes_per_frame{1u};
+    std::uint32_t m_frame_count{0u};
+    std::uint32_t m_frames_per_block{1u};
+    //Read position and loop state. Only the thread running Fill touches these.
+    std::uint32_t m_read_cursor{0u};
+    std::uint32_t m_loops_remaining{0u};
+    std::uint32_t m_loop_begin{0u};
+    std::uint32_t m_loop_end{0u};
+    bool m_has_loop{false};
+    bool m_stop_at_loop_end{false};
+    //Free-running block counters: Fill publishes at the tail, the mixer retires at the head.
+    alignas(64) std::atomic<std::size_t> m_tail{0u};
+    alignas(64) std::atomic<std::size_t> m_head{0u};
+    std::atomic_bool m_end_of_stream{false};
+    std::atomic_bool m_fill_scheduled{false};
+};
+
+constexpr std::size_t AudioStream::GetResidentBytes() noexcept {
+    return block_count * sizeof(Block);
+}
+
+//The ring is all the sample memory a stream owns; each block only adds its frame count.
+static_assert(AudioStream::GetResidentBytes() <= AudioStream::block_count * (AudioStream::block_bytes + 64u));
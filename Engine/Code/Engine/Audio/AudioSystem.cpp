@@ -3,11 +3,13 @@
 #include "Engine/Audio/Wav.hpp"
 #include "Engine/Audio/Audio3DEmitter.hpp"
 #include "Engine/Audio/Audio3DListener.hpp"
+#include "Engine/Audio/AudioOutput.hpp"
+#include "Engine/Audio/AudioStream.hpp"
+#include "Engine/Audio/XAudio2AudioOutput.hpp"
 
 #include "Engine/Core/BuildConfig.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
-#include "Engine/Core/ThreadUtils.hpp"
 
 #include "Engine/Input/InputSystem.hpp"
 
@@ -19,42 +21,26 @@
 #include <algorithm>
 #include <format>
 
-void AudioSystem::EmitterListenerDSP_worker() noexcept {
-    while(IsRunning()) {
-        static thread_local auto updateAudioThisFrame = uint8_t{0u};
-        std::unique_lock<std::mutex> lock(m_cs);
-        //Condition to wake up: not running or should update this frame.
-        m_signal.wait(lock, [this]() -> bool { return !m_is_running || !!updateAudioThisFrame; });
-        if(!!updateAudioThisFrame) {
-            for(auto& active : m_active_channels) {
-                for(auto& emitter : m_emitters) {
-                    for(auto& listener : m_listeners) {
-                        //const auto old_freq = active->GetFrequency();
-                        auto dsp = CalculateDSP(*emitter, *listener, m_dsp_settings);
-                        active->SetDSPSettings(dsp);
-                    }
-                }
-            }
-        }
-        ++updateAudioThisFrame;
-        updateAudioThisFrame &= 1;
-    }
-}
+namespace {
 
-bool AudioSystem::IsRunning() const noexcept {
-    bool running = false;
-    {
-        std::scoped_lock<std::mutex> lock(m_cs);
-        running = m_is_running;
-    }
-    return running;
+//Smallest playback rate a channel accepts, matching what XAudio2 allowed before the software mixer.
+constexpr float min_channel_frequency = 1.0f / 1024.0f;
+
+std::unique_ptr<IAudioOutput> CreateDefaultAudioOutput() noexcept {
+#if defined(PLATFORM_WINDOWS)
+    return std::make_unique<XAudio2AudioOutput>();
+#else
+    return std::make_unique<NullAudioOutput>();
+#endif
 }
 
+} // namespace
+
 AudioSystem::AudioSystem() noexcept
 : EngineSubsystem()
 , IAudioService()
 {
-    InitializeAudioSystem();
+    InitializeAudioSystem(CreateDefaultAudioOutput());
 }
 
 AudioSystem::AudioSystem(std::size_t max_channels) noexcept
@@ -62,26 +48,23 @@ AudioSystem::AudioSystem(std::size_t max_channels) noexcept
 , IAudioService()
 , m_max_channels(max_channels)
 {
-    InitializeAudioSystem();
+    InitializeAudioSystem(CreateDefaultAudioOutput());
 }
 
-AudioSystem::~AudioSystem() noexcept {
-    m_is_running = false;
-    m_signal.notify_one();
+AudioSystem::AudioSystem(std::size_t max_channels, std::unique_ptr<IAudioOutput> output) noexcept
+: EngineSubsystem()
+, IAudioService()
+, m_max_channels(max_channels)
+{
+    InitializeAudioSystem(std::move(output));
+}
 
-    m_dsp_thread.join();
+AudioSystem::~AudioSystem() noexcept {
+    //The mixer reads straight out of the loaded .wav data, so it has to stop before any of it is freed.
+    m_mixer->Stop();
 
     for(auto& channel : m_active_channels) {
-        channel->Stop();
-    }
-
-    {
-        bool done_cleanup = false;
-        do {
-            std::this_thread::yield();
-            std::scoped_lock<std::mutex> lock(m_cs);
-            done_cleanup = m_active_channels.empty();
-        } while(!done_cleanup);
+        channel->Detach();
     }
 
     m_active_channels.clear();
@@ -93,51 +76,21 @@ AudioSystem::~AudioSystem() noexcept {
     m_sounds.clear();
     m_wave_files.clear();
 
-    if(m_master_voice) {
-        m_master_voice->DestroyVoice();
-        m_master_voice = nullptr;
-    }
-
-    if(m_xaudio2) {
-        m_xaudio2->UnregisterForCallbacks(&m_engine_callback);
-
-        m_xaudio2->Release();
-        m_xaudio2 = nullptr;
-    }
-
-    ::CoUninitialize();
+    m_mixer.reset();
 }
 
-void AudioSystem::InitializeAudioSystem() noexcept {
-    bool co_init_succeeded = SUCCEEDED(::CoInitializeEx(nullptr, COINIT_MULTITHREADED));
-    GUARANTEE_OR_DIE(co_init_succeeded, "Failed to setup Audio System.");
-    bool xaudio2_create_succeeded = SUCCEEDED(::XAudio2Create(&m_xaudio2));
-    GUARANTEE_OR_DIE(xaudio2_create_succeeded, "Failed to create Audio System.");
+void AudioSystem::InitializeAudioSystem(std::unique_ptr<IAudioOutput> output) noexcept {
+    GUARANTEE_OR_DIE(output != nullptr, "Failed to setup Audio System.");
+    m_mixer = std::make_unique<AudioMixer>(std::move(output), AudioMixerFormat{}, m_max_channels);
 }
 
 void AudioSystem::Initialize() noexcept {
-#ifdef AUDIO_DEBUG
-    XAUDIO2_DEBUG_CONFIGURATION config{};
-    config.LogFileline = true;
-    config.LogFunctionName = true;
-    config.LogThreadID = true;
-    config.LogTiming = true;
-    config.BreakMask = XAUDIO2_LOG_WARNINGS;
-    config.TraceMask = XAUDIO2_LOG_DETAIL | XAUDIO2_LOG_WARNINGS | XAUDIO2_LOG_FUNC_CALLS;
-    m_xaudio2->SetDebugConfiguration(&config);
-#endif
-    m_xaudio2->CreateMasteringVoice(&m_master_voice);
-
-    XAUDIO2_VOICE_DETAILS details{};
-    m_master_voice->GetVoiceDetails(&details);
-    m_input_channels = details.InputChannels;
-
-    DebuggerPrintf(std::format("Mastering voice expects {} input channels.\n", details.InputChannels));
-
-    DWORD dwChannelMask;
-    m_master_voice->GetChannelMask(&dwChannelMask);
-
-    ::X3DAudioInitialize(dwChannelMask, X3DAUDIO_SPEED_OF_SOUND, m_x3daudio);
+    if(!m_mixer->Start()) {
+        //No usable device: keep mixing into a null output so the game, and everything that times itself off audio, still runs.
+        DebuggerPrintf("Audio output could not be opened. Continuing without sound.\n");
+        m_mixer = std::make_unique<AudioMixer>(std::make_unique<NullAudioOutput>(), AudioMixerFormat{}, m_max_channels);
+        (void)m_mixer->Start();
+    }
 
     m_idle_channels.reserve(m_max_channels);
     m_active_channels.reserve(m_max_channels);
@@ -151,44 +104,13 @@ void AudioSystem::Initialize() noexcept {
     fmt.bitsPerSample = 16;
     SetFormat(fmt);
 
-    SetEngineCallback(&m_engine_callback);
-    m_is_running = true;
-
-    m_dsp_thread = std::thread(&AudioSystem::EmitterListenerDSP_worker, this);
-    ThreadUtils::SetThreadDescription(m_dsp_thread, std::string{"AudioSystem Updater"});
-
     for(std::size_t i = 0; i < m_max_channels; ++i) {
         m_idle_channels.push_back(std::make_unique<Channel>(*this, AudioSystem::Channel::ChannelDesc{this}));
     }
 }
 
-const std::atomic_uint32_t& AudioSystem::GetOperationSetId() const noexcept {
-    return m_operationID;
-}
-const std::atomic_uint32_t& AudioSystem::IncrementAndGetOperationSetId() noexcept {
-    IncrementOperationSetId();
-    return GetOperationSetId();
-}
-
-void AudioSystem::IncrementOperationSetId() noexcept {
-    m_operationID++;
-}
-
-void AudioSystem::SubmitDeferredOperation(uint32_t operationSetId) noexcept {
-    m_xaudio2->CommitChanges(operationSetId);
-}
-
-void AudioSystem::SetEngineCallback(EngineCallback* callback) noexcept {
-    if(&m_engine_callback == callback) {
-        return;
-    }
-    m_xaudio2->UnregisterForCallbacks(&m_engine_callback);
-    m_engine_callback = *callback;
-    m_xaudio2->RegisterForCallbacks(&m_engine_callback);
-}
-
-const WAVEFORMATEXTENSIBLE& AudioSystem::GetFormat() const noexcept {
-    return m_audio_format_ex;
+const FileUtils::detail::WavFormatChunk& AudioSystem::GetFormat() const noexcept {
+    return m_format;
 }
 
 FileUtils::detail::WavFormatChunk AudioSystem::GetLoadedWavFileFormat() const noexcept {
@@ -199,38 +121,8 @@ FileUtils::detail::WavFormatChunk AudioSystem::GetLoadedWavFileFormat() const no
     return m_wave_files.begin()->second->GetFormatChunk();
 }
 
-AudioDSPResults AudioSystem::CalculateDSP(const Audio3DEmitter& emitter, const Audio3DListener& listener, const AudioDSPSettings& settings) const noexcept {
-    X3DAUDIO_EMITTER x3daudio_emitter{};
-    X3DAUDIO_CONE emitter_cone{};
-    if(const auto is_emitter_omniDirectional = emitter.IsOmniDirectional(); is_emitter_omniDirectional) {
-        emitter_cone = GetDefaultOmniDirectionalX3DAudioCone();
-    } else {
-        emitter_cone = Audio3DConeToX3DAudioCone(emitter.Get3DCone());
-    }
-    x3daudio_emitter.pCone = &emitter_cone;
-
-    const auto& x3daudio_listener = listener.GetX3DAudioListener();
-
-    uint32_t flags = AudioDSPSettingsToX3DAudioDSPFlags(settings);
-
-    X3DAUDIO_DSP_SETTINGS dsp_settings{};
-    dsp_settings.pMatrixCoefficients = settings.use_matrix_table ? new float[m_input_channels * m_max_channels] : nullptr;
-    dsp_settings.pDelayTimes = settings.use_delay_array && m_input_channels > 1 ? new float[m_max_channels] : nullptr;
-    dsp_settings.SrcChannelCount = 1;
-    dsp_settings.DstChannelCount = m_input_channels * static_cast<uint32_t>(m_max_channels);
-
-    ::X3DAudioCalculate(m_x3daudio, &x3daudio_listener, &x3daudio_emitter, flags, &dsp_settings);
-    
-    AudioDSPResults results{};
-    results.dopplerFactor = dsp_settings.DopplerFactor;
-    results.emitterToListenerAngleRadians = dsp_settings.EmitterToListenerAngle;
-    results.emitterToListenerDistance = dsp_settings.EmitterToListenerDistance;
-    results.emitterVelocityComponent = dsp_settings.EmitterVelocityComponent;
-    results.lowPassFilterDirectCoefficient = dsp_settings.LPFDirectCoefficient;
-    results.lowPassFilterReverbCoefficient = dsp_settings.LPFReverbCoefficient;
-    results.pMatrixCoefficients = &dsp_settings.pMatrixCoefficients;
-
-    return results;
+AudioMixer& AudioSystem::GetMixer() noexcept {
+    return *m_mixer;
 }
 
 void AudioSystem::BeginFrame() noexcept {
@@ -238,7 +130,36 @@ void AudioSystem::BeginFrame() noexcept {
 }
 
 void AudioSystem::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noexcept {
-    /* DO NOTHING */
+    ReleaseFinishedChannels();
+    UpdateChannelPanning();
+}
+
+void AudioSystem::ReleaseFinishedChannels() noexcept {
+    auto finished = AudioMixer::invalid_voice;
+    while(m_mixer->TryPopFinishedVoice(finished)) {
+        auto* channel = [&]() -> Channel* {
+            std::scoped_lock<std::mutex> lock(m_cs);
+            const auto found = std::find_if(std::begin(m_active_channels), std::end(m_active_channels), [finished](const std::unique_ptr<Channel>& c) { return c->GetVoiceId() == finished; });
+            return found != std::end(m_active_channels) ? found->get() : nullptr;
+        }(); //IIIL
+        if(channel) {
+            channel->Detach();
+            DeactivateChannel(*channel);
+        }
+    }
+}
+
+void AudioSystem::UpdateChannelPanning() noexcept {
+    if(m_listeners.empty()) {
+        return;
+    }
+    const auto& listener = *m_listeners.front();
+    std::scoped_lock<std::mutex> lock(m_cs);
+    for(const auto& channel : m_active_channels) {
+        if(const auto* emitter = channel->GetEmitter(); emitter != nullptr) {
+            m_mixer->SetVoicePan(channel->GetVoiceId(), AudioMixer::CalculatePan(*emitter, listener));
+        }
+    }
 }
 
 void AudioSystem::Render() const noexcept {
@@ -254,24 +175,15 @@ bool AudioSystem::ProcessSystemMessage(const EngineMessage& /*msg*/) noexcept {
 }
 
 void AudioSystem::SuspendAudio() noexcept {
-    if(m_xaudio2) {
-        m_xaudio2->StopEngine();
-    }
+    m_mixer->SetSuspended(true);
 }
 
 void AudioSystem::ResumeAudio() noexcept {
-    if(m_xaudio2) {
-        m_xaudio2->StartEngine();
-    }
-}
-
-void AudioSystem::SetFormat(const WAVEFORMATEXTENSIBLE& format) noexcept {
-    m_audio_format_ex = format;
+    m_mixer->SetSuspended(false);
 }
 
 void AudioSystem::SetFormat(const FileUtils::detail::WavFormatChunk& format) noexcept {
-    auto* fmt_buffer = reinterpret_cast<const unsigned char*>(&format);
-    std::memcpy(&m_audio_format_ex, fmt_buffer, sizeof(m_audio_format_ex));
+    m_format = format;
 }
 
 void AudioSystem::RegisterWavFilesFromFolder(std::filesystem::path folderpath, bool recursive /*= false*/) noexcept {
@@ -305,6 +217,9 @@ void AudioSystem::DeactivateChannel(Channel& channel) noexcept {
     std::scoped_lock<std::mutex> lock(m_cs);
     const auto found_iter = std::find_if(std::begin(m_active_channels), std::end(m_active_channels),
                                          [&channel](const std::unique_ptr<Channel>& c) { return c.get() == &channel; });
+    if(found_iter == std::end(m_active_channels)) {
+        return;
+    }
     m_idle_channels.push_back(std::move(*found_iter));
     m_active_channels.erase(found_iter);
 }
@@ -323,7 +238,14 @@ void AudioSystem::Play(Sound& snd, SoundDesc desc /* = SoundDesc{}*/) noexcept {
     inserted_channel->SetLoopCount(desc.loopCount < 0 ? -1 : desc.loopCount);
     inserted_channel->SetStopWhenFinishedLooping(desc.stopWhenFinishedLooping);
     inserted_channel->SetVolume(desc.volume);
+    inserted_channel->SetEmitter(desc.emitter);
     inserted_channel->Play(snd);
+    //The mixer turns away formats it cannot read; hand the channel straight back.
+    if(inserted_channel->GetVoiceId() == AudioMixer::invalid_voice) {
+        inserted_channel->Detach();
+        m_idle_channels.push_back(std::move(inserted_channel));
+        m_active_channels.pop_back();
+    }
 }
 
 void AudioSystem::Play(std::filesystem::path filepath, SoundDesc desc /*= SoundDesc{}*/) noexcept {
@@ -355,14 +277,12 @@ void AudioSystem::Play(const std::size_t id, const bool looping) noexcept {
     Play(m_sounds[id].first, desc);
 }
 
-void AudioSystem::SetDSPSettings(const AudioDSPSettings& newSettings) noexcept {
-    m_dsp_settings = newSettings;
-}
-
 void AudioSystem::Stop(const std::filesystem::path& filepath) noexcept {
     const auto& found = std::find_if(std::cbegin(m_sounds), std::cend(m_sounds), [&filepath](const auto& snd) { return snd.first == filepath; });
     if(found != std::cend(m_sounds)) {
-        for(auto& channel : found->second->GetChannels()) {
+        //Stopping a channel removes it from the sound's list, so walk a copy.
+        const auto channels = found->second->GetChannels();
+        for(auto* channel : channels) {
             channel->Stop();
             DeactivateChannel(*channel);
         }
@@ -370,18 +290,23 @@ void AudioSystem::Stop(const std::filesystem::path& filepath) noexcept {
 }
 
 void AudioSystem::Stop(const std::size_t id) noexcept {
+    if(id >= m_active_channels.size()) {
+        return;
+    }
     auto& channel = m_active_channels[id];
     channel->Stop();
     DeactivateChannel(*channel);
 }
 
 void AudioSystem::StopAll() noexcept {
-    const auto& op_id = IncrementAndGetOperationSetId();
+    //One mixer command stops everything in the same block.
+    m_mixer->StopAllVoices();
+    std::scoped_lock<std::mutex> lock(m_cs);
     for(auto& active_sound : m_active_channels) {
-        active_sound->Stop(op_id);
-        DeactivateChannel(*active_sound);
+        active_sound->Detach();
+        m_idle_channels.push_back(std::move(active_sound));
     }
-    SubmitDeferredOperation(op_id);
+    m_active_channels.clear();
 }
 
 AudioSystem::Sound* AudioSystem::CreateSound(std::filesystem::path filepath) noexcept {
@@ -402,7 +327,7 @@ AudioSystem::Sound* AudioSystem::CreateSound(std::filesystem::path filepath) noe
         }
     }
     filepath.make_preferred();
-    const auto finder = [&filepath](const auto& a) { return a.first == filepath; };
+    const auto finder = [&filepath](const auto& a) { return a.first == filepath && !a.second->IsStreamed(); };
     auto found_iter = std::find_if(std::begin(m_sounds), std::end(m_sounds), finder);
     if(found_iter == m_sounds.end()) {
         m_sounds.emplace_back(std::make_pair(filepath, std::move(std::make_unique<Sound>(*this, filepath))));
@@ -432,6 +357,33 @@ AudioSystem::Sound* AudioSystem::CreateSoundInstance(std::filesystem::path filep
     return m_sounds.back().second.get();
 }
 
+AudioSystem::Sound* AudioSystem::CreateStreamingSound(std::filesystem::path filepath) noexcept {
+    namespace FS = std::filesystem;
+    if(!FS::exists(filepath)) {
+        auto* logger = ServiceLocator::get<IFileLoggerService>();
+        logger->LogErrorLine("Could not find file: " + filepath.string());
+        return nullptr;
+    }
+    {
+        std::error_code ec{};
+        filepath = FS::canonical(filepath, ec);
+        if(ec || !FileUtils::IsSafeReadPath(filepath)) {
+            auto* logger = ServiceLocator::get<IFileLoggerService>();
+            logger->LogErrorLine("File: " + filepath.string() + " is inaccessible.");
+            return nullptr;
+        }
+    }
+    filepath.make_preferred();
+    //Every play opens its own stream, so one streamed Sound per file is enough.
+    const auto finder = [&filepath](const auto& a) { return a.first == filepath && a.second->IsStreamed(); };
+    auto found_iter = std::find_if(std::begin(m_sounds), std::end(m_sounds), finder);
+    if(found_iter == m_sounds.end()) {
+        m_sounds.emplace_back(std::make_pair(filepath, std::make_unique<Sound>(*this, filepath, true)));
+        found_iter = std::prev(std::end(m_sounds));
+    }
+    return found_iter->second.get();
+}
+
 void AudioSystem::RegisterWavFile(std::filesystem::path filepath) noexcept {
     namespace FS = std::filesystem;
     if(!FS::exists(filepath)) {
@@ -487,137 +439,73 @@ void AudioSystem::Register3DAudioListener(Audio3DListener* listener) noexcept {
     m_listeners.emplace_back(listener);
 }
 
-void STDMETHODCALLTYPE AudioSystem::Channel::VoiceCallback::OnBufferEnd(void* pBufferContext) {
-    Channel& channel = *static_cast<Channel*>(pBufferContext);
-    channel.Stop();
-    channel.m_sound->RemoveChannel(&channel);
-    channel.m_sound = nullptr;
-    channel.m_audio_system->DeactivateChannel(channel);
-}
-
-void STDMETHODCALLTYPE AudioSystem::Channel::VoiceCallback::OnLoopEnd(void* pBufferContext) {
-    Channel& channel = *static_cast<Channel*>(pBufferContext);
-    if(channel.m_desc.stopWhenFinishedLooping && channel.m_desc.loop_count != XAUDIO2_LOOP_INFINITE) {
-        if(++channel.m_desc.repeat_count >= channel.m_desc.loop_count) {
-            channel.Stop();
-        }
-    }
-}
-
 AudioSystem::Channel::Channel(AudioSystem& audioSystem, const ChannelDesc& desc) noexcept
 : m_audio_system(&audioSystem)
 , m_desc{desc} {
-    static VoiceCallback vcb;
-    m_buffer.pContext = this;
-    auto* fmt = reinterpret_cast<const WAVEFORMATEX*>(&(m_audio_system->GetFormat()));
-    m_audio_system->m_xaudio2->CreateSourceVoice(&m_voice, fmt, 0, m_desc.frequency_max, &vcb);
-    //if(auto* group = _audio_system->GetChannelGroup(desc.groupName); group != nullptr) {
-    //    group->AddChannel(this);
-    //}
+    /* DO NOTHING */
 }
 
 AudioSystem::Channel::~Channel() noexcept {
-    if(m_voice) {
-        Stop();
-        m_voice->DestroyVoice();
-        m_voice = nullptr;
-    }
-}
-
-void AudioSystem::Channel::SetDSPSettings(AudioDSPResults& settings) {
-    if(this && m_voice) {
-        if(settings.pMatrixCoefficients && *settings.pMatrixCoefficients) {
-            m_voice->SetOutputMatrix(m_audio_system->m_master_voice, 1, m_audio_system->m_input_channels, *settings.pMatrixCoefficients);
-            delete[] *settings.pMatrixCoefficients;
-            *settings.pMatrixCoefficients = nullptr;
-        }
-        XAUDIO2_FILTER_PARAMETERS filterParameters{XAUDIO2_FILTER_TYPE::LowPassFilter, 2.0f * std::sin(MathUtils::M_1PI_6 * settings.lowPassFilterDirectCoefficient)};
-        m_voice->SetFilterParameters(&filterParameters);
-    }
-}
-
-void AudioSystem::Channel::SetDSPSettings(AudioDSPResults& settings, uint32_t operationSetId) {
-    if(m_voice) {
-        if(settings.pMatrixCoefficients && *settings.pMatrixCoefficients) {
-            m_voice->SetOutputMatrix(m_audio_system->m_master_voice, 1, m_audio_system->m_input_channels, *settings.pMatrixCoefficients, operationSetId);
-            delete[] *settings.pMatrixCoefficients;
-            *settings.pMatrixCoefficients = nullptr;
-        }
-        XAUDIO2_FILTER_PARAMETERS filterParameters{XAUDIO2_FILTER_TYPE::LowPassFilter, 2.0f * std::sin(MathUtils::M_1PI_6 * settings.lowPassFilterDirectCoefficient)};
-        m_voice->SetFilterParameters(&filterParameters, operationSetId);
-    }
+    Stop();
 }
 
 void AudioSystem::Channel::Play(Sound& snd) noexcept {
     snd.AddChannel(this);
     m_sound = &snd;
-    if(const auto* wav = snd.GetWav()) {
-        m_buffer.pAudioData = wav->GetDataBuffer();
-        m_buffer.AudioBytes = wav->GetDataBufferSize();
-        m_buffer.LoopCount = m_desc.loop_count;
-        m_buffer.LoopBegin = 0;
-        m_buffer.LoopLength = 0;
-        if(m_desc.loop_count) {
-            m_buffer.LoopBegin = m_desc.loop_beginSamples;
-            m_buffer.LoopLength = m_desc.loop_endSamples - m_desc.loop_beginSamples;
-        }
-        m_voice->Stop();
-        m_voice->FlushSourceBuffers();
-        m_voice->SubmitSourceBuffer(&m_buffer, nullptr);
-        m_voice->SetVolume(m_desc.volume);
-        m_voice->SetFrequencyRatio(m_desc.frequency);
-        m_voice->Start();
+    const auto* wav = snd.GetWav();
+    if(!wav && !snd.IsStreamed()) {
+        return;
     }
-}
-
-void AudioSystem::Channel::Play(Sound& snd, uint32_t operationSetId) noexcept {
-    snd.AddChannel(this);
-    m_sound = &snd;
-    if(const auto* wav = snd.GetWav()) {
-        m_buffer.pAudioData = wav->GetDataBuffer();
-        m_buffer.AudioBytes = wav->GetDataBufferSize();
-        m_buffer.LoopCount = m_desc.loop_count;
-        m_buffer.LoopBegin = 0;
-        m_buffer.LoopLength = 0;
-        if(m_desc.loop_count) {
-            m_buffer.LoopBegin = m_desc.loop_beginSamples;
-            m_buffer.LoopLength = m_desc.loop_endSamples - m_desc.loop_beginSamples;
-        }
-        m_voice->Stop();
-        m_voice->FlushSourceBuffers();
-        m_voice->SubmitSourceBuffer(&m_buffer, nullptr);
-        m_voice->SetVolume(m_desc.volume, operationSetId);
-        m_voice->SetFrequencyRatio(m_desc.frequency, operationSetId);
-        m_voice->Start(0, operationSetId);
+    AudioVoiceDesc voice_desc{};
+    voice_desc.volume = m_desc.volume;
+    voice_desc.frequency = m_desc.frequency;
+    voice_desc.loop_count = m_desc.loop_count;
+    voice_desc.loop_begin_seconds = m_desc.loop_begin.count();
+    voice_desc.loop_end_seconds = m_desc.loop_end.count();
+    voice_desc.stop_at_loop_end = m_desc.stopWhenFinishedLooping;
+    auto& mixer = m_audio_system->GetMixer();
+    if(m_voice != AudioMixer::invalid_voice) {
+        mixer.StopVoice(m_voice);
+        m_voice = AudioMixer::invalid_voice;
+    }
+    if(wav) {
+        m_voice = mixer.Play(*wav, voice_desc);
+    } else if(auto stream = AudioStream::Open(snd.GetFilepath())) {
+        m_voice = mixer.Play(std::move(stream), voice_desc);
     }
 }
 
 void AudioSystem::Channel::Stop() noexcept {
-    if(m_voice) {
-        m_voice->Stop();
-        m_voice->FlushSourceBuffers();
+    if(m_voice != AudioMixer::invalid_voice) {
+        m_audio_system->GetMixer().StopVoice(m_voice);
     }
+    Detach();
 }
 
-void AudioSystem::Channel::Stop(uint32_t operationSetId) noexcept {
-    if(m_voice) {
-        m_voice->Stop(0, operationSetId);
-        m_voice->FlushSourceBuffers();
+void AudioSystem::Channel::Detach() noexcept {
+    m_voice = AudioMixer::invalid_voice;
+    if(m_sound) {
+        m_sound->RemoveChannel(this);
+        m_sound = nullptr;
     }
 }
 
 void AudioSystem::Channel::Pause() noexcept {
-    if(m_voice) {
-        m_voice->Stop();
+    if(m_voice != AudioMixer::invalid_voice) {
+        m_audio_system->GetMixer().PauseVoice(m_voice);
     }
 }
 
-void AudioSystem::Channel::Pause(uint32_t operationSetId) noexcept {
-    if(m_voice) {
-        m_voice->Stop(0, operationSetId);
+void AudioSystem::Channel::Resume() noexcept {
+    if(m_voice != AudioMixer::invalid_voice) {
+        m_audio_system->GetMixer().ResumeVoice(m_voice);
     }
 }
 
+AudioMixer::VoiceId AudioSystem::Channel::GetVoiceId() const noexcept {
+    return m_voice;
+}
+
 AudioSystem::Channel::ChannelDesc::ChannelDesc(AudioSystem* audioSystem)
 : audio_system{audioSystem} {
     /* DO NOTHING */
@@ -626,12 +514,12 @@ AudioSystem::Channel::ChannelDesc::ChannelDesc(AudioSystem* audioSystem)
 AudioSystem::Channel::ChannelDesc& AudioSystem::Channel::ChannelDesc::operator=(const SoundDesc& sndDesc) {
     volume = sndDesc.volume;
     frequency = sndDesc.frequency;
-    loop_count = sndDesc.loopCount <= -1 ? XAUDIO2_LOOP_INFINITE : (std::clamp(sndDesc.loopCount, 0, XAUDIO2_MAX_LOOP_COUNT));
+    loop_count = sndDesc.loopCount <= -1 ? AudioVoiceDesc::infinite_loops : static_cast<uint32_t>(sndDesc.loopCount);
     stopWhenFinishedLooping = sndDesc.stopWhenFinishedLooping;
-    const auto& fmt = audio_system->GetLoadedWavFileFormat();
-    loop_beginSamples = static_cast<uint32_t>(fmt.samplesPerSecond * sndDesc.loopBegin.count());
-    loop_endSamples = static_cast<uint32_t>(fmt.samplesPerSecond * sndDesc.loopEnd.count());
+    loop_begin = sndDesc.loopBegin;
+    loop_end = sndDesc.loopEnd;
     groupName = sndDesc.groupName;
+    emitter = sndDesc.emitter;
     return *this;
 }
 
@@ -641,10 +529,9 @@ void AudioSystem::Channel::SetStopWhenFinishedLooping(bool value) {
 
 void AudioSystem::Channel::SetLoopCount(int count) noexcept {
     if(count <= -1) {
-        m_desc.loop_count = XAUDIO2_LOOP_INFINITE;
+        m_desc.loop_count = AudioVoiceDesc::infinite_loops;
     } else {
-        count = std::clamp(count, 0, XAUDIO2_MAX_LOOP_COUNT);
-        m_desc.loop_count = count;
+        m_desc.loop_count = static_cast<uint32_t>(count);
     }
 }
 
@@ -657,23 +544,28 @@ void AudioSystem::Channel::SetLoopRange(TimeUtils::FPSeconds start, TimeUtils::F
     SetLoopEnd(end);
 }
 
+//Loop points stay in seconds; the mixer converts them with each file's own sample rate.
 void AudioSystem::Channel::SetLoopBegin(TimeUtils::FPSeconds start) {
-    const auto& fmt = m_audio_system->GetLoadedWavFileFormat();
-    m_desc.loop_beginSamples = static_cast<uint32_t>(fmt.samplesPerSecond * start.count());
+    m_desc.loop_begin = start;
 }
 
 void AudioSystem::Channel::SetLoopEnd(TimeUtils::FPSeconds end) {
-    const auto& fmt = m_audio_system->GetLoadedWavFileFormat();
-    m_desc.loop_endSamples = static_cast<uint32_t>(fmt.samplesPerSecond * end.count());
+    m_desc.loop_end = end;
 }
 
 void AudioSystem::Channel::SetVolume(float newVolume) noexcept {
     m_desc.volume = newVolume;
+    if(m_voice != AudioMixer::invalid_voice) {
+        m_audio_system->GetMixer().SetVoiceVolume(m_voice, newVolume);
+    }
 }
 
 void AudioSystem::Channel::SetFrequency(float newFrequency) noexcept {
-    newFrequency = std::clamp(newFrequency, XAUDIO2_MIN_FREQ_RATIO, m_desc.frequency_max);
+    newFrequency = std::clamp(newFrequency, min_channel_frequency, m_desc.frequency_max);
     m_desc.frequency = newFrequency;
+    if(m_voice != AudioMixer::invalid_voice) {
+        m_audio_system->GetMixer().SetVoiceFrequency(m_voice, newFrequency);
+    }
 }
 
 float AudioSystem::Channel::GetVolume() const noexcept {
@@ -684,8 +576,17 @@ float AudioSystem::Channel::GetFrequency() const noexcept {
     return m_desc.frequency;
 }
 
-AudioSystem::Sound::Sound(AudioSystem& audiosystem, std::filesystem::path filepath)
-: m_audio_system(&audiosystem) {
+void AudioSystem::Channel::SetEmitter(const Audio3DEmitter* emitter) noexcept {
+    m_desc.emitter = emitter;
+}
+
+const Audio3DEmitter* AudioSystem::Channel::GetEmitter() const noexcept {
+    return m_desc.emitter;
+}
+
+AudioSystem::Sound::Sound(AudioSystem& audiosystem, std::filesystem::path filepath, bool streamed /*= false*/)
+: m_audio_system(&audiosystem)
+, m_streamed(streamed) {
     namespace FS = std::filesystem;
     GUARANTEE_OR_DIE(FS::exists(filepath), "Attempting to create sound that does not exist.\n");
     {
@@ -697,6 +598,11 @@ AudioSystem::Sound::Sound(AudioSystem& audiosystem, std::filesystem::path filepa
         }
     }
     filepath.make_preferred();
+    m_filepath = filepath;
+    if(m_streamed) {
+        m_my_id = m_id++;
+        return;
+    }
     const auto pred = [&filepath](const auto& wav) { return wav.first == filepath; };
     auto found = std::find_if(std::begin(m_audio_system->m_wave_files), std::end(m_audio_system->m_wave_files), pred);
     if(found == m_audio_system->m_wave_files.end()) {
@@ -733,11 +639,14 @@ const FileUtils::Wav* const AudioSystem::Sound::GetWav() const noexcept {
     return m_wave_file;
 }
 
-const std::vector<AudioSystem::Channel*>& AudioSystem::Sound::GetChannels() const noexcept {
-    return m_channels;
+bool AudioSystem::Sound::IsStreamed() const noexcept {
+    return m_streamed;
 }
 
-void STDMETHODCALLTYPE AudioSystem::EngineCallback::OnCriticalError(HRESULT error) {
-    const auto error_msg = std::format("The Audio System encountered a fata error: {:0<#8x}", error);
-    ERROR_AND_DIE(error_msg.c_str());
+const std::filesystem::path& AudioSystem::Sound::GetFilepath() const noexcept {
+    return m_filepath;
+}
+
+const std::vector<AudioSystem::Channel*>& AudioSystem::Sound::GetChannels() const noexcept {
+    return m_channels;
 }
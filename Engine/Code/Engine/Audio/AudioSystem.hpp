@@ -6,12 +6,11 @@
 /* https://www.youtube.com/watch?v=T51Eqbbald4  */
 /************************************************/
 
+#include "Engine/Audio/AudioMixer.hpp"
 #include "Engine/Audio/Wav.hpp"
-#include "Engine/Audio/XAudio.hpp"
 
 #include "Engine/Core/EngineSubsystem.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
-#include "Engine/Platform/Win.hpp"
 
 #include "Engine/Services/IAudioService.hpp"
 
@@ -22,7 +21,6 @@
 #include <mutex>
 #include <string>
 #include <sstream>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -39,28 +37,25 @@ private:
     class ChannelGroup;
 
 public:
-    class EngineCallback : public IXAudio2EngineCallback {
-    public:
-        virtual ~EngineCallback() {
-        }
-        virtual void STDMETHODCALLTYPE OnProcessingPassStart() override {};
-        virtual void STDMETHODCALLTYPE OnProcessingPassEnd() override {};
-        virtual void STDMETHODCALLTYPE OnCriticalError(HRESULT error) override;
-    };
     class Sound {
     public:
-        Sound(AudioSystem& audiosystem, std::filesystem::path filepath);
+        //A streamed sound keeps nothing in memory; each play reads the file from disk through its own AudioStream.
+        Sound(AudioSystem& audiosystem, std::filesystem::path filepath, bool streamed = false);
         void AddChannel(Channel* channel) noexcept;
         void RemoveChannel(Channel* channel) noexcept;
         [[nodiscard]] const std::size_t GetId() const noexcept;
         [[nodiscard]] static const std::size_t GetCount() noexcept;
         [[nodiscard]] const FileUtils::Wav* const GetWav() const noexcept;
+        [[nodiscard]] bool IsStreamed() const noexcept;
+        [[nodiscard]] const std::filesystem::path& GetFilepath() const noexcept;
         const std::vector<Channel*>& GetChannels() const noexcept;
     private:
         inline static std::size_t m_id{0u};
         AudioSystem* m_audio_system{};
         std::size_t m_my_id{0u};
         FileUtils::Wav* m_wave_file{};
+        std::filesystem::path m_filepath{};
+        bool m_streamed{false};
         std::vector<Channel*> m_channels{};
         mutable std::mutex m_cs{};
     };
@@ -72,6 +67,7 @@ public:
         TimeUtils::FPSeconds loopBegin{};
         TimeUtils::FPSeconds loopEnd{};
         std::string groupName{};
+        const Audio3DEmitter* emitter{nullptr}; //When set, Update pans the sound against the first registered listener.
     };
 
     void Play(const std::filesystem::path& filepath) noexcept override;
@@ -85,18 +81,6 @@ public:
 private:
     class Channel {
     public:
-        class VoiceCallback : public IXAudio2VoiceCallback {
-        public:
-            virtual ~VoiceCallback() {
-            }
-            virtual void STDMETHODCALLTYPE OnVoiceProcessingPassStart(uint32_t /*bytesRequired*/) override {};
-            virtual void STDMETHODCALLTYPE OnVoiceProcessingPassEnd() override {};
-            virtual void STDMETHODCALLTYPE OnStreamEnd() override {};
-            virtual void STDMETHODCALLTYPE OnBufferStart(void* /*pBufferContext*/) override {};
-            virtual void STDMETHODCALLTYPE OnBufferEnd(void* pBufferContext) override;
-            virtual void STDMETHODCALLTYPE OnLoopEnd(void* pBufferContext) override;
-            virtual void STDMETHODCALLTYPE OnVoiceError(void* /*pBufferContext*/, HRESULT /*Error*/) override {};
-        };
         struct ChannelDesc {
             ChannelDesc() = default;
             ChannelDesc(const ChannelDesc& other) = default;
@@ -105,31 +89,25 @@ private:
             explicit ChannelDesc(AudioSystem* audioSystem);
 
             AudioSystem* audio_system{nullptr};
-            unsigned long long repeat_count{0ull};
             float volume{1.0f};
             float frequency{1.0f};
             float frequency_max{2.0f};
             uint32_t loop_count{0};
-            uint32_t loop_beginSamples{0};
-            uint32_t loop_endSamples{0};
+            TimeUtils::FPSeconds loop_begin{};
+            TimeUtils::FPSeconds loop_end{};
             bool stopWhenFinishedLooping{false};
             std::string groupName{};
+            const Audio3DEmitter* emitter{nullptr};
         };
         explicit Channel(AudioSystem& audioSystem, const ChannelDesc& desc) noexcept;
         ~Channel() noexcept;
 
-        void SetDSPSettings(AudioDSPResults& settings);
-
         void Play(Sound& snd) noexcept;
         void Stop() noexcept;
         void Pause() noexcept;
+        void Resume() noexcept;
         void SetStopWhenFinishedLooping(bool value);
 
-        void SetDSPSettings(AudioDSPResults& settings, uint32_t operationSetId);
-        void Play(Sound& snd, uint32_t operationSetId) noexcept;
-        void Stop(uint32_t operationSetId) noexcept;
-        void Pause(uint32_t operationSetId) noexcept;
-
         void SetLoopCount(int count) noexcept;
         [[nodiscard]] uint32_t GetLoopCount() const noexcept;
 
@@ -143,20 +121,27 @@ private:
         [[nodiscard]] float GetFrequency() const noexcept;
         void SetFrequency(float newFrequency) noexcept;
 
+        void SetEmitter(const Audio3DEmitter* emitter) noexcept;
+        [[nodiscard]] const Audio3DEmitter* GetEmitter() const noexcept;
+
+        [[nodiscard]] AudioMixer::VoiceId GetVoiceId() const noexcept;
+        //Lets go of the sound and the voice without touching the mixer, for voices that already ended there.
+        void Detach() noexcept;
+
     private:
-        XAUDIO2_BUFFER m_buffer{};
-        IXAudio2SourceVoice* m_voice = nullptr;
         Sound* m_sound = nullptr;
         AudioSystem* m_audio_system = nullptr;
         ChannelDesc m_desc{};
+        AudioMixer::VoiceId m_voice{AudioMixer::invalid_voice};
 
-        friend class VoiceCallback;
         friend class ChannelGroup;
     };
 
 public:
     AudioSystem() noexcept;
     explicit AudioSystem(std::size_t max_channels) noexcept;
+    //Mixes into output instead of the platform's default device, e.g. a NullAudioOutput on a headless test machine.
+    AudioSystem(std::size_t max_channels, std::unique_ptr<IAudioOutput> output) noexcept;
     AudioSystem(const AudioSystem& other) = delete;
     AudioSystem(AudioSystem&& other) = delete;
     AudioSystem& operator=(const AudioSystem& rhs) = delete;
@@ -172,8 +157,8 @@ public:
     void SuspendAudio() noexcept;
     void ResumeAudio() noexcept;
 
-    void SetFormat(const WAVEFORMATEXTENSIBLE& format) noexcept;
-    void SetFormat(const FileUtils::detail::WavFormatChunk & format) noexcept;
+    //Format of audio handed to the system from outside a .wav file, such as a WebM track. Each .wav carries its own.
+    void SetFormat(const FileUtils::detail::WavFormatChunk& format) noexcept;
 
     void RegisterWavFilesFromFolder(std::filesystem::path folderpath, bool recursive = false) noexcept;
     void RegisterWavFile(std::filesystem::path filepath) noexcept;
@@ -184,35 +169,27 @@ public:
     void Play(Sound& snd, SoundDesc desc = SoundDesc{}) noexcept;
     void Play(std::filesystem::path filepath, SoundDesc desc = SoundDesc{}) noexcept;
 
-    void SetDSPSettings(const AudioDSPSettings& newSettings) noexcept;
-
     [[nodiscard]] Sound* CreateSound(std::filesystem::path filepath) noexcept;
     [[nodiscard]] Sound* CreateSoundInstance(std::filesystem::path filepath) noexcept;
+    //For music and other long files: plays from disk without ever loading the whole file.
+    [[nodiscard]] Sound* CreateStreamingSound(std::filesystem::path filepath) noexcept;
 
     [[nodiscard]] ChannelGroup* GetChannelGroup(const std::string& name) const noexcept;
 
-    void SubmitDeferredOperation(uint32_t operationSetId) noexcept;
-    const std::atomic_uint32_t& GetOperationSetId() const noexcept;
-    const std::atomic_uint32_t& IncrementAndGetOperationSetId() noexcept;
-    void IncrementOperationSetId() noexcept;
-
-    void SetEngineCallback(EngineCallback* callback) noexcept;
-    [[nodiscard]] const WAVEFORMATEXTENSIBLE& GetFormat() const noexcept;
+    [[nodiscard]] const FileUtils::detail::WavFormatChunk& GetFormat() const noexcept;
     [[nodiscard]] FileUtils::detail::WavFormatChunk GetLoadedWavFileFormat() const noexcept;
 
-    AudioDSPResults CalculateDSP(const Audio3DEmitter& emitter, const Audio3DListener& listener, const AudioDSPSettings& settings) const noexcept;
+    [[nodiscard]] AudioMixer& GetMixer() noexcept;
 
 protected:
 private:
-    void InitializeAudioSystem() noexcept;
+    void InitializeAudioSystem(std::unique_ptr<IAudioOutput> output) noexcept;
 
     void DeactivateChannel(Channel& channel) noexcept;
+    void ReleaseFinishedChannels() noexcept;
+    void UpdateChannelPanning() noexcept;
 
-    void EmitterListenerDSP_worker() noexcept;
-
-    bool IsRunning() const noexcept;
-
-    WAVEFORMATEXTENSIBLE m_audio_format_ex{};
+    FileUtils::detail::WavFormatChunk m_format{};
     std::size_t m_sound_count{};
     std::size_t m_max_channels{64u};
     std::vector<std::pair<std::filesystem::path, std::unique_ptr<FileUtils::Wav>>> m_wave_files{};
@@ -221,15 +198,6 @@ private:
     std::vector<std::unique_ptr<Channel>> m_idle_channels{};
     std::vector<Audio3DEmitter*> m_emitters{};
     std::vector<Audio3DListener*> m_listeners{};
-    std::atomic_uint32_t m_operationID{};
-    IXAudio2* m_xaudio2 = nullptr;
-    X3DAUDIO_HANDLE m_x3daudio;
-    IXAudio2MasteringVoice* m_master_voice{};
-    EngineCallback m_engine_callback{};
-    uint32_t m_input_channels{};
+    std::unique_ptr<AudioMixer> m_mixer{};
     mutable std::mutex m_cs{};
-    std::thread m_dsp_thread{};
-    AudioDSPSettings m_dsp_settings{};
-    std::atomic_bool m_is_running{false};
-    std::condition_variable m_signal{};
 };
@@ -2,6 +2,8 @@
 
 #include "Engine/Core/Riff.hpp"
 
+#include <algorithm>
+#include <fstream>
 #include <sstream>
 
 namespace FileUtils {
@@ -69,6 +71,56 @@ unsigned int Wav::Load(std::filesystem::path filepath) noexcept {
     return WAV_SUCCESS;
 }
 
+unsigned int Wav::LoadStreamInfo(std::filesystem::path filepath, detail::WavStreamInfo& info) noexcept {
+    std::ifstream ifs(filepath, std::ios_base::binary);
+    if(!ifs.is_open()) {
+        return WAV_ERROR_NOT_A_WAV;
+    }
+    detail::WavHeader riff_header{};
+    char form_type[4]{};
+    if(!ifs.read(reinterpret_cast<char*>(&riff_header), sizeof(riff_header)) || !ifs.read(form_type, sizeof(form_type))) {
+        return WAV_ERROR_NOT_A_WAV;
+    }
+    if(StringUtils::FourCC(riff_header.fourcc) != RiffChunkID::RIFF || StringUtils::FourCC(form_type) != RiffChunkID::WAVE) {
+        return WAV_ERROR_NOT_A_WAV;
+    }
+    info = detail::WavStreamInfo{};
+    bool has_fmt = false;
+    detail::WavHeader cur_header{};
+    while(ifs.read(reinterpret_cast<char*>(&cur_header), sizeof(cur_header))) {
+        //Chunks are padded to an even length.
+        const auto padded_length = static_cast<std::streamoff>(cur_header.length) + (cur_header.length & 1u);
+        switch(StringUtils::FourCC(cur_header.fourcc)) {
+        case WavChunkID::FMT: {
+            const auto fmt_length = (std::min)(static_cast<std::size_t>(cur_header.length), sizeof(info.fmt));
+            if(!ifs.read(reinterpret_cast<char*>(&info.fmt), fmt_length)) {
+                return WAV_ERROR_BAD_FILE;
+            }
+            ifs.seekg(padded_length - static_cast<std::streamoff>(fmt_length), std::ios_base::cur);
+            has_fmt = true;
+            break;
+        }
+        case WavChunkID::DATA: {
+            if(!has_fmt) {
+                return WAV_ERROR_BAD_FILE;
+            }
+            info.dataOffset = static_cast<uint64_t>(ifs.tellg());
+            info.dataLength = cur_header.length;
+            //Truncated files play what is there.
+            ifs.seekg(0, std::ios_base::end);
+            const auto available = static_cast<uint64_t>(ifs.tellg()) - info.dataOffset;
+            info.dataLength = static_cast<uint32_t>((std::min)(static_cast<uint64_t>(info.dataLength), available));
+            return WAV_SUCCESS;
+        }
+        default: {
+            ifs.seekg(padded_length, std::ios_base::cur);
+            break;
+        }
+        }
+    }
+    return WAV_ERROR_BAD_FILE;
+}
+
 unsigned char* Wav::GetFormatAsBuffer() noexcept {
     return reinterpret_cast<unsigned char*>(&m_fmt);
 }
@@ -41,6 +41,13 @@ struct WavDataChunk {
     std::unique_ptr<uint8_t[]> data{nullptr};
 };
 
+//Everything needed to read a file's samples straight from disk: the format and where the data chunk sits.
+struct WavStreamInfo {
+    WavFormatChunk fmt{};
+    uint64_t dataOffset{0u};
+    uint32_t dataLength{0u};
+};
+
 }
 
 class Wav {
@@ -57,6 +64,8 @@ public:
     static constexpr const unsigned int WAV_ERROR_BAD_FILE = 2;
 
     [[nodiscard]] unsigned int Load(std::filesystem::path filepath) noexcept;
+    //Walks the chunk headers without reading the sample data. Returns the same codes as Load.
+    [[nodiscard]] static unsigned int LoadStreamInfo(std::filesystem::path filepath, detail::WavStreamInfo& info) noexcept;
     [[nodiscard]] unsigned char* GetFormatAsBuffer() noexcept;
     [[nodiscard]] unsigned char* GetDataBuffer() const noexcept;
     [[nodiscard]] const detail::WavFormatChunk& GetFormatChunk() const noexcept;
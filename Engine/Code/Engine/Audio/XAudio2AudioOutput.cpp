@@ -0,0 +1,118 @@
+#include "Engine/Audio/XAudio2AudioOutput.hpp"
+
+#if defined(PLATFORM_WINDOWS)
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+
+XAudio2AudioOutput::~XAudio2AudioOutput() noexcept {
+    Close();
+}
+
+bool XAudio2AudioOutput::Open(const AudioMixerFormat& format) noexcept {
+    m_com_initialized = SUCCEEDED(::CoInitializeEx(nullptr, COINIT_MULTITHREADED));
+    if(FAILED(::XAudio2Create(&m_xaudio2))) {
+        Close();
+        return false;
+    }
+#ifdef AUDIO_DEBUG
+    XAUDIO2_DEBUG_CONFIGURATION config{};
+    config.LogFileline = true;
+    config.LogFunctionName = true;
+    config.LogThreadID = true;
+    config.LogTiming = true;
+    config.BreakMask = XAUDIO2_LOG_WARNINGS;
+    config.TraceMask = XAUDIO2_LOG_DETAIL | XAUDIO2_LOG_WARNINGS | XAUDIO2_LOG_FUNC_CALLS;
+    m_xaudio2->SetDebugConfiguration(&config);
+#endif
+    m_xaudio2->RegisterForCallbacks(&m_engine_callback);
+    if(FAILED(m_xaudio2->CreateMasteringVoice(&m_master_voice))) {
+        Close();
+        return false;
+    }
+
+    WAVEFORMATEX wave_format{};
+    wave_format.wFormatTag = WAVE_FORMAT_IEEE_FLOAT;
+    wave_format.nChannels = static_cast<WORD>(format.channel_count);
+    wave_format.nSamplesPerSec = format.sample_rate;
+    wave_format.wBitsPerSample = 32u;
+    wave_format.nBlockAlign = static_cast<WORD>(format.channel_count * sizeof(float));
+    wave_format.nAvgBytesPerSec = format.sample_rate * wave_format.nBlockAlign;
+    wave_format.cbSize = 0u;
+    if(FAILED(m_xaudio2->CreateSourceVoice(&m_source_voice, &wave_format, 0u, XAUDIO2_DEFAULT_FREQ_RATIO, &m_voice_callback))) {
+        Close();
+        return false;
+    }
+    for(auto& buffer : m_buffers) {
+        buffer.resize(format.GetBlockSampleCount());
+    }
+    m_next_buffer = 0u;
+    m_source_voice->Start();
+    return true;
+}
+
+bool XAudio2AudioOutput::WaitForBlock(std::stop_token stopToken) noexcept {
+    while(!stopToken.stop_requested()) {
+        XAUDIO2_VOICE_STATE state{};
+        m_source_voice->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+        if(state.BuffersQueued < buffer_count) {
+            return true;
+        }
+        //Timed so a stop request is noticed even if the device has stalled.
+        if(m_buffer_finished.try_acquire_for(std::chrono::milliseconds{5})) {
+            m_buffer_finished_pending.clear();
+        }
+    }
+    return false;
+}
+
+void XAudio2AudioOutput::SubmitBlock(std::span<const float> samples) noexcept {
+    //XAudio2 reads the buffer until OnBufferEnd, so the block is copied into the next slot of the ring.
+    auto& buffer = m_buffers[m_next_buffer];
+    m_next_buffer = (m_next_buffer + 1u) % buffer_count;
+    std::copy(std::cbegin(samples), std::cend(samples), std::begin(buffer));
+    XAUDIO2_BUFFER xbuffer{};
+    xbuffer.AudioBytes = static_cast<UINT32>(samples.size() * sizeof(float));
+    xbuffer.pAudioData = reinterpret_cast<const BYTE*>(buffer.data());
+    xbuffer.pContext = this;
+    m_source_voice->SubmitSourceBuffer(&xbuffer);
+}
+
+void XAudio2AudioOutput::Close() noexcept {
+    if(m_source_voice) {
+        m_source_voice->Stop();
+        m_source_voice->FlushSourceBuffers();
+        m_source_voice->DestroyVoice();
+        m_source_voice = nullptr;
+    }
+    if(m_master_voice) {
+        m_master_voice->DestroyVoice();
+        m_master_voice = nullptr;
+    }
+    if(m_xaudio2) {
+        m_xaudio2->UnregisterForCallbacks(&m_engine_callback);
+        m_xaudio2->Release();
+        m_xaudio2 = nullptr;
+    }
+    if(m_com_initialized) {
+        ::CoUninitialize();
+        m_com_initialized = false;
+    }
+}
+
+void STDMETHODCALLTYPE XAudio2AudioOutput::VoiceCallback::OnBufferEnd(void* pBufferContext) {
+    auto* output = static_cast<XAudio2AudioOutput*>(pBufferContext);
+    if(!output->m_buffer_finished_pending.test_and_set()) {
+        output->m_buffer_finished.release();
+    }
+}
+
+void STDMETHODCALLTYPE XAudio2AudioOutput::EngineCallback::OnCriticalError(HRESULT error) {
+    const auto error_msg = std::format("The Audio System encountered a fata error: {:0<#8x}", error);
+    ERROR_AND_DIE(error_msg.c_str());
+}
+
+#endif
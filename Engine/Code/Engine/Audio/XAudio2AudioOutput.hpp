@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Engine/Core/BuildConfig.hpp"
+
+#if defined(PLATFORM_WINDOWS)
+
+#include "Engine/Audio/AudioOutput.hpp"
+#include "Engine/Audio/XAudio.hpp"
+
+#include <array>
+#include <atomic>
+#include <semaphore>
+#include <vector>
+
+//Plays mixed blocks through a single XAudio2 source voice in the mixer's float format.
+//A few blocks stay queued on the voice; WaitForBlock returns as soon as XAudio2 has finished one.
+class XAudio2AudioOutput : public IAudioOutput {
+public:
+    XAudio2AudioOutput() noexcept = default;
+    XAudio2AudioOutput(const XAudio2AudioOutput& other) = delete;
+    XAudio2AudioOutput(XAudio2AudioOutput&& other) = delete;
+    XAudio2AudioOutput& operator=(const XAudio2AudioOutput& other) = delete;
+    XAudio2AudioOutput& operator=(XAudio2AudioOutput&& other) = delete;
+    ~XAudio2AudioOutput() noexcept;
+
+    [[nodiscard]] bool Open(const AudioMixerFormat& format) noexcept override;
+    [[nodiscard]] bool WaitForBlock(std::stop_token stopToken) noexcept override;
+    void SubmitBlock(std::span<const float> samples) noexcept override;
+    void Close() noexcept override;
+
+protected:
+private:
+    class VoiceCallback : public IXAudio2VoiceCallback {
+    public:
+        virtual ~VoiceCallback() {
+        }
+        virtual void STDMETHODCALLTYPE OnVoiceProcessingPassStart(uint32_t /*bytesRequired*/) override {};
+        virtual void STDMETHODCALLTYPE OnVoiceProcessingPassEnd() override {};
+        virtual void STDMETHODCALLTYPE OnStreamEnd() override {};
+        virtual void STDMETHODCALLTYPE OnBufferStart(void* /*pBufferContext*/) override {};
+        virtual void STDMETHODCALLTYPE OnBufferEnd(void* pBufferContext) override;
+        virtual void STDMETHODCALLTYPE OnLoopEnd(void* /*pBufferContext*/) override {};
+        virtual void STDMETHODCALLTYPE OnVoiceError(void* /*pBufferContext*/, HRESULT /*Error*/) override {};
+    };
+    class EngineCallback : public IXAudio2EngineCallback {
+    public:
+        virtual ~EngineCallback() {
+        }
+        virtual void STDMETHODCALLTYPE OnProcessingPassStart() override {};
+        virtual void STDMETHODCALLTYPE OnProcessingPassEnd() override {};
+        virtual void STDMETHODCALLTYPE OnCriticalError(HRESULT error) override;
+    };
+
+    //Three blocks: one playing, one queued behind it, one being mixed.
+    static constexpr std::size_t buffer_count = 3u;
+
+    IXAudio2* m_xaudio2{nullptr};
+    IXAudio2MasteringVoice* m_master_voice{nullptr};
+    IXAudio2SourceVoice* m_source_voice{nullptr};
+    VoiceCallback m_voice_callback{};
+    EngineCallback m_engine_callback{};
+    std::array<std::vector<float>, buffer_count> m_buffers{};
+    std::size_t m_next_buffer{0u};
+    std::binary_semaphore m_buffer_finished{0};
+    std::atomic_flag m_buffer_finished_pending{}; //Keeps OnBufferEnd from releasing the semaphore past its maximum.
+    bool m_com_initialized{false};
+};
+
+#endif
@@ -6,16 +6,22 @@
 #include "Engine/Core/Console.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/EngineSubsystem.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileLogger.hpp"
 #include "Engine/Core/JobSystem.hpp"
 #include "Engine/Core/KeyValueParser.hpp"
 #include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/TaskGraph.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 
 #include "Engine/Input/InputSystem.hpp"
 
+#include "Engine/Memory/FrameArena.hpp"
+
 #include "Engine/Physics/PhysicsSystem.hpp"
 #include "Engine/Profiling/AllocationTracker.hpp"
+#include "Engine/Profiling/Instrumentor.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 
 #include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Renderer/Window.hpp"
@@ -89,6 +95,7 @@ private:
 
     void SetupEngineSystemPointers();
     void SetupEngineSystemChainOfResponsibility();
+    void SetupUpdateGraph() noexcept;
 
     void Initialize() noexcept override;
     void BeginFrame() noexcept override;
@@ -106,6 +113,9 @@ private:
 
     std::string m_title{"UNTITLED GAME"};
 
+    TaskGraph m_updateGraph{};
+    TimeUtils::FPSeconds m_updateDeltaSeconds{};
+
     std::unique_ptr<Config> m_theConfig{};
     std::unique_ptr<JobSystem> m_theJobSystem{};
     std::unique_ptr<FileLogger> m_theFileLogger{};
@@ -204,7 +214,9 @@ void App<T>::SetupEngineSystemPointers() {
 #endif
     ServiceLocator::provide(*static_cast<IConfigService*>(m_theConfig.get()), m_nullConfig);
 
-    m_theJobSystem = std::make_unique<JobSystem>(-1, static_cast<std::size_t>(JobType::Max), std::move(std::make_unique<std::condition_variable>()));
+    auto job_pool_size = static_cast<unsigned long long>(JobPool::default_slab_size);
+    m_theConfig->GetValueOr(std::string{"jobpoolsize"}, job_pool_size, job_pool_size);
+    m_theJobSystem = std::make_unique<JobSystem>(-1, static_cast<std::size_t>(JobType::Max), std::move(std::make_unique<std::condition_variable>()), static_cast<std::size_t>(job_pool_size));
     ServiceLocator::provide(*static_cast<IJobSystemService*>(m_theJobSystem.get()), m_nullJobSystem);
 
     m_theFileLogger = std::make_unique<FileLogger>("game");
@@ -303,6 +315,53 @@ void App<T>::Initialize() noexcept {
     g_theVideoSystem->Initialize();
     g_thePhysicsSystem->Initialize();
     g_theGame->Initialize();
+
+    SetupUpdateGraph();
+}
+
+template<GameType T>
+void App<T>::SetupUpdateGraph() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    //Each task declares what its Update touches. Tasks with no conflicting access run on the generic workers
+    //alongside each other and alongside UI on the main thread; anything that uses the immediate context, the
+    //ImGui backends or game code stays on the main thread. Console commands and input state are handled by the
+    //message pump before the update, so Input's and Console's Update only read what the pump wrote.
+    //The game may play sounds, move the listener, add bodies and create GPU resources, so it writes all of those
+    //and runs after the subsystems that own them.
+    using Affinity = TaskGraph::Affinity;
+    m_updateGraph.AddTask("Input", [this]() { g_theInputSystem->Update(m_updateDeltaSeconds); }).Writes("input");
+    m_updateGraph.AddTask("UI", [this]() { g_theUISystem->Update(m_updateDeltaSeconds); }).Reads("input").Writes("ui").RunOn(Affinity::MainThread);
+    m_updateGraph.AddTask("Console", [this]() { g_theConsole->Update(m_updateDeltaSeconds); }).Reads("input").Writes("console");
+    m_updateGraph.AddTask("Audio", [this]() { g_theAudioSystem->Update(m_updateDeltaSeconds); }).Writes("audio");
+    m_updateGraph.AddTask("Video", [this]() { g_theVideoSystem->Update(m_updateDeltaSeconds); }).Writes("video");
+    m_updateGraph.AddTask("Physics", [this]() { g_thePhysicsSystem->Update(m_updateDeltaSeconds); }).Writes("physics");
+    m_updateGraph.AddTask("Game", [this]() { g_theGame->Update(m_updateDeltaSeconds); })
+        .Reads("input")
+        .Reads("ui")
+        .Reads("console")
+        .Writes("audio")
+        .Writes("video")
+        .Writes("physics")
+        .Writes("game")
+        .Writes("render context")
+        .RunOn(Affinity::MainThread);
+    m_updateGraph.AddTask("Renderer", [this]() { g_theRenderer->Update(m_updateDeltaSeconds); }).Reads("game").Writes("render context").RunOn(Affinity::MainThread);
+    if(!m_updateGraph.Compile()) {
+        ERROR_AND_DIE("App update graph contains a dependency cycle.");
+    }
+
+    Console::Command framegraph{};
+    framegraph.command_name = "framegraph";
+    framegraph.help_text_short = "Displays the critical path of the last update.";
+    framegraph.help_text_long = "framegraph: Displays the longest chain of dependent update tasks and their durations from the last frame.";
+    framegraph.command_function = [this](const std::string& /*args*/) -> void {
+        for(const auto& line : StringUtils::Split(m_updateGraph.DumpCriticalPath(), '\n')) {
+            g_theConsole->PrintMsg(line);
+        }
+    };
+    g_theConsole->RegisterCommand(framegraph);
 }
 
 template<GameType T>
@@ -318,6 +377,8 @@ void App<T>::BeginFrame() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    PROFILE_BENCHMARK_SCOPE("App::BeginFrame");
+    FrameArena::BeginFrame();
     g_theJobSystem->BeginFrame();
     g_theUISystem->BeginFrame();
     g_theInputSystem->BeginFrame();
@@ -334,14 +395,9 @@ void App<T>::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    g_theUISystem->Update(deltaSeconds);
-    g_theInputSystem->Update(deltaSeconds);
-    g_theConsole->Update(deltaSeconds);
-    g_theAudioSystem->Update(deltaSeconds);
-    g_theVideoSystem->Update(deltaSeconds);
-    g_thePhysicsSystem->Update(deltaSeconds);
-    g_theGame->Update(deltaSeconds);
-    g_theRenderer->Update(deltaSeconds);
+    PROFILE_BENCHMARK_SCOPE("App::Update");
+    m_updateDeltaSeconds = deltaSeconds;
+    m_updateGraph.Run();
 }
 
 template<GameType T>
@@ -349,6 +405,7 @@ void App<T>::Render() const noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    PROFILE_BENCHMARK_SCOPE("App::Render");
     g_theGame->Render();
     g_theUISystem->Render();
     g_theConsole->Render();
@@ -364,6 +421,7 @@ void App<T>::EndFrame() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    PROFILE_BENCHMARK_SCOPE("App::EndFrame");
     g_theUISystem->EndFrame();
     g_theGame->EndFrame();
     g_theConsole->EndFrame();
@@ -486,6 +544,7 @@ void App<T>::RunFrame() {
     Render();
     EndFrame();
     AllocationTracker::tick();
+    Metrics::EndFrame();
     #ifdef PROFILE_BUILD
     FrameMark;
     #endif
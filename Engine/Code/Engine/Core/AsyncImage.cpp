@@ -0,0 +1,125 @@
+#include "Engine/Core/AsyncImage.hpp"
+
+#include "Engine/Core/FileUtils.hpp"
+
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <thread>
+
+//Captured by the job that runs one step of the load. The job system destroys the callback, and with it the last
+//copy of this, either after running it or when it drops the job at shutdown. In the second case the image is
+//still in the step's state, so it is failed here; otherwise the step already moved it on and this does nothing.
+class AsyncImage::PendingStep {
+public:
+    PendingStep(std::shared_ptr<AsyncImage> image, State step) noexcept
+    : m_image(std::move(image))
+    , m_step(step) {
+        /* DO NOTHING */
+    }
+    PendingStep(const PendingStep& other) = delete;
+    PendingStep& operator=(const PendingStep& other) = delete;
+    ~PendingStep() noexcept {
+        auto expected = m_step;
+        m_image->m_state.compare_exchange_strong(expected, State::Failed);
+    }
+
+    std::shared_ptr<AsyncImage> m_image{};
+    State m_step{State::Reading};
+};
+
+AsyncImage::AsyncImage(std::filesystem::path filepath) noexcept
+: m_filepath(std::move(filepath)) {
+    /* DO NOTHING */
+}
+
+std::shared_ptr<AsyncImage> AsyncImage::Load(std::filesystem::path filepath) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto image = std::shared_ptr<AsyncImage>(new AsyncImage(std::move(filepath)));
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    if(!js->IsRunning()) {
+        Read(image);
+        return image;
+    }
+    js->Run(JobType::Io, [step = std::make_shared<PendingStep>(image, State::Reading)](void*) { Read(step->m_image); }, nullptr);
+    return image;
+}
+
+void AsyncImage::Read(std::shared_ptr<AsyncImage> image) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto& filepath = image->m_filepath;
+    if(!Image::IsSupportedExtension(filepath.extension()) || !FileUtils::IsSafeReadPath(filepath)) {
+        image->m_state = State::Failed;
+        return;
+    }
+    if(auto file = FileUtils::MappedFile::Open(filepath); file.has_value()) {
+        //Start paging the file in now so the decode rarely stalls on a page fault.
+        file->Prefetch();
+        image->m_file = std::move(*file);
+    } else {
+        image->m_state = State::Failed;
+        return;
+    }
+    image->m_state = State::Decoding;
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    if(!js->IsRunning()) {
+        Decode(std::move(image));
+        return;
+    }
+    js->Run(JobType::Generic, [step = std::make_shared<PendingStep>(std::move(image), State::Decoding)](void*) { Decode(step->m_image); }, nullptr);
+}
+
+void AsyncImage::Decode(std::shared_ptr<AsyncImage> image) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    image->m_image = Image(image->m_file.GetBytes(), image->m_filepath);
+    image->m_file.Close();
+    image->m_state = image->m_image.GetDataLength() != 0u ? State::Ready : State::Failed;
+}
+
+AsyncImage::State AsyncImage::GetState() const noexcept {
+    return m_state.load();
+}
+
+bool AsyncImage::IsDone() const noexcept {
+    const auto state = GetState();
+    return state == State::Ready || state == State::Failed;
+}
+
+bool AsyncImage::IsReady() const noexcept {
+    return GetState() == State::Ready;
+}
+
+void AsyncImage::Wait() const noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    while(!IsDone()) {
+        //The decode may be sitting in a queue this thread can drain.
+        if(!js->TryRunPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+const std::filesystem::path& AsyncImage::GetFilepath() const noexcept {
+    return m_filepath;
+}
+
+Image& AsyncImage::GetImage() noexcept {
+    return m_image;
+}
+
+const Image& AsyncImage::GetImage() const noexcept {
+    return m_image;
+}
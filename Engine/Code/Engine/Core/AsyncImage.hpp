@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/MappedFile.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+
+//An image file being mapped on the Io job thread and decoded on a generic worker.
+//Only the decoded Image is produced, so it works without a renderer or graphics device.
+class AsyncImage {
+public:
+    enum class State : unsigned int {
+        Reading,
+        Decoding,
+        Ready,
+        Failed,
+    };
+
+    //Queues filepath for loading and returns immediately.
+    //Without a running job system the file is read and decoded before this returns.
+    [[nodiscard]] static std::shared_ptr<AsyncImage> Load(std::filesystem::path filepath) noexcept;
+
+    AsyncImage(const AsyncImage& other) = delete;
+    AsyncImage& operator=(const AsyncImage& other) = delete;
+    ~AsyncImage() noexcept = default;
+
+    [[nodiscard]] State GetState() const noexcept;
+    [[nodiscard]] bool IsDone() const noexcept;
+    [[nodiscard]] bool IsReady() const noexcept;
+    //Blocks until the image is Ready or Failed, running queued generic jobs in the meantime.
+    //A load whose jobs were dropped by a job system shutdown ends as Failed.
+    void Wait() const noexcept;
+
+    [[nodiscard]] const std::filesystem::path& GetFilepath() const noexcept;
+    //Only valid once IsReady returns true.
+    [[nodiscard]] Image& GetImage() noexcept;
+    [[nodiscard]] const Image& GetImage() const noexcept;
+
+protected:
+private:
+    class PendingStep;
+
+    explicit AsyncImage(std::filesystem::path filepath) noexcept;
+
+    static void Read(std::shared_ptr<AsyncImage> image) noexcept;
+    static void Decode(std::shared_ptr<AsyncImage> image) noexcept;
+
+    std::filesystem::path m_filepath{};
+    FileUtils::MappedFile m_file{};
+    Image m_image{};
+    std::atomic<State> m_state{State::Reading};
+};
@@ -0,0 +1,454 @@
+#include "Engine/Core/BinaryLog.hpp"
+
+#include "Engine/Core/SpscRingBuffer.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+
+namespace {
+
+//Records per thread before writes start being dropped: 128 KiB of ring for every thread that logs.
+constexpr std::size_t ring_capacity = 1024u;
+
+struct ThreadBuffer {
+    SpscRingBuffer<BinaryLogRecord> ring{ring_capacity};
+    std::uint16_t index{0u};
+};
+
+struct Registry {
+    //Guards the formats and the hand-over of new rings. Neither Submit nor the ring reads in Drain take it.
+    std::mutex cs{};
+    std::vector<std::string> formats{};
+    std::map<std::string, std::uint32_t, std::less<>> format_ids{};
+    std::vector<std::shared_ptr<ThreadBuffer>> registered_threads{};
+    std::uint16_t next_thread_index{0u};
+    //Bumped under cs with every registration; Drain only locks when it has moved past adopted_count.
+    std::atomic<std::uint64_t> registered_count{0u};
+    //Drainer only.
+    std::vector<std::shared_ptr<ThreadBuffer>> threads{};
+    std::uint64_t adopted_count{0u};
+    std::atomic<std::uint64_t> dropped{0u};
+    std::atomic<std::atomic<std::uint64_t>*> drain_signal{nullptr};
+    //Submits between loading drain_signal and notifying it; SetDrainSignal waits for them to leave.
+    std::atomic<std::uint32_t> drain_signal_users{0u};
+    //Read by every Submit, so it gets a cache line of its own instead of sharing the one cs is written on.
+    alignas(64) std::atomic_bool drain_requested{false};
+};
+
+Registry& GetRegistry() noexcept {
+    static Registry registry{};
+    return registry;
+}
+
+struct Epoch {
+    std::chrono::steady_clock::time_point steady{std::chrono::steady_clock::now()};
+    std::chrono::system_clock::time_point system{std::chrono::system_clock::now()};
+};
+
+const Epoch& GetEpoch() noexcept {
+    static const Epoch epoch{};
+    return epoch;
+}
+
+ThreadBuffer& GetThreadBuffer() noexcept {
+    //Shared with the registry so records still queued when a thread exits are drained, not lost.
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+        auto result = std::make_shared<ThreadBuffer>();
+        auto& registry = GetRegistry();
+        std::scoped_lock<std::mutex> lock(registry.cs);
+        result->index = registry.next_thread_index++;
+        registry.registered_threads.push_back(result);
+        registry.registered_count.fetch_add(1u, std::memory_order_release);
+        return result;
+    }();
+    return *buffer;
+}
+
+using DecodedArg = std::variant<bool, std::int64_t, std::uint64_t, double, char, std::string_view, const void*>;
+
+template<typename T>
+T ReadPod(const std::byte* data) noexcept {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+std::size_t DecodeArgs(const BinaryLogRecord& record, std::array<DecodedArg, 32>& args) noexcept {
+    const auto* data = record.payload.data();
+    const auto size = (std::min)(std::size_t{record.payload_size}, BinaryLogRecord::payload_capacity);
+    std::size_t offset = 0u;
+    std::size_t count = 0u;
+    while(offset < size && count < args.size()) {
+        const auto type = static_cast<BinaryLogArgType>(data[offset++]);
+        const auto remaining = size - offset;
+        switch(type) {
+        case BinaryLogArgType::Bool:
+            if(remaining < sizeof(std::uint8_t)) {
+                return count;
+            }
+            args[count++] = ReadPod<std::uint8_t>(data + offset) != 0u;
+            offset += sizeof(std::uint8_t);
+            break;
+        case BinaryLogArgType::Char:
+            if(remaining < sizeof(char)) {
+                return count;
+            }
+            args[count++] = ReadPod<char>(data + offset);
+            offset += sizeof(char);
+            break;
+        case BinaryLogArgType::Int:
+            if(remaining < sizeof(std::int64_t)) {
+                return count;
+            }
+            args[count++] = ReadPod<std::int64_t>(data + offset);
+            offset += sizeof(std::int64_t);
+            break;
+        case BinaryLogArgType::UInt:
+            if(remaining < sizeof(std::uint64_t)) {
+                return count;
+            }
+            args[count++] = ReadPod<std::uint64_t>(data + offset);
+            offset += sizeof(std::uint64_t);
+            break;
+        case BinaryLogArgType::Double:
+            if(remaining < sizeof(double)) {
+                return count;
+            }
+            args[count++] = ReadPod<double>(data + offset);
+            offset += sizeof(double);
+            break;
+        case BinaryLogArgType::Pointer:
+            if(remaining < sizeof(std::uint64_t)) {
+                return count;
+            }
+            args[count++] = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(ReadPod<std::uint64_t>(data + offset)));
+            offset += sizeof(std::uint64_t);
+            break;
+        case BinaryLogArgType::String: {
+            if(remaining < sizeof(std::uint16_t)) {
+                return count;
+            }
+            const auto length = (std::min)(std::size_t{ReadPod<std::uint16_t>(data + offset)}, remaining - sizeof(std::uint16_t));
+            offset += sizeof(std::uint16_t);
+            args[count++] = std::string_view{reinterpret_cast<const char*>(data + offset), length};
+            offset += length;
+            break;
+        }
+        default:
+            //Corrupt payload; render what was decoded so far.
+            return count;
+        }
+    }
+    return count;
+}
+
+template<typename T>
+void WriteValue(std::ostream& stream, const T& value) noexcept {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool ReadValue(std::istream& stream, T& value) noexcept {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // namespace
+
+std::uint32_t BinaryLog::RegisterFormat(std::string_view format) noexcept {
+    auto& registry = GetRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    if(const auto found = registry.format_ids.find(format); found != std::end(registry.format_ids)) {
+        return found->second;
+    }
+    const auto id = static_cast<std::uint32_t>(registry.formats.size());
+    registry.formats.emplace_back(format);
+    registry.format_ids.emplace(std::string{format}, id);
+    return id;
+}
+
+std::string BinaryLog::GetFormat(std::uint32_t format_id) noexcept {
+    auto& registry = GetRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    return format_id < registry.formats.size() ? registry.formats[format_id] : std::string{};
+}
+
+std::uint64_t BinaryLog::Now() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetEpoch().steady).count());
+}
+
+std::uint64_t BinaryLog::GetEpochUnixNanoseconds() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(GetEpoch().system.time_since_epoch()).count());
+}
+
+void BinaryLog::Submit(BinaryLogRecord& record) noexcept {
+    auto& buffer = GetThreadBuffer();
+    record.thread_index = buffer.index;
+    auto& registry = GetRegistry();
+    if(!buffer.ring.try_push(record)) {
+        registry.dropped.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+    //Only the first record since the last Drain wakes the drainer. The fence pairs with the one in Drain:
+    //either this sees the flag Drain cleared, or that Drain sees this record.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(registry.drain_requested.load(std::memory_order_relaxed) || registry.drain_requested.exchange(true)) {
+        return;
+    }
+    //Registering as a user before loading the pointer is what lets SetDrainSignal know when an old signal is safe to destroy.
+    registry.drain_signal_users.fetch_add(1u);
+    if(auto* signal = registry.drain_signal.load(); signal != nullptr) {
+        ++*signal;
+        signal->notify_one();
+    }
+    registry.drain_signal_users.fetch_sub(1u);
+}
+
+void BinaryLog::SetDrainSignal(std::atomic<std::uint64_t>* signal) noexcept {
+    auto& registry = GetRegistry();
+    registry.drain_signal.store(signal);
+    //A Submit that loaded the previous signal may still be notifying it.
+    while(registry.drain_signal_users.load() != 0u) {
+        std::this_thread::yield();
+    }
+}
+
+std::size_t BinaryLog::Drain(std::span<BinaryLogRecord> out) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto& registry = GetRegistry();
+    registry.drain_requested.store(false, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(registry.registered_count.load(std::memory_order_acquire) != registry.adopted_count) {
+        std::scoped_lock<std::mutex> lock(registry.cs);
+        std::move(std::begin(registry.registered_threads), std::end(registry.registered_threads), std::back_inserter(registry.threads));
+        registry.registered_threads.clear();
+        registry.adopted_count = registry.registered_count.load(std::memory_order_relaxed);
+    }
+    auto& threads = registry.threads;
+    std::size_t count = 0u;
+    //An even share per thread first so one chatty thread cannot starve the others' rings into dropping.
+    const auto share = (std::max)(std::size_t{1u}, out.size() / (std::max)(std::size_t{1u}, threads.size()));
+    for(auto& buffer : threads) {
+        count += buffer->ring.try_pop_n(out.subspan(count, (std::min)(share, out.size() - count)));
+    }
+    for(auto& buffer : threads) {
+        count += buffer->ring.try_pop_n(out.subspan(count));
+    }
+    //Forget threads that have exited and been emptied; the drainer's list holds the last reference.
+    std::erase_if(threads, [](const std::shared_ptr<ThreadBuffer>& buffer) { return buffer.use_count() == 1 && buffer->ring.empty(); });
+    std::stable_sort(std::begin(out), std::begin(out) + count, [](const BinaryLogRecord& a, const BinaryLogRecord& b) { return a.timestamp_ns < b.timestamp_ns; });
+    return count;
+}
+
+std::uint64_t BinaryLog::GetDroppedCount() noexcept {
+    return GetRegistry().dropped.load(std::memory_order_relaxed);
+}
+
+std::string BinaryLog::FormatRecord(std::string_view format, const BinaryLogRecord& record) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    std::array<DecodedArg, 32> args{};
+    const auto arg_count = DecodeArgs(record, args);
+    std::string result{};
+    result.reserve(format.size() + 32u);
+    auto out = std::back_inserter(result);
+    std::size_t next_arg = 0u;
+    for(std::size_t i = 0u; i < format.size(); /* DO NOTHING */) {
+        const auto c = format[i];
+        if(c == '}' && i + 1u < format.size() && format[i + 1u] == '}') {
+            result += '}';
+            i += 2u;
+            continue;
+        }
+        if(c != '{') {
+            result += c;
+            ++i;
+            continue;
+        }
+        if(i + 1u < format.size() && format[i + 1u] == '{') {
+            result += '{';
+            i += 2u;
+            continue;
+        }
+        const auto close = format.find('}', i);
+        if(close == std::string_view::npos) {
+            result.append(format.substr(i));
+            break;
+        }
+        //Replacement field: an optional argument index, then an optional :spec.
+        const auto field = format.substr(i + 1u, close - i - 1u);
+        const auto colon = field.find(':');
+        const auto index_text = field.substr(0u, colon);
+        auto index = next_arg++;
+        if(!index_text.empty()) {
+            index = 0u;
+            for(const auto digit : index_text) {
+                index = index * 10u + static_cast<std::size_t>(digit - '0');
+            }
+        }
+        if(index >= arg_count) {
+            result += "{?}";
+        } else {
+            const auto spec = colon == std::string_view::npos ? std::string{"{}"} : std::format("{{{}}}", field.substr(colon));
+            try {
+                std::visit([&](const auto& value) { std::vformat_to(out, spec, std::make_format_args(value)); }, args[index]);
+            } catch(const std::format_error&) {
+                result += "{!}";
+            }
+        }
+        i = close + 1u;
+    }
+    return result;
+}
+
+std::string BinaryLog::FormatLine(std::string_view format, const BinaryLogRecord& record) noexcept {
+    return std::format("[+{:.6f}s][T{}] {}", static_cast<double>(record.timestamp_ns) * 1e-9, record.thread_index, FormatRecord(format, record));
+}
+
+bool BinaryLog::Decode(const std::filesystem::path& binary_path, const std::filesystem::path& text_path) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    std::ifstream input{binary_path, std::ios_base::binary};
+    std::array<char, 8> magic{};
+    std::uint32_t version{};
+    std::uint64_t epoch_ns{};
+    if(!ReadValue(input, magic) || magic != BinaryLogWriter::magic || !ReadValue(input, version) || version != BinaryLogWriter::version || !ReadValue(input, epoch_ns)) {
+        return false;
+    }
+    std::ofstream output{text_path};
+    if(!output) {
+        return false;
+    }
+    const auto epoch = std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{epoch_ns})};
+    output << std::format("Binary log started {:%Y-%m-%d %H:%M:%S} UTC\n", std::chrono::floor<std::chrono::seconds>(epoch));
+    std::unordered_map<std::uint32_t, std::string> formats{};
+    BinaryLogWriter::Chunk chunk{};
+    while(ReadValue(input, chunk)) {
+        switch(chunk) {
+        case BinaryLogWriter::Chunk::Format: {
+            std::uint32_t id{};
+            std::uint32_t length{};
+            if(!ReadValue(input, id) || !ReadValue(input, length)) {
+                return false;
+            }
+            std::string format(length, '\0');
+            if(!input.read(format.data(), length)) {
+                return false;
+            }
+            formats[id] = std::move(format);
+            break;
+        }
+        case BinaryLogWriter::Chunk::Record: {
+            BinaryLogRecord record;
+            if(!ReadValue(input, record.timestamp_ns) || !ReadValue(input, record.format_id) || !ReadValue(input, record.thread_index) || !ReadValue(input, record.payload_size)) {
+                return false;
+            }
+            if(record.payload_size > BinaryLogRecord::payload_capacity || !input.read(reinterpret_cast<char*>(record.payload.data()), record.payload_size)) {
+                return false;
+            }
+            if(const auto found = formats.find(record.format_id); found != std::end(formats)) {
+                output << FormatLine(found->second, record) << '\n';
+            } else {
+                output << FormatLine(std::format("<unknown format {}>", record.format_id), record) << '\n';
+            }
+            break;
+        }
+        case BinaryLogWriter::Chunk::Dropped: {
+            std::uint64_t dropped{};
+            if(!ReadValue(input, dropped)) {
+                return false;
+            }
+            output << std::format("[{} records dropped: a thread's ring was full]\n", dropped);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+void BinaryLog::Encoder::PutBytes(BinaryLogArgType type, const void* data, std::size_t size) noexcept {
+    auto& record = *m_record;
+    //Once one argument is cut off the rest are too, so indices in the format string still line up.
+    if(m_full || record.payload_size + 1u + size > BinaryLogRecord::payload_capacity) {
+        m_full = true;
+        return;
+    }
+    auto* dest = record.payload.data() + record.payload_size;
+    dest[0] = static_cast<std::byte>(type);
+    std::memcpy(dest + 1, data, size);
+    record.payload_size += static_cast<std::uint16_t>(1u + size);
+}
+
+void BinaryLog::Encoder::PutString(std::string_view value) noexcept {
+    auto& record = *m_record;
+    constexpr auto header_size = 1u + sizeof(std::uint16_t);
+    if(m_full || record.payload_size + header_size > BinaryLogRecord::payload_capacity) {
+        m_full = true;
+        return;
+    }
+    //Long strings are truncated to what is left of the payload rather than dropped.
+    const auto length = static_cast<std::uint16_t>((std::min)(value.size(), BinaryLogRecord::payload_capacity - record.payload_size - header_size));
+    auto* dest = record.payload.data() + record.payload_size;
+    dest[0] = static_cast<std::byte>(BinaryLogArgType::String);
+    std::memcpy(dest + 1, &length, sizeof(length));
+    std::memcpy(dest + header_size, value.data(), length);
+    record.payload_size += static_cast<std::uint16_t>(header_size + length);
+}
+
+BinaryLogWriter::BinaryLogWriter(std::ostream& stream) noexcept
+: m_stream{&stream} {
+    m_stream->write(magic.data(), magic.size());
+    WriteValue(*m_stream, version);
+    WriteValue(*m_stream, BinaryLog::GetEpochUnixNanoseconds());
+}
+
+void BinaryLogWriter::Write(std::span<const BinaryLogRecord> records) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto& stream = *m_stream;
+    for(const auto& record : records) {
+        if(m_formats_written.size() <= record.format_id) {
+            m_formats_written.resize(record.format_id + 1u, false);
+        }
+        if(!m_formats_written[record.format_id]) {
+            const auto format = BinaryLog::GetFormat(record.format_id);
+            WriteValue(stream, Chunk::Format);
+            WriteValue(stream, record.format_id);
+            WriteValue(stream, static_cast<std::uint32_t>(format.size()));
+            stream.write(format.data(), format.size());
+            m_formats_written[record.format_id] = true;
+        }
+        WriteValue(stream, Chunk::Record);
+        WriteValue(stream, record.timestamp_ns);
+        WriteValue(stream, record.format_id);
+        WriteValue(stream, record.thread_index);
+        WriteValue(stream, record.payload_size);
+        stream.write(reinterpret_cast<const char*>(record.payload.data()), record.payload_size);
+    }
+}
+
+void BinaryLogWriter::WriteDropped(std::uint64_t count) noexcept {
+    WriteValue(*m_stream, Chunk::Dropped);
+    WriteValue(*m_stream, count);
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+//Records a structured log entry: the format string is registered once per call site and only its id and the raw
+//arguments are captured. Formatting happens later, on the FileLogger worker or in the decoder.
+//Usage: LOG_STRUCTURED("Loaded {} in {:.2f} ms", path.string(), elapsed.count());
+//Takes the format as part of __VA_ARGS__ so calls without arguments work without __VA_OPT__.
+#define LOG_STRUCTURED(...)                                                                                      \
+    do {                                                                                                         \
+        static const auto binary_log_format_id = BinaryLog::RegisterFormat(BinaryLog::FormatOf(__VA_ARGS__));  \
+        BinaryLog::WriteWithFormat(binary_log_format_id, __VA_ARGS__);                                          \
+    } while(false)
+
+// clang-format off
+enum class BinaryLogArgType : std::uint8_t {
+    Bool
+    ,Int
+    ,UInt
+    ,Double
+    ,Char
+    ,String
+    ,Pointer
+};
+// clang-format on
+
+//One log call. Fixed size so each thread's ring is a plain array of these; arguments that do not fit
+//in the payload are dropped from the end and render as {?}.
+struct BinaryLogRecord {
+    static constexpr std::size_t payload_capacity = 112u;
+
+    std::uint64_t timestamp_ns{0u}; //Since BinaryLog's epoch, see GetEpochUnixNanoseconds.
+    std::uint32_t format_id{0u};
+    std::uint16_t thread_index{0u};
+    std::uint16_t payload_size{0u};
+    std::array<std::byte, payload_capacity> payload;
+};
+static_assert(sizeof(BinaryLogRecord) == 128u);
+
+class BinaryLog {
+public:
+    //Returns the id for format, registering it the first time it is seen. Takes a lock; call once per call site.
+    [[nodiscard]] static std::uint32_t RegisterFormat(std::string_view format) noexcept;
+    [[nodiscard]] static std::string GetFormat(std::uint32_t format_id) noexcept;
+
+    //Captures the arguments into the calling thread's ring. Never blocks; when the ring is full the record is dropped and counted.
+    template<typename... Args>
+    static void Write(std::uint32_t format_id, const Args&... args) noexcept;
+    template<typename... Args>
+    static void WriteWithFormat(std::uint32_t format_id, std::string_view format, const Args&... args) noexcept;
+    template<typename... Args>
+    [[nodiscard]] static constexpr std::string_view FormatOf(std::string_view format, const Args&... args) noexcept;
+
+    //Moves up to out.size() queued records from every thread's ring into out, oldest first. One drainer at a time.
+    [[nodiscard]] static std::size_t Drain(std::span<BinaryLogRecord> out) noexcept;
+    //The first record written after a Drain bumps signal and notifies one waiter, so the drainer can sleep on it
+    //with an atomic wait instead of polling. Set back to nullptr before signal is destroyed.
+    static void SetDrainSignal(std::atomic<std::uint64_t>* signal) noexcept;
+    [[nodiscard]] static std::uint64_t GetDroppedCount() noexcept;
+    [[nodiscard]] static std::uint64_t GetEpochUnixNanoseconds() noexcept;
+
+    //Substitutes the record's arguments into format. Accepts the std::format replacement field syntax, {} and {:spec}.
+    [[nodiscard]] static std::string FormatRecord(std::string_view format, const BinaryLogRecord& record) noexcept;
+    //"[+seconds][T<thread>] message", without a trailing newline.
+    [[nodiscard]] static std::string FormatLine(std::string_view format, const BinaryLogRecord& record) noexcept;
+
+    //Renders a file written by BinaryLogWriter as text, one line per record.
+    [[nodiscard]] static bool Decode(const std::filesystem::path& binary_path, const std::filesystem::path& text_path) noexcept;
+
+protected:
+private:
+    class Encoder;
+
+    [[nodiscard]] static std::uint64_t Now() noexcept;
+    static void Submit(BinaryLogRecord& record) noexcept;
+};
+
+//Writes drained records in the binary log file format. Each format string is written the first time a record uses it,
+//so the file decodes on its own, without the process that wrote it.
+class BinaryLogWriter {
+public:
+    explicit BinaryLogWriter(std::ostream& stream) noexcept;
+
+    void Write(std::span<const BinaryLogRecord> records) noexcept;
+    void WriteDropped(std::uint64_t count) noexcept;
+
+    static constexpr std::array<char, 8> magic{'A', '2', 'D', 'E', 'B', 'L', 'O', 'G'};
+    static constexpr std::uint32_t version = 1u;
+
+    // clang-format off
+    enum class Chunk : std::uint8_t {
+        Format = 1
+        ,Record
+        ,Dropped
+    };
+    // clang-format on
+
+protected:
+private:
+    std::ostream* m_stream{};
+    std::vector<bool> m_formats_written{};
+};
+
+class BinaryLog::Encoder {
+public:
+    explicit Encoder(BinaryLogRecord& record) noexcept
+    : m_record{&record} {
+        /* DO NOTHING */
+    }
+
+    template<typename T>
+    void Put(const T& value) noexcept;
+
+private:
+    void PutBytes(BinaryLogArgType type, const void* data, std::size_t size) noexcept;
+    void PutString(std::string_view value) noexcept;
+
+    BinaryLogRecord* m_record{};
+    bool m_full{false};
+};
+
+template<typename T>
+void BinaryLog::Encoder::Put(const T& value) noexcept {
+    using U = std::remove_cvref_t<T>;
+    if constexpr(std::is_same_v<U, bool>) {
+        const auto byte = static_cast<std::uint8_t>(value);
+        PutBytes(BinaryLogArgType::Bool, &byte, sizeof(byte));
+    } else if constexpr(std::is_same_v<U, char>) {
+        PutBytes(BinaryLogArgType::Char, &value, sizeof(value));
+    } else if constexpr(std::is_enum_v<U>) {
+        Put(static_cast<std::underlying_type_t<U>>(value));
+    } else if constexpr(std::is_integral_v<U> && std::is_signed_v<U>) {
+        const auto wide = static_cast<std::int64_t>(value);
+        PutBytes(BinaryLogArgType::Int, &wide, sizeof(wide));
+    } else if constexpr(std::is_integral_v<U>) {
+        const auto wide = static_cast<std::uint64_t>(value);
+        PutBytes(BinaryLogArgType::UInt, &wide, sizeof(wide));
+    } else if constexpr(std::is_floating_point_v<U>) {
+        const auto wide = static_cast<double>(value);
+        PutBytes(BinaryLogArgType::Double, &wide, sizeof(wide));
+    } else if constexpr(std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+        PutString(value ? std::string_view{value} : std::string_view{"(null)"});
+    } else if constexpr(std::is_convertible_v<const U&, std::string_view>) {
+        PutString(std::string_view{value});
+    } else if constexpr(std::is_pointer_v<U>) {
+        const auto address = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value));
+        PutBytes(BinaryLogArgType::Pointer, &address, sizeof(address));
+    } else {
+        static_assert(std::is_void_v<U>, "LOG_STRUCTURED arguments must be arithmetic, enums, strings or pointers; format anything else into a string first.");
+    }
+}
+
+template<typename... Args>
+void BinaryLog::Write(std::uint32_t format_id, const Args&... args) noexcept {
+    BinaryLogRecord record;
+    record.timestamp_ns = Now();
+    record.format_id = format_id;
+    record.thread_index = 0u;
+    record.payload_size = 0u;
+    Encoder encoder{record};
+    (encoder.Put(args), ...);
+    Submit(record);
+}
+
+template<typename... Args>
+void BinaryLog::WriteWithFormat(std::uint32_t format_id, [[maybe_unused]] std::string_view format, const Args&... args) noexcept {
+    Write(format_id, args...);
+}
+
+template<typename... Args>
+constexpr std::string_view BinaryLog::FormatOf(std::string_view format, [[maybe_unused]] const Args&... args) noexcept {
+    return format;
+}
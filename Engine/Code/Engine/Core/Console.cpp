@@ -1,6 +1,7 @@
 #include "Engine/Core/Console.hpp"
 
 #include "Engine/Core/ArgumentParser.hpp"
+#include "Engine/Core/BinaryLog.hpp"
 #include "Engine/Core/BuildConfig.hpp"
 #include "Engine/Core/Clipboard.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
@@ -14,6 +15,8 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/Matrix4.hpp"
 #include "Engine/Math/Vector3.hpp"
+#include "Engine/Profiling/Instrumentor.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 #include "Engine/RHI/RHIOutput.hpp"
 
 #include "Engine/Renderer/Camera2D.hpp"
@@ -29,6 +32,7 @@
 #include <Thirdparty/Tracy/tracy/Tracy.hpp>
 #endif
 
+#include <charconv>
 #include <iterator>
 #include <sstream>
 #include <utility>
@@ -935,6 +939,113 @@ void Console::RegisterDefaultCommands() noexcept {
         m_output_buffer.clear();
     };
     RegisterCommand(clear);
+
+    Console::Command decodelog{};
+    decodelog.command_name = "decodelog";
+    decodelog.help_text_short = "Renders a binary structured log as text.";
+    decodelog.help_text_long = "decodelog [path] [output]: Decodes a .blog file written in binary structured log mode. Output defaults to the input path with a .txt extension.";
+    decodelog.command_function = [this](const std::string& args) -> void {
+        ArgumentParser arg_set(args);
+        std::string input{};
+        if(!(arg_set >> input)) {
+            ErrorMsg("decodelog: expected the path of a .blog file.");
+            return;
+        }
+        std::string output{};
+        const auto output_path = (arg_set >> output) ? std::filesystem::path{output} : std::filesystem::path{input}.replace_extension(".txt");
+        if(BinaryLog::Decode(input, output_path)) {
+            PrintMsg(std::format("Decoded {} to {}", input, output_path));
+        } else {
+            ErrorMsg(std::format("decodelog: {} is not a readable binary log, or {} could not be written.", input, output_path));
+        }
+    };
+    RegisterCommand(decodelog);
+
+    Console::Command trace{};
+    trace.command_name = "trace";
+    trace.help_text_short = "Starts or stops a Chrome trace of the profiled scopes.";
+    trace.help_text_long = "trace [path] | trace end: Records every PROFILE_BENCHMARK_SCOPE to a Chrome trace file (default trace.json) until trace end. Open it in chrome://tracing or Perfetto.";
+    trace.command_function = [this](const std::string& args) -> void {
+        ArgumentParser arg_set(args);
+        std::string cur_arg{};
+        auto& instrumentor = Instrumentor::Get();
+        if(arg_set >> cur_arg && cur_arg == "end") {
+            if(!instrumentor.IsSessionActive()) {
+                ErrorMsg("trace: no trace is running.");
+                return;
+            }
+            instrumentor.EndSession();
+            PrintMsg("Trace written.");
+            return;
+        }
+        const auto path = std::filesystem::path{cur_arg.empty() ? std::string{"trace.json"} : cur_arg};
+        instrumentor.BeginSession("Console", path);
+        if(instrumentor.IsSessionActive()) {
+            PrintMsg(std::format("Tracing to {}. Enter trace end to stop.", path));
+        } else {
+            ErrorMsg(std::format("trace: could not open {}.", path));
+        }
+    };
+    RegisterCommand(trace);
+
+    Console::Command metrics{};
+    metrics.command_name = "metrics";
+    metrics.help_text_short = "Displays p50/p95/p99 of engine metrics over recent frames.";
+    metrics.help_text_long = "metrics [frames] | metrics csv [path] [frames] | metrics reset: Summarizes the last frames (default 300) or writes them one row per frame to a CSV file (default metrics.csv). Histogram rows summarize the values recorded during those frames.";
+    metrics.command_function = [this](const std::string& args) -> void {
+        constexpr std::size_t default_frame_count = 300u;
+        const auto parse_frames = [](const std::string& text, std::size_t& frames) {
+            return std::from_chars(text.data(), text.data() + text.size(), frames).ec == std::errc{};
+        };
+        ArgumentParser arg_set(args);
+        std::string cur_arg{};
+        std::size_t frames = default_frame_count;
+        if(arg_set >> cur_arg) {
+            if(cur_arg == "reset") {
+                Metrics::Reset();
+                PrintMsg("Metrics history and histograms cleared.");
+                return;
+            }
+            if(cur_arg == "csv") {
+                std::string path{"metrics.csv"};
+                std::string path_arg{};
+                if(arg_set >> path_arg) {
+                    path = path_arg;
+                    std::string frames_arg{};
+                    if(arg_set >> frames_arg && !parse_frames(frames_arg, frames)) {
+                        ErrorMsg(std::format("metrics: {} is not a frame count.", frames_arg));
+                        return;
+                    }
+                }
+                if(Metrics::WriteCsv(path, frames)) {
+                    PrintMsg(std::format("Wrote {} frames of metrics to {}", (std::min)(frames, Metrics::GetHistorySize()), path));
+                } else {
+                    ErrorMsg(std::format("metrics: could not write {}.", path));
+                }
+                return;
+            }
+            if(!parse_frames(cur_arg, frames)) {
+                ErrorMsg(std::format("metrics: {} is not a frame count.", cur_arg));
+                return;
+            }
+        }
+        const auto summaries = Metrics::Summarize(frames);
+        const auto print_rows = [&](bool histograms) {
+            PrintMsg(std::format("{:<40}{:>12}{:>12}{:>12}{:>12}{:>12}{:>12}", "metric", "p50", "p95", "p99", "max", "mean", "samples"));
+            for(const auto& summary : summaries) {
+                if(!summary.samples || (summary.kind == MetricKind::Histogram) != histograms) {
+                    continue;
+                }
+                PrintMsg(std::format("{:<40}{:>12.2f}{:>12.2f}{:>12.2f}{:>12.2f}{:>12.2f}{:>12}", summary.name, summary.p50, summary.p95, summary.p99, summary.max, summary.mean, summary.samples));
+            }
+        };
+        const auto history = (std::min)(frames, Metrics::GetHistorySize());
+        PrintMsg(std::format("Per frame, last {} frames:", history));
+        print_rows(false);
+        PrintMsg(std::format("Histograms, every value recorded in the last {} frames:", history));
+        print_rows(true);
+    };
+    RegisterCommand(metrics);
 }
 
 void Console::BeginFrame() noexcept {
@@ -966,10 +1077,13 @@ void Console::Render() const noexcept {
     renderer->SetViewportAsPercent(0.0f, 0.0f, 1.0f, 0.957f);
 
     const auto view_half_extents = SetupViewFromCamera();
+    //The background, selection and entry line text are quads; the output's scissor change flushes them in order.
+    renderer->BeginSpriteBatch();
     DrawBackground(view_half_extents);
     DrawOutput(view_half_extents);
     DrawEntryLine(view_half_extents);
     DrawCursor(view_half_extents);
+    renderer->EndSpriteBatch();
 }
 
 void Console::DrawCursor(const Vector2& view_half_extents) const noexcept {
@@ -10,6 +10,7 @@
 #include "Engine/Platform/Win.hpp"
 
 #include "Engine/Profiling/AllocationTracker.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 
 #include "Engine/Services/IJobSystemService.hpp"
 #include "Engine/Services/ServiceLocator.hpp"
@@ -18,14 +19,25 @@
 #include <Thirdparty/Tracy/tracy/Tracy.hpp>
 #endif
 
+#include <array>
 #include <chrono>
 #include <cstdarg>
 #include <cstdio>
 #include <filesystem>
 #include <iostream>
+#include <span>
 
 namespace FS = std::filesystem;
 
+namespace {
+
+MetricsCounter& GetLogMessageCounter() noexcept {
+    static auto& log_messages = Metrics::GetCounter("log.messages");
+    return log_messages;
+}
+
+} // namespace
+
 FileLogger::FileLogger(const std::string& logName) noexcept
 : IFileLoggerService()
 {
@@ -48,28 +60,116 @@ void FileLogger::Log_worker() noexcept {
 #ifdef PROFILE_BUILD
     FrameMarkStart("FileLogger worker");
 #endif
+    //Logging jobs have no signal of their own; they run whenever something else wakes the worker.
     JobConsumer jc;
     jc.AddCategory(JobType::Logging);
-    auto* js = ServiceLocator::get<IJobSystemService>();
-    js->SetCategorySignal(JobType::Logging, &m_signal);
-
-    while(IsRunning()) {
-        std::unique_lock<std::mutex> lock(m_cs);
-        //Condition to wake up: not running or queue has jobs.
-        m_signal.wait(lock, [this]() -> bool { return !m_is_running || !m_queue.empty(); });
-        if(!m_queue.empty()) {
-            const std::string str = m_queue.front();
-            m_queue.pop();
-            m_stream << str;
+    BinaryLog::SetDrainSignal(&m_wake_epoch);
+
+    for(;;) {
+        //Read before the running flag and before draining. Anything queued after this point bumps the epoch,
+        //so the wait below returns at once instead of sleeping on a message nobody will announce again.
+        const auto epoch = m_wake_epoch.load();
+        if(!IsRunning()) {
+            break;
+        }
+        {
+            std::scoped_lock<std::mutex> lock(m_cs);
+            WriteQueued();
+            WriteStructured();
+            //A Flush may have woken the worker with nothing queued, so the request is checked every time round.
             RequestFlush();
-            jc.ConsumeAll();
         }
+        jc.ConsumeAll();
+        m_worker_sleeping = true;
+        m_wake_epoch.wait(epoch);
+        m_worker_sleeping = false;
+    }
+    BinaryLog::SetDrainSignal(nullptr);
+    //Whatever was logged between the last wakeup and shutdown, including the shutdown message itself.
+    {
+        std::scoped_lock<std::mutex> lock(m_cs);
+        WriteQueued();
+        WriteStructured();
+        RequestFlush();
     }
 #ifdef PROFILE_BUILD
     FrameMarkEnd("FileLogger worker");
 #endif
 }
 
+void FileLogger::WriteQueued() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    std::array<std::string, max_messages_per_write> batch{};
+    while(const auto count = m_queue.try_pop_n(batch)) {
+        for(std::size_t i = 0u; i < count; ++i) {
+            m_stream << batch[i];
+        }
+    }
+}
+
+void FileLogger::WriteStructured() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    if(m_structured_records.size() != max_records_per_drain) {
+        m_structured_records.resize(max_records_per_drain);
+    }
+    const auto binary = m_structured_mode.load(std::memory_order_relaxed) == StructuredLogMode::Binary;
+    if(binary && !m_binary_writer) {
+        auto binary_path = m_current_log_path;
+        m_binary_stream.open(binary_path.replace_extension(".blog"), std::ios_base::binary | std::ios_base::trunc);
+        m_binary_writer = std::make_unique<BinaryLogWriter>(m_binary_stream);
+    }
+    for(;;) {
+        const auto count = BinaryLog::Drain(m_structured_records);
+        const auto records = std::span<const BinaryLogRecord>{m_structured_records}.first(count);
+        //Structured records are counted as they are drained rather than in the hot LOG_STRUCTURED path.
+        GetLogMessageCounter().Add(count);
+        if(binary) {
+            m_binary_writer->Write(records);
+        } else {
+            for(const auto& record : records) {
+                m_stream << BinaryLog::FormatLine(GetStructuredFormat(record.format_id), record) << '\n';
+            }
+        }
+        if(count < max_records_per_drain) {
+            break;
+        }
+    }
+    if(const auto dropped = BinaryLog::GetDroppedCount(); dropped != m_reported_dropped) {
+        if(binary) {
+            m_binary_writer->WriteDropped(dropped - m_reported_dropped);
+        } else {
+            m_stream << std::format("[{} structured log records dropped: a thread's ring was full]\n", dropped - m_reported_dropped);
+        }
+        m_reported_dropped = dropped;
+    }
+}
+
+const std::string& FileLogger::GetStructuredFormat(std::uint32_t format_id) noexcept {
+    //Formats never change once registered, so each is copied out of BinaryLog's locked registry only once.
+    if(m_structured_formats.size() <= format_id) {
+        m_structured_formats.resize(format_id + 1u);
+    }
+    auto& format = m_structured_formats[format_id];
+    if(format.empty()) {
+        format = BinaryLog::GetFormat(format_id);
+    }
+    return format;
+}
+
+void FileLogger::SetStructuredLogMode(StructuredLogMode mode) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    m_structured_mode.store(mode, std::memory_order_relaxed);
+}
+
 void FileLogger::RequestFlush() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
@@ -161,6 +261,8 @@ void FileLogger::FinalizeLog() noexcept {
     m_stream << std::format("Copied log to: {}\n", to_p);
     m_stream.flush();
     m_stream.close();
+    m_binary_writer.reset();
+    m_binary_stream.close();
     std::cout.rdbuf(m_old_cout);
     std::filesystem::copy_file(from_p, to_p, std::filesystem::copy_options::overwrite_existing);
 }
@@ -222,12 +324,12 @@ void FileLogger::Shutdown() noexcept {
             LogLine(std::format("Shutting down Logger: {}...", m_current_log_path));
         }
         SetIsRunning(false);
-        m_signal.notify_all();
+        ++m_wake_epoch;
+        m_wake_epoch.notify_all();
         if(m_worker.joinable()) {
             m_worker.join();
         }
         FinalizeLog();
-        ServiceLocator::get<IJobSystemService>()->SetCategorySignal(JobType::Logging, nullptr);
     }
 }
 
@@ -236,11 +338,34 @@ void FileLogger::Log(const std::string& msg) noexcept {
     ZoneScopedC(0xFF0000);
 #endif
 
-    {
-        std::scoped_lock<std::mutex> lock(m_cs);
-        m_queue.push(msg);
+    GetLogMessageCounter().Add();
+    //The queue is bounded. A full queue waits for the worker to catch up rather than dropping the message,
+    //except on the worker itself, which would be waiting on its own loop, and once the worker has stopped.
+    while(!m_queue.try_push(msg)) {
+        if(!m_is_running) {
+            return;
+        }
+        if(std::this_thread::get_id() == m_worker.get_id()) {
+            m_stream << msg;
+            return;
+        }
+        Wake();
+        std::this_thread::yield();
+    }
+    Wake();
+}
+
+void FileLogger::Wake() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    //The bump alone is enough while the worker is busy: it rereads the epoch before it next sleeps.
+    //Only the first producer to find it asleep pays for the notify; the rest would each make a wake syscall
+    //until the worker is scheduled, which on a busy core is every Log call.
+    ++m_wake_epoch;
+    if(m_worker_sleeping.load() && m_worker_sleeping.exchange(false)) {
+        m_wake_epoch.notify_one();
     }
-    m_signal.notify_all();
 }
 
 void FileLogger::LogLine(const std::string& msg) noexcept {
@@ -338,8 +463,18 @@ void FileLogger::Flush() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    if(!m_is_running) {
+        return;
+    }
+    //The worker would be waiting on itself; everything it has popped is already in the stream.
+    if(std::this_thread::get_id() == m_worker.get_id()) {
+        m_stream.flush();
+        return;
+    }
     m_requesting_flush = true;
-    while(m_requesting_flush) {
+    Wake();
+    //Stops waiting once the logger shuts down; the worker's final drain flushes whatever is left.
+    while(m_requesting_flush && m_is_running) {
         std::this_thread::yield();
     }
 }
@@ -1,17 +1,19 @@
 #pragma once
 
-#include "Engine/Core/ThreadSafeQueue.hpp"
+#include "Engine/Core/BinaryLog.hpp"
+#include "Engine/Core/MpscQueue.hpp"
 #include "Engine/Services/IFileLoggerService.hpp"
 
 #include <atomic>
-#include <condition_variable>
 #include <filesystem>
 #include <fstream>
 #include <iosfwd>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 class JobSystem;
 
@@ -42,12 +44,21 @@ public:
     void SetIsRunning(bool value = true) noexcept;
 
     void SaveLog() noexcept override;
+    void SetStructuredLogMode(StructuredLogMode mode) noexcept override;
 
 protected:
 private:
+    static constexpr std::size_t max_queued_messages = 4096u;
+    static constexpr std::size_t max_messages_per_write = 64u;
+    static constexpr std::size_t max_records_per_drain = 256u;
+
     void Initialize(const std::string& log_name) noexcept;
+    void WriteQueued() noexcept;
+    void WriteStructured() noexcept;
+    [[nodiscard]] const std::string& GetStructuredFormat(std::uint32_t format_id) noexcept;
 
     void Log_worker() noexcept;
+    void Wake() noexcept;
     void RequestFlush() noexcept;
     [[nodiscard]] bool IsRunning() const noexcept;
 
@@ -60,8 +71,18 @@ private:
     std::filesystem::path m_current_log_path{};
     std::streambuf* m_old_cout{};
     std::jthread m_worker{};
-    std::condition_variable m_signal{};
-    ThreadSafeQueue<std::string> m_queue;
+    //Bumped by everything that hands the worker something to write; the worker sleeps on it with an atomic wait.
+    std::atomic<std::uint64_t> m_wake_epoch{0u};
+    std::atomic_bool m_worker_sleeping = false;
+    //Any thread logs; only the worker drains.
+    MpscQueue<std::string> m_queue{max_queued_messages};
+    //Worker only: drained records, the format strings seen so far and the .blog output.
+    std::vector<BinaryLogRecord> m_structured_records{};
+    std::vector<std::string> m_structured_formats{};
+    std::ofstream m_binary_stream{};
+    std::unique_ptr<BinaryLogWriter> m_binary_writer{};
+    std::uint64_t m_reported_dropped{0u};
+    std::atomic<StructuredLogMode> m_structured_mode{StructuredLogMode::Text};
     std::atomic_bool m_is_running = false;
     std::atomic_bool m_requesting_flush = false;
 };
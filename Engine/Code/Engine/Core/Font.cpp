@@ -2,6 +2,7 @@
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 #include "Engine/Core/Image.hpp"
 #include "Engine/Core/Rgba.hpp"
 
@@ -32,17 +33,17 @@ Font::Font(std::filesystem::path path, const IntVector2& pixelDimensions) noexce
 }
 
 bool Font::LoadFont(std::filesystem::path path, const IntVector2& pixelDimensions) noexcept {
-    if(auto file_contents = FileUtils::ReadBinaryBufferFromFile(path); !file_contents.has_value()) {
+    if(const auto file_contents = FileUtils::MappedFile::Open(path); !file_contents.has_value()) {
         auto* logger = ServiceLocator::get<IFileLoggerService>();
         logger->LogLineAndFlush(std::format("Failed to read file contents from {}", path));
     } else {
         m_filepath = path;
-        return LoadFont(*file_contents, pixelDimensions);
+        return LoadFont(file_contents->GetBytes(), pixelDimensions);
     }
     return m_loaded;
 }
 
-bool Font::LoadFont(const std::vector<uint8_t>& buffer, const IntVector2& pixelDimensions) noexcept {
+bool Font::LoadFont(std::span<const uint8_t> buffer, const IntVector2& pixelDimensions) noexcept {
     FT_Library library{nullptr};
     if(const auto ft_init_error = FT_Init_FreeType(&library); ft_init_error != FT_Err_Ok) {
         return false;
@@ -149,7 +150,7 @@ bool Font::LoadFromFile(std::filesystem::path filepath) noexcept {
     return LoadFont(filepath, IntVector2{32,32});
 }
 
-bool Font::LoadFromBuffer(const std::vector<uint8_t>& buffer) noexcept {
+bool Font::LoadFromBuffer(std::span<const uint8_t> buffer) noexcept {
     return LoadFont(buffer, IntVector2{32,32});
 }
 
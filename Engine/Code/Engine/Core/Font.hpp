@@ -24,7 +24,7 @@ public:
     ~Font() noexcept = default;
 
     [[nodiscard]] bool LoadFont(std::filesystem::path path, const IntVector2& pixelDimensions) noexcept;
-    [[nodiscard]] bool LoadFont(const std::vector<uint8_t>& buffer, const IntVector2& pixelDimensions) noexcept;
+    [[nodiscard]] bool LoadFont(std::span<const uint8_t> buffer, const IntVector2& pixelDimensions) noexcept;
 
     [[nodiscard]] bool IsLoaded() const noexcept override;
     [[nodiscard]] const std::string& GetName() const noexcept override;
@@ -64,7 +64,7 @@ public:
      [[nodiscard]] float GetLineHeight() const noexcept override;
      [[nodiscard]] float GetLineHeightAsUV() const noexcept override;
      [[nodiscard]] bool LoadFromFile(std::filesystem::path filepath) noexcept override;
-     [[nodiscard]] bool LoadFromBuffer(const std::vector<uint8_t>& buffer) noexcept override;
+     [[nodiscard]] bool LoadFromBuffer(std::span<const uint8_t> buffer) noexcept override;
      [[nodiscard]] Material* GetMaterial() const noexcept override;
      [[nodiscard]] void SetMaterial(Material* mat) noexcept override;
      [[nodiscard]] int GetKerningValue(unsigned long first, unsigned long second) const noexcept override;
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 
 #include "Engine/Services/ServiceLocator.hpp"
 #include "Engine/Services/IFileLoggerService.hpp"
@@ -79,7 +80,7 @@ bool Gif::Load(std::filesystem::path filepath) noexcept {
         }
     }
 
-    if(const auto buffer = FileUtils::ReadBinaryBufferFromFile(filepath); !buffer.has_value()) {
+    if(const auto buffer = FileUtils::MappedFile::Open(filepath); !buffer.has_value()) {
         logger->LogLineAndFlush("Gif: failed to read binary buffer.\n");
         return false;
     } else {
@@ -90,7 +91,7 @@ bool Gif::Load(std::filesystem::path filepath) noexcept {
         auto data_deleter = [](uint8_t* p) {
             stbi_image_free(p);
         };
-        auto data = std::unique_ptr<uint8_t, decltype(data_deleter)>(stbi_load_gif_from_memory((*buffer).data(), static_cast<int>((*buffer).size()), &delays, &width, &height, &frame_count, nullptr, 4), data_deleter);
+        auto data = std::unique_ptr<uint8_t, decltype(data_deleter)>(stbi_load_gif_from_memory(buffer->data(), static_cast<int>(buffer->size()), &delays, &width, &height, &frame_count, nullptr, 4), data_deleter);
         if(data.get() == nullptr) {
             logger->LogLineAndFlush(std::format("stbi failed to load .gif from file: {}", filepath));
             return false;
@@ -166,6 +167,8 @@ void Gif::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
 void Gif::Render(const Matrix4& transform /*= Matrix4::I*/) const noexcept {
     auto* r = ServiceLocator::get<IRendererService>();
     auto* mat = r->GetMaterial("__unlit2DSprite");
+    //Drawn unbatched; see Flipbook::Render.
+    r->FlushSpriteBatch();
     if(const auto& cbs = mat->GetShader()->GetConstantBuffers(); !cbs.empty()) {
         auto& cb = cbs[0].get();
         IntVector4 data{static_cast<int>(m_currentFrame), 0, 0, 0};
@@ -174,6 +177,7 @@ void Gif::Render(const Matrix4& transform /*= Matrix4::I*/) const noexcept {
     r->SetMaterial(mat);
     r->SetTexture(m_texture);
     r->DrawQuad2D(transform);
+    r->FlushSpriteBatch();
 }
 
 IntVector2 Gif::GetDimensions() const noexcept {
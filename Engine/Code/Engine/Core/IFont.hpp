@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -26,7 +27,7 @@ public:
     [[nodiscard]] virtual float GetLineHeightAsUV() const noexcept = 0;
 
     [[nodiscard]] virtual bool LoadFromFile(std::filesystem::path filepath) noexcept = 0;
-    [[nodiscard]] virtual bool LoadFromBuffer(const std::vector<uint8_t>& buffer) noexcept = 0;
+    [[nodiscard]] virtual bool LoadFromBuffer(std::span<const uint8_t> buffer) noexcept = 0;
 
     [[nodiscard]] virtual Material* GetMaterial() const noexcept = 0;
     virtual void SetMaterial(Material* mat) noexcept = 0;
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Platform/Win.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -13,6 +14,7 @@
 #include "Engine/Renderer/Texture3D.hpp"
 
 #include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IJobSystemService.hpp"
 #include "Engine/Services/IRendererService.hpp"
 
 #include <Thirdparty/stb/stb_image.h>
@@ -52,70 +54,80 @@ Image::Image(std::filesystem::path filepath) noexcept
         }
     }
     filepath.make_preferred();
-    if(const auto& buf = FileUtils::ReadBinaryBufferFromFile(filepath); buf.has_value()) {
-        int comp = 0;
-        int req_comp = 4;
-        if(auto* texel_bytes = stbi_load_from_memory(buf->data(), static_cast<int>(buf->size()), &m_dimensions.x, &m_dimensions.y, &comp, req_comp); texel_bytes != nullptr) {
-            //Image data is basic image file. Use stbi to load it.
-            m_bytesPerTexel = req_comp;
-            m_texelBytes = std::vector<unsigned char>(texel_bytes, texel_bytes + (static_cast<std::size_t>(m_dimensions.x) * m_dimensions.y * m_bytesPerTexel));
-            stbi_image_free(texel_bytes);
-        } else if(auto webpvalid = !!WebPGetInfo(buf->data(), buf->size(), &m_dimensions.x, &m_dimensions.y); webpvalid == true) {
-            //Image data is a .webp file. 
-            WebPBitstreamFeatures features{};
-            if(auto features_href = WebPGetFeatures(buf->data(), buf->size(), &features); features_href == VP8_STATUS_OK) {
-                if(!features.has_animation) { //.webp file is a static image.
-                    if(auto* bytes = WebPDecodeRGBA(buf->data(), buf->size(), &m_dimensions.x, &m_dimensions.y); bytes != nullptr) {
-                        m_bytesPerTexel = req_comp;
-                        m_texelBytes = std::vector<unsigned char>(bytes, bytes + (static_cast<std::size_t>(m_dimensions.x) * m_dimensions.y * m_bytesPerTexel));
-                        WebPFree(bytes);
-                    } else {
-                        const auto error_msg = std::format("Failed to load image. {} is not a valid .webp file.", filepath);
-                        GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
-                    }
-                } else { //.webp file is animated.
-                    auto* logger = ServiceLocator::get<IFileLoggerService>();
-                    logger->LogWarnLine("Loading animated .webp files are not supported by the Image type. Use the WebP types instead.");
+    if(const auto file = FileUtils::MappedFile::Open(filepath); file.has_value()) {
+        DecodeFileBuffer(file->GetBytes());
+    } else {
+        const auto error_msg = std::format("Failed to load image. File '{}' not read successfully.", filepath);
+        GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
+    }
+}
+
+Image::Image(std::span<const unsigned char> fileBuffer, std::filesystem::path filepath) noexcept
+: m_filepath(filepath) {
+    DecodeFileBuffer(fileBuffer);
+}
+
+void Image::DecodeFileBuffer(std::span<const unsigned char> fileBuffer) noexcept {
+    const auto& filepath = m_filepath;
+    int comp = 0;
+    int req_comp = 4;
+    if(auto* texel_bytes = stbi_load_from_memory(fileBuffer.data(), static_cast<int>(fileBuffer.size()), &m_dimensions.x, &m_dimensions.y, &comp, req_comp); texel_bytes != nullptr) {
+        //Image data is basic image file. Use stbi to load it.
+        m_bytesPerTexel = req_comp;
+        m_texelBytes = std::vector<unsigned char>(texel_bytes, texel_bytes + (static_cast<std::size_t>(m_dimensions.x) * m_dimensions.y * m_bytesPerTexel));
+        stbi_image_free(texel_bytes);
+    } else if(auto webpvalid = !!WebPGetInfo(fileBuffer.data(), fileBuffer.size(), &m_dimensions.x, &m_dimensions.y); webpvalid == true) {
+        //Image data is a .webp file. 
+        WebPBitstreamFeatures features{};
+        if(auto features_href = WebPGetFeatures(fileBuffer.data(), fileBuffer.size(), &features); features_href == VP8_STATUS_OK) {
+            if(!features.has_animation) { //.webp file is a static image.
+                if(auto* bytes = WebPDecodeRGBA(fileBuffer.data(), fileBuffer.size(), &m_dimensions.x, &m_dimensions.y); bytes != nullptr) {
                     m_bytesPerTexel = req_comp;
-                    WebPData webp_data{};
-                    webp_data.bytes = buf->data();
-                    webp_data.size = buf->size();
-                    if(WebPDemuxer* demux = WebPDemux(&webp_data); demux != nullptr) {
-                        m_dimensions.x = WebPDemuxGetI(demux, WEBP_FF_CANVAS_WIDTH);
-                        m_dimensions.y = WebPDemuxGetI(demux, WEBP_FF_CANVAS_HEIGHT);
-                        //const auto format = WebPDemuxGetI(demux, WEBP_FF_FORMAT_FLAGS);
-                        //const auto frame_count = WebPDemuxGetI(demux, WEBP_FF_FRAME_COUNT);
-                        //const auto loop_count = WebPDemuxGetI(demux, WEBP_FF_LOOP_COUNT);
-                        //const auto background_color = WebPDemuxGetI(demux, WEBP_FF_BACKGROUND_COLOR);
-
-                        {
-                            WebPIterator iter{};
-                            if(WebPDemuxGetFrame(demux, 1, &iter)) {
-                                //do {
-                                auto* frame_data = WebPDecodeRGBA(iter.fragment.bytes, iter.fragment.size, &m_dimensions.x, &m_dimensions.y);
-                                const auto slice = m_dimensions.x * m_bytesPerTexel * m_dimensions.y;
-                                m_texelBytes = std::vector<unsigned char>(frame_data, frame_data + slice);
-                                WebPFree(frame_data);
-                                frame_data = nullptr;
-                                //} while(WebPDemuxNextFrame(&iter));
-                            }
-                            WebPDemuxReleaseIterator(&iter);
+                    m_texelBytes = std::vector<unsigned char>(bytes, bytes + (static_cast<std::size_t>(m_dimensions.x) * m_dimensions.y * m_bytesPerTexel));
+                    WebPFree(bytes);
+                } else {
+                    const auto error_msg = std::format("Failed to load image. {} is not a valid .webp file.", filepath);
+                    GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
+                }
+            } else { //.webp file is animated.
+                auto* logger = ServiceLocator::get<IFileLoggerService>();
+                logger->LogWarnLine("Loading animated .webp files are not supported by the Image type. Use the WebP types instead.");
+                m_bytesPerTexel = req_comp;
+                WebPData webp_data{};
+                webp_data.bytes = fileBuffer.data();
+                webp_data.size = fileBuffer.size();
+                if(WebPDemuxer* demux = WebPDemux(&webp_data); demux != nullptr) {
+                    m_dimensions.x = WebPDemuxGetI(demux, WEBP_FF_CANVAS_WIDTH);
+                    m_dimensions.y = WebPDemuxGetI(demux, WEBP_FF_CANVAS_HEIGHT);
+                    //const auto format = WebPDemuxGetI(demux, WEBP_FF_FORMAT_FLAGS);
+                    //const auto frame_count = WebPDemuxGetI(demux, WEBP_FF_FRAME_COUNT);
+                    //const auto loop_count = WebPDemuxGetI(demux, WEBP_FF_LOOP_COUNT);
+                    //const auto background_color = WebPDemuxGetI(demux, WEBP_FF_BACKGROUND_COLOR);
+
+                    {
+                        WebPIterator iter{};
+                        if(WebPDemuxGetFrame(demux, 1, &iter)) {
+                            //do {
+                            auto* frame_data = WebPDecodeRGBA(iter.fragment.bytes, iter.fragment.size, &m_dimensions.x, &m_dimensions.y);
+                            const auto slice = m_dimensions.x * m_bytesPerTexel * m_dimensions.y;
+                            m_texelBytes = std::vector<unsigned char>(frame_data, frame_data + slice);
+                            WebPFree(frame_data);
+                            frame_data = nullptr;
+                            //} while(WebPDemuxNextFrame(&iter));
                         }
-
-                        WebPDemuxDelete(demux);
-                        demux = nullptr;
-                    } else {
-                        const auto error_msg = std::format("Failed to load image. {} is not a valid animated .webp file.", filepath);
-                        GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
+                        WebPDemuxReleaseIterator(&iter);
                     }
+
+                    WebPDemuxDelete(demux);
+                    demux = nullptr;
+                } else {
+                    const auto error_msg = std::format("Failed to load image. {} is not a valid animated .webp file.", filepath);
+                    GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
                 }
             }
-        } else {
-            const auto error_msg = std::format("Failed to load image. {} is not a supported image type.", filepath);
-            GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
         }
     } else {
-        const auto error_msg = std::format("Failed to load image. File '{}' not read successfully.", filepath);
+        const auto error_msg = std::format("Failed to load image. {} is not a supported image type.", filepath);
         GUARANTEE_RECOVERABLE(!m_texelBytes.empty(), error_msg.c_str());
     }
 }
@@ -197,14 +209,17 @@ Image::Image(const Texture* tex) noexcept {
         GUARANTEE_OR_DIE(SUCCEEDED(hr), StringUtils::FormatWindowsMessage(hr));
     }
 
-    auto* src = reinterpret_cast<unsigned int*>(resource.pData);
-    auto* dst = reinterpret_cast<unsigned int*>(m_texelBytes.data());
+    //The mapped rows are RowPitch bytes apart; the Image rows are tightly packed.
+    const auto* src = static_cast<const unsigned char*>(resource.pData);
+    auto* dst = m_texelBytes.data();
     const auto stride = static_cast<std::size_t>(desc.Width) * m_bytesPerTexel;
-    for(std::size_t i = 0u; i < desc.Height; ++i) {
-        std::memcpy(dst, src, stride);
-        dst += resource.RowPitch >> 2;
-        src += desc.Width;
-    }
+    const auto pitch = static_cast<std::size_t>(resource.RowPitch);
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    js->ParallelFor(0u, desc.Height, 64u, [src, dst, stride, pitch](std::size_t first, std::size_t last) {
+        for(auto row = first; row < last; ++row) {
+            std::memcpy(dst + row * stride, src + row * pitch, stride);
+        }
+    });
     dx_dc->Unmap(stage->GetDxResource(), 0u);
     stage.reset(nullptr);
 }
@@ -321,7 +336,7 @@ bool Image::Export(std::filesystem::path filepath, int bytes_per_pixel /*= 4*/,
     return 0 != result;
 }
 
-Image Image::CreateImageFromFileBuffer(const std::vector<unsigned char>& data) noexcept {
+Image Image::CreateImageFromFileBuffer(std::span<const unsigned char> data) noexcept {
     if(data.empty()) {
         DebuggerPrintf("Attempting to create image from empty data buffer.\n");
         return {};
@@ -6,7 +6,9 @@
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
+#include <vector>
 
 class Renderer;
 class Texture;
@@ -15,6 +17,8 @@ class Image {
 public:
     Image() = default;
     explicit Image(std::filesystem::path filepath) noexcept;
+    //Decodes an image file that has already been read into memory. filepath is only recorded, never opened.
+    Image(std::span<const unsigned char> fileBuffer, std::filesystem::path filepath) noexcept;
     Image(const Image& img) = delete;
     Image& operator=(const Image& rhs) = delete;
     Image(Image&& img) noexcept;
@@ -41,7 +45,7 @@ public:
     [[nodiscard]] int GetBytesPerTexel() const noexcept;
 
     [[nodiscard]] bool Export(std::filesystem::path filepath, int bytes_per_pixel = 4, int jpg_quality = 100) const noexcept;
-    [[nodiscard]] static Image CreateImageFromFileBuffer(const std::vector<unsigned char>& data) noexcept;
+    [[nodiscard]] static Image CreateImageFromFileBuffer(std::span<const unsigned char> data) noexcept;
     [[nodiscard]] static constexpr inline std::string GetSupportedExtensionsList() noexcept {
         return std::string(".png,.bmp,.tga,.jpg,.webp,.ppm");
     }
@@ -51,6 +55,7 @@ public:
 
 protected:
 private:
+    void DecodeFileBuffer(std::span<const unsigned char> fileBuffer) noexcept;
 
     IntVector2 m_dimensions{};
     unsigned int m_bytesPerTexel = 0;
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, std::size_t Capacity = 64u>
+class InplaceFunction;
+
+//Fixed-capacity, type-erased callable that stores its target inline.
+//Unlike std::function it never allocates: targets that do not fit are a compile-time error.
+template<typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template<typename F>
+    requires(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InplaceFunction(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>) {
+        using Target = std::decay_t<F>;
+        static_assert(sizeof(Target) <= Capacity, "Callable is too large for InplaceFunction. Capture less or capture by pointer.");
+        static_assert(alignof(Target) <= alignof(std::max_align_t), "Callable is over-aligned for InplaceFunction.");
+        static_assert(std::is_nothrow_move_constructible_v<Target>, "Callable must be nothrow move constructible.");
+        static_assert(std::is_copy_constructible_v<Target>, "Callable must be copy constructible.");
+        ::new(static_cast<void*>(&m_storage)) Target(std::forward<F>(f));
+        m_ops = &ops_for<Target>;
+    }
+
+    InplaceFunction(const InplaceFunction& other) {
+        if(other.m_ops) {
+            other.m_ops->copy(&m_storage, &other.m_storage);
+            m_ops = other.m_ops;
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        if(other.m_ops) {
+            other.m_ops->move(&m_storage, &other.m_storage);
+            m_ops = other.m_ops;
+            other.reset();
+        }
+    }
+
+    InplaceFunction& operator=(const InplaceFunction& rhs) {
+        if(this != &rhs) {
+            reset();
+            if(rhs.m_ops) {
+                rhs.m_ops->copy(&m_storage, &rhs.m_storage);
+                m_ops = rhs.m_ops;
+            }
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& rhs) noexcept {
+        if(this != &rhs) {
+            reset();
+            if(rhs.m_ops) {
+                rhs.m_ops->move(&m_storage, &rhs.m_storage);
+                m_ops = rhs.m_ops;
+                rhs.reset();
+            }
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~InplaceFunction() noexcept {
+        reset();
+    }
+
+    R operator()(Args... args) const {
+        return m_ops->invoke(const_cast<void*>(static_cast<const void*>(&m_storage)), std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return m_ops != nullptr;
+    }
+
+    void reset() noexcept {
+        if(m_ops) {
+            m_ops->destroy(&m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+protected:
+private:
+    struct Ops {
+        R (*invoke)(void* target, Args&&... args);
+        void (*copy)(void* dst, const void* src);
+        void (*move)(void* dst, void* src) noexcept;
+        void (*destroy)(void* target) noexcept;
+    };
+
+    template<typename Target>
+    static constexpr Ops ops_for{
+    [](void* target, Args&&... args) -> R { return std::invoke(*static_cast<Target*>(target), std::forward<Args>(args)...); },
+    [](void* dst, const void* src) { ::new(dst) Target(*static_cast<const Target*>(src)); },
+    [](void* dst, void* src) noexcept { ::new(dst) Target(std::move(*static_cast<Target*>(src))); },
+    [](void* target) noexcept { static_cast<Target*>(target)->~Target(); }};
+
+    alignas(std::max_align_t) std::byte m_storage[Capacity]{};
+    const Ops* m_ops{nullptr};
+};
@@ -0,0 +1,121 @@
+#include "Engine/Core/JobPool.hpp"
+
+#include "Engine/Core/JobTypes.hpp"
+
+#include "Engine/Profiling/AllocationTracker.hpp"
+
+#include <algorithm>
+#include <new>
+
+union JobPool::Slot {
+    Slot() noexcept {}
+    ~Slot() noexcept {}
+    FreeSlot free;
+    alignas(Job) std::byte storage[sizeof(Job)];
+};
+
+struct JobPool::ThreadCache {
+    std::uint64_t owner_id{0u};
+    FreeSlot* head{nullptr};
+    std::size_t count{0u};
+};
+
+JobPool::JobPool(std::size_t jobsPerSlab /*= default_slab_size*/) noexcept
+: m_slab_size{(std::max)(jobsPerSlab, std::size_t{16u})}
+, m_batch_size{(std::max)(m_slab_size / 16u, std::size_t{1u})}
+, m_id{s_next_id++} {
+    AllocateSlab();
+}
+
+JobPool::~JobPool() noexcept {
+    std::scoped_lock<std::mutex> lock(m_cs);
+    m_free = nullptr;
+    m_free_count = 0u;
+    m_slabs.clear();
+}
+
+Job* JobPool::Acquire() noexcept {
+    auto& cache = GetThreadCache();
+    if(!cache.head) {
+        Refill(cache);
+    }
+    auto* slot = cache.head;
+    cache.head = slot->next;
+    --cache.count;
+    AllocationTracker::track_job_pool_acquire();
+    return ::new(static_cast<void*>(slot)) Job();
+}
+
+void JobPool::Release(Job* job) noexcept {
+    if(!job) {
+        return;
+    }
+    job->~Job();
+    auto& cache = GetThreadCache();
+    auto* slot = ::new(static_cast<void*>(job)) FreeSlot{cache.head};
+    cache.head = slot;
+    ++cache.count;
+    AllocationTracker::track_job_pool_release();
+    //Threads that only release (e.g. the workers running jobs created on the main thread) hand surplus back to the pool.
+    if(cache.count > m_batch_size * 2u) {
+        Drain(cache, m_batch_size);
+    }
+}
+
+std::size_t JobPool::GetSlabCount() const noexcept {
+    std::scoped_lock<std::mutex> lock(m_cs);
+    return m_slabs.size();
+}
+
+std::size_t JobPool::GetCapacity() const noexcept {
+    std::scoped_lock<std::mutex> lock(m_cs);
+    return m_slabs.size() * m_slab_size;
+}
+
+JobPool::ThreadCache& JobPool::GetThreadCache() noexcept {
+    static thread_local ThreadCache cache{};
+    if(cache.owner_id != m_id) {
+        //Slots cached for a previous pool died with it.
+        cache = ThreadCache{m_id, nullptr, 0u};
+    }
+    return cache;
+}
+
+void JobPool::Refill(ThreadCache& cache) noexcept {
+    std::scoped_lock<std::mutex> lock(m_cs);
+    if(!m_free) {
+        AllocateSlab();
+    }
+    for(std::size_t i = 0u; i < m_batch_size && m_free; ++i) {
+        auto* slot = m_free;
+        m_free = slot->next;
+        --m_free_count;
+        slot->next = cache.head;
+        cache.head = slot;
+        ++cache.count;
+    }
+}
+
+void JobPool::Drain(ThreadCache& cache, std::size_t count) noexcept {
+    std::scoped_lock<std::mutex> lock(m_cs);
+    for(std::size_t i = 0u; i < count && cache.head; ++i) {
+        auto* slot = cache.head;
+        cache.head = slot->next;
+        --cache.count;
+        slot->next = m_free;
+        m_free = slot;
+        ++m_free_count;
+    }
+}
+
+void JobPool::AllocateSlab() noexcept {
+    //Assumes m_cs is held or the pool is still being constructed.
+    auto slab = std::make_unique<Slot[]>(m_slab_size);
+    for(std::size_t i = 0u; i < m_slab_size; ++i) {
+        auto* slot = ::new(static_cast<void*>(&slab[i])) FreeSlot{m_free};
+        m_free = slot;
+    }
+    m_free_count += m_slab_size;
+    AllocationTracker::track_job_pool_slab(m_slab_size * sizeof(Slot));
+    m_slabs.emplace_back(std::move(slab));
+}
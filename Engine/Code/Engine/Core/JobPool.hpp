@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Job;
+
+//Recycles Job storage so Create/Release do not hit the heap in steady state.
+//Each thread keeps a private free list; threads only take the pool lock to trade batches of free slots or to grow by a slab.
+class JobPool {
+public:
+    static constexpr std::size_t default_slab_size = 1024u;
+
+    explicit JobPool(std::size_t jobsPerSlab = default_slab_size) noexcept;
+    JobPool(const JobPool& other) = delete;
+    JobPool(JobPool&& other) = delete;
+    JobPool& operator=(const JobPool& other) = delete;
+    JobPool& operator=(JobPool&& other) = delete;
+    ~JobPool() noexcept;
+
+    [[nodiscard]] Job* Acquire() noexcept;
+    void Release(Job* job) noexcept;
+
+    [[nodiscard]] std::size_t GetSlabCount() const noexcept;
+    [[nodiscard]] std::size_t GetCapacity() const noexcept;
+
+protected:
+private:
+    struct FreeSlot {
+        FreeSlot* next{nullptr};
+    };
+    union Slot;
+    struct ThreadCache;
+
+    [[nodiscard]] ThreadCache& GetThreadCache() noexcept;
+    void Refill(ThreadCache& cache) noexcept;
+    void Drain(ThreadCache& cache, std::size_t count) noexcept;
+    void AllocateSlab() noexcept;
+
+    mutable std::mutex m_cs{};
+    std::vector<std::unique_ptr<Slot[]>> m_slabs{};
+    FreeSlot* m_free{nullptr};
+    std::size_t m_free_count{0u};
+    std::size_t m_slab_size{default_slab_size};
+    std::size_t m_batch_size{default_slab_size / 16u};
+    std::uint64_t m_id{0u};
+    static inline std::atomic<std::uint64_t> s_next_id{1u};
+};
@@ -6,33 +6,78 @@
 #include "Engine/Core/TimeUtils.hpp"
 #include "Engine/Core/TypeUtils.hpp"
 #include "Engine/Platform/Win.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 
 #ifdef PROFILE_BUILD
 #include <Thirdparty/Tracy/tracy/Tracy.hpp>
 #endif
 
+#include <algorithm>
 #include <chrono>
 #include <string>
 #include <sstream>
 
-void JobSystem::GenericJobWorker(std::condition_variable* signal) noexcept {
+namespace {
+constexpr std::size_t invalid_worker_index = static_cast<std::size_t>(-1);
+constexpr int idle_spin_count = 64;
+thread_local const JobSystem* tl_owner = nullptr;
+thread_local std::size_t tl_worker_index = invalid_worker_index;
+
+std::size_t GetRandomVictim(std::size_t victim_count) noexcept {
+    //xorshift: cheap and good enough to spread thieves across victims.
+    static thread_local std::uint32_t state = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+    return static_cast<std::size_t>(state) % victim_count;
+}
+} // namespace
+
+void JobSystem::GenericJobWorker(std::size_t worker_index) noexcept {
+    tl_owner = this;
+    tl_worker_index = worker_index;
+    int idle_spins = 0;
+    for(;;) {
+        //The epoch must be read before the running flag. Shutdown clears the flag and then bumps the epoch,
+        //so a worker that still sees the flag set is guaranteed to see the bump in its wait below.
+        const auto epoch = m_generic_epoch.load();
+        if(!IsRunning()) {
+            break;
+        }
+        if(TryRunGenericJob()) {
+            idle_spins = 0;
+            continue;
+        }
+        if(idle_spins++ < idle_spin_count) {
+            std::this_thread::yield();
+            continue;
+        }
+        //Condition to wake up: Not running or new jobs dispatched since the epoch was read.
+        ++m_sleeping_workers;
+        m_generic_epoch.wait(epoch);
+        --m_sleeping_workers;
+        idle_spins = 0;
+    }
+    tl_owner = nullptr;
+    tl_worker_index = invalid_worker_index;
+}
+
+void JobSystem::IoJobWorker() noexcept {
     JobConsumer jc;
-    jc.AddCategory(JobType::Generic);
-    SetCategorySignal(JobType::Generic, signal);
+    jc.AddCategory(JobType::Io);
+    auto* signal = m_signals[TypeUtils::GetUnderlyingValue<JobType>(JobType::Io)];
     while(IsRunning()) {
-        if(signal) {
-            std::unique_lock<std::mutex> lock(m_cs);
-            //Condition to wake up: Not running or has jobs available
-            signal->wait(lock, [&jc, this]() -> bool { return !m_is_running || jc.HasJobs(); });
-            if(jc.HasJobs()) {
-                jc.ConsumeAll();
-            }
+        {
+            std::unique_lock<std::mutex> lock(m_io_cs);
+            signal->wait(lock, [this, &jc]() -> bool { return !IsRunning() || jc.HasJobs(); });
         }
+        jc.ConsumeAll();
     }
 }
 
-JobSystem::JobSystem(int genericCount, std::size_t categoryCount, std::unique_ptr<std::condition_variable> mainJobSignal) noexcept
-: m_main_job_signal(mainJobSignal.release()) {
+JobSystem::JobSystem(int genericCount, std::size_t categoryCount, std::unique_ptr<std::condition_variable> mainJobSignal, std::size_t jobPoolSlabSize /*= JobPool::default_slab_size*/) noexcept
+: m_job_pool(jobPoolSlabSize)
+, m_main_job_signal(mainJobSignal.release()) {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
@@ -58,9 +103,11 @@ void JobSystem::Initialize(int genericCount, std::size_t categoryCount) noexcept
         core_count += genericCount;
     }
     --core_count;
+    core_count = (std::max)(core_count, 0);
     m_queues.resize(categoryCount);
     m_signals.resize(categoryCount);
     m_threads.resize(core_count);
+    m_deques.resize(static_cast<std::size_t>(core_count) + 1u);
     m_is_running = true;
 
     for(std::size_t i = 0; i < categoryCount; ++i) {
@@ -69,14 +116,24 @@ void JobSystem::Initialize(int genericCount, std::size_t categoryCount) noexcept
     for(std::size_t i = 0; i < categoryCount; ++i) {
         m_signals[i] = nullptr;
     }
-    m_signals[TypeUtils::GetUnderlyingValue<JobType>(JobType::Generic)] = new std::condition_variable;
+    for(auto& deque : m_deques) {
+        deque = std::make_unique<WorkStealingDeque<Job*>>();
+    }
+    tl_owner = this;
+    tl_worker_index = 0u;
 
     for(std::size_t i = 0; i < static_cast<std::size_t>(core_count); ++i) {
-        auto t = std::jthread(&JobSystem::GenericJobWorker, this, m_signals[TypeUtils::GetUnderlyingValue<JobType>(JobType::Generic)]);
+        auto t = std::jthread(&JobSystem::GenericJobWorker, this, i + 1u);
         std::string thread_desc = std::format("Generic Job Thread {}", i);
         ThreadUtils::SetThreadDescription(t, thread_desc);
         m_threads[i] = std::move(t);
     }
+    //Io jobs block on the disk, so they get a thread of their own instead of tying up a generic worker.
+    if(const auto io_category = TypeUtils::GetUnderlyingValue<JobType>(JobType::Io); io_category < categoryCount) {
+        m_signals[io_category] = new std::condition_variable{};
+        m_io_thread = std::jthread(&JobSystem::IoJobWorker, this);
+        ThreadUtils::SetThreadDescription(m_io_thread, std::string{"Io Job Thread"});
+    }
 }
 
 void JobSystem::BeginFrame() noexcept {
@@ -94,7 +151,13 @@ void JobSystem::Shutdown() noexcept {
     if(!IsRunning()) {
         return;
     }
-    m_is_running = false;
+    {
+        //Cleared under the Io lock for the same reason Dispatch notifies under it.
+        std::scoped_lock<std::mutex> lock(m_io_cs);
+        m_is_running = false;
+    }
+    ++m_generic_epoch;
+    m_generic_epoch.notify_all();
     for(auto& signal : m_signals) {
         if(signal) {
             signal->notify_all();
@@ -106,6 +169,23 @@ void JobSystem::Shutdown() noexcept {
             thread.join();
         }
     }
+    if(m_io_thread.joinable()) {
+        m_io_thread.join();
+    }
+    //Nothing is left to run what is still queued. Releasing those jobs destroys their callbacks,
+    //which lets anything they captured (e.g. an AsyncImage waiting to be read) learn it was dropped.
+    for(auto& queue : m_queues) {
+        Job* job = nullptr;
+        while(queue && queue->try_pop(job)) {
+            Cancel(job);
+        }
+    }
+    for(auto& deque : m_deques) {
+        Job* job = nullptr;
+        while(deque && deque->steal(job)) {
+            Cancel(job);
+        }
+    }
 
     for(auto& queue : m_queues) {
         queue.reset();
@@ -124,6 +204,14 @@ void JobSystem::Shutdown() noexcept {
 
     m_threads.clear();
     m_threads.shrink_to_fit();
+
+    m_deques.clear();
+    m_deques.shrink_to_fit();
+
+    if(tl_owner == this) {
+        tl_owner = nullptr;
+        tl_worker_index = invalid_worker_index;
+    }
 }
 
 void JobSystem::MainStep() noexcept {
@@ -135,6 +223,12 @@ void JobSystem::MainStep() noexcept {
     jc.AddCategory(JobType::Main);
     SetCategorySignal(JobType::Main, m_main_job_signal);
     jc.ConsumeAll();
+    //Without any generic workers the main thread is the only one left to run generic jobs.
+    if(m_threads.empty()) {
+        while(TryRunGenericJob()) {
+            /* DO NOTHING */
+        }
+    }
 }
 
 void JobSystem::SetCategorySignal(const JobType& category_id, std::condition_variable* signal) noexcept {
@@ -145,12 +239,13 @@ void JobSystem::SetCategorySignal(const JobType& category_id, std::condition_var
     m_signals[static_cast<std::underlying_type_t<JobType>>(category_id)] = signal;
 }
 
-Job* JobSystem::Create(const JobType& category, const std::function<void(void*)>& cb, void* user_data) noexcept {
+Job* JobSystem::Create(const JobType& category, const JobCallback& cb, void* user_data) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
 
-    auto* j = new Job();
+    auto* j = m_job_pool.Acquire();
+    j->pool = &m_job_pool;
     j->type = category;
     j->state = JobState::Created;
     j->work_cb = cb;
@@ -159,7 +254,7 @@ Job* JobSystem::Create(const JobType& category, const std::function<void(void*)>
     return j;
 }
 
-void JobSystem::Run(const JobType& category, const std::function<void(void*)>& cb, void* user_data) noexcept {
+void JobSystem::Run(const JobType& category, const JobCallback& cb, void* user_data) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
@@ -176,10 +271,21 @@ void JobSystem::Dispatch(Job* job) noexcept {
 
     job->state = JobState::Dispatched;
     ++job->num_dependencies;
+    if(job->type == JobType::Generic) {
+        DispatchGeneric(job);
+        return;
+    }
     const auto jobtype = TypeUtils::GetUnderlyingValue<JobType>(job->type);
     m_queues[jobtype]->push(job);
     if(auto* signal = m_signals[jobtype]; signal) {
-        signal->notify_all();
+        if(job->type == JobType::Io) {
+            //The Io worker checks for jobs under this lock before it sleeps; holding it here means the push
+            //lands either before that check or after the worker is waiting, never in between.
+            std::scoped_lock<std::mutex> lock(m_io_cs);
+            signal->notify_all();
+        } else {
+            signal->notify_all();
+        }
     }
 }
 
@@ -188,12 +294,7 @@ bool JobSystem::Release(Job* job) noexcept {
     ZoneScopedC(0xFF0000);
 #endif
 
-    const auto dcount = --job->num_dependencies;
-    if(dcount != 0) {
-        return false;
-    }
-    delete job;
-    return true;
+    return ReleaseJob(job);
 }
 
 void JobSystem::Wait(Job* job) noexcept {
@@ -201,8 +302,11 @@ void JobSystem::Wait(Job* job) noexcept {
     ZoneScopedC(0xFF0000);
 #endif
 
-    while(job->state != JobState::Finished) {
-        std::this_thread::yield();
+    //Help out with queued generic work instead of idling until the job finishes.
+    while(job->state != JobState::Finished && job->state != JobState::Cancelled) {
+        if(!TryRunGenericJob()) {
+            std::this_thread::yield();
+        }
     }
 }
 
@@ -248,3 +352,157 @@ std::condition_variable* JobSystem::GetMainJobSignal() const noexcept {
 
     return m_main_job_signal;
 }
+
+std::size_t JobSystem::GetWorkerCount() const noexcept {
+    return m_threads.size();
+}
+
+bool JobSystem::TryRunPendingJob() noexcept {
+    return TryRunGenericJob();
+}
+
+struct JobSystem::parallel_for_context_t {
+    const ParallelRangeCallback* cb{};
+    std::size_t grain{1u};
+    std::atomic<std::size_t> remaining{0u};
+};
+
+void JobSystem::ParallelFor(std::size_t first, std::size_t last, std::size_t grain, const ParallelRangeCallback& cb) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    if(last <= first) {
+        return;
+    }
+    const auto count = last - first;
+    if(grain == 0u) {
+        grain = (std::max)(std::size_t{1u}, count / (8u * (m_threads.size() + 1u)));
+    }
+    //Single-core machines and ranges too small to split run serially on the caller.
+    if(m_threads.empty() || count <= grain) {
+        cb(first, last);
+        return;
+    }
+    parallel_for_context_t context{};
+    context.cb = &cb;
+    context.grain = grain;
+    context.remaining = count;
+    ParallelForRange(&context, first, last);
+    while(context.remaining.load(std::memory_order_acquire) != 0u) {
+        if(!TryRunGenericJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::ParallelForRange(parallel_for_context_t* context, std::size_t first, std::size_t last) noexcept {
+    //Lazy binary splitting: only hand off half of the range while this thread has nothing queued for thieves to take.
+    //Splitting stops below two grains, so every chunk handed to cb holds at least grain indices.
+    const auto& cb = *context->cb;
+    const auto grain = context->grain;
+    std::size_t processed = 0u;
+    while(2u * grain <= last - first) {
+        if(auto* deque = GetThisThreadDeque(); deque && !deque->empty()) {
+            cb(first, first + grain);
+            processed += grain;
+            first += grain;
+            continue;
+        }
+        const auto mid = first + (last - first) / 2u;
+        auto* job = Create(JobType::Generic, [this, context, mid, last](void*) { ParallelForRange(context, mid, last); }, nullptr);
+        DispatchAndRelease(job);
+        last = mid;
+    }
+    cb(first, last);
+    processed += last - first;
+    //The context lives on the caller's stack; it must not be touched after this.
+    context->remaining.fetch_sub(processed, std::memory_order_acq_rel);
+}
+
+void JobSystem::DispatchGeneric(Job* job) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    if(auto* deque = GetThisThreadDeque(); deque) {
+        deque->push(job);
+    } else {
+        m_queues[TypeUtils::GetUnderlyingValue<JobType>(JobType::Generic)]->push(job);
+    }
+    ++m_generic_epoch;
+    if(m_sleeping_workers.load() != 0u) {
+        m_generic_epoch.notify_one();
+    }
+}
+
+bool JobSystem::TryRunGenericJob() noexcept {
+    Job* job = nullptr;
+    if(!TryGetGenericJob(job)) {
+        return false;
+    }
+    Execute(job);
+    return true;
+}
+
+bool JobSystem::TryGetGenericJob(Job*& job) noexcept {
+    //Own deque first (LIFO, cache-warm), then work submitted from non-worker threads, then steal from a random victim.
+    if(auto* deque = GetThisThreadDeque(); deque && deque->pop(job)) {
+        return true;
+    }
+    if(m_queues[TypeUtils::GetUnderlyingValue<JobType>(JobType::Generic)]->try_pop(job)) {
+        return true;
+    }
+    const auto victim_count = m_deques.size();
+    if(victim_count == 0u) {
+        return false;
+    }
+    const auto first_victim = GetRandomVictim(victim_count);
+    for(std::size_t i = 0u; i < victim_count; ++i) {
+        const auto victim = (first_victim + i) % victim_count;
+        if(victim == tl_worker_index && tl_owner == this) {
+            continue;
+        }
+        if(m_deques[victim]->steal(job)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+WorkStealingDeque<Job*>* JobSystem::GetThisThreadDeque() const noexcept {
+    if(tl_owner != this || tl_worker_index >= m_deques.size()) {
+        return nullptr;
+    }
+    return m_deques[tl_worker_index].get();
+}
+
+void JobSystem::Execute(Job* job) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    job->state = JobState::Running;
+    std::invoke(job->work_cb, job->user_data);
+    job->OnFinish();
+    job->state = JobState::Finished;
+    static auto& jobs_run = Metrics::GetCounter("jobs.run");
+    jobs_run.Add();
+    //Drops the reference taken by Dispatch.
+    ReleaseJob(job);
+}
+
+void JobSystem::Cancel(Job* job) noexcept {
+    job->state = JobState::Cancelled;
+    //Drops the reference taken by Dispatch, as Execute would have.
+    ReleaseJob(job);
+}
+
+bool JobSystem::ReleaseJob(Job* job) noexcept {
+    const auto dcount = --job->num_dependencies;
+    if(dcount != 0) {
+        return false;
+    }
+    job->pool->Release(job);
+    return true;
+}
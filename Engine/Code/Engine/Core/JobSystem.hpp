@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Engine/Core/EngineSubsystem.hpp"
+#include "Engine/Core/JobPool.hpp"
 #include "Engine/Core/ThreadSafeQueue.hpp"
+#include "Engine/Core/WorkStealingDeque.hpp"
 
 #include "Engine/Services/IJobSystemService.hpp"
 
@@ -9,6 +11,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -17,15 +20,15 @@
 
 class JobSystem : public IJobSystemService {
 public:
-    JobSystem(int genericCount, std::size_t categoryCount, std::unique_ptr<std::condition_variable> mainJobSignal) noexcept;
+    JobSystem(int genericCount, std::size_t categoryCount, std::unique_ptr<std::condition_variable> mainJobSignal, std::size_t jobPoolSlabSize = JobPool::default_slab_size) noexcept;
     virtual ~JobSystem() noexcept;
 
     void BeginFrame() noexcept;
     void Shutdown() noexcept;
 
     void SetCategorySignal(const JobType& category_id, std::condition_variable* signal) noexcept;
-    [[nodiscard]] Job* Create(const JobType& category, const std::function<void(void*)>& cb, void* user_data) noexcept;
-    void Run(const JobType& category, const std::function<void(void*)>& cb, void* user_data) noexcept;
+    [[nodiscard]] Job* Create(const JobType& category, const JobCallback& cb, void* user_data) noexcept;
+    void Run(const JobType& category, const JobCallback& cb, void* user_data) noexcept;
     void Dispatch(Job* job) noexcept;
     bool Release(Job* job) noexcept;
     void Wait(Job* job) noexcept;
@@ -33,18 +36,43 @@ public:
     void WaitAndRelease(Job* job) noexcept;
     [[nodiscard]] bool IsRunning() const noexcept;
     [[nodiscard]] std::condition_variable* GetMainJobSignal() const noexcept;
+    [[nodiscard]] std::size_t GetWorkerCount() const noexcept;
+    [[nodiscard]] bool TryRunPendingJob() noexcept;
+
+    void ParallelFor(std::size_t first, std::size_t last, std::size_t grain, const ParallelRangeCallback& cb) noexcept;
 
 protected:
 private:
     void Initialize(int genericCount, std::size_t categoryCount) noexcept;
     void SetIsRunning(bool value = true) noexcept;
     void MainStep() noexcept;
-    void GenericJobWorker(std::condition_variable* signal) noexcept;
+    void GenericJobWorker(std::size_t worker_index) noexcept;
+    void IoJobWorker() noexcept;
+
+    struct parallel_for_context_t;
+    void ParallelForRange(parallel_for_context_t* context, std::size_t first, std::size_t last) noexcept;
+
+    void DispatchGeneric(Job* job) noexcept;
+    [[nodiscard]] bool TryRunGenericJob() noexcept;
+    [[nodiscard]] bool TryGetGenericJob(Job*& job) noexcept;
+    [[nodiscard]] WorkStealingDeque<Job*>* GetThisThreadDeque() const noexcept;
+
+    static void Execute(Job* job) noexcept;
+    static void Cancel(Job* job) noexcept;
+    static bool ReleaseJob(Job* job) noexcept;
 
     static inline std::vector<std::unique_ptr<ThreadSafeQueue<Job*>>> m_queues = std::vector<std::unique_ptr<ThreadSafeQueue<Job*>>>{};
     static inline std::vector<std::condition_variable*> m_signals = std::vector<std::condition_variable*>{};
     static inline std::vector<std::jthread> m_threads = std::vector<std::jthread>{};
+    //Index 0 belongs to the thread that constructed the JobSystem, the rest to each generic worker.
+    std::vector<std::unique_ptr<WorkStealingDeque<Job*>>> m_deques{};
+    //Lives as long as the JobSystem, not just until Shutdown, so jobs still held by callers can be released afterwards.
+    JobPool m_job_pool;
+    std::atomic<std::uint64_t> m_generic_epoch{0u};
+    std::atomic<std::size_t> m_sleeping_workers{0u};
     std::condition_variable* m_main_job_signal{};
+    std::jthread m_io_thread{};
+    std::mutex m_io_cs{};
     std::mutex m_cs{};
     std::atomic_bool m_is_running = false;
     friend class JobConsumer;
@@ -6,6 +6,7 @@
 #include "Engine/Services/ServiceLocator.hpp"
 #include "Engine/Services/IJobSystemService.hpp"
 
+#include <algorithm>
 
 void JobConsumer::AddCategory(const JobType& category) noexcept {
     const auto categoryAsSizeT = TypeUtils::GetUnderlyingValue<JobType>(category);
@@ -21,22 +22,18 @@ bool JobConsumer::ConsumeJob() noexcept {
     if(m_consumables.empty()) {
         return false;
     }
+    bool consumed = false;
     for(const auto& consumable : m_consumables) {
         if(!consumable) {
             continue;
         }
-        auto& queue = *consumable;
-        if(queue.empty()) {
-            return false;
+        Job* job = nullptr;
+        if(consumable->try_pop(job)) {
+            JobSystem::Execute(job);
+            consumed = true;
         }
-        auto* job = queue.front();
-        queue.pop();
-        std::invoke(job->work_cb, job->user_data);
-        job->OnFinish();
-        job->state = JobState::Finished;
-        delete job;
     }
-    return true;
+    return consumed;
 }
 
 unsigned int JobConsumer::ConsumeAll() noexcept {
@@ -85,12 +82,21 @@ void Job::OnDependancyFinished() noexcept {
 }
 
 void Job::OnFinish() noexcept {
-    for(auto& dependent : dependents) {
+    const auto inline_count = (std::min)(dependent_count, max_inline_dependents);
+    for(std::size_t i = 0u; i < inline_count; ++i) {
+        dependents[i]->OnDependancyFinished();
+    }
+    for(auto& dependent : overflow_dependents) {
         dependent->OnDependancyFinished();
     }
 }
 
 void Job::AddDependent(Job* dependent) noexcept {
     dependent->state = JobState::Enqueued;
-    dependents.push_back(dependent);
+    if(dependent_count < max_inline_dependents) {
+        dependents[dependent_count] = dependent;
+    } else {
+        overflow_dependents.push_back(dependent);
+    }
+    ++dependent_count;
 }
@@ -1,15 +1,22 @@
 #pragma once
 
+#include "Engine/Core/InplaceFunction.hpp"
 #include "Engine/Core/ThreadSafeQueue.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 
+#include <array>
 #include <atomic>
-#include <functional>
 #include <vector>
 
 class Job;
+class JobPool;
 class JobSystem;
 
+//Work callbacks are stored inline in the Job. Captures larger than the capacity fail to compile; capture a pointer instead.
+using JobCallback = InplaceFunction<void(void*), 64u>;
+//Processes the half-open index range [first, last).
+using ParallelRangeCallback = InplaceFunction<void(std::size_t, std::size_t), 64u>;
+
 enum class JobType : std::size_t {
     Generic,
     Logging,
@@ -26,6 +33,7 @@ enum class JobState : unsigned int {
     Enqueued,
     Running,
     Finished,
+    Cancelled, //Still queued when the job system shut down; its callback never ran.
     Max,
 };
 
@@ -34,16 +42,22 @@ public:
     Job() noexcept = default;
     ~Job() noexcept;
     JobType type{};
-    JobState state{};
-    std::function<void(void*)> work_cb;
+    std::atomic<JobState> state{JobState::None};
+    JobCallback work_cb;
     void* user_data{};
+    //The pool of the JobSystem that created the job, which the last release returns it to.
+    JobPool* pool{};
 
     void DependencyOf(Job* dependency) noexcept;
     void DependentOn(Job* parent) noexcept;
     void OnDependancyFinished() noexcept;
     void OnFinish() noexcept;
 
-    std::vector<Job*> dependents{};
+    static constexpr std::size_t max_inline_dependents = 4u;
+    std::array<Job*, max_inline_dependents> dependents{};
+    //Only used once a job has more dependents than fit inline.
+    std::vector<Job*> overflow_dependents{};
+    std::size_t dependent_count{0u};
     std::atomic<unsigned int> num_dependencies{0u};
 
 private:
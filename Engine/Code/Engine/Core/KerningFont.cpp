@@ -3,9 +3,11 @@
 #include "Engine/Core/DataUtils.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 #include "Engine/Core/StringUtils.hpp"
 
 #include "Engine/Renderer/Material.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
 
 #include "Engine/Services/ServiceLocator.hpp"
 #include "Engine/Services/IService.hpp"
@@ -24,10 +26,7 @@ float KerningFont::CalculateTextWidth(const KerningFont& font, const std::string
         const auto current_char_def = font.GetCharDef(*char_iter);
         const auto previous_char = char_iter++;
         if(char_iter != text.end()) {
-            auto kern_value = 0.0f;
-            if(const auto kern_iter = font.m_kernmap.find(std::make_pair(*previous_char, *char_iter)); kern_iter != font.m_kernmap.end()) {
-                kern_value = static_cast<float>(kern_iter->second);
-            }
+            const auto kern_value = static_cast<float>(font.GetKerningValue(static_cast<int>(*previous_char), static_cast<int>(*char_iter)));
             cursor_x += current_char_def.xadvance + kern_value;
         } else {
             KerningFont::CharDef previous_char_def = font.GetCharDef(*previous_char);
@@ -71,7 +70,7 @@ float KerningFont::GetLineHeight() const noexcept {
 }
 
 float KerningFont::GetLineHeightAsUV() const noexcept {
-    return GetLineHeight() / static_cast<float>(m_common.scale.y);
+    return m_atlas_uvs.CalcDimensions().y * GetLineHeight() / static_cast<float>(m_common.scale.y);
 }
 
 const std::string& KerningFont::GetName() const noexcept {
@@ -79,6 +78,9 @@ const std::string& KerningFont::GetName() const noexcept {
 }
 
 KerningFont::CharDef KerningFont::GetCharDef(int ch) const noexcept {
+    if(0 <= ch && static_cast<std::size_t>(ch) < m_dense_chardefs.size()) {
+        return m_dense_chardefs[ch];
+    }
     auto chardef_iter = m_charmap.find(ch);
     if(chardef_iter == m_charmap.end()) {
         chardef_iter = m_charmap.find(-1);
@@ -101,6 +103,13 @@ const std::vector<std::string>& KerningFont::GetImagePaths() const noexcept {
     return m_image_paths;
 }
 
+std::filesystem::path KerningFont::GetImageFilePath(std::size_t page) const noexcept {
+    if(page >= m_image_paths.size()) {
+        return {};
+    }
+    return m_filepath.parent_path() / m_image_paths[page];
+}
+
 const std::filesystem::path& KerningFont::GetFilePath() const noexcept {
     return m_filepath;
 }
@@ -136,28 +145,33 @@ bool KerningFont::LoadFromFile(std::filesystem::path filepath) noexcept {
         }
         m_filepath = filepath;
     }
-    if(const auto& buffer = FileUtils::ReadBinaryBufferFromFile(m_filepath.string()); buffer.has_value()) {
-        if(buffer->size() < 4) {
+    if(const auto file = FileUtils::MappedFile::Open(m_filepath); file.has_value()) {
+        if(file->size() < 4) {
             DebuggerPrintf(std::format("{} is not a BMFont file.\n", m_filepath));
             return false;
         }
-        return LoadFromBuffer(*buffer);
+        return LoadFromBuffer(file->GetBytes());
     } else {
         DebuggerPrintf(std::format("Failed to read file: {} \n", m_filepath));
         return false;
     }
 }
 
-bool KerningFont::LoadFromBuffer(const std::vector<uint8_t>& buffer) noexcept {
-    std::vector<uint8_t> out_buffer(buffer);
-    const auto is_binary = out_buffer[0] == 66 && out_buffer[1] == 77 && out_buffer[2] == 70;
-    const auto is_text = out_buffer[0] == 105 && out_buffer[1] == 110 && out_buffer[2] == 102 && out_buffer[3] == 111;
+bool KerningFont::LoadFromBuffer(std::span<const uint8_t> buffer) noexcept {
+    if(buffer.size() < 4) {
+        return false;
+    }
+    const auto is_binary = buffer[0] == 66 && buffer[1] == 77 && buffer[2] == 70;
+    const auto is_text = buffer[0] == 105 && buffer[1] == 110 && buffer[2] == 102 && buffer[3] == 111;
     if(is_binary) {
-        m_is_loaded = LoadFromBinary(out_buffer);
+        m_is_loaded = LoadFromBinary(buffer);
     } else if(is_text) {
-        m_is_loaded = LoadFromText(out_buffer);
+        m_is_loaded = LoadFromText(buffer);
     } else {
-        m_is_loaded = LoadFromXml(out_buffer);
+        m_is_loaded = LoadFromXml(buffer);
+    }
+    if(m_is_loaded) {
+        BuildLookupTables();
     }
     CreateTextures();
     CreateMaterial();
@@ -172,6 +186,19 @@ void KerningFont::SetMaterial(Material* mat) noexcept {
     m_material = mat;
 }
 
+bool KerningFont::SetAtlasRegion(const TextureAtlasRegion& region, Material* pageMaterial) noexcept {
+    if(m_image_paths.size() != 1u || pageMaterial == nullptr) {
+        return false;
+    }
+    m_atlas_uvs = region.uvs;
+    SetMaterial(pageMaterial);
+    //Layouts shaped before the move still point at the old UVs.
+    if(auto* renderer = ServiceLocator::get<IRendererService>(); renderer != nullptr) {
+        renderer->InvalidateTextLayouts(this);
+    }
+    return true;
+}
+
 int KerningFont::GetKerningValue(unsigned long first, unsigned long second) const noexcept {
     const auto firstAsInt = static_cast<int>(first);
     const auto secondAsInt = static_cast<int>(second);
@@ -179,11 +206,7 @@ int KerningFont::GetKerningValue(unsigned long first, unsigned long second) cons
 }
 
 int KerningFont::GetKerningValue(int first, int second) const noexcept {
-    if(const auto iter = m_kernmap.find(std::make_pair(first, second)); iter != m_kernmap.end()) {
-        return (*iter).second;
-    } else {
-        return 0;
-    }
+    return m_kerning_table.Find(first, second);
 }
 
 bool KerningFont::IsLoaded() const noexcept {
@@ -199,6 +222,12 @@ AABB2 KerningFont::GetGlyphUVs(int c) const noexcept {
     float char_uvt = current_def.position.y / texture_h;
     float char_uvr = char_uvl + (current_def.dimensions.x / texture_w);
     float char_uvb = char_uvt + (current_def.dimensions.y / texture_h);
+    //Identity unless the font image was packed into an atlas.
+    const auto atlas_dims = m_atlas_uvs.CalcDimensions();
+    char_uvl = m_atlas_uvs.mins.x + char_uvl * atlas_dims.x;
+    char_uvr = m_atlas_uvs.mins.x + char_uvr * atlas_dims.x;
+    char_uvt = m_atlas_uvs.mins.y + char_uvt * atlas_dims.y;
+    char_uvb = m_atlas_uvs.mins.y + char_uvb * atlas_dims.y;
     return AABB2{char_uvl, char_uvt, char_uvr, char_uvb};
 }
 
@@ -221,11 +250,9 @@ int KerningFont::GetEmSize() const noexcept {
     return GetInfoDef().em_size;
 }
 
-bool KerningFont::LoadFromText(std::vector<unsigned char>& buffer) noexcept {
+bool KerningFont::LoadFromText(std::span<const uint8_t> buffer) noexcept {
     auto bufferAsStr = std::string(buffer.begin(), buffer.end());
     bufferAsStr = StringUtils::ReplaceAll(bufferAsStr, "\r\n", "\n");
-    buffer.clear();
-    buffer.shrink_to_fit();
     auto kerning_count = 0u;
     {
         std::istringstream ss;
@@ -602,12 +629,27 @@ void KerningFont::CreateTextures() noexcept {
 
 }
 
-bool KerningFont::LoadFromXml(std::vector<unsigned char>& buffer) noexcept {
+void KerningFont::BuildLookupTables() noexcept {
+    std::vector<KerningTable::Pair> pairs{};
+    pairs.reserve(m_kernmap.size());
+    for(const auto& [chars, amount] : m_kernmap) {
+        pairs.push_back(KerningTable::Pair{chars.first, chars.second, amount});
+    }
+    m_kerning_table.Build(pairs);
+
+    //Filled aside so GetCharDef still reads the map while the table is being built.
+    m_dense_chardefs.clear();
+    std::vector<CharDef> dense(256u);
+    for(int ch = 0; ch < 256; ++ch) {
+        dense[ch] = GetCharDef(ch);
+    }
+    m_dense_chardefs = std::move(dense);
+}
+
+bool KerningFont::LoadFromXml(std::span<const uint8_t> buffer) noexcept {
     tinyxml2::XMLDocument doc;
     std::string file(buffer.begin(), buffer.end());
     file = StringUtils::ReplaceAll(file, "\r\n", "\n");
-    buffer.clear();
-    buffer.shrink_to_fit();
     if(const auto& result = doc.Parse(file.c_str(), file.size()); result != tinyxml2::XML_SUCCESS) {
         return false;
     }
@@ -721,7 +763,7 @@ bool KerningFont::LoadFromXml(std::vector<unsigned char>& buffer) noexcept {
     return true;
 }
 
-bool KerningFont::LoadFromBinary(std::vector<unsigned char>& buffer) noexcept {
+bool KerningFont::LoadFromBinary(std::span<const uint8_t> buffer) noexcept {
     //See https://www.angelcode.com/products/bmfont/doc/file_format.html#bin
     //for specifics regarding layout
 
@@ -789,8 +831,6 @@ bool KerningFont::LoadFromBinary(std::vector<unsigned char>& buffer) noexcept {
     BMFBinaryKerning kerning{};
     std::stringstream bss(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
     bss.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
-    buffer.clear();
-    buffer.shrink_to_fit();
 
     bss.clear();
     bss.seekg(0);
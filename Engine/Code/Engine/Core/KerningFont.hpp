@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Core/IFont.hpp"
+#include "Engine/Core/KerningTable.hpp"
 
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/IntVector2.hpp"
@@ -14,6 +15,7 @@
 
 class Material;
 class Renderer;
+struct TextureAtlasRegion;
 
 class KerningFont : public a2de::IFont {
 public:
@@ -107,12 +109,16 @@ public:
     [[nodiscard]] const KerningFont::InfoDef& GetInfoDef() const noexcept;
 
     [[nodiscard]] const std::vector<std::string>& GetImagePaths() const noexcept;
+    //Where the image for page lives on disk; page paths in the font file are relative to the font file.
+    [[nodiscard]] std::filesystem::path GetImageFilePath(std::size_t page) const noexcept;
     [[nodiscard]] const std::filesystem::path& GetFilePath() const noexcept override;
     [[nodiscard]] bool LoadFromFile(std::filesystem::path filepath) noexcept override;
-    [[nodiscard]] bool LoadFromBuffer(const std::vector<uint8_t>& buffer) noexcept override;
+    [[nodiscard]] bool LoadFromBuffer(std::span<const uint8_t> buffer) noexcept override;
 
     [[nodiscard]] Material* GetMaterial() const noexcept override;
     void SetMaterial(Material* mat) noexcept override;
+    //Draws glyphs from the font's image after it was packed into a TextureAtlas. Only single-page fonts can be remapped.
+    [[nodiscard]] bool SetAtlasRegion(const TextureAtlasRegion& region, Material* pageMaterial) noexcept;
 
     [[nodiscard]] int GetKerningValue(unsigned long first, unsigned long second) const noexcept override;
     [[nodiscard]] int GetKerningValue(int first, int second) const noexcept;
@@ -130,10 +136,12 @@ private:
 
     void CreateMaterial() noexcept;
     void CreateTextures() noexcept;
+    //Flattens the parsed maps into the tables GetCharDef and GetKerningValue read per glyph.
+    void BuildLookupTables() noexcept;
 
-    [[nodiscard]] bool LoadFromText(std::vector<unsigned char>& buffer) noexcept;
-    [[nodiscard]] bool LoadFromXml(std::vector<unsigned char>& buffer) noexcept;
-    [[nodiscard]] bool LoadFromBinary(std::vector<unsigned char>& buffer) noexcept;
+    [[nodiscard]] bool LoadFromText(std::span<const uint8_t> buffer) noexcept;
+    [[nodiscard]] bool LoadFromXml(std::span<const uint8_t> buffer) noexcept;
+    [[nodiscard]] bool LoadFromBinary(std::span<const uint8_t> buffer) noexcept;
 
     [[nodiscard]] bool IsInfoLine(const std::string& cur_line) noexcept;
     [[nodiscard]] bool IsCommonLine(const std::string& cur_line) noexcept;
@@ -155,8 +163,11 @@ private:
     std::string m_name{};
     std::vector<std::string> m_image_paths{};
     std::filesystem::path m_filepath{};
+    AABB2 m_atlas_uvs{0.0f, 0.0f, 1.0f, 1.0f};
     CharMap m_charmap{};
     KerningMap m_kernmap{};
+    KerningTable m_kerning_table{};
+    std::vector<CharDef> m_dense_chardefs{}; //Indexed by char id for ids 0-255, missing ids already resolved to the -1 fallback.
     InfoDef m_info{};
     CommonDef m_common{};
     std::size_t m_char_count{0u};
@@ -0,0 +1,143 @@
+#include "Engine/Core/KerningTable.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+namespace {
+//Displacements tried per bucket before the slot array is grown and the build restarted.
+constexpr std::uint32_t max_displacement = 1u << 14u;
+} // namespace
+
+void KerningTable::Build(const std::vector<Pair>& pairs) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    Clear();
+    if(pairs.empty()) {
+        return;
+    }
+    //Identical keys can never be displaced apart, so drop all but the last of each.
+    std::vector<Pair> unique_pairs(std::crbegin(pairs), std::crend(pairs));
+    std::stable_sort(std::begin(unique_pairs), std::end(unique_pairs), [](const Pair& a, const Pair& b) { return MakeKey(a.first, a.second) < MakeKey(b.first, b.second); });
+    const auto last = std::unique(std::begin(unique_pairs), std::end(unique_pairs), [](const Pair& a, const Pair& b) { return a.first == b.first && a.second == b.second; });
+    unique_pairs.erase(last, std::end(unique_pairs));
+
+    //At most half full, so every bucket finds a free displacement after a handful of tries.
+    auto slot_count = std::bit_ceil(unique_pairs.size() * 2u);
+    while(!TryBuild(unique_pairs, slot_count)) {
+        slot_count *= 2u;
+    }
+    m_size = unique_pairs.size();
+}
+
+void KerningTable::Clear() noexcept {
+    m_displacements.clear();
+    m_slots.clear();
+    m_size = 0u;
+}
+
+int KerningTable::Find(int first, int second) const noexcept {
+    if(m_slots.empty()) {
+        return 0;
+    }
+    const auto key = MakeKey(first, second);
+    const auto hash = Mix(key);
+    const auto displacement = m_displacements[hash & (m_displacements.size() - 1u)];
+    const auto& slot = m_slots[SlotIndex(hash, displacement, m_slots.size() - 1u)];
+    //A pair not in the table lands on some other pair's slot or an empty one; the key compare rejects both.
+    return slot.key == key ? slot.amount : 0;
+}
+
+std::size_t KerningTable::size() const noexcept {
+    return m_size;
+}
+
+bool KerningTable::empty() const noexcept {
+    return m_size == 0u;
+}
+
+std::uint64_t KerningTable::MakeKey(int first, int second) noexcept {
+    return (std::uint64_t{static_cast<std::uint32_t>(first)} << 32u) | std::uint64_t{static_cast<std::uint32_t>(second)};
+}
+
+std::uint64_t KerningTable::Mix(std::uint64_t value) noexcept {
+    //splitmix64 finalizer
+    value ^= value >> 30u;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27u;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31u;
+    return value;
+}
+
+std::size_t KerningTable::SlotIndex(std::uint64_t hash, std::uint32_t displacement, std::size_t slot_mask) noexcept {
+    return static_cast<std::size_t>(Mix(hash + displacement * 0x9E3779B97F4A7C15ull)) & slot_mask;
+}
+
+bool KerningTable::TryBuild(const std::vector<Pair>& pairs, std::size_t slot_count) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto bucket_count = (std::max)(std::size_t{1u}, slot_count / 8u);
+    const auto bucket_mask = bucket_count - 1u;
+    const auto slot_mask = slot_count - 1u;
+
+    std::vector<std::uint64_t> hashes(pairs.size());
+    std::vector<std::uint32_t> bucket_sizes(bucket_count);
+    for(std::size_t i = 0u; i < pairs.size(); ++i) {
+        hashes[i] = Mix(MakeKey(pairs[i].first, pairs[i].second));
+        ++bucket_sizes[hashes[i] & bucket_mask];
+    }
+    //Group pair indices by bucket, then place the crowded buckets first while the slots are still mostly free.
+    std::vector<std::uint32_t> by_bucket(pairs.size());
+    std::iota(std::begin(by_bucket), std::end(by_bucket), 0u);
+    std::sort(std::begin(by_bucket), std::end(by_bucket), [&](std::uint32_t a, std::uint32_t b) {
+        const auto bucket_a = hashes[a] & bucket_mask;
+        const auto bucket_b = hashes[b] & bucket_mask;
+        if(bucket_sizes[bucket_a] != bucket_sizes[bucket_b]) {
+            return bucket_sizes[bucket_a] > bucket_sizes[bucket_b];
+        }
+        return bucket_a < bucket_b;
+    });
+
+    std::vector<std::uint32_t> displacements(bucket_count, 0u);
+    std::vector<Slot> slots(slot_count);
+    //Tracked apart from the keys because the pair (-1, -1) packs to the same bits as an empty slot.
+    std::vector<bool> occupied(slot_count, false);
+    std::vector<std::size_t> candidate_slots{};
+    for(auto begin = std::cbegin(by_bucket); begin != std::cend(by_bucket); /* DO NOTHING */) {
+        const auto bucket = hashes[*begin] & bucket_mask;
+        const auto end = begin + bucket_sizes[bucket];
+        bool placed = false;
+        for(std::uint32_t displacement = 0u; !placed && displacement < max_displacement; ++displacement) {
+            candidate_slots.clear();
+            placed = std::all_of(begin, end, [&](std::uint32_t index) {
+                const auto slot = SlotIndex(hashes[index], displacement, slot_mask);
+                const auto is_free = !occupied[slot] && std::find(std::cbegin(candidate_slots), std::cend(candidate_slots), slot) == std::cend(candidate_slots);
+                candidate_slots.push_back(slot);
+                return is_free;
+            });
+            if(placed) {
+                displacements[bucket] = displacement;
+                for(auto index = begin; index != end; ++index) {
+                    const auto& pair = pairs[*index];
+                    const auto slot = candidate_slots[std::distance(begin, index)];
+                    slots[slot] = Slot{MakeKey(pair.first, pair.second), pair.amount};
+                    occupied[slot] = true;
+                }
+            }
+        }
+        if(!placed) {
+            return false;
+        }
+        begin = end;
+    }
+    m_displacements = std::move(displacements);
+    m_slots = std::move(slots);
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//Read-only kerning lookup built once at font load.
+//Uses hash-and-displace perfect hashing: every pair in the table has a slot of its own,
+//so a lookup is two hashes, two array reads and one key compare, hit or miss.
+class KerningTable {
+public:
+    struct Pair {
+        int first{};
+        int second{};
+        int amount{};
+    };
+
+    //Pairs must be unique; a duplicate keeps whichever amount lands last.
+    void Build(const std::vector<Pair>& pairs) noexcept;
+    void Clear() noexcept;
+
+    [[nodiscard]] int Find(int first, int second) const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+protected:
+private:
+    struct Slot {
+        std::uint64_t key{empty_key};
+        int amount{0};
+    };
+
+    static constexpr std::uint64_t empty_key = ~std::uint64_t{0u};
+
+    [[nodiscard]] static std::uint64_t MakeKey(int first, int second) noexcept;
+    [[nodiscard]] static std::uint64_t Mix(std::uint64_t value) noexcept;
+    [[nodiscard]] static std::size_t SlotIndex(std::uint64_t hash, std::uint32_t displacement, std::size_t slot_mask) noexcept;
+    [[nodiscard]] bool TryBuild(const std::vector<Pair>& pairs, std::size_t slot_count) noexcept;
+
+    std::vector<std::uint32_t> m_displacements{};
+    std::vector<Slot> m_slots{};
+    std::size_t m_size{0u};
+};
@@ -0,0 +1,211 @@
+#include "Engine/Core/MappedFile.hpp"
+
+#include "Engine/Platform/Win.hpp"
+
+#include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IFileLoggerService.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <format>
+#include <utility>
+
+#ifndef PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FileUtils {
+
+std::optional<MappedFile> MappedFile::Open(std::filesystem::path filepath) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    namespace FS = std::filesystem;
+    if(!FS::exists(filepath)) {
+        return {};
+    }
+    {
+        std::error_code ec{};
+        if(filepath = FS::canonical(filepath, ec); ec) {
+            auto* logger = ServiceLocator::get<IFileLoggerService>();
+            logger->LogErrorLine(std::format("File: {:s} is inaccessible.", filepath));
+            return {};
+        }
+    }
+    filepath.make_preferred();
+    if(FS::is_directory(filepath)) {
+        return {};
+    }
+
+    MappedFile result{};
+    result.m_filepath = filepath;
+#ifdef PLATFORM_WINDOWS
+    HANDLE file = ::CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+        return {};
+    }
+    result.m_file = file;
+    LARGE_INTEGER file_size{};
+    if(!::GetFileSizeEx(file, &file_size)) {
+        return {};
+    }
+    result.m_is_open = true;
+    if(file_size.QuadPart == 0) {
+        //Windows refuses to map empty files.
+        return result;
+    }
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(mapping == nullptr) {
+        return {};
+    }
+    result.m_mapping = mapping;
+    if(auto* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0); view != nullptr) {
+        result.m_data = static_cast<const uint8_t*>(view);
+        result.m_size = static_cast<std::size_t>(file_size.QuadPart);
+        return result;
+    }
+    return {};
+#else
+    const int fd = ::open(filepath.c_str(), O_RDONLY);
+    if(fd == -1) {
+        return {};
+    }
+    struct stat file_stat{};
+    if(::fstat(fd, &file_stat) == -1) {
+        ::close(fd);
+        return {};
+    }
+    result.m_is_open = true;
+    if(file_stat.st_size == 0) {
+        ::close(fd);
+        return result;
+    }
+    auto* view = ::mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    //The mapping keeps its own reference to the file.
+    ::close(fd);
+    if(view == MAP_FAILED) {
+        return {};
+    }
+    result.m_data = static_cast<const uint8_t*>(view);
+    result.m_size = static_cast<std::size_t>(file_stat.st_size);
+    return result;
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& rother) noexcept
+: m_data{std::exchange(rother.m_data, nullptr)}
+, m_size{std::exchange(rother.m_size, 0u)}
+, m_is_open{std::exchange(rother.m_is_open, false)}
+#ifdef PLATFORM_WINDOWS
+, m_file{std::exchange(rother.m_file, nullptr)}
+, m_mapping{std::exchange(rother.m_mapping, nullptr)}
+#endif
+, m_filepath{std::move(rother.m_filepath)}
+{
+    /* DO NOTHING */
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rrhs) noexcept {
+    if(this == &rrhs) {
+        return *this;
+    }
+    Close();
+    m_data = std::exchange(rrhs.m_data, nullptr);
+    m_size = std::exchange(rrhs.m_size, 0u);
+    m_is_open = std::exchange(rrhs.m_is_open, false);
+#ifdef PLATFORM_WINDOWS
+    m_file = std::exchange(rrhs.m_file, nullptr);
+    m_mapping = std::exchange(rrhs.m_mapping, nullptr);
+#endif
+    m_filepath = std::move(rrhs.m_filepath);
+    return *this;
+}
+
+MappedFile::~MappedFile() noexcept {
+    Close();
+}
+
+void MappedFile::Close() noexcept {
+#ifdef PLATFORM_WINDOWS
+    if(m_data) {
+        ::UnmapViewOfFile(m_data);
+    }
+    if(m_mapping) {
+        ::CloseHandle(m_mapping);
+    }
+    if(m_file) {
+        ::CloseHandle(m_file);
+    }
+    m_mapping = nullptr;
+    m_file = nullptr;
+#else
+    if(m_data) {
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0u;
+    m_is_open = false;
+}
+
+bool MappedFile::IsOpen() const noexcept {
+    return m_is_open;
+}
+
+std::span<const uint8_t> MappedFile::GetBytes() const noexcept {
+    return std::span<const uint8_t>{m_data, m_size};
+}
+
+std::span<const uint8_t> MappedFile::GetBytes(std::size_t offset, std::size_t count) const noexcept {
+    if(offset >= m_size) {
+        return {};
+    }
+    return GetBytes().subspan(offset, (std::min)(count, m_size - offset));
+}
+
+const uint8_t* MappedFile::data() const noexcept {
+    return m_data;
+}
+
+std::size_t MappedFile::size() const noexcept {
+    return m_size;
+}
+
+bool MappedFile::empty() const noexcept {
+    return m_size == 0u;
+}
+
+const std::filesystem::path& MappedFile::GetFilepath() const noexcept {
+    return m_filepath;
+}
+
+void MappedFile::Prefetch(std::size_t offset, std::size_t count) const noexcept {
+    const auto bytes = GetBytes(offset, count);
+    if(bytes.empty()) {
+        return;
+    }
+#ifdef PLATFORM_WINDOWS
+    WIN32_MEMORY_RANGE_ENTRY range{};
+    range.VirtualAddress = const_cast<uint8_t*>(bytes.data());
+    range.NumberOfBytes = bytes.size();
+    ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+#else
+    //madvise needs a page-aligned start address.
+    const auto page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto first = reinterpret_cast<std::uintptr_t>(bytes.data());
+    const auto aligned = first - (first % page_size);
+    ::madvise(reinterpret_cast<void*>(aligned), bytes.size() + (first - aligned), MADV_WILLNEED);
+#endif
+}
+
+void MappedFile::Prefetch() const noexcept {
+    Prefetch(0u, m_size);
+}
+
+} // namespace FileUtils
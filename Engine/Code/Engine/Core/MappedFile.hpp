@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Engine/Core/BuildConfig.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace FileUtils {
+
+//A read-only view of a whole file mapped into the address space.
+//Pages are read in by the OS on first touch, so parsers that only walk part of a file
+//never pay for the rest, and nothing is copied into a heap buffer.
+//The bytes stay valid until the MappedFile is closed, moved from, or destroyed.
+class MappedFile {
+public:
+    //Returns an empty optional if filepath does not exist, is a directory, or cannot be mapped.
+    //Zero-length files open successfully with an empty view.
+    [[nodiscard]] static std::optional<MappedFile> Open(std::filesystem::path filepath) noexcept;
+
+    MappedFile() noexcept = default;
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& rother) noexcept;
+    MappedFile& operator=(const MappedFile& rhs) = delete;
+    MappedFile& operator=(MappedFile&& rrhs) noexcept;
+    ~MappedFile() noexcept;
+
+    void Close() noexcept;
+
+    [[nodiscard]] bool IsOpen() const noexcept;
+    [[nodiscard]] std::span<const uint8_t> GetBytes() const noexcept;
+    //Clamped to the end of the file; returns an empty view if offset is past the end.
+    [[nodiscard]] std::span<const uint8_t> GetBytes(std::size_t offset, std::size_t count) const noexcept;
+    [[nodiscard]] const uint8_t* data() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] const std::filesystem::path& GetFilepath() const noexcept;
+
+    //Asks the OS to start reading the given range in the background.
+    //Purely a hint: the bytes are readable whether or not it is called.
+    void Prefetch(std::size_t offset, std::size_t count) const noexcept;
+    void Prefetch() const noexcept;
+
+protected:
+private:
+    const uint8_t* m_data{nullptr};
+    std::size_t m_size{0u};
+    bool m_is_open{false};
+#ifdef PLATFORM_WINDOWS
+    void* m_file{nullptr};
+    void* m_mapping{nullptr};
+#endif
+    std::filesystem::path m_filepath{};
+};
+
+} // namespace FileUtils
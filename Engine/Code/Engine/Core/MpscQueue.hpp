@@ -0,0 +1,179 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+//Bounded lock-free multi-producer, single-consumer queue.
+//See: Dmitry Vyukov - "Bounded MPMC queue" (1024cores.net). Each cell carries a sequence number that tells a
+//producer whether the cell is free for its ticket and tells the consumer whether the value in it is published,
+//so producers only contend on one CAS of the tail and the consumer never takes a lock or a CAS at all.
+//Pushing into a full queue fails instead of blocking or growing; callers decide whether to retry, drop or fall back.
+template<typename T>
+class MpscQueue {
+public:
+    explicit MpscQueue(std::size_t capacity = 1024u) noexcept;
+    MpscQueue(const MpscQueue& other) = delete;
+    MpscQueue(MpscQueue&& other) = delete;
+    MpscQueue& operator=(const MpscQueue& other) = delete;
+    MpscQueue& operator=(MpscQueue&& other) = delete;
+    ~MpscQueue() noexcept;
+
+    //Any thread.
+    [[nodiscard]] bool try_push(const T& value) noexcept;
+    //Any thread.
+    [[nodiscard]] bool try_push(T&& value) noexcept;
+    //Any thread.
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args) noexcept;
+
+    //Consumer thread only.
+    [[nodiscard]] bool try_pop(T& out) noexcept;
+    //Consumer thread only. Moves up to out.size() values into the front of out and returns how many.
+    [[nodiscard]] std::size_t try_pop_n(std::span<T> out) noexcept;
+
+    //Both are snapshots; with producers running the answer may be stale by the time it is used.
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+protected:
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0u};
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    [[nodiscard]] Cell* ClaimCell() noexcept;
+    [[nodiscard]] bool PopOne(T& out) noexcept;
+
+    static constexpr std::size_t cache_line_size = 64u;
+
+    std::unique_ptr<Cell[]> m_cells{};
+    std::size_t m_capacity{};
+    std::size_t m_mask{};
+    alignas(cache_line_size) std::atomic<std::size_t> m_tail{0u};
+    //Only the consumer writes the head; it is atomic so empty() and size() can read it from anywhere.
+    alignas(cache_line_size) std::atomic<std::size_t> m_head{0u};
+};
+
+template<typename T>
+MpscQueue<T>::MpscQueue(std::size_t capacity /*= 1024u*/) noexcept {
+    auto rounded = std::size_t{2u};
+    while(rounded < capacity) {
+        rounded <<= 1u;
+    }
+    m_capacity = rounded;
+    m_mask = rounded - 1u;
+    m_cells = std::make_unique<Cell[]>(rounded);
+    for(std::size_t i = 0u; i < rounded; ++i) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+MpscQueue<T>::~MpscQueue() noexcept {
+    if constexpr(!std::is_trivially_destructible_v<T>) {
+        for(auto pos = m_head.load(std::memory_order_relaxed); m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) == pos + 1u; ++pos) {
+            std::launder(reinterpret_cast<T*>(m_cells[pos & m_mask].storage))->~T();
+        }
+    }
+}
+
+template<typename T>
+bool MpscQueue<T>::try_push(const T& value) noexcept {
+    return try_emplace(value);
+}
+
+template<typename T>
+bool MpscQueue<T>::try_push(T&& value) noexcept {
+    return try_emplace(std::move(value));
+}
+
+template<typename T>
+template<typename... Args>
+bool MpscQueue<T>::try_emplace(Args&&... args) noexcept {
+    auto* cell = ClaimCell();
+    if(!cell) {
+        return false;
+    }
+    const auto ticket = cell->sequence.load(std::memory_order_relaxed);
+    ::new(static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+    //Publishes the value: the consumer waits for sequence == ticket + 1.
+    cell->sequence.store(ticket + 1u, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+typename MpscQueue<T>::Cell* MpscQueue<T>::ClaimCell() noexcept {
+    auto pos = m_tail.load(std::memory_order_relaxed);
+    for(;;) {
+        auto* cell = &m_cells[pos & m_mask];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if(diff == 0) {
+            if(m_tail.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                return cell;
+            }
+        } else if(diff < 0) {
+            //The consumer has not freed this cell from the previous lap yet.
+            return nullptr;
+        } else {
+            //Another producer took this ticket first.
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+bool MpscQueue<T>::try_pop(T& out) noexcept {
+    return PopOne(out);
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::try_pop_n(std::span<T> out) noexcept {
+    std::size_t count = 0u;
+    while(count < out.size() && PopOne(out[count])) {
+        ++count;
+    }
+    return count;
+}
+
+template<typename T>
+bool MpscQueue<T>::PopOne(T& out) noexcept {
+    const auto pos = m_head.load(std::memory_order_relaxed);
+    auto& cell = m_cells[pos & m_mask];
+    if(cell.sequence.load(std::memory_order_acquire) != pos + 1u) {
+        //Empty, or the producer holding this ticket has not finished writing it.
+        return false;
+    }
+    auto* value = std::launder(reinterpret_cast<T*>(cell.storage));
+    out = std::move(*value);
+    value->~T();
+    //Hands the cell to whichever producer draws the ticket one lap ahead.
+    cell.sequence.store(pos + m_capacity, std::memory_order_release);
+    m_head.store(pos + 1u, std::memory_order_relaxed);
+    return true;
+}
+
+template<typename T>
+bool MpscQueue<T>::empty() const noexcept {
+    return size() == 0u;
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::size() const noexcept {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0u;
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::capacity() const noexcept {
+    return m_capacity;
+}
@@ -2,19 +2,282 @@
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 #include "Engine/Core/MtlReader.hpp"
+#include "Engine/Core/StringId.hpp"
 #include "Engine/Core/StringUtils.hpp"
 
 #include "Engine/Profiling/ProfileLogScope.hpp"
 
 #include "Engine/Renderer/Renderer.hpp"
 
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <format>
+#include <fstream>
+#include <limits>
 #include <numeric>
-#include <sstream>
+#include <type_traits>
+#include <unordered_map>
 
 namespace FileUtils {
 
+namespace {
+
+//Bump whenever the layout of the cache or of Vertex3D changes.
+constexpr const uint32_t mesh_cache_version = 1u;
+constexpr const char mesh_cache_magic[4] = {'M', 'E', 'S', 'H'};
+
+//Files smaller than this are parsed on the calling thread; splitting them costs more than it saves.
+constexpr const std::size_t parallel_parse_threshold = 4u * 1024u * 1024u;
+constexpr const std::size_t min_parse_chunk_size = 1024u * 1024u;
+
+struct MeshCacheHeader {
+    char magic[4] = {0, 0, 0, 0};
+    uint32_t version{0u};
+    uint32_t vertex_size{0u};
+    uint32_t flags{0u};
+    uint64_t source_size{0u};
+    int64_t source_time{0};
+    uint64_t source_hash{0u};
+    uint64_t vertex_count{0u};
+    uint64_t index_count{0u};
+};
+
+namespace MeshCacheFlags {
+constexpr const uint32_t HasTexCoords = 0b0001;
+constexpr const uint32_t HasNormals = 0b0010;
+} // namespace MeshCacheFlags
+
+static_assert(std::is_trivially_copyable_v<Vertex3D>, "The .mesh cache stores Vertex3D as raw bytes.");
+
+[[nodiscard]] int64_t GetSourceTime(const std::filesystem::path& filepath) noexcept {
+    std::error_code ec{};
+    const auto time = std::filesystem::last_write_time(filepath, ec);
+    return ec ? int64_t{0} : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+[[nodiscard]] uint64_t HashSource(std::span<const uint8_t> source) noexcept {
+    return StringId::Hash(std::string_view{reinterpret_cast<const char*>(source.data()), source.size()});
+}
+
+//A face corner as written in the file. Indices are zero-based.
+//Negative indices in the file count back from the end of the attribute list at that line; those are stored
+//relative to the start of the chunk that read them, and resolved once the chunk's offset is known.
+struct ObjCorner {
+    static constexpr const int32_t missing = (std::numeric_limits<int32_t>::min)();
+    int32_t index[3] = {missing, missing, missing};
+    uint8_t relative_mask{0u};
+};
+
+//Everything one slice of the file contributes, in file order.
+struct ObjChunk {
+    std::span<const uint8_t> text{};
+    std::vector<Vector3> positions{};
+    std::vector<Vector2> texcoords{};
+    std::vector<Vector3> normals{};
+    std::vector<ObjCorner> corners{};
+    std::vector<uint32_t> face_sizes{};
+    std::vector<uint32_t> face_lines{};
+    std::vector<std::pair<unsigned long long, std::string>> mtllibs{};
+    std::string object_name{};
+    std::string material_name{};
+    unsigned long long line_count{0u};
+    unsigned long long error_line{0u};
+    std::string error_element{};
+};
+
+[[nodiscard]] bool IsObjWhitespace(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+[[nodiscard]] std::string_view TrimObjWhitespace(std::string_view str) noexcept {
+    while(!str.empty() && IsObjWhitespace(str.front())) {
+        str.remove_prefix(1);
+    }
+    while(!str.empty() && IsObjWhitespace(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+//Splits the next whitespace-separated token off the front of line.
+[[nodiscard]] std::string_view NextToken(std::string_view& line) noexcept {
+    auto first = std::size_t{0u};
+    while(first < line.size() && IsObjWhitespace(line[first])) {
+        ++first;
+    }
+    auto last = first;
+    while(last < line.size() && !IsObjWhitespace(line[last])) {
+        ++last;
+    }
+    const auto token = line.substr(first, last - first);
+    line.remove_prefix(last);
+    return token;
+}
+
+[[nodiscard]] bool ParseFloat(std::string_view token, float& out) noexcept {
+    if(!token.empty() && token.front() == '+') {
+        token.remove_prefix(1);
+    }
+    const auto* last = token.data() + token.size();
+    const auto [ptr, ec] = std::from_chars(token.data(), last, out);
+    return ec == std::errc{} && ptr == last;
+}
+
+//Reads up to max_count floats from line into out and returns how many were read, or -1 on a malformed number.
+[[nodiscard]] int ParseFloats(std::string_view line, float* out, int max_count) noexcept {
+    auto count = 0;
+    for(auto token = NextToken(line); !token.empty(); token = NextToken(line)) {
+        if(count == max_count || !ParseFloat(token, out[count])) {
+            return -1;
+        }
+        ++count;
+    }
+    return count;
+}
+
+//Parses one v, v/vt, v//vn or v/vt/vn triplet. attribute_counts are the counts read so far in this chunk.
+[[nodiscard]] bool ParseCorner(std::string_view token, const std::size_t (&attribute_counts)[3], ObjCorner& corner) noexcept {
+    for(auto i = 0; i < 3 && !token.empty(); ++i) {
+        const auto slash = token.find('/');
+        const auto element = token.substr(0, slash);
+        token = slash == std::string_view::npos ? std::string_view{} : token.substr(slash + 1);
+        if(element.empty()) {
+            if(i == 0) {
+                return false;
+            }
+            continue;
+        }
+        auto value = int32_t{0};
+        const auto* last = element.data() + element.size();
+        if(const auto [ptr, ec] = std::from_chars(element.data(), last, value); ec != std::errc{} || ptr != last || value == 0) {
+            return false;
+        }
+        if(value < 0) {
+            corner.index[i] = static_cast<int32_t>(attribute_counts[i]) + value;
+            corner.relative_mask |= static_cast<uint8_t>(1u << i);
+        } else {
+            corner.index[i] = value - 1;
+        }
+    }
+    return true;
+}
+
+void ParseChunk(ObjChunk& chunk) noexcept {
+    auto text = std::string_view{reinterpret_cast<const char*>(chunk.text.data()), chunk.text.size()};
+    const auto fail = [&chunk](const char* element) {
+        chunk.error_line = chunk.line_count;
+        chunk.error_element = element;
+    };
+    while(!text.empty()) {
+        const auto eol = text.find('\n');
+        auto line = text.substr(0, eol);
+        text = eol == std::string_view::npos ? std::string_view{} : text.substr(eol + 1);
+        ++chunk.line_count;
+        line = line.substr(0, line.find('#'));
+        const auto key = NextToken(line);
+        if(key.empty()) {
+            continue;
+        }
+        if(key == "v") {
+            float v[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+            if(ParseFloats(line, v, 4) < 1) {
+                return fail("vertex");
+            }
+            if(v[3] != 0.0f) {
+                v[0] /= v[3];
+                v[1] /= v[3];
+                v[2] /= v[3];
+            }
+            chunk.positions.emplace_back(v[0], v[1], v[2]);
+        } else if(key == "vt") {
+            float vt[3] = {0.0f, 0.0f, 0.0f};
+            if(ParseFloats(line, vt, 3) < 1) {
+                return fail("texture coordinate");
+            }
+            chunk.texcoords.emplace_back(vt[0], vt[1]);
+        } else if(key == "vn") {
+            float vn[3] = {0.0f, 0.0f, 0.0f};
+            if(ParseFloats(line, vn, 3) != 3) {
+                return fail("vertex normal");
+            }
+            chunk.normals.emplace_back(vn[0], vn[1], vn[2]);
+        } else if(key == "f") {
+            const std::size_t counts[3] = {chunk.positions.size(), chunk.texcoords.size(), chunk.normals.size()};
+            auto face_size = uint32_t{0u};
+            for(auto token = NextToken(line); !token.empty(); token = NextToken(line)) {
+                auto corner = ObjCorner{};
+                if(!ParseCorner(token, counts, corner)) {
+                    return fail("face index");
+                }
+                chunk.corners.push_back(corner);
+                ++face_size;
+            }
+            if(face_size < 3u) {
+                return fail("face triplet");
+            }
+            chunk.face_sizes.push_back(face_size);
+            chunk.face_lines.push_back(static_cast<uint32_t>(chunk.line_count));
+        } else if(key == "mtllib") {
+            chunk.mtllibs.emplace_back(chunk.line_count, std::string{TrimObjWhitespace(line)});
+        } else if(key == "o") {
+            chunk.object_name = TrimObjWhitespace(line);
+        } else if(key == "usemtl") {
+            chunk.material_name = TrimObjWhitespace(line);
+        }
+    }
+}
+
+//Splits buffer into up to chunk_count slices that each end on a line break.
+[[nodiscard]] std::vector<ObjChunk> SplitIntoChunks(std::span<const uint8_t> buffer, std::size_t chunk_count) noexcept {
+    std::vector<ObjChunk> chunks(chunk_count);
+    auto first = std::size_t{0u};
+    for(auto i = std::size_t{0u}; i < chunk_count; ++i) {
+        auto last = (i + 1u == chunk_count) ? buffer.size() : (std::max)(first, buffer.size() * (i + 1u) / chunk_count);
+        while(last < buffer.size() && buffer[last - 1u] != '\n') {
+            ++last;
+        }
+        chunks[i].text = buffer.subspan(first, last - first);
+        first = last;
+    }
+    return chunks;
+}
+
+struct VertexKey {
+    uint32_t position{0u};
+    uint32_t texcoord{0u};
+    uint32_t normal{0u};
+    [[nodiscard]] friend bool operator==(const VertexKey& lhs, const VertexKey& rhs) noexcept = default;
+};
+
+struct VertexKeyHasher {
+    [[nodiscard]] std::size_t operator()(const VertexKey& key) const noexcept {
+        auto hash = uint64_t{key.position};
+        hash = hash * 0x9E3779B97F4A7C15ull + key.texcoord;
+        hash = hash * 0x9E3779B97F4A7C15ull + key.normal;
+        return static_cast<std::size_t>(hash ^ (hash >> 29));
+    }
+};
+
+void AppendFloat(std::string& buffer, float value) noexcept {
+    char digits[64];
+    const auto [ptr, ec] = std::to_chars(std::begin(digits), std::end(digits), value, std::chars_format::fixed, 6);
+    buffer.append(digits, ptr);
+}
+
+void AppendIndex(std::string& buffer, std::size_t value) noexcept {
+    char digits[24];
+    const auto [ptr, ec] = std::to_chars(std::begin(digits), std::end(digits), value);
+    buffer.append(digits, ptr);
+}
+
+} // namespace
+
 //Run only as an asynchronous operation highly recommended.
 Obj::Obj(std::filesystem::path filepath) noexcept {
     namespace FS = std::filesystem;
@@ -54,74 +317,54 @@ bool Obj::Save(std::filesystem::path filepath) noexcept {
     filepath.make_preferred();
 
     m_is_saving = true;
-    std::ostringstream buffer;
-    buffer << std::fixed << std::setprecision(6);
-    for(auto& v : m_verts) {
-        buffer << "v " << v.x << ' ' << v.y << ' ' << v.z << '\n';
-    }
-    for(auto& v : m_normals) {
-        //v.Normalize();
-        buffer << "vn " << v.x << ' ' << v.y << ' ' << v.z << '\n';
-    }
-    for(auto& v : m_tex_coords) {
-        buffer << "vt " << v.x << ' ' << v.y << ' ' << v.z << '\n';
+    //Every vertex is written with its own v/vt/vn so faces index all three with the same number.
+    std::string buffer{};
+    buffer.reserve(m_vbo.size() * 96u + m_ibo.size() * 24u);
+    const auto append_vector = [&buffer](const char* key, const float* values, int count) {
+        buffer += key;
+        for(auto i = 0; i < count; ++i) {
+            buffer += ' ';
+            AppendFloat(buffer, values[i]);
+        }
+        buffer += '\n';
+    };
+    for(const auto& v : m_vbo) {
+        const float position[3] = {v.position.x, v.position.y, v.position.z};
+        append_vector("v", position, 3);
     }
-    bool has_vn = !m_normals.empty();
-    bool has_vt = !m_tex_coords.empty();
-    bool has_neither = !has_vt && !has_vn;
-    for(auto iter = std::begin(m_face_idxs); iter != std::end(m_face_idxs); /* DO NOTHING */) {
-        auto value1 = (*iter).a;
-        auto value2 = (*iter).b;
-        auto value3 = (*iter).c;
-        buffer << "f ";
-        buffer << (1 + value1);
-        if(!has_neither) {
-            buffer << '/';
-            if(has_vt) {
-                buffer << (1 + value2);
-            }
-            buffer << '/';
-            if(has_vn) {
-                buffer << (1 + value3);
-            }
+    if(m_has_texcoords) {
+        for(const auto& v : m_vbo) {
+            const float texcoords[2] = {v.texcoords.x, v.texcoords.y};
+            append_vector("vt", texcoords, 2);
         }
-        ++iter;
-        value1 = (*iter).a;
-        value2 = (*iter).b;
-        value3 = (*iter).c;
-        buffer << ' ';
-        buffer << (1 + value1);
-        if(!has_neither) {
-            buffer << '/';
-            if(has_vt) {
-                buffer << (1 + value2);
-            }
-            buffer << '/';
-            if(has_vn) {
-                buffer << (1 + value3);
-            }
+    }
+    if(m_has_normals) {
+        for(const auto& v : m_vbo) {
+            const float normal[3] = {v.normal.x, v.normal.y, v.normal.z};
+            append_vector("vn", normal, 3);
         }
-        ++iter;
-        value1 = (*iter).a;
-        value2 = (*iter).b;
-        value3 = (*iter).c;
-        buffer << ' ';
-        buffer << (1 + value1);
-        if(!has_neither) {
-            buffer << '/';
-            if(has_vt) {
-                buffer << (1 + value2);
-            }
-            buffer << '/';
-            if(has_vn) {
-                buffer << (1 + value3);
+    }
+    const bool has_neither = !m_has_texcoords && !m_has_normals;
+    for(auto i = std::size_t{0u}; i + 2u < m_ibo.size(); i += 3u) {
+        buffer += 'f';
+        for(auto corner = i; corner != i + 3u; ++corner) {
+            const auto index = std::size_t{m_ibo[corner]} + 1u;
+            buffer += ' ';
+            AppendIndex(buffer, index);
+            if(!has_neither) {
+                buffer += '/';
+                if(m_has_texcoords) {
+                    AppendIndex(buffer, index);
+                }
+                buffer += '/';
+                if(m_has_normals) {
+                    AppendIndex(buffer, index);
+                }
             }
         }
-        buffer << '\n';
-        ++iter;
+        buffer += '\n';
     }
-    buffer.flush();
-    if(FileUtils::WriteBufferToFile(buffer.str().data(), buffer.str().size(), filepath)) {
+    if(FileUtils::WriteBufferToFile(buffer.data(), buffer.size(), filepath)) {
         m_is_saved = true;
         m_is_saving = false;
         return true;
@@ -155,260 +398,239 @@ const std::vector<unsigned int>& Obj::GetIbo() const noexcept {
     return m_ibo;
 }
 
+std::filesystem::path Obj::GetCachePath(const std::filesystem::path& filepath) noexcept {
+    auto cache_path = filepath;
+    cache_path.replace_extension(".mesh");
+    return cache_path;
+}
+
 void Obj::Unload() noexcept {
     m_is_saved = false;
     m_is_saving = false;
     m_is_loading = false;
     m_is_loaded = false;
-    m_face_idxs.clear();
-    m_face_idxs.shrink_to_fit();
-    m_normals.clear();
-    m_normals.shrink_to_fit();
-    m_tex_coords.clear();
-    m_tex_coords.shrink_to_fit();
-    m_verts.clear();
-    m_verts.shrink_to_fit();
+    m_has_texcoords = false;
+    m_has_normals = false;
     m_ibo.clear();
     m_ibo.shrink_to_fit();
     m_vbo.clear();
     m_vbo.shrink_to_fit();
     m_materialName.clear();
     m_materialName.shrink_to_fit();
+    m_objectName.clear();
+    m_objectName.shrink_to_fit();
 }
 
 bool Obj::Parse(const std::filesystem::path& filepath) noexcept {
-    PROFILE_LOG_SCOPE_FUNCTION();
-    m_verts.clear();
-    m_tex_coords.clear();
-    m_normals.clear();
     m_vbo.clear();
     m_ibo.clear();
-    m_face_idxs.clear();
 
     m_is_loaded = false;
     m_is_saving = false;
     m_is_saved = false;
     m_is_loading = true;
-    if(auto buffer = FileUtils::ReadBinaryBufferFromFile(filepath)) {
-        if(std::stringstream ss{}; ss.write(reinterpret_cast<const char*>(buffer->data()), buffer->size())) {
-            buffer->clear();
-            buffer->shrink_to_fit();
-            ss.clear();
-            ss.seekg(ss.beg);
-            ss.seekp(ss.beg);
-            std::string cur_line{};
-            std::size_t vert_count{};
-            unsigned long long line_index = 0;
-            while(std::getline(ss, cur_line, '\n')) {
-                if(StringUtils::StartsWith(cur_line, "v ")) {
-                    ++vert_count;
-                }
-            }
-            ss.clear();
-            ss.seekg(ss.beg);
-            ss.seekp(ss.beg);
-            m_verts.reserve(vert_count);
-            m_vbo.resize(vert_count);
-            while(std::getline(ss, cur_line, '\n')) {
-                ++line_index;
-                cur_line = cur_line.substr(0, cur_line.find_first_of('#'));
-                if(cur_line.empty()) {
-                    continue;
-                }
-                cur_line = StringUtils::TrimWhitespace(cur_line);
-                const auto&& [key, value] = StringUtils::SplitOnFirst(cur_line, ' ');
-                if(key == "mtllib") {
-                    auto folder = filepath.parent_path();
-                    auto mtlpath = folder / value;
-                    MtlReader mtl{};
-                    if(!mtl.Parse(mtlpath)) {
-                        DebuggerPrintf("Ill-formed material library in OBJ!\n");
-                        PrintErrorToDebugger(filepath, "mtllib", line_index);
-                        return false;
-                    }
-                    continue;
-                } else if(key == "o") {
-                    m_objectName = value;
-                    continue;
-                } else if(key == "usemtl") {
-                    m_materialName = value;
-                    continue;
-                } else if(key == "v") {
-                    auto elems = StringUtils::Split(value, ' ');
-                    std::string v_str = {"["};
-                    auto count = std::size_t{0u};
-                    for(const auto e : elems) {
-                        if(count++ > 0) {
-                            v_str += ",";
-                        }
-                        v_str += e;
-                    }
-                    switch(elems.size()) {
-                    case 4: /* DO NOTHING */ break;
-                    case 3: v_str += ",1.0"; break;
-                    case 2: v_str += ",0.0,1.0"; break;
-                    case 1: v_str += ",0.0,0.0,1.0"; break;
-                    default: PrintErrorToDebugger(filepath, "vertex", line_index); return false;
-                    }
-                    v_str += "]";
-                    Vector4 v(v_str);
-                    v.CalcHomogeneous();
-                    m_verts.emplace_back(v);
-                    continue;
-                } else if(key == "vt") {
-                    auto elems = StringUtils::Split(value, ' ');
-                    std::string v_str = {"["};
-                    auto count = std::size_t{0u};
-                    for(const auto e : elems) {
-                        if(count++ > 0) {
-                            v_str += ",";
-                        }
-                        v_str += e;
-                    }
-                    switch(elems.size()) {
-                    case 3: /* DO NOTHING */ break;
-                    case 2: v_str += ",0.0"; break;
-                    case 1: v_str += ",0.0,0.0"; break;
-                    default: PrintErrorToDebugger(filepath, "texture coordinate", line_index); return false;
-                    }
-                    v_str += "]";
-                    m_tex_coords.emplace_back(v_str);
-                    continue;
-                } else if(key == "vn") {
-                    auto elems = StringUtils::Split(value, ' ');
-                    std::string v_str = {"["};
-                    auto count = std::size_t{0u};
-                    for(const auto e : elems) {
-                        if(count++ > 0) {
-                            v_str += ",";
-                        }
-                        v_str += e;
-                    }
-                    if(elems.size() != 3) {
-                        PrintErrorToDebugger(filepath, "vertex normal", line_index);
-                        return false;
-                    }
-                    v_str += "]";
-                    m_normals.emplace_back(v_str);
-                    continue;
-                } else if(key == "f") {
-                    if(value.find('-') != std::string::npos) {
-                        DebuggerPrintf("ERROR: OBJ implementation does not support relative reference numbers!\n");
-                        PrintErrorToDebugger(filepath, "face index", line_index);
-                        return false;
-                    }
-                    auto tris = StringUtils::Split(value, ' ');
-                    if(tris.size() != 3) {
-                        DebuggerPrintf("WARNING: Performance will be reduced when loading non-triangle polygons!\n");
-                        PrintErrorToDebugger(filepath, "face triplet", line_index);
-                    }
-                    TriangulatePolygon(tris);
-                    continue;
-                }
-            }
-            m_ibo.shrink_to_fit();
+    if(LoadFromCache(filepath)) {
+        m_is_loaded = true;
+        m_is_loading = false;
+        return true;
+    }
+    if(const auto file = FileUtils::MappedFile::Open(filepath)) {
+        if(ParseBuffer(file->GetBytes(), filepath)) {
+            SaveToCache(filepath, file->GetBytes());
             m_is_loaded = true;
             m_is_loading = false;
             return true;
         }
     }
+    m_vbo.clear();
+    m_ibo.clear();
     m_is_loading = false;
     return false;
 }
 
-void Obj::PrintErrorToDebugger(std::filesystem::path filepath, const std::string& elementType, unsigned long long line_index) const noexcept {
-    namespace FS = std::filesystem;
-    filepath = FS::canonical(filepath);
-    filepath.make_preferred();
-    DebuggerPrintf(std::format("{}({}): Invalid {}\n", filepath, line_index, elementType));
-}
-
-Vertex3D Obj::FaceTriToVertex(const std::string& t) const noexcept {
-    auto elems = StringUtils::Split(t, '/', false);
-    Vertex3D vertex{};
-    auto elem_count = elems.size();
-    for(auto i = 0u; i < elem_count; ++i) {
-        switch(i) {
-        case 0:
-            if(!elems[0].empty()) {
-                std::size_t cur_v = std::stoul(elems[0]);
-                vertex.position = m_verts[cur_v - 1];
-            }
-            break;
-        case 1:
-            if(!elems[1].empty()) {
-                std::size_t cur_vt = std::stoul(elems[1]);
-                vertex.texcoords = Vector2{m_tex_coords[cur_vt - 1]};
+bool Obj::ParseBuffer(std::span<const uint8_t> buffer, const std::filesystem::path& filepath) noexcept {
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    const auto use_workers = js->IsRunning() && js->GetWorkerCount() > 0u && buffer.size() >= parallel_parse_threshold;
+    const auto chunk_count = use_workers ? (std::min)(js->GetWorkerCount() + 1u, buffer.size() / min_parse_chunk_size) : std::size_t{1u};
+    auto chunks = SplitIntoChunks(buffer, chunk_count);
+    if(chunks.size() == 1u) {
+        ParseChunk(chunks.front());
+    } else {
+        js->ParallelFor(0u, chunks.size(), 1u, [&chunks](std::size_t first, std::size_t last) {
+            for(auto i = first; i != last; ++i) {
+                ParseChunk(chunks[i]);
             }
-            break;
-        case 2:
-            if(!elems[2].empty()) {
-                std::size_t cur_vn = std::stoul(elems[2]);
-                vertex.normal = m_normals[cur_vn - 1];
+        });
+    }
+
+    //Stitch the chunks back together in file order.
+    auto line_base = 0ull;
+    std::size_t totals[3] = {0u, 0u, 0u};
+    auto corner_total = std::size_t{0u};
+    auto triangle_total = std::size_t{0u};
+    for(const auto& chunk : chunks) {
+        if(!chunk.error_element.empty()) {
+            PrintErrorToDebugger(filepath, chunk.error_element, line_base + chunk.error_line);
+            return false;
+        }
+        for(const auto& [line, library] : chunk.mtllibs) {
+            if(MtlReader mtl{}; !mtl.Parse(filepath.parent_path() / library)) {
+                DebuggerPrintf("Ill-formed material library in OBJ!\n");
+                PrintErrorToDebugger(filepath, "mtllib", line_base + line);
+                return false;
             }
-            break;
-        default: break;
+        }
+        if(!chunk.object_name.empty()) {
+            m_objectName = chunk.object_name;
+        }
+        if(!chunk.material_name.empty()) {
+            m_materialName = chunk.material_name;
+        }
+        line_base += chunk.line_count;
+        totals[0] += chunk.positions.size();
+        totals[1] += chunk.texcoords.size();
+        totals[2] += chunk.normals.size();
+        corner_total += chunk.corners.size();
+        for(const auto face_size : chunk.face_sizes) {
+            triangle_total += face_size - 2u;
         }
     }
-    return vertex;
-}
 
-Obj::FaceIdxs Obj::FaceTriToFaceIdx(const std::string& t) const noexcept {
-    auto elems = StringUtils::Split(t, '/', false);
-    decltype(m_face_idxs)::value_type face{};
-    auto elem_count = elems.size();
-    for(auto i = 0u; i < elem_count; ++i) {
-        switch(i) {
-        case 0:
-            if(!elems[0].empty()) {
-                face.a = std::stoul(elems[0]);
-            } else {
-                face.a = static_cast<std::size_t>(-1);
-            }
-            break;
-        case 1:
-            if(!elems[1].empty()) {
-                face.b = std::stoul(elems[1]);
-            } else {
-                face.b = static_cast<std::size_t>(-1);
+    std::vector<Vector3> positions{};
+    std::vector<Vector2> texcoords{};
+    std::vector<Vector3> normals{};
+    positions.reserve(totals[0]);
+    texcoords.reserve(totals[1]);
+    normals.reserve(totals[2]);
+    for(const auto& chunk : chunks) {
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        texcoords.insert(texcoords.end(), chunk.texcoords.begin(), chunk.texcoords.end());
+        normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+    }
+    m_has_texcoords = !texcoords.empty();
+    m_has_normals = !normals.empty();
+
+    //Corners that name the same v/vt/vn triplet share a vertex.
+    std::unordered_map<VertexKey, unsigned int, VertexKeyHasher> vertex_lookup{};
+    vertex_lookup.reserve(corner_total);
+    m_vbo.reserve(corner_total);
+    m_ibo.reserve(triangle_total * 3u);
+    std::vector<unsigned int> face{};
+    std::size_t bases[3] = {0u, 0u, 0u};
+    line_base = 0ull;
+    for(const auto& chunk : chunks) {
+        auto corner = chunk.corners.cbegin();
+        for(auto face_index = std::size_t{0u}; face_index != chunk.face_sizes.size(); ++face_index) {
+            const auto face_size = chunk.face_sizes[face_index];
+            face.clear();
+            for(auto i = 0u; i != face_size; ++i, ++corner) {
+                uint32_t resolved[3] = {0u, 0u, 0u};
+                for(auto attribute = 0u; attribute != 3u; ++attribute) {
+                    if(corner->index[attribute] == ObjCorner::missing) {
+                        resolved[attribute] = (std::numeric_limits<uint32_t>::max)();
+                        continue;
+                    }
+                    const auto is_relative = (corner->relative_mask & (1u << attribute)) != 0u;
+                    const auto index = static_cast<int64_t>(corner->index[attribute]) + (is_relative ? static_cast<int64_t>(bases[attribute]) : int64_t{0});
+                    if(index < 0 || static_cast<std::size_t>(index) >= totals[attribute]) {
+                        PrintErrorToDebugger(filepath, "face index", line_base + chunk.face_lines[face_index]);
+                        return false;
+                    }
+                    resolved[attribute] = static_cast<uint32_t>(index);
+                }
+                const auto key = VertexKey{resolved[0], resolved[1], resolved[2]};
+                const auto [found, inserted] = vertex_lookup.try_emplace(key, static_cast<unsigned int>(m_vbo.size()));
+                if(inserted) {
+                    auto& vertex = m_vbo.emplace_back(positions[key.position]);
+                    if(key.texcoord != (std::numeric_limits<uint32_t>::max)()) {
+                        vertex.texcoords = texcoords[key.texcoord];
+                    }
+                    if(key.normal != (std::numeric_limits<uint32_t>::max)()) {
+                        vertex.normal = normals[key.normal];
+                    }
+                }
+                face.push_back(found->second);
             }
-            break;
-        case 2:
-            if(!elems[2].empty()) {
-                face.c = std::stoul(elems[2]);
-            } else {
-                face.c = static_cast<std::size_t>(-1);
+            for(auto i = std::size_t{1u}; i + 1u < face.size(); ++i) {
+                m_ibo.push_back(face[0]);
+                m_ibo.push_back(face[i]);
+                m_ibo.push_back(face[i + 1u]);
             }
-            break;
-        default: break;
         }
+        line_base += chunk.line_count;
+        bases[0] += chunk.positions.size();
+        bases[1] += chunk.texcoords.size();
+        bases[2] += chunk.normals.size();
     }
-    return face;
+    m_vbo.shrink_to_fit();
+    return true;
 }
 
-void Obj::TriangulatePolygon(const std::vector<std::string>& tris) noexcept {
-    std::vector<std::size_t> vbo_idxs{};
-    const auto tri_count = tris.size();
-    vbo_idxs.resize(tri_count);
-    auto ai = std::size_t{0u};
-    for(const auto& t : tris) {
-        auto elems = StringUtils::Split(t, '/', false);
-        std::size_t cur_v = std::stoul(elems[0]);
-        std::size_t vbo_index = cur_v - std::size_t{1u};
-        vbo_idxs[ai++] = vbo_index;
+bool Obj::LoadFromCache(const std::filesystem::path& filepath) noexcept {
+    PROFILE_LOG_SCOPE_FUNCTION();
+    const auto cache = FileUtils::MappedFile::Open(GetCachePath(filepath));
+    if(!cache.has_value() || cache->size() < sizeof(MeshCacheHeader)) {
+        return false;
     }
-    for(auto i = std::size_t{0u}; i != tri_count; ++i) {
-        m_vbo[vbo_idxs[i]] = FaceTriToVertex(tris[i]);
+    auto header = MeshCacheHeader{};
+    std::memcpy(&header, cache->data(), sizeof(header));
+    const auto is_current_format = std::memcmp(header.magic, mesh_cache_magic, sizeof(header.magic)) == 0
+                                   && header.version == mesh_cache_version
+                                   && header.vertex_size == sizeof(Vertex3D);
+    const auto vertex_bytes = header.vertex_count * sizeof(Vertex3D);
+    const auto index_bytes = header.index_count * sizeof(unsigned int);
+    if(!is_current_format || cache->size() != sizeof(header) + vertex_bytes + index_bytes) {
+        return false;
     }
-    for(auto i = std::size_t{0u}; i != tri_count - 2; ++i) {
-        m_ibo.push_back(static_cast<unsigned int>(vbo_idxs[0]));
-        m_ibo.push_back(static_cast<unsigned int>(vbo_idxs[(i + 1) % tri_count]));
-        m_ibo.push_back(static_cast<unsigned int>(vbo_idxs[(i + 2) % tri_count]));
-        m_face_idxs.emplace_back(FaceTriToFaceIdx(tris[0]));
-        m_face_idxs.emplace_back(FaceTriToFaceIdx(tris[(i + 1) % tri_count]));
-        m_face_idxs.emplace_back(FaceTriToFaceIdx(tris[(i + 2) % tri_count]));
+    std::error_code ec{};
+    if(const auto source_size = std::filesystem::file_size(filepath, ec); ec || source_size != header.source_size) {
+        return false;
     }
+    //A newer timestamp alone does not mean new contents: checkouts and copies touch files without changing them.
+    if(header.source_time != GetSourceTime(filepath)) {
+        const auto source = FileUtils::MappedFile::Open(filepath);
+        if(!source.has_value() || HashSource(source->GetBytes()) != header.source_hash) {
+            return false;
+        }
+    }
+    m_vbo.resize(static_cast<std::size_t>(header.vertex_count));
+    m_ibo.resize(static_cast<std::size_t>(header.index_count));
+    std::memcpy(m_vbo.data(), cache->data() + sizeof(header), static_cast<std::size_t>(vertex_bytes));
+    std::memcpy(m_ibo.data(), cache->data() + sizeof(header) + vertex_bytes, static_cast<std::size_t>(index_bytes));
+    m_has_texcoords = (header.flags & MeshCacheFlags::HasTexCoords) != 0u;
+    m_has_normals = (header.flags & MeshCacheFlags::HasNormals) != 0u;
+    return true;
 }
 
+void Obj::SaveToCache(const std::filesystem::path& filepath, std::span<const uint8_t> source) const noexcept {
+    PROFILE_LOG_SCOPE_FUNCTION();
+    const auto cache_path = GetCachePath(filepath);
+    if(!FileUtils::HasWritePermissions(cache_path.parent_path())) {
+        return;
+    }
+    auto header = MeshCacheHeader{};
+    std::memcpy(header.magic, mesh_cache_magic, sizeof(header.magic));
+    header.version = mesh_cache_version;
+    header.vertex_size = sizeof(Vertex3D);
+    header.flags = (m_has_texcoords ? MeshCacheFlags::HasTexCoords : 0u) | (m_has_normals ? MeshCacheFlags::HasNormals : 0u);
+    header.source_size = source.size();
+    header.source_time = GetSourceTime(filepath);
+    header.source_hash = HashSource(source);
+    header.vertex_count = m_vbo.size();
+    header.index_count = m_ibo.size();
+    //A failed write only costs the next load a parse.
+    if(std::ofstream ofs{cache_path, std::ios_base::binary | std::ios_base::trunc}; ofs) {
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        ofs.write(reinterpret_cast<const char*>(m_vbo.data()), m_vbo.size() * sizeof(Vertex3D));
+        ofs.write(reinterpret_cast<const char*>(m_ibo.data()), m_ibo.size() * sizeof(unsigned int));
+    }
+}
+
+void Obj::PrintErrorToDebugger(std::filesystem::path filepath, const std::string& elementType, unsigned long long line_index) const noexcept {
+    namespace FS = std::filesystem;
+    filepath = FS::canonical(filepath);
+    filepath.make_preferred();
+    DebuggerPrintf(std::format("{}({}): Invalid {}\n", filepath, line_index, elementType));
+}
 
 } // namespace FileUtils
@@ -4,8 +4,10 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -29,6 +31,8 @@ public:
     [[nodiscard]] const std::vector<unsigned int>& GetIbo() const noexcept;
 
     void Unload() noexcept;
+    //Loads from the binary .mesh cache next to filepath when it was built from the same source file,
+    //otherwise parses filepath and rewrites the cache.
     [[nodiscard]] bool Load(std::filesystem::path filepath) noexcept;
     [[nodiscard]] bool Save(std::filesystem::path filepath) noexcept;
     [[nodiscard]] bool IsLoaded() const noexcept;
@@ -36,31 +40,23 @@ public:
     [[nodiscard]] bool IsSaving() const noexcept;
     [[nodiscard]] bool IsSaved() const noexcept;
 
+    [[nodiscard]] static std::filesystem::path GetCachePath(const std::filesystem::path& filepath) noexcept;
+
 protected:
 private:
     [[nodiscard]] bool Parse(const std::filesystem::path& filepath) noexcept;
+    [[nodiscard]] bool ParseBuffer(std::span<const uint8_t> buffer, const std::filesystem::path& filepath) noexcept;
+    [[nodiscard]] bool LoadFromCache(const std::filesystem::path& filepath) noexcept;
+    void SaveToCache(const std::filesystem::path& filepath, std::span<const uint8_t> source) const noexcept;
 
     void PrintErrorToDebugger(std::filesystem::path filepath, const std::string& elementType, unsigned long long line_index) const noexcept;
 
-    Vertex3D FaceTriToVertex(const std::string& t) const noexcept;
-
-    struct FaceIdxs {
-        std::size_t a;
-        std::size_t b;
-        std::size_t c;
-    };
-    FaceIdxs FaceTriToFaceIdx(const std::string& t) const noexcept;
-
-    void TriangulatePolygon(const std::vector<std::string>& tris) noexcept;
-
     std::string m_materialName{};
     std::string m_objectName{};
     std::vector<Vertex3D> m_vbo{};
     std::vector<unsigned int> m_ibo{};
-    std::vector<Vector3> m_verts{};
-    std::vector<Vector3> m_tex_coords{};
-    std::vector<Vector3> m_normals{};
-    std::vector<FaceIdxs> m_face_idxs{};
+    bool m_has_texcoords{false};
+    bool m_has_normals{false};
     std::atomic_bool m_is_loaded = false;
     std::atomic_bool m_is_loading = false;
     std::atomic_bool m_is_saving = false;
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/Core/StringId.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//Owns named resources and finds them by StringId in constant time.
+//Resources keep the index they were registered at, even when replaced, so indices can be handed out as ids.
+//Names are used exactly as given; callers that key by file path canonicalize before registering.
+template<typename T>
+class ResourceRegistry {
+public:
+    struct Entry {
+        std::string name{};
+        std::unique_ptr<T> resource{};
+    };
+
+    //Adds resource as name, replacing and destroying any resource already registered under that name.
+    T* Register(std::string_view name, std::unique_ptr<T> resource) noexcept {
+        const auto id = StringId::Intern(name);
+        auto* result = resource.get();
+        if(const auto found = m_lookup.find(id); found != m_lookup.end()) {
+            m_entries[found->second].resource = std::move(resource);
+            return result;
+        }
+        m_lookup.emplace(id, m_entries.size());
+        m_entries.push_back(Entry{std::string{name}, std::move(resource)});
+        return result;
+    }
+
+    //Makes alias find the resource at index. Clear removes aliases along with the resources.
+    void AddAlias(std::string_view alias, std::size_t index) noexcept {
+        if(index < m_entries.size()) {
+            m_lookup.insert_or_assign(StringId::Intern(alias), index);
+        }
+    }
+
+    [[nodiscard]] T* Find(const StringId& id) const noexcept {
+        if(const auto found = m_lookup.find(id); found != m_lookup.end()) {
+            return m_entries[found->second].resource.get();
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] T* Find(std::string_view name) const noexcept {
+        return Find(StringId{name});
+    }
+
+    //Returns size() when id is not registered.
+    [[nodiscard]] std::size_t FindIndex(const StringId& id) const noexcept {
+        if(const auto found = m_lookup.find(id); found != m_lookup.end()) {
+            return found->second;
+        }
+        return m_entries.size();
+    }
+
+    [[nodiscard]] bool Contains(const StringId& id) const noexcept {
+        return m_lookup.contains(id);
+    }
+
+    [[nodiscard]] T* Get(std::size_t index) const noexcept {
+        return index < m_entries.size() ? m_entries[index].resource.get() : nullptr;
+    }
+
+    [[nodiscard]] const std::string& GetName(std::size_t index) const noexcept {
+        return m_entries[index].name;
+    }
+
+    void Clear() noexcept {
+        m_lookup.clear();
+        m_entries.clear();
+        m_entries.shrink_to_fit();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_entries.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_entries.empty();
+    }
+
+    [[nodiscard]] auto begin() const noexcept {
+        return m_entries.cbegin();
+    }
+
+    [[nodiscard]] auto end() const noexcept {
+        return m_entries.cend();
+    }
+
+protected:
+private:
+    std::vector<Entry> m_entries{};
+    std::unordered_map<StringId, std::size_t> m_lookup{};
+};
@@ -3,7 +3,10 @@
 #include "Engine/Core/BuildConfig.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <sstream>
@@ -33,25 +36,34 @@ Riff::~Riff() noexcept {
     m_current_chunk = m_chunks.end();
 }
 
-bool Riff::ParseDataIntoChunks(std::vector<uint8_t>& buffer) noexcept {
-    std::stringstream stream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-    stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
-    stream.clear();
-    stream.seekp(0);
-    stream.seekg(0);
+namespace {
+
+//Copies count bytes from the front of buffer into dest and advances buffer past them.
+[[nodiscard]] bool ReadBytes(std::span<const uint8_t>& buffer, void* dest, std::size_t count) noexcept {
+    if(buffer.size() < count) {
+        return false;
+    }
+    std::memcpy(dest, buffer.data(), count);
+    buffer = buffer.subspan(count);
+    return true;
+}
+
+} // namespace
+
+bool Riff::ParseDataIntoChunks(std::span<const uint8_t> buffer) noexcept {
     detail::RiffHeader cur_header{};
-    while(stream.read(reinterpret_cast<char*>(&cur_header), sizeof(cur_header))) {
+    while(ReadBytes(buffer, &cur_header, sizeof(cur_header))) {
         auto cur_chunk = detail::RiffChunk{};
         cur_chunk.header = cur_header;
         switch(StringUtils::FourCC(cur_header.fourcc)) {
         case RiffChunkID::RIFF: {
             auto subdata = detail::RiffSubChunk{};
-            if(!stream.read(reinterpret_cast<char*>(&subdata.fourcc), 4)) {
+            if(!ReadBytes(buffer, &subdata.fourcc, 4)) {
                 return false;
             }
             subdata.subdata_length = std::size_t{cur_header.length - uint32_t{4u}};
             subdata.subdata = std::move(std::make_unique<uint8_t[]>(subdata.subdata_length));
-            if(!stream.read(reinterpret_cast<char*>(subdata.subdata.get()), subdata.subdata_length)) {
+            if(!ReadBytes(buffer, subdata.subdata.get(), subdata.subdata_length)) {
                 return false;
             }
             cur_chunk.data = std::move(subdata);
@@ -59,12 +71,12 @@ bool Riff::ParseDataIntoChunks(std::vector<uint8_t>& buffer) noexcept {
         }
         case RiffChunkID::INFO: {
             auto subdata = detail::RiffSubChunk{};
-            if(!stream.read(reinterpret_cast<char*>(&subdata.fourcc), 4)) {
+            if(!ReadBytes(buffer, &subdata.fourcc, 4)) {
                 return false;
             }
             subdata.subdata_length = std::size_t{cur_header.length - uint32_t{4u}};
             subdata.subdata = std::move(std::make_unique<uint8_t[]>(subdata.subdata_length));
-            if(!stream.read(reinterpret_cast<char*>(subdata.subdata.get()), subdata.subdata_length)) {
+            if(!ReadBytes(buffer, subdata.subdata.get(), subdata.subdata_length)) {
                 return false;
             }
             {
@@ -82,16 +94,16 @@ bool Riff::ParseDataIntoChunks(std::vector<uint8_t>& buffer) noexcept {
         }
         case RiffChunkID::LIST: {
             auto subdata = detail::RiffSubChunk{};
-            if(!stream.read(reinterpret_cast<char*>(&subdata.fourcc), 4)) {
+            if(!ReadBytes(buffer, &subdata.fourcc, 4)) {
                 return false;
             }
             subdata.subdata_length = std::size_t{cur_header.length - uint32_t{4u}};
             subdata.subdata = std::move(std::make_unique<uint8_t[]>(subdata.subdata_length));
             auto subdata_head = subdata.subdata.get();
-            if(!stream.read(reinterpret_cast<char*>(subdata_head), subdata.subdata_length)) {
+            if(!ReadBytes(buffer, subdata_head, subdata.subdata_length)) {
                 return false;
             }
-            auto&& list_chunk = std::move(ReadListChunk(stream));
+            auto&& list_chunk = std::move(ReadListChunk(buffer));
             if(list_chunk) {
                 cur_chunk = std::move(list_chunk.value());
             }
@@ -108,8 +120,7 @@ bool Riff::ParseDataIntoChunks(std::vector<uint8_t>& buffer) noexcept {
                 err_ss.write(len.c_str(), len.size());
                 DebuggerPrintf(err_ss.str().c_str());
             }
-            stream.seekp(cur_header.length, std::ios_base::cur);
-            stream.seekg(cur_header.length, std::ios_base::cur);
+            buffer = buffer.subspan((std::min)(std::size_t{cur_header.length}, buffer.size()));
             break;
         }
         }
@@ -129,8 +140,8 @@ detail::RiffChunk* Riff::GetNextChunk() const noexcept {
 }
 
 unsigned int Riff::Load(std::filesystem::path filename) noexcept {
-    if(auto buffer = FileUtils::ReadBinaryBufferFromFile(filename)) {
-        if(RIFF_SUCCESS == Load(buffer.value())) {
+    if(const auto file = FileUtils::MappedFile::Open(filename)) {
+        if(RIFF_SUCCESS == Load(file->GetBytes())) {
             return RIFF_SUCCESS;
         }
     }
@@ -138,6 +149,10 @@ unsigned int Riff::Load(std::filesystem::path filename) noexcept {
 }
 
 unsigned int Riff::Load(std::vector<unsigned char>& data) noexcept {
+    return Load(std::span<const uint8_t>{data});
+}
+
+unsigned int Riff::Load(std::span<const uint8_t> data) noexcept {
     if(!ParseDataIntoChunks(data)) {
         return RIFF_ERROR_NOT_A_RIFF;
     }
@@ -167,4 +182,22 @@ std::optional<FileUtils::detail::RiffChunk> Riff::ReadListChunk(std::stringstrea
     return {};
 }
 
+std::optional<FileUtils::detail::RiffChunk> Riff::ReadListChunk(std::span<const uint8_t>& buffer) noexcept {
+    detail::RiffHeader cur_header{};
+    if(ReadBytes(buffer, &cur_header, sizeof(cur_header))) {
+        auto cur_chunk = detail::RiffChunk{};
+        cur_chunk.header = cur_header;
+        auto subdata = detail::RiffSubChunk{};
+        StringUtils::CopyFourCC(subdata.fourcc, cur_header.fourcc);
+        uint32_t subdata_length = cur_header.length - 4;
+        subdata.subdata = std::move(std::make_unique<uint8_t[]>(subdata_length));
+        if(!ReadBytes(buffer, subdata.subdata.get(), subdata_length)) {
+            return {};
+        }
+        cur_chunk.data = std::move(subdata);
+        return cur_chunk;
+    }
+    return {};
+}
+
 } // namespace FileUtils
\ No newline at end of file
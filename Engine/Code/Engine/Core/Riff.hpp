@@ -4,6 +4,7 @@
 
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace FileUtils {
@@ -73,11 +74,13 @@ public:
     [[nodiscard]] detail::RiffChunk* GetNextChunk() const noexcept;
     [[nodiscard]] unsigned int Load(std::filesystem::path filename) noexcept;
     [[nodiscard]] unsigned int Load(std::vector<unsigned char>& data) noexcept;
+    [[nodiscard]] unsigned int Load(std::span<const uint8_t> data) noexcept;
     [[nodiscard]] static std::optional<detail::RiffChunk> ReadListChunk(std::stringstream& stream) noexcept;
 
 protected:
 private:
-    [[nodiscard]] bool ParseDataIntoChunks(std::vector<uint8_t>& buffer) noexcept;
+    [[nodiscard]] bool ParseDataIntoChunks(std::span<const uint8_t> buffer) noexcept;
+    [[nodiscard]] static std::optional<detail::RiffChunk> ReadListChunk(std::span<const uint8_t>& buffer) noexcept;
 
     std::vector<detail::RiffChunk> m_chunks;
     mutable decltype(m_chunks)::iterator m_current_chunk;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <utility>
 
 struct RingBufferDesc {
@@ -27,14 +28,14 @@ public:
         if(m_desc.NoWriteOnFull && full()) {
             return;
         }
-        *m_tailIdx = object;
+        m_ringbuffer[m_tailIdx] = object;
         IncrementTail();
     }
     void Push(T&& object) noexcept {
         if(m_desc.NoWriteOnFull && full()) {
             return;
         }
-        *m_tailIdx = std::move(object);
+        m_ringbuffer[m_tailIdx] = std::move(object);
         IncrementTail();
     }
 
@@ -55,27 +56,25 @@ public:
     }
 
     auto begin() noexcept {
-        return m_headIdx;
+        return std::begin(m_ringbuffer) + m_headIdx;
     }
     auto end() noexcept {
-        return m_tailIdx;
+        return std::begin(m_ringbuffer) + m_tailIdx;
     }
     
-    auto cbegin() noexcept {
-        return m_headIdx;
+    auto cbegin() const noexcept {
+        return std::cbegin(m_ringbuffer) + m_headIdx;
     }
-    auto cend() noexcept {
-        return m_tailIdx;
+    auto cend() const noexcept {
+        return std::cbegin(m_ringbuffer) + m_tailIdx;
     }
 
 protected:
 
 private:
-    auto GetNext(std::array<T, Size>::iterator iter) const noexcept {
-        return std::next(iter) == std::cend(m_ringbuffer) ? std::cbegin(m_ringbuffer) : std::next(iter);
-    }
-    auto GetNext(std::array<T, Size>::iterator iter) noexcept {
-        return std::next(iter) == std::end(m_ringbuffer) ? std::begin(m_ringbuffer) : std::next(iter);
+    //Indices rather than iterators so copies and moves keep pointing into their own array.
+    static constexpr std::size_t GetNext(std::size_t index) noexcept {
+        return index + 1u == Size ? 0u : index + 1u;
     }
     void IncrementHead() noexcept {
         m_headIdx = GetNext(m_headIdx);
@@ -84,7 +83,7 @@ private:
         m_tailIdx = GetNext(m_tailIdx);
     }
     std::array<T, Size> m_ringbuffer;
-    std::array<T, Size>::iterator m_headIdx = std::begin(m_ringbuffer);
-    std::array<T, Size>::iterator m_tailIdx = std::begin(m_ringbuffer);
+    std::size_t m_headIdx{0u};
+    std::size_t m_tailIdx{0u};
     RingBufferDesc m_desc{};
 };
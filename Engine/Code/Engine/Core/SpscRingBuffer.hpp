@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+//Bounded wait-free single-producer, single-consumer ring.
+//Head and tail are free-running counters on their own cache lines; each side also keeps a private copy of the
+//other side's counter and only reloads it when the copy says the ring looks full (producer) or empty (consumer),
+//so in steady state neither thread touches the other's line.
+template<typename T>
+class SpscRingBuffer {
+public:
+    explicit SpscRingBuffer(std::size_t capacity = 1024u) noexcept;
+    SpscRingBuffer(const SpscRingBuffer& other) = delete;
+    SpscRingBuffer(SpscRingBuffer&& other) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer& other) = delete;
+    SpscRingBuffer& operator=(SpscRingBuffer&& other) = delete;
+    ~SpscRingBuffer() noexcept;
+
+    //Producer thread only.
+    [[nodiscard]] bool try_push(const T& value) noexcept;
+    //Producer thread only.
+    [[nodiscard]] bool try_push(T&& value) noexcept;
+    //Producer thread only.
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args) noexcept;
+
+    //Consumer thread only.
+    [[nodiscard]] bool try_pop(T& out) noexcept;
+    //Consumer thread only. Takes as many values as are ready, up to out.size(), and frees them with a single store.
+    [[nodiscard]] std::size_t try_pop_n(std::span<T> out) noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+protected:
+private:
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    [[nodiscard]] T* At(std::size_t index) noexcept;
+
+    static constexpr std::size_t cache_line_size = 64u;
+
+    std::unique_ptr<Slot[]> m_slots{};
+    std::size_t m_capacity{};
+    std::size_t m_mask{};
+    alignas(cache_line_size) std::atomic<std::size_t> m_head{0u};
+    std::size_t m_cached_tail{0u};
+    alignas(cache_line_size) std::atomic<std::size_t> m_tail{0u};
+    std::size_t m_cached_head{0u};
+};
+
+template<typename T>
+SpscRingBuffer<T>::SpscRingBuffer(std::size_t capacity /*= 1024u*/) noexcept {
+    auto rounded = std::size_t{2u};
+    while(rounded < capacity) {
+        rounded <<= 1u;
+    }
+    m_capacity = rounded;
+    m_mask = rounded - 1u;
+    m_slots = std::make_unique<Slot[]>(rounded);
+}
+
+template<typename T>
+SpscRingBuffer<T>::~SpscRingBuffer() noexcept {
+    if constexpr(!std::is_trivially_destructible_v<T>) {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        for(auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+            At(head)->~T();
+        }
+    }
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::try_push(const T& value) noexcept {
+    return try_emplace(value);
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::try_push(T&& value) noexcept {
+    return try_emplace(std::move(value));
+}
+
+template<typename T>
+template<typename... Args>
+bool SpscRingBuffer<T>::try_emplace(Args&&... args) noexcept {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    if(tail - m_cached_head == m_capacity) {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        if(tail - m_cached_head == m_capacity) {
+            return false;
+        }
+    }
+    ::new(static_cast<void*>(m_slots[tail & m_mask].storage)) T(std::forward<Args>(args)...);
+    m_tail.store(tail + 1u, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::try_pop(T& out) noexcept {
+    return try_pop_n(std::span<T>{&out, 1u}) == 1u;
+}
+
+template<typename T>
+std::size_t SpscRingBuffer<T>::try_pop_n(std::span<T> out) noexcept {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    if(m_cached_tail - head < out.size()) {
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+    }
+    const auto count = (std::min)(m_cached_tail - head, out.size());
+    for(std::size_t i = 0u; i < count; ++i) {
+        auto* value = At(head + i);
+        out[i] = std::move(*value);
+        value->~T();
+    }
+    if(count) {
+        m_head.store(head + count, std::memory_order_release);
+    }
+    return count;
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::empty() const noexcept {
+    return size() == 0u;
+}
+
+template<typename T>
+std::size_t SpscRingBuffer<T>::size() const noexcept {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+template<typename T>
+std::size_t SpscRingBuffer<T>::capacity() const noexcept {
+    return m_capacity;
+}
+
+template<typename T>
+T* SpscRingBuffer<T>::At(std::size_t index) noexcept {
+    return std::launder(reinterpret_cast<T*>(m_slots[index & m_mask].storage));
+}
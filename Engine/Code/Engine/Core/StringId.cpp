@@ -0,0 +1,40 @@
+#include "Engine/Core/StringId.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <format>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+struct InternTable {
+    std::mutex cs{};
+    std::unordered_map<std::uint64_t, std::string> strings{};
+};
+
+InternTable& GetInternTable() noexcept {
+    static InternTable table{};
+    return table;
+}
+
+} // namespace
+
+StringId StringId::Intern(std::string_view str) noexcept {
+    const auto id = StringId{str};
+    auto& table = GetInternTable();
+    std::scoped_lock lock(table.cs);
+    if(const auto [iter, inserted] = table.strings.try_emplace(id.GetHash(), str); !inserted) {
+        GUARANTEE_OR_DIE(iter->second == str, std::format("StringId hash collision between \"{}\" and \"{}\".", iter->second, str));
+    }
+    return id;
+}
+
+std::string_view StringId::GetString() const noexcept {
+    auto& table = GetInternTable();
+    std::scoped_lock lock(table.cs);
+    if(const auto found = table.strings.find(m_hash); found != table.strings.end()) {
+        return found->second;
+    }
+    return {};
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+//A string reduced to its 64-bit FNV-1a hash.
+//Comparing and hashing a StringId costs the same as an integer, and an id built from a
+//string literal is computed at compile time, so it can be stored and reused as a lookup key.
+class StringId {
+public:
+    constexpr StringId() noexcept = default;
+    constexpr explicit StringId(std::string_view str) noexcept
+    : m_hash(Hash(str)) {}
+    constexpr explicit StringId(const char* str) noexcept
+    : StringId(std::string_view{str}) {}
+    explicit StringId(const std::string& str) noexcept
+    : StringId(std::string_view{str}) {}
+
+    //Records str so it can be recovered with GetString.
+    //Dies if a different string was already interned with the same hash.
+    [[nodiscard]] static StringId Intern(std::string_view str) noexcept;
+
+    //Returns the interned string, or an empty view if this id was never interned.
+    [[nodiscard]] std::string_view GetString() const noexcept;
+
+    [[nodiscard]] constexpr std::uint64_t GetHash() const noexcept {
+        return m_hash;
+    }
+
+    [[nodiscard]] constexpr bool IsValid() const noexcept {
+        return m_hash != 0u;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const StringId& lhs, const StringId& rhs) noexcept = default;
+    [[nodiscard]] constexpr friend std::strong_ordering operator<=>(const StringId& lhs, const StringId& rhs) noexcept = default;
+
+    [[nodiscard]] static constexpr std::uint64_t Hash(std::string_view str) noexcept {
+        std::uint64_t hash = 14695981039346656037ull;
+        for(const auto c : str) {
+            hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+protected:
+private:
+    std::uint64_t m_hash{0u};
+};
+
+namespace std {
+
+template<typename T> struct hash;
+
+template<>
+struct hash<StringId> {
+    std::size_t operator()(const StringId& id) const noexcept {
+        return static_cast<std::size_t>(id.GetHash());
+    }
+};
+} // namespace std
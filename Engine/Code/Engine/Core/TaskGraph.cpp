@@ -0,0 +1,297 @@
+#include "Engine/Core/TaskGraph.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/JobTypes.hpp"
+
+#include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IFileLoggerService.hpp"
+#include "Engine/Services/IJobSystemService.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <map>
+#include <queue>
+#include <thread>
+
+TaskGraph::TaskBuilder::TaskBuilder(TaskGraph* graph, TaskId id) noexcept
+: m_graph{graph}
+, m_id{id} {
+    /* DO NOTHING */
+}
+
+TaskGraph::TaskBuilder& TaskGraph::TaskBuilder::Reads(const std::string& resource) noexcept {
+    m_graph->m_tasks[m_id].accesses.push_back(Access{resource, false});
+    m_graph->m_compiled = false;
+    return *this;
+}
+
+TaskGraph::TaskBuilder& TaskGraph::TaskBuilder::Writes(const std::string& resource) noexcept {
+    m_graph->m_tasks[m_id].accesses.push_back(Access{resource, true});
+    m_graph->m_compiled = false;
+    return *this;
+}
+
+TaskGraph::TaskBuilder& TaskGraph::TaskBuilder::After(TaskId other) noexcept {
+    m_graph->m_tasks[m_id].explicit_predecessors.push_back(other);
+    m_graph->m_compiled = false;
+    return *this;
+}
+
+TaskGraph::TaskBuilder& TaskGraph::TaskBuilder::RunOn(Affinity affinity) noexcept {
+    m_graph->m_tasks[m_id].affinity = affinity;
+    return *this;
+}
+
+TaskGraph::TaskId TaskGraph::TaskBuilder::GetId() const noexcept {
+    return m_id;
+}
+
+TaskGraph::TaskBuilder TaskGraph::AddTask(const std::string& name, const TaskCallback& cb) noexcept {
+    Task t{};
+    t.name = name;
+    t.cb = cb;
+    m_tasks.push_back(std::move(t));
+    m_compiled = false;
+    return TaskBuilder{this, m_tasks.size() - 1u};
+}
+
+bool TaskGraph::Compile() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    const auto task_count = m_tasks.size();
+    for(auto& task : m_tasks) {
+        task.successors.clear();
+        task.predecessor_count = 0u;
+    }
+    const auto add_edge = [this](TaskId from, TaskId to) {
+        if(from == invalid_task || from == to || m_tasks.size() <= from) {
+            return;
+        }
+        auto& successors = m_tasks[from].successors;
+        if(std::find(std::cbegin(successors), std::cend(successors), to) == std::cend(successors)) {
+            successors.push_back(to);
+            ++m_tasks[to].predecessor_count;
+        }
+    };
+
+    struct resource_state_t {
+        TaskId last_writer{invalid_task};
+        std::vector<TaskId> readers_since_write{};
+    };
+    std::map<std::string, resource_state_t> resources{};
+    for(TaskId id = 0u; id < task_count; ++id) {
+        auto& task = m_tasks[id];
+        //Reads first so a task that reads and writes the same resource is ordered after the previous writer only once.
+        for(const auto& access : task.accesses) {
+            if(access.write) {
+                continue;
+            }
+            auto& state = resources[access.resource];
+            add_edge(state.last_writer, id);
+            state.readers_since_write.push_back(id);
+        }
+        for(const auto& access : task.accesses) {
+            if(!access.write) {
+                continue;
+            }
+            auto& state = resources[access.resource];
+            add_edge(state.last_writer, id);
+            for(const auto reader : state.readers_since_write) {
+                add_edge(reader, id);
+            }
+            state.last_writer = id;
+            state.readers_since_write.clear();
+        }
+        for(const auto predecessor : task.explicit_predecessors) {
+            add_edge(predecessor, id);
+        }
+    }
+
+    //Kahn's algorithm, always taking the earliest-added ready task so the schedule is stable.
+    m_schedule.clear();
+    m_roots.clear();
+    std::vector<std::size_t> in_degree(task_count);
+    std::priority_queue<TaskId, std::vector<TaskId>, std::greater<>> ready{};
+    for(TaskId id = 0u; id < task_count; ++id) {
+        in_degree[id] = m_tasks[id].predecessor_count;
+        if(in_degree[id] == 0u) {
+            ready.push(id);
+            m_roots.push_back(id);
+        }
+    }
+    while(!ready.empty()) {
+        const auto id = ready.top();
+        ready.pop();
+        m_schedule.push_back(id);
+        for(const auto successor : m_tasks[id].successors) {
+            if(--in_degree[successor] == 0u) {
+                ready.push(successor);
+            }
+        }
+    }
+    if(m_schedule.size() != task_count) {
+        auto* logger = ServiceLocator::get<IFileLoggerService>();
+        logger->LogErrorLine("TaskGraph: Dependency cycle detected. Graph was not compiled.");
+        m_schedule.clear();
+        m_roots.clear();
+        m_compiled = false;
+        return false;
+    }
+    m_pending = std::make_unique<std::atomic<std::size_t>[]>(task_count);
+    m_compiled = true;
+    return true;
+}
+
+bool TaskGraph::IsCompiled() const noexcept {
+    return m_compiled;
+}
+
+void TaskGraph::Run() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+
+    if(!m_compiled && !Compile()) {
+        return;
+    }
+    if(m_tasks.empty()) {
+        return;
+    }
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    const auto start = TimeUtils::Now();
+    if(js->GetWorkerCount() == 0u) {
+        RunSerial();
+        m_last_run_duration = TimeUtils::Now() - start;
+        return;
+    }
+
+    for(std::size_t i = 0u; i < m_tasks.size(); ++i) {
+        m_pending[i].store(m_tasks[i].predecessor_count, std::memory_order_relaxed);
+    }
+    m_remaining.store(m_tasks.size(), std::memory_order_release);
+    for(const auto root : m_roots) {
+        if(m_tasks[root].affinity == Affinity::Any) {
+            Schedule(root);
+        }
+    }
+    //Main-thread tasks run here in schedule order; help with worker tasks while waiting on their inputs.
+    for(const auto id : m_schedule) {
+        if(m_tasks[id].affinity != Affinity::MainThread) {
+            continue;
+        }
+        while(m_pending[id].load(std::memory_order_acquire) != 0u) {
+            if(!js->TryRunPendingJob()) {
+                std::this_thread::yield();
+            }
+        }
+        Execute(id);
+    }
+    while(m_remaining.load(std::memory_order_acquire) != 0u) {
+        if(!js->TryRunPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+    m_last_run_duration = TimeUtils::Now() - start;
+}
+
+void TaskGraph::RunSerial() noexcept {
+    for(const auto id : m_schedule) {
+        auto& task = m_tasks[id];
+        const auto task_start = TimeUtils::Now();
+        task.cb();
+        task.duration = TimeUtils::Now() - task_start;
+    }
+}
+
+void TaskGraph::Schedule(TaskId id) noexcept {
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    js->Run(JobType::Generic, [this, id](void*) { Execute(id); }, nullptr);
+}
+
+//Worker threads keep one ready successor as a continuation instead of paying for another dispatch.
+void TaskGraph::Execute(TaskId id) noexcept {
+    while(id != invalid_task) {
+        auto& task = m_tasks[id];
+        const auto task_start = TimeUtils::Now();
+        task.cb();
+        task.duration = TimeUtils::Now() - task_start;
+
+        auto continuation = invalid_task;
+        const bool on_main_thread = task.affinity == Affinity::MainThread;
+        for(const auto successor : task.successors) {
+            if(m_pending[successor].fetch_sub(1u, std::memory_order_acq_rel) != 1u) {
+                continue;
+            }
+            if(m_tasks[successor].affinity == Affinity::MainThread) {
+                //Picked up by the main thread loop in Run().
+                continue;
+            }
+            if(continuation == invalid_task && !on_main_thread) {
+                continuation = successor;
+            } else {
+                Schedule(successor);
+            }
+        }
+        //Run() may return as soon as this reaches zero; nothing may touch the graph afterwards.
+        m_remaining.fetch_sub(1u, std::memory_order_acq_rel);
+        id = continuation;
+    }
+}
+
+std::size_t TaskGraph::GetTaskCount() const noexcept {
+    return m_tasks.size();
+}
+
+const std::vector<TaskGraph::TaskId>& TaskGraph::GetSchedule() const noexcept {
+    return m_schedule;
+}
+
+std::vector<TaskGraph::CriticalPathEntry> TaskGraph::GetCriticalPath() const noexcept {
+    if(!m_compiled || m_schedule.empty()) {
+        return {};
+    }
+    const auto task_count = m_tasks.size();
+    std::vector<TimeUtils::FPMilliseconds> longest_to(task_count, TimeUtils::FPMilliseconds::zero());
+    std::vector<TimeUtils::FPMilliseconds> finish(task_count, TimeUtils::FPMilliseconds::zero());
+    std::vector<TaskId> previous(task_count, invalid_task);
+    for(const auto id : m_schedule) {
+        finish[id] = longest_to[id] + m_tasks[id].duration;
+        for(const auto successor : m_tasks[id].successors) {
+            if(longest_to[successor] < finish[id]) {
+                longest_to[successor] = finish[id];
+                previous[successor] = id;
+            }
+        }
+    }
+    auto last = static_cast<TaskId>(std::distance(std::cbegin(finish), std::max_element(std::cbegin(finish), std::cend(finish))));
+    std::vector<CriticalPathEntry> result{};
+    for(auto id = last; id != invalid_task; id = previous[id]) {
+        result.push_back(CriticalPathEntry{m_tasks[id].name, m_tasks[id].duration});
+    }
+    std::reverse(std::begin(result), std::end(result));
+    return result;
+}
+
+TimeUtils::FPMilliseconds TaskGraph::GetLastRunDuration() const noexcept {
+    return m_last_run_duration;
+}
+
+std::string TaskGraph::DumpCriticalPath() const noexcept {
+    const auto path = GetCriticalPath();
+    auto path_total = TimeUtils::FPMilliseconds::zero();
+    std::string result{};
+    for(const auto& entry : path) {
+        path_total += entry.duration;
+        result += std::format("{:>10.3f} ms  {}\n", entry.duration.count(), entry.name);
+    }
+    result += std::format("{:>10.3f} ms  critical path ({} of {} tasks)\n", path_total.count(), path.size(), m_tasks.size());
+    result += std::format("{:>10.3f} ms  total run\n", m_last_run_duration.count());
+    return result;
+}
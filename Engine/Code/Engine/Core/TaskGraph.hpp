@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Engine/Core/InplaceFunction.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+//Builds a dependency graph of tasks from the named resources each task reads and writes,
+//compiles it once into a topologically sorted schedule and runs that schedule on the JobSystem each frame.
+//Ordering between tasks that touch the same resource follows the order the tasks were added:
+//a task runs after every earlier writer of what it reads and after every earlier reader or writer of what it writes.
+class TaskGraph {
+public:
+    using TaskId = std::size_t;
+    using TaskCallback = InplaceFunction<void(), 64u>;
+    static constexpr TaskId invalid_task = static_cast<TaskId>(-1);
+
+    enum class Affinity {
+        Any,
+        MainThread,
+    };
+
+    class TaskBuilder {
+    public:
+        TaskBuilder& Reads(const std::string& resource) noexcept;
+        TaskBuilder& Writes(const std::string& resource) noexcept;
+        TaskBuilder& After(TaskId other) noexcept;
+        TaskBuilder& RunOn(Affinity affinity) noexcept;
+        [[nodiscard]] TaskId GetId() const noexcept;
+
+    private:
+        TaskBuilder(TaskGraph* graph, TaskId id) noexcept;
+        TaskGraph* m_graph{};
+        TaskId m_id{invalid_task};
+        friend class TaskGraph;
+    };
+
+    struct CriticalPathEntry {
+        std::string name{};
+        TimeUtils::FPMilliseconds duration{};
+    };
+
+    TaskGraph() noexcept = default;
+    TaskGraph(const TaskGraph& other) = delete;
+    TaskGraph(TaskGraph&& other) = delete;
+    TaskGraph& operator=(const TaskGraph& other) = delete;
+    TaskGraph& operator=(TaskGraph&& other) = delete;
+    ~TaskGraph() noexcept = default;
+
+    TaskBuilder AddTask(const std::string& name, const TaskCallback& cb) noexcept;
+
+    //Resolves resource accesses into edges and sorts the tasks. Returns false if explicit After() edges form a cycle.
+    [[nodiscard]] bool Compile() noexcept;
+    [[nodiscard]] bool IsCompiled() const noexcept;
+
+    //Runs every task once and returns when all have finished. Main-thread tasks run on the caller, in schedule order.
+    void Run() noexcept;
+
+    [[nodiscard]] std::size_t GetTaskCount() const noexcept;
+    [[nodiscard]] const std::vector<TaskId>& GetSchedule() const noexcept;
+
+    //Longest chain of dependent tasks weighted by their durations in the last Run.
+    [[nodiscard]] std::vector<CriticalPathEntry> GetCriticalPath() const noexcept;
+    [[nodiscard]] TimeUtils::FPMilliseconds GetLastRunDuration() const noexcept;
+    [[nodiscard]] std::string DumpCriticalPath() const noexcept;
+
+protected:
+private:
+    struct Access {
+        std::string resource{};
+        bool write{false};
+    };
+
+    struct Task {
+        std::string name{};
+        TaskCallback cb{};
+        Affinity affinity{Affinity::Any};
+        std::vector<Access> accesses{};
+        std::vector<TaskId> explicit_predecessors{};
+        std::vector<TaskId> successors{};
+        std::size_t predecessor_count{0u};
+        TimeUtils::FPMilliseconds duration{};
+    };
+
+    void Schedule(TaskId id) noexcept;
+    void Execute(TaskId id) noexcept;
+    void RunSerial() noexcept;
+
+    std::vector<Task> m_tasks{};
+    std::vector<TaskId> m_schedule{};
+    std::vector<TaskId> m_roots{};
+    std::unique_ptr<std::atomic<std::size_t>[]> m_pending{};
+    std::atomic<std::size_t> m_remaining{0u};
+    TimeUtils::FPMilliseconds m_last_run_duration{};
+    bool m_compiled{false};
+};
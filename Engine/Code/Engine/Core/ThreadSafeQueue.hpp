@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <mutex>
 #include <queue>
+#include <span>
 
 template<typename T>
 class ThreadSafeQueue {
@@ -15,6 +17,27 @@ public:
         m_queue.pop();
     }
 
+    [[nodiscard]] bool try_pop(T& out) noexcept {
+        std::scoped_lock<std::mutex> lock(m_cs);
+        if(m_queue.empty()) {
+            return false;
+        }
+        out = std::move(m_queue.front());
+        m_queue.pop();
+        return true;
+    }
+
+    //Moves up to out.size() elements into the front of out under one lock and returns how many.
+    [[nodiscard]] std::size_t try_pop_n(std::span<T> out) noexcept {
+        std::scoped_lock<std::mutex> lock(m_cs);
+        std::size_t count = 0u;
+        for(; count < out.size() && !m_queue.empty(); ++count) {
+            out[count] = std::move(m_queue.front());
+            m_queue.pop();
+        }
+        return count;
+    }
+
     template<class... Args>
     decltype(auto) emplace(Args&&... args) {
         std::scoped_lock<std::mutex> lock(m_cs);
@@ -31,22 +54,13 @@ public:
         return m_queue.empty();
     }
 
-    [[nodiscard]] T& back() const noexcept {
+    //Copies, not references: the element may be popped by another thread as soon as the lock is released.
+    [[nodiscard]] T back() const noexcept {
         std::scoped_lock<std::mutex> lock(m_cs);
         return m_queue.back();
     }
 
-    [[nodiscard]] T& back() noexcept {
-        std::scoped_lock<std::mutex> lock(m_cs);
-        return m_queue.back();
-    }
-
-    [[nodiscard]] T& front() const noexcept {
-        std::scoped_lock<std::mutex> lock(m_cs);
-        return m_queue.front();
-    }
-
-    [[nodiscard]] T& front() noexcept {
+    [[nodiscard]] T front() const noexcept {
         std::scoped_lock<std::mutex> lock(m_cs);
         return m_queue.front();
     }
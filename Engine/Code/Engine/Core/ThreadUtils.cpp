@@ -57,6 +57,14 @@ unsigned long GetProcessIDFromThisThread() noexcept {
 #endif
 }
 
+unsigned long GetThisThreadId() noexcept {
+#ifdef PLATFORM_WINDOWS
+    return static_cast<unsigned long>(::GetCurrentThreadId());
+#else
+    return static_cast<unsigned long>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
+}
+
 void SetThreadDescription(std::jthread& thread, const std::string& description) noexcept {
     auto wide_description = StringUtils::ConvertMultiByteToUnicode(description);
     SetThreadDescription(thread, wide_description);
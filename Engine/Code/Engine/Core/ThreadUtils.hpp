@@ -15,4 +15,5 @@ void GetThreadDescription(std::jthread& thread, std::wstring& description) noexc
 unsigned long GetProcessId() noexcept;
 unsigned long GetProcessIDFromThread(std::jthread& thread) noexcept;
 unsigned long GetProcessIDFromThisThread() noexcept;
+unsigned long GetThisThreadId() noexcept;
 } // namespace ThreadUtils
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/MappedFile.hpp"
 
 #include "Engine/Profiling/ProfileLogScope.hpp"
 
@@ -18,9 +19,12 @@
 
 #include "Engine/Audio/AudioSystem.hpp"
 
-#include <fstream>
+#include <algorithm>
 #include <concepts>
+#include <cstring>
 #include <format>
+#include <fstream>
+#include <span>
 
 #include <Thirdparty/webm/webm_parser/include/webm/webm_parser.h>
 #include <Thirdparty/webm/webm_parser/include/webm/reader.h>
@@ -30,6 +34,45 @@
 #include <Thirdparty/webm/webm_parser/include/webm/callback.h>
 
 
+//Feeds the parser straight out of a mapped file so clusters are paged in as they are reached
+//instead of the whole file being copied up front.
+class MappedFileReader : public webm::Reader {
+public:
+    explicit MappedFileReader(std::span<const std::uint8_t> bytes) noexcept
+    : m_bytes(bytes)
+    {
+        /* DO NOTHING */
+    }
+    virtual ~MappedFileReader() = default;
+
+    webm::Status Read(std::size_t num_to_read, std::uint8_t* buffer, std::uint64_t* num_actually_read) override {
+        const auto count = (std::min)(num_to_read, m_bytes.size() - m_position);
+        *num_actually_read = count;
+        if(count == 0u) {
+            return webm::Status(webm::Status::kEndOfFile);
+        }
+        std::memcpy(buffer, m_bytes.data() + m_position, count);
+        m_position += count;
+        return webm::Status(count == num_to_read ? webm::Status::kOkCompleted : webm::Status::kOkPartial);
+    }
+    webm::Status Skip(std::uint64_t num_to_skip, std::uint64_t* num_actually_skipped) override {
+        const auto count = (std::min)(num_to_skip, static_cast<std::uint64_t>(m_bytes.size() - m_position));
+        *num_actually_skipped = count;
+        if(count == 0u) {
+            return webm::Status(webm::Status::kEndOfFile);
+        }
+        m_position += static_cast<std::size_t>(count);
+        return webm::Status(count == num_to_skip ? webm::Status::kOkCompleted : webm::Status::kOkPartial);
+    }
+    std::uint64_t Position() const override {
+        return m_position;
+    }
+protected:
+private:
+    std::span<const std::uint8_t> m_bytes{};
+    std::size_t m_position{0u};
+};
+
 class MyWebMCallback : public webm::Callback {
 public:
     MyWebMCallback() = default;
@@ -149,9 +192,9 @@ WebM::WebM(std::filesystem::path filepath) noexcept {
 }
 
 bool WebM::Load(std::filesystem::path filepath) noexcept {
-    if(auto buffer = FileUtils::ReadBinaryBufferFromFile(filepath); buffer.has_value()) {
+    if(const auto file = FileUtils::MappedFile::Open(filepath); file.has_value()) {
         m_path = filepath;
-        webm::BufferReader reader{buffer.value()};
+        auto reader = MappedFileReader{file->GetBytes()};
         auto callback = MyWebMCallback(this);
         webm::WebmParser parser{};
         webm::Status status{};
@@ -113,6 +113,7 @@ void WebP::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noexcept {
 void WebP::Render(const Matrix4& transform/* = Matrix4::I*/) const noexcept {
     auto* r = ServiceLocator::get<IRendererService>();
     auto* mat = r->GetMaterial("__unlit2DSprite");
+    r->FlushSpriteBatch();
     if(const auto& cbs = mat->GetShader()->GetConstantBuffers(); !cbs.empty()) {
         auto& cb = cbs[0].get();
         IntVector4 data{static_cast<int>(m_currentFrame), 0, 0, 0};
@@ -121,6 +122,7 @@ void WebP::Render(const Matrix4& transform/* = Matrix4::I*/) const noexcept {
     r->SetMaterial(mat);
     r->SetTexture(m_frames.get());
     r->DrawQuad2D(transform);
+    r->FlushSpriteBatch();
 }
 
 std::size_t WebP::GetFrameCount() const noexcept {
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//Chase-Lev work-stealing deque.
+//See: Le, Pop, Cohen, Zappa Nardelli - "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013)
+//The owning thread pushes and pops from the bottom; any other thread may steal from the top.
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(std::size_t initialCapacity = 1024u) noexcept;
+    WorkStealingDeque(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque(WorkStealingDeque&& other) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&& other) = delete;
+    ~WorkStealingDeque() noexcept = default;
+
+    //Owner thread only.
+    void push(T item) noexcept;
+    //Owner thread only.
+    [[nodiscard]] bool pop(T& out) noexcept;
+    //Any thread.
+    [[nodiscard]] bool steal(T& out) noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+protected:
+private:
+    class Array {
+    public:
+        explicit Array(std::size_t capacity) noexcept
+        : m_capacity{capacity}
+        , m_mask{capacity - 1}
+        , m_data{std::make_unique<std::atomic<T>[]>(capacity)} {
+            /* DO NOTHING */
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return m_capacity;
+        }
+        void put(std::int64_t index, T item) noexcept {
+            m_data[static_cast<std::size_t>(index) & m_mask].store(item, std::memory_order_relaxed);
+        }
+        [[nodiscard]] T get(std::int64_t index) const noexcept {
+            return m_data[static_cast<std::size_t>(index) & m_mask].load(std::memory_order_relaxed);
+        }
+        [[nodiscard]] std::unique_ptr<Array> grow(std::int64_t bottom, std::int64_t top) const noexcept {
+            auto result = std::make_unique<Array>(m_capacity * 2u);
+            for(auto i = top; i != bottom; ++i) {
+                result->put(i, get(i));
+            }
+            return result;
+        }
+
+    private:
+        std::size_t m_capacity{};
+        std::size_t m_mask{};
+        std::unique_ptr<std::atomic<T>[]> m_data{};
+    };
+
+    static constexpr std::size_t cache_line_size = 64u;
+
+    alignas(cache_line_size) std::atomic<std::int64_t> m_top{0};
+    alignas(cache_line_size) std::atomic<std::int64_t> m_bottom{0};
+    alignas(cache_line_size) std::atomic<Array*> m_array{nullptr};
+    //Thieves may still be reading an old array after a grow; retired arrays live until the deque is destroyed.
+    std::vector<std::unique_ptr<Array>> m_arrays{};
+};
+
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t initialCapacity /*= 1024u*/) noexcept {
+    auto capacity = std::size_t{1u};
+    while(capacity < initialCapacity) {
+        capacity <<= 1u;
+    }
+    m_arrays.emplace_back(std::make_unique<Array>(capacity));
+    m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+}
+
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+void WorkStealingDeque<T>::push(T item) noexcept {
+    const auto b = m_bottom.load(std::memory_order_relaxed);
+    const auto t = m_top.load(std::memory_order_acquire);
+    auto* a = m_array.load(std::memory_order_relaxed);
+    if(static_cast<std::int64_t>(a->capacity()) - 1 < (b - t)) {
+        m_arrays.emplace_back(a->grow(b, t));
+        a = m_arrays.back().get();
+        m_array.store(a, std::memory_order_release);
+    }
+    a->put(b, item);
+    m_bottom.store(b + 1, std::memory_order_release);
+}
+
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+bool WorkStealingDeque<T>::pop(T& out) noexcept {
+    const auto b = m_bottom.load(std::memory_order_relaxed) - 1;
+    auto* a = m_array.load(std::memory_order_relaxed);
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = m_top.load(std::memory_order_relaxed);
+    if(b < t) {
+        //Deque was already empty.
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+    out = a->get(b);
+    if(t != b) {
+        //More than one item remained, no race with thieves is possible.
+        return true;
+    }
+    //Last item: race the thieves for it.
+    const bool won = m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return won;
+}
+
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+bool WorkStealingDeque<T>::steal(T& out) noexcept {
+    auto t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto b = m_bottom.load(std::memory_order_acquire);
+    if(b <= t) {
+        return false;
+    }
+    auto* a = m_array.load(std::memory_order_acquire);
+    const auto item = a->get(t);
+    if(!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        //Lost the race to the owner or another thief.
+        return false;
+    }
+    out = item;
+    return true;
+}
+
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+bool WorkStealingDeque<T>::empty() const noexcept {
+    return size() == 0u;
+}
+
+template<typename T>
+requires(std::is_trivially_copyable_v<T>)
+std::size_t WorkStealingDeque<T>::size() const noexcept {
+    const auto b = m_bottom.load(std::memory_order_relaxed);
+    const auto t = m_top.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(t < b ? b - t : 0);
+}
@@ -0,0 +1,101 @@
+#include "Engine/Memory/FrameArena.hpp"
+
+#include "Engine/Profiling/AllocationTracker.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <bit>
+
+FrameArena::FrameArena(std::size_t capacity /*= default_capacity*/) noexcept {
+    //The block itself is allocated on first use; most worker threads never ask for one.
+    m_stats.capacity_bytes = capacity;
+    m_frame = s_frame.load(std::memory_order_acquire);
+}
+
+void* FrameArena::Allocate(std::size_t bytes, std::size_t alignment /*= alignof(std::max_align_t)*/) noexcept {
+    if(!m_block && m_stats.capacity_bytes) {
+        m_block = std::make_unique_for_overwrite<std::byte[]>(m_stats.capacity_bytes);
+    }
+    const auto base = reinterpret_cast<std::uintptr_t>(m_block.get());
+    const auto aligned_offset = ((base + m_offset + alignment - 1u) & ~(alignment - 1u)) - base;
+    if(m_block && aligned_offset + bytes <= m_stats.capacity_bytes) {
+        m_stats.used_bytes += aligned_offset + bytes - m_offset;
+        m_stats.high_water_bytes = (std::max)(m_stats.high_water_bytes, m_stats.used_bytes);
+        ++m_stats.allocations;
+        m_offset = aligned_offset + bytes;
+        return m_block.get() + aligned_offset;
+    }
+    return AllocateOverflow(bytes, alignment);
+}
+
+void FrameArena::Reset() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    AllocationTracker::track_frame_arena(m_stats.used_bytes, m_stats.overflow_bytes);
+    if(m_stats.overflow_bytes) {
+        //Grow so a frame like this one fits next time. The old block is released now and the new one allocated on first use.
+        m_block.reset();
+        m_stats.capacity_bytes = std::bit_ceil(m_stats.used_bytes);
+    }
+    m_overflow.clear();
+    m_offset = 0u;
+    m_stats.used_bytes = 0u;
+    m_stats.overflow_bytes = 0u;
+    m_stats.allocations = 0u;
+    m_frame = s_frame.load(std::memory_order_acquire);
+}
+
+const FrameArenaStats& FrameArena::GetStats() const noexcept {
+    return m_stats;
+}
+
+FrameArena& FrameArena::GetThreadArena() noexcept {
+    thread_local FrameArena arena{};
+    if(arena.m_frame != s_frame.load(std::memory_order_acquire)) {
+        arena.Reset();
+    }
+    return arena;
+}
+
+std::pmr::memory_resource* FrameArena::GetResource() noexcept {
+    return &GetThreadArena();
+}
+
+void FrameArena::BeginFrame() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    s_frame.fetch_add(1u, std::memory_order_acq_rel);
+    [[maybe_unused]] auto& arena = GetThreadArena();
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    return Allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate([[maybe_unused]] void* ptr, [[maybe_unused]] std::size_t bytes, [[maybe_unused]] std::size_t alignment) {
+    /* DO NOTHING */
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void* FrameArena::AllocateOverflow(std::size_t bytes, std::size_t alignment) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto padded_bytes = bytes + alignment - 1u;
+    auto& chunk = m_overflow.emplace_back(std::make_unique_for_overwrite<std::byte[]>(padded_bytes));
+    const auto base = reinterpret_cast<std::uintptr_t>(chunk.get());
+    const auto aligned = (base + alignment - 1u) & ~(alignment - 1u);
+    m_stats.used_bytes += bytes;
+    m_stats.overflow_bytes += bytes;
+    m_stats.high_water_bytes = (std::max)(m_stats.high_water_bytes, m_stats.used_bytes);
+    ++m_stats.allocations;
+    return chunk.get() + (aligned - base);
+}
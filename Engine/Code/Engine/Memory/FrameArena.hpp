@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+struct FrameArenaStats {
+    std::size_t used_bytes{0u};       //Bytes handed out since the last reset, including alignment padding.
+    std::size_t high_water_bytes{0u}; //Largest used_bytes seen in any single frame.
+    std::size_t capacity_bytes{0u};   //Size of the main block.
+    std::size_t overflow_bytes{0u};   //Bytes that did not fit in the main block this frame and came from the heap.
+    std::size_t allocations{0u};
+};
+
+//Linear allocator for memory that lives no longer than the current frame.
+//Allocation is a pointer bump; deallocation does nothing; everything is released at once when the frame ends.
+//When a frame needs more than the block holds, the excess comes from the heap and the block grows to fit at the next reset,
+//so allocations never fail and steady state touches the heap not at all.
+//
+//Each thread has its own arena. App resets the main thread's arena in BeginFrame; other threads' arenas reset
+//the first time they are asked for after that. Anything allocated from a frame arena, including pmr containers
+//built on GetResource(), must be gone before the next frame begins on the thread that allocated it.
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t default_capacity = 256u * 1024u;
+
+    explicit FrameArena(std::size_t capacity = default_capacity) noexcept;
+    FrameArena(const FrameArena& other) = delete;
+    FrameArena(FrameArena&& other) = delete;
+    FrameArena& operator=(const FrameArena& other) = delete;
+    FrameArena& operator=(FrameArena&& other) = delete;
+    ~FrameArena() noexcept override = default;
+
+    [[nodiscard]] void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+    template<typename T>
+    [[nodiscard]] T* AllocateArray(std::size_t count) noexcept;
+    //Releases everything allocated since the last reset.
+    void Reset() noexcept;
+
+    [[nodiscard]] const FrameArenaStats& GetStats() const noexcept;
+
+    //The calling thread's arena, reset first if a new frame has begun since it was last used.
+    [[nodiscard]] static FrameArena& GetThreadArena() noexcept;
+    //The calling thread's arena as a memory resource for std::pmr containers.
+    [[nodiscard]] static std::pmr::memory_resource* GetResource() noexcept;
+    //Starts a new frame for every thread's arena and resets the caller's immediately.
+    static void BeginFrame() noexcept;
+
+protected:
+    [[nodiscard]] void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    [[nodiscard]] void* AllocateOverflow(std::size_t bytes, std::size_t alignment) noexcept;
+
+    std::unique_ptr<std::byte[]> m_block{};
+    std::vector<std::unique_ptr<std::byte[]>> m_overflow{};
+    std::size_t m_offset{0u};
+    FrameArenaStats m_stats{};
+    std::uint64_t m_frame{0u};
+    static inline std::atomic<std::uint64_t> s_frame{0u};
+};
+
+template<typename T>
+T* FrameArena::AllocateArray(std::size_t count) noexcept {
+    static_assert(std::is_trivially_destructible_v<T>, "Frame arena memory is never destroyed; only store trivially destructible types directly.");
+    return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+}
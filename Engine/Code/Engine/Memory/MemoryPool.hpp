@@ -26,10 +26,10 @@ private:
 template<typename T, std::size_t maxSize>
 [[nodiscard]] void* MemoryPool<T, maxSize>::allocate(std::size_t size) noexcept {
     std::size_t elems = size / sizeof(T);
-    if(m_count + elems < m_max) {
+    if(m_count + elems <= m_max) {
         auto front = m_ptr;
         m_count += elems;
-        m_ptr += m_count;
+        m_ptr += elems;
         return static_cast<void*>(front);
     }
     return nullptr;
@@ -37,8 +37,8 @@ template<typename T, std::size_t maxSize>
 
 template<typename T, std::size_t maxSize>
 void MemoryPool<T, maxSize>::deallocate(void* ptr, std::size_t size) noexcept {
-    const auto elems = static_cast<int>(size / sizeof(T));
-    if(0 < m_count - elems) {
+    const auto elems = size / sizeof(T);
+    if(elems < m_count) {
         m_ptr -= elems;
         m_count -= elems;
     } else {
@@ -13,6 +13,10 @@ ColliderPolygon::ColliderPolygon(int sides, const Vector2& position, const Vecto
     /* DO NOTHING */
 }
 
+ColliderType ColliderPolygon::GetType() const noexcept {
+    return ColliderType::Polygon;
+}
+
 void ColliderPolygon::DebugRender() const noexcept {
     ServiceLocator::get<IRendererService>()->DrawPolygon2D(Vector2::Zero, 0.5f, m_polygon.GetSides(), Rgba::Pink);
 }
@@ -115,6 +119,10 @@ ColliderOBB::ColliderOBB(const Vector2& position, const Vector2& half_extents)
     /* DO NOTHING */
 }
 
+ColliderType ColliderOBB::GetType() const noexcept {
+    return ColliderType::OBB;
+}
+
 float ColliderOBB::CalcArea() const noexcept {
     const auto dims = CalcDimensions();
     return dims.x * dims.y;
@@ -128,8 +136,13 @@ Vector2 ColliderOBB::GetHalfExtents() const noexcept {
     return m_obb.half_extents;
 }
 
+//The corner farthest along d; GJK needs the extreme point, not the point nearest the center.
 Vector2 ColliderOBB::Support(const Vector2& d) const noexcept {
-    return MathUtils::CalcClosestPoint(m_obb.position + d, m_obb);
+    const auto right = m_obb.GetRight();
+    const auto up = m_obb.GetUp();
+    const auto along_right = MathUtils::DotProduct(d, right) < 0.0f ? -m_obb.half_extents.x : m_obb.half_extents.x;
+    const auto along_up = MathUtils::DotProduct(d, up) < 0.0f ? -m_obb.half_extents.y : m_obb.half_extents.y;
+    return m_obb.position + right * along_right + up * along_up;
 }
 
 void ColliderOBB::SetPosition(const Vector2& position) noexcept {
@@ -165,6 +178,10 @@ ColliderCircle::ColliderCircle(const Position& position, float radius)
     /* DO NOTHING */
 }
 
+ColliderType ColliderCircle::GetType() const noexcept {
+    return ColliderType::Circle;
+}
+
 float ColliderCircle::CalcArea() const noexcept {
     const auto& half_extents = m_polygon.GetHalfExtents();
     return MathUtils::pi_v<float> * half_extents.x * half_extents.x;
@@ -216,6 +233,10 @@ ColliderAABB::ColliderAABB(const Vector2& position, const Vector2& half_extents)
     /* DO NOTHING */
 }
 
+ColliderType ColliderAABB::GetType() const noexcept {
+    return ColliderType::AABB;
+}
+
 float ColliderAABB::CalcArea() const noexcept {
     const auto& dims = CalcDimensions();
     return dims.x * dims.y;
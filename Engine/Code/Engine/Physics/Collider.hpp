@@ -9,9 +9,18 @@
 class Renderer;
 struct Position;
 
+//Concrete shape of a collider, used by the narrow phase to pick a closed-form test.
+enum class ColliderType {
+    Polygon,
+    AABB,
+    OBB,
+    Circle,
+};
+
 class Collider {
 public:
     virtual ~Collider() = default;
+    [[nodiscard]] virtual ColliderType GetType() const noexcept = 0;
     virtual void DebugRender() const noexcept = 0;
     [[nodiscard]] virtual Vector2 CalcDimensions() const noexcept = 0;
     [[nodiscard]] virtual Vector2 CalcCenter() const noexcept = 0;
@@ -31,6 +40,7 @@ public:
     explicit ColliderPolygon(int sides, const Vector2& position, const Vector2& half_extents, float orientationDegrees);
 
     virtual ~ColliderPolygon() = default;
+    [[nodiscard]] virtual ColliderType GetType() const noexcept override;
     virtual void DebugRender() const noexcept override;
     virtual void SetPosition(const Vector2& position) noexcept override;
     [[nodiscard]] virtual float GetOrientationDegrees() const noexcept override;
@@ -64,6 +74,7 @@ class ColliderAABB : public ColliderPolygon {
 public:
     ColliderAABB(const Vector2& position, const Vector2& half_extents);
     virtual ~ColliderAABB() = default;
+    [[nodiscard]] virtual ColliderType GetType() const noexcept override;
     [[nodiscard]] virtual float CalcArea() const noexcept override;
 
     virtual void DebugRender() const noexcept override;
@@ -85,6 +96,7 @@ class ColliderOBB : public Collider {
 public:
     ColliderOBB(const Vector2& position, const Vector2& half_extents);
     virtual ~ColliderOBB() = default;
+    [[nodiscard]] virtual ColliderType GetType() const noexcept override;
     [[nodiscard]] virtual float CalcArea() const noexcept override;
 
     virtual void DebugRender() const noexcept override;
@@ -107,6 +119,7 @@ class ColliderCircle : public ColliderPolygon {
 public:
     ColliderCircle(const Position& position, float radius);
     virtual ~ColliderCircle() = default;
+    [[nodiscard]] virtual ColliderType GetType() const noexcept override;
     [[nodiscard]] virtual float CalcArea() const noexcept override;
     [[nodiscard]] virtual Vector2 GetHalfExtents() const noexcept override;
     [[nodiscard]] virtual Vector2 Support(const Vector2& d) const noexcept override;
@@ -0,0 +1,85 @@
+#include "Engine/Physics/ContactSolver.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+[[nodiscard]] Vector2 CalcTangent(const Vector2& normal) noexcept {
+    return Vector2{-normal.y, normal.x};
+}
+
+void ApplyImpulse(const ContactConstraint& c, const Vector2& impulse, std::vector<Vector2>& velocities) noexcept {
+    if(c.inverse_mass_a != 0.0f) {
+        velocities[c.a] -= impulse * c.inverse_mass_a;
+    }
+    if(c.inverse_mass_b != 0.0f) {
+        velocities[c.b] += impulse * c.inverse_mass_b;
+    }
+}
+
+} // namespace
+
+void ContactSolver::Prepare(std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island, float dt, float baumgarte, float slop) noexcept {
+    const auto& indices = islands.GetContacts();
+    const auto inv_dt = dt > 0.0f ? 1.0f / dt : 0.0f;
+    for(std::size_t i = island.first_contact; i < island.first_contact + island.contact_count; ++i) {
+        auto& c = contacts[indices[i]];
+        const auto inverse_mass_sum = c.inverse_mass_a + c.inverse_mass_b;
+        c.effective_mass = inverse_mass_sum > 0.0f ? 1.0f / inverse_mass_sum : 0.0f;
+        c.bias = baumgarte * inv_dt * (std::max)(c.depth - slop, 0.0f);
+        if(c.cached) {
+            c.normal_impulse = c.cached->normal_impulse;
+            c.tangent_impulse = c.cached->tangent_impulse;
+        }
+    }
+}
+
+void ContactSolver::WarmStart(const std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island, std::vector<Vector2>& velocities) noexcept {
+    const auto& indices = islands.GetContacts();
+    for(std::size_t i = island.first_contact; i < island.first_contact + island.contact_count; ++i) {
+        const auto& c = contacts[indices[i]];
+        ApplyImpulse(c, c.normal * c.normal_impulse + CalcTangent(c.normal) * c.tangent_impulse, velocities);
+    }
+}
+
+void ContactSolver::SolveVelocities(std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island, std::vector<Vector2>& velocities) noexcept {
+    const auto& indices = islands.GetContacts();
+    for(std::size_t i = island.first_contact; i < island.first_contact + island.contact_count; ++i) {
+        auto& c = contacts[indices[i]];
+        if(c.effective_mass == 0.0f) {
+            continue;
+        }
+        //Friction first so the normal row, which matters more, is solved last.
+        const auto tangent = CalcTangent(c.normal);
+        {
+            const auto relative_velocity = velocities[c.b] - velocities[c.a];
+            const auto lambda = -MathUtils::DotProduct(relative_velocity, tangent) * c.effective_mass;
+            const auto max_friction = c.friction * c.normal_impulse;
+            const auto new_impulse = std::clamp(c.tangent_impulse + lambda, -max_friction, max_friction);
+            const auto delta = new_impulse - c.tangent_impulse;
+            c.tangent_impulse = new_impulse;
+            ApplyImpulse(c, tangent * delta, velocities);
+        }
+        {
+            const auto relative_velocity = velocities[c.b] - velocities[c.a];
+            const auto lambda = (c.bias - MathUtils::DotProduct(relative_velocity, c.normal)) * c.effective_mass;
+            const auto new_impulse = (std::max)(c.normal_impulse + lambda, 0.0f);
+            const auto delta = new_impulse - c.normal_impulse;
+            c.normal_impulse = new_impulse;
+            ApplyImpulse(c, c.normal * delta, velocities);
+        }
+    }
+}
+
+void ContactSolver::StoreImpulses(const std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island) noexcept {
+    const auto& indices = islands.GetContacts();
+    for(std::size_t i = island.first_contact; i < island.first_contact + island.contact_count; ++i) {
+        const auto& c = contacts[indices[i]];
+        if(c.cached) {
+            c.cached->normal_impulse = c.normal_impulse;
+            c.cached->tangent_impulse = c.tangent_impulse;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Physics/IslandGraph.hpp"
+#include "Engine/Physics/NarrowPhase.hpp"
+
+#include <cstddef>
+#include <vector>
+
+//One contact prepared for the sequential-impulse solver.
+//Bodies are RigidBodyStore indices; a body that is not simulated has zero inverse mass and is never written.
+struct ContactConstraint {
+    std::size_t a{0u};
+    std::size_t b{0u};
+    Vector2 normal{};             //From a to b.
+    float depth{0.0f};
+    float friction{0.0f};
+    float inverse_mass_a{0.0f};
+    float inverse_mass_b{0.0f};
+    float effective_mass{0.0f};   //Shared by the normal and tangent rows; the solver is linear only.
+    float bias{0.0f};             //Separating velocity that removes penetration beyond the slop.
+    float normal_impulse{0.0f};   //Accumulated over the iterations and carried to the next step through the contact cache.
+    float tangent_impulse{0.0f};
+    NarrowPhase::CachedContact* cached{nullptr};
+};
+
+//Sequential-impulse contact solver working on per-body velocities indexed like the RigidBodyStore.
+//Every function works on the contacts of a single island so islands can be solved on different threads.
+namespace ContactSolver {
+
+void Prepare(std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island, float dt, float baumgarte, float slop) noexcept;
+//Applies last step's accumulated impulses so resting contacts start close to their solution.
+void WarmStart(const std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island, std::vector<Vector2>& velocities) noexcept;
+void SolveVelocities(std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island, std::vector<Vector2>& velocities) noexcept;
+//Writes accumulated impulses back to the contact cache for the next step's warm start.
+void StoreImpulses(const std::vector<ContactConstraint>& contacts, const IslandGraph& islands, const IslandGraph::Island& island) noexcept;
+
+} // namespace ContactSolver
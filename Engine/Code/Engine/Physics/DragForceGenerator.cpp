@@ -2,6 +2,7 @@
 
 #include "Engine/Core/TimeUtils.hpp"
 #include "Engine/Physics/RigidBody.hpp"
+#include "Engine/Physics/RigidBodyStore.hpp"
 
 DragForceGenerator::DragForceGenerator(const Vector2& k1k2) noexcept
 : ForceGenerator()
@@ -21,6 +22,22 @@ void DragForceGenerator::notify([[maybe_unused]] TimeUtils::FPSeconds deltaSecon
     }
 }
 
+void DragForceGenerator::apply(RigidBodyStore& store) const noexcept {
+    const auto count = store.size();
+    for(std::size_t i = 0u; i < count; ++i) {
+        if(!(store.flags[i] & RigidBodyStore::Drag)) {
+            continue;
+        }
+        if(auto dragForce = store.velocity[i]; !MathUtils::IsEquivalentToZero(dragForce)) {
+            auto dragCoeff = dragForce.CalcLength();
+            dragCoeff = m_k1k2.x * dragCoeff + m_k1k2.y * dragCoeff * dragCoeff;
+            dragForce.Normalize();
+            dragForce *= -dragCoeff;
+            store.force[i] += dragForce;
+        }
+    }
+}
+
 void DragForceGenerator::SetCoefficients(const Vector2& k1k2) noexcept {
     m_k1k2 = k1k2;
 }
@@ -3,6 +3,8 @@
 #include "Engine/Math/Vector2.hpp"
 #include "Engine/Physics/ForceGenerator.hpp"
 
+class RigidBodyStore;
+
 class DragForceGenerator : public ForceGenerator {
 public:
     DragForceGenerator() = default;
@@ -14,6 +16,8 @@ public:
     virtual ~DragForceGenerator() = default;
 
     void notify([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) const noexcept override;
+    //Applies to every body in the store with the matching flag set, ignoring attached observers.
+    void apply(RigidBodyStore& store) const noexcept;
 
     void SetCoefficients(const Vector2& k1k2) noexcept;
 
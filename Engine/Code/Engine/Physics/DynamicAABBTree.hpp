@@ -0,0 +1,411 @@
+#pragma once
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Rgba.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Matrix4.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IRendererService.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+//Incremental bounding volume hierarchy over fattened AABBs.
+//Leaves store an enlarged copy of each element's bounds so small movements do not require touching the tree;
+//MoveProxy only reinserts a leaf once the element leaves its fat bounds. Internal nodes are kept balanced with tree rotations.
+//See: Erin Catto - Box2D b2DynamicTree
+template<typename T>
+class DynamicAABBTree {
+public:
+    static constexpr int null_node = -1;
+
+    explicit DynamicAABBTree(float margin = 10.0f, float displacementMultiplier = 4.0f) noexcept;
+    DynamicAABBTree(const DynamicAABBTree& other) = default;
+    DynamicAABBTree(DynamicAABBTree&& other) noexcept = default;
+    DynamicAABBTree& operator=(const DynamicAABBTree& other) = default;
+    DynamicAABBTree& operator=(DynamicAABBTree&& other) noexcept = default;
+    ~DynamicAABBTree() noexcept = default;
+
+    [[nodiscard]] int CreateProxy(const AABB2& bounds, std::add_pointer_t<T> element) noexcept;
+    void DestroyProxy(int proxyId) noexcept;
+    //Returns true if the proxy had to be reinserted. The fat bounds are extended in the direction of displacement.
+    [[nodiscard]] bool MoveProxy(int proxyId, const AABB2& bounds, const Vector2& displacement) noexcept;
+    void Clear() noexcept;
+
+    //Calls callback(proxyId) for each proxy whose fat bounds overlap area. Return false from the callback to stop early.
+    template<typename Callback>
+    void Query(const AABB2& area, Callback&& callback) const noexcept;
+
+    [[nodiscard]] bool IsProxyOf(int proxyId, std::add_pointer_t<T> element) const noexcept;
+    [[nodiscard]] std::add_pointer_t<T> GetElement(int proxyId) const noexcept;
+    [[nodiscard]] const AABB2& GetFatBounds(int proxyId) const noexcept;
+    [[nodiscard]] std::size_t GetProxyCount() const noexcept;
+    [[nodiscard]] int GetHeight() const noexcept;
+
+    void SetMargin(float margin) noexcept;
+    [[nodiscard]] float GetMargin() const noexcept;
+
+    void DebugRender() const noexcept;
+
+protected:
+private:
+    struct Node {
+        AABB2 bounds{};
+        std::add_pointer_t<T> element{nullptr};
+        int parent{null_node}; //Doubles as the next free index while on the free list.
+        int child1{null_node};
+        int child2{null_node};
+        int height{-1};        //Leaves are 0, free nodes are -1.
+        [[nodiscard]] bool IsLeaf() const noexcept {
+            return child1 == null_node;
+        }
+    };
+
+    [[nodiscard]] int AllocateNode() noexcept;
+    void FreeNode(int nodeId) noexcept;
+    void InsertLeaf(int leaf) noexcept;
+    void RemoveLeaf(int leaf) noexcept;
+    [[nodiscard]] int Balance(int a) noexcept;
+    [[nodiscard]] AABB2 CalcFatBounds(const AABB2& bounds, const Vector2& displacement) const noexcept;
+
+    [[nodiscard]] static AABB2 Combine(const AABB2& a, const AABB2& b) noexcept;
+    [[nodiscard]] static float CalcPerimeter(const AABB2& a) noexcept;
+    [[nodiscard]] static bool Encloses(const AABB2& outer, const AABB2& inner) noexcept;
+
+    std::vector<Node> m_nodes{};
+    int m_root{null_node};
+    int m_free_list{null_node};
+    std::size_t m_proxy_count{0u};
+    float m_margin{10.0f};
+    float m_displacement_multiplier{4.0f};
+};
+
+template<typename T>
+DynamicAABBTree<T>::DynamicAABBTree(float margin /*= 10.0f*/, float displacementMultiplier /*= 4.0f*/) noexcept
+: m_margin{margin}
+, m_displacement_multiplier{displacementMultiplier} {
+    /* DO NOTHING */
+}
+
+template<typename T>
+int DynamicAABBTree<T>::CreateProxy(const AABB2& bounds, std::add_pointer_t<T> element) noexcept {
+    const auto proxyId = AllocateNode();
+    auto& node = m_nodes[proxyId];
+    node.bounds = CalcFatBounds(bounds, Vector2::Zero);
+    node.element = element;
+    node.height = 0;
+    InsertLeaf(proxyId);
+    ++m_proxy_count;
+    return proxyId;
+}
+
+template<typename T>
+void DynamicAABBTree<T>::DestroyProxy(int proxyId) noexcept {
+    GUARANTEE_OR_DIE(0 <= proxyId && static_cast<std::size_t>(proxyId) < m_nodes.size() && m_nodes[proxyId].height == 0, "DynamicAABBTree: Invalid proxy id.");
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_proxy_count;
+}
+
+template<typename T>
+bool DynamicAABBTree<T>::MoveProxy(int proxyId, const AABB2& bounds, const Vector2& displacement) noexcept {
+    GUARANTEE_OR_DIE(0 <= proxyId && static_cast<std::size_t>(proxyId) < m_nodes.size() && m_nodes[proxyId].height == 0, "DynamicAABBTree: Invalid proxy id.");
+    const auto& tree_bounds = m_nodes[proxyId].bounds;
+    const auto fat_bounds = CalcFatBounds(bounds, displacement);
+    if(Encloses(tree_bounds, bounds)) {
+        //Still reinsert if the stored bounds have become much larger than needed, e.g. after a fast body stops.
+        auto huge_bounds = fat_bounds;
+        huge_bounds.mins -= Vector2{4.0f * m_margin, 4.0f * m_margin};
+        huge_bounds.maxs += Vector2{4.0f * m_margin, 4.0f * m_margin};
+        if(Encloses(huge_bounds, tree_bounds)) {
+            return false;
+        }
+    }
+    RemoveLeaf(proxyId);
+    m_nodes[proxyId].bounds = fat_bounds;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+template<typename T>
+void DynamicAABBTree<T>::Clear() noexcept {
+    m_nodes.clear();
+    m_root = null_node;
+    m_free_list = null_node;
+    m_proxy_count = 0u;
+}
+
+template<typename T>
+template<typename Callback>
+void DynamicAABBTree<T>::Query(const AABB2& area, Callback&& callback) const noexcept {
+    if(m_root == null_node) {
+        return;
+    }
+    thread_local std::vector<int> stack{};
+    const auto stack_base = stack.size();
+    stack.push_back(m_root);
+    while(stack.size() > stack_base) {
+        const auto nodeId = stack.back();
+        stack.pop_back();
+        const auto& node = m_nodes[nodeId];
+        if(!MathUtils::DoAABBsOverlap(node.bounds, area)) {
+            continue;
+        }
+        if(node.IsLeaf()) {
+            if(!callback(nodeId)) {
+                stack.resize(stack_base);
+                return;
+            }
+        } else {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+}
+
+template<typename T>
+bool DynamicAABBTree<T>::IsProxyOf(int proxyId, std::add_pointer_t<T> element) const noexcept {
+    return 0 <= proxyId && static_cast<std::size_t>(proxyId) < m_nodes.size() && m_nodes[proxyId].height == 0 && m_nodes[proxyId].element == element;
+}
+
+template<typename T>
+std::add_pointer_t<T> DynamicAABBTree<T>::GetElement(int proxyId) const noexcept {
+    return m_nodes[proxyId].element;
+}
+
+template<typename T>
+const AABB2& DynamicAABBTree<T>::GetFatBounds(int proxyId) const noexcept {
+    return m_nodes[proxyId].bounds;
+}
+
+template<typename T>
+std::size_t DynamicAABBTree<T>::GetProxyCount() const noexcept {
+    return m_proxy_count;
+}
+
+template<typename T>
+int DynamicAABBTree<T>::GetHeight() const noexcept {
+    return m_root == null_node ? 0 : m_nodes[m_root].height;
+}
+
+template<typename T>
+void DynamicAABBTree<T>::SetMargin(float margin) noexcept {
+    m_margin = margin;
+}
+
+template<typename T>
+float DynamicAABBTree<T>::GetMargin() const noexcept {
+    return m_margin;
+}
+
+template<typename T>
+void DynamicAABBTree<T>::DebugRender() const noexcept {
+    auto* renderer = ServiceLocator::get<IRendererService>();
+    renderer->SetMaterial(renderer->GetMaterial("__2D"));
+    renderer->SetModelMatrix(Matrix4::I);
+    for(const auto& node : m_nodes) {
+        if(node.height < 0) {
+            continue;
+        }
+        renderer->DrawAABB2(node.bounds, node.IsLeaf() ? Rgba::Green : Rgba::Yellow, Rgba::NoAlpha);
+    }
+}
+
+template<typename T>
+int DynamicAABBTree<T>::AllocateNode() noexcept {
+    if(m_free_list == null_node) {
+        m_nodes.emplace_back();
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+    const auto nodeId = m_free_list;
+    m_free_list = m_nodes[nodeId].parent;
+    m_nodes[nodeId] = Node{};
+    return nodeId;
+}
+
+template<typename T>
+void DynamicAABBTree<T>::FreeNode(int nodeId) noexcept {
+    auto& node = m_nodes[nodeId];
+    node.element = nullptr;
+    node.child1 = null_node;
+    node.child2 = null_node;
+    node.height = -1;
+    node.parent = m_free_list;
+    m_free_list = nodeId;
+}
+
+template<typename T>
+void DynamicAABBTree<T>::InsertLeaf(int leaf) noexcept {
+    if(m_root == null_node) {
+        m_root = leaf;
+        m_nodes[m_root].parent = null_node;
+        return;
+    }
+
+    //Descend towards the sibling that minimizes the surface area heuristic.
+    const auto leaf_bounds = m_nodes[leaf].bounds;
+    auto index = m_root;
+    while(!m_nodes[index].IsLeaf()) {
+        const auto& node = m_nodes[index];
+        const auto area = CalcPerimeter(node.bounds);
+        const auto combined_area = CalcPerimeter(Combine(node.bounds, leaf_bounds));
+        const auto cost = 2.0f * combined_area;
+        const auto inheritance_cost = 2.0f * (combined_area - area);
+        const auto child_cost = [&](int child) {
+            const auto& c = m_nodes[child];
+            const auto combined = CalcPerimeter(Combine(c.bounds, leaf_bounds));
+            return c.IsLeaf() ? combined + inheritance_cost : (combined - CalcPerimeter(c.bounds)) + inheritance_cost;
+        };
+        const auto cost1 = child_cost(node.child1);
+        const auto cost2 = child_cost(node.child2);
+        if(cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const auto sibling = index;
+    const auto old_parent = m_nodes[sibling].parent;
+    const auto new_parent = AllocateNode();
+    {
+        auto& p = m_nodes[new_parent];
+        p.parent = old_parent;
+        p.bounds = Combine(leaf_bounds, m_nodes[sibling].bounds);
+        p.height = m_nodes[sibling].height + 1;
+        p.child1 = sibling;
+        p.child2 = leaf;
+    }
+    if(old_parent != null_node) {
+        auto& op = m_nodes[old_parent];
+        (op.child1 == sibling ? op.child1 : op.child2) = new_parent;
+    } else {
+        m_root = new_parent;
+    }
+    m_nodes[sibling].parent = new_parent;
+    m_nodes[leaf].parent = new_parent;
+
+    //Refit and rebalance the ancestors.
+    index = m_nodes[leaf].parent;
+    while(index != null_node) {
+        index = Balance(index);
+        auto& node = m_nodes[index];
+        const auto& c1 = m_nodes[node.child1];
+        const auto& c2 = m_nodes[node.child2];
+        node.height = 1 + (std::max)(c1.height, c2.height);
+        node.bounds = Combine(c1.bounds, c2.bounds);
+        index = node.parent;
+    }
+}
+
+template<typename T>
+void DynamicAABBTree<T>::RemoveLeaf(int leaf) noexcept {
+    if(leaf == m_root) {
+        m_root = null_node;
+        return;
+    }
+    const auto parent = m_nodes[leaf].parent;
+    const auto grand_parent = m_nodes[parent].parent;
+    const auto sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+    if(grand_parent == null_node) {
+        m_root = sibling;
+        m_nodes[sibling].parent = null_node;
+        FreeNode(parent);
+        return;
+    }
+    {
+        auto& gp = m_nodes[grand_parent];
+        (gp.child1 == parent ? gp.child1 : gp.child2) = sibling;
+    }
+    m_nodes[sibling].parent = grand_parent;
+    FreeNode(parent);
+
+    auto index = grand_parent;
+    while(index != null_node) {
+        index = Balance(index);
+        auto& node = m_nodes[index];
+        const auto& c1 = m_nodes[node.child1];
+        const auto& c2 = m_nodes[node.child2];
+        node.bounds = Combine(c1.bounds, c2.bounds);
+        node.height = 1 + (std::max)(c1.height, c2.height);
+        index = node.parent;
+    }
+}
+
+//Rotates the taller child of a up if the subtree is out of balance. Returns the new root of the subtree.
+template<typename T>
+int DynamicAABBTree<T>::Balance(int iA) noexcept {
+    auto& A = m_nodes[iA];
+    if(A.IsLeaf() || A.height < 2) {
+        return iA;
+    }
+    const auto iB = A.child1;
+    const auto iC = A.child2;
+    const auto balance = m_nodes[iC].height - m_nodes[iB].height;
+    if(-1 <= balance && balance <= 1) {
+        return iA;
+    }
+    //Promote the taller child (iUp) and hand one of its children to A.
+    const auto iUp = 1 < balance ? iC : iB;
+    const auto iOther = 1 < balance ? iB : iC;
+    auto& Up = m_nodes[iUp];
+    const auto iF = Up.child1;
+    const auto iG = Up.child2;
+
+    Up.child1 = iA;
+    Up.parent = A.parent;
+    A.parent = iUp;
+    if(Up.parent != null_node) {
+        auto& p = m_nodes[Up.parent];
+        (p.child1 == iA ? p.child1 : p.child2) = iUp;
+    } else {
+        m_root = iUp;
+    }
+
+    //Keep the taller grandchild under Up, give the shorter to A in place of Up.
+    const auto keep = m_nodes[iG].height < m_nodes[iF].height ? iF : iG;
+    const auto give = keep == iF ? iG : iF;
+    Up.child2 = keep;
+    if(iUp == iC) {
+        A.child2 = give;
+    } else {
+        A.child1 = give;
+    }
+    m_nodes[give].parent = iA;
+    A.bounds = Combine(m_nodes[iOther].bounds, m_nodes[give].bounds);
+    A.height = 1 + (std::max)(m_nodes[iOther].height, m_nodes[give].height);
+    Up.bounds = Combine(A.bounds, m_nodes[keep].bounds);
+    Up.height = 1 + (std::max)(A.height, m_nodes[keep].height);
+    return iUp;
+}
+
+template<typename T>
+AABB2 DynamicAABBTree<T>::CalcFatBounds(const AABB2& bounds, const Vector2& displacement) const noexcept {
+    auto result = bounds;
+    result.mins -= Vector2{m_margin, m_margin};
+    result.maxs += Vector2{m_margin, m_margin};
+    const auto d = displacement * m_displacement_multiplier;
+    (d.x < 0.0f ? result.mins.x : result.maxs.x) += d.x;
+    (d.y < 0.0f ? result.mins.y : result.maxs.y) += d.y;
+    return result;
+}
+
+template<typename T>
+AABB2 DynamicAABBTree<T>::Combine(const AABB2& a, const AABB2& b) noexcept {
+    return AABB2{(std::min)(a.mins.x, b.mins.x), (std::min)(a.mins.y, b.mins.y), (std::max)(a.maxs.x, b.maxs.x), (std::max)(a.maxs.y, b.maxs.y)};
+}
+
+template<typename T>
+float DynamicAABBTree<T>::CalcPerimeter(const AABB2& a) noexcept {
+    return 2.0f * ((a.maxs.x - a.mins.x) + (a.maxs.y - a.mins.y));
+}
+
+template<typename T>
+bool DynamicAABBTree<T>::Encloses(const AABB2& outer, const AABB2& inner) noexcept {
+    return outer.mins.x <= inner.mins.x && outer.mins.y <= inner.mins.y && inner.maxs.x <= outer.maxs.x && inner.maxs.y <= outer.maxs.y;
+}
@@ -2,6 +2,7 @@
 
 #include "Engine/Math/Vector2.hpp"
 #include "Engine/Physics/RigidBody.hpp"
+#include "Engine/Physics/RigidBodyStore.hpp"
 
 GravityForceGenerator::GravityForceGenerator(const Vector2& gravity) noexcept
 : ForceGenerator()
@@ -18,6 +19,18 @@ void GravityForceGenerator::notify([[maybe_unused]] TimeUtils::FPSeconds deltaSe
     }
 }
 
+void GravityForceGenerator::apply(RigidBodyStore& store) const noexcept {
+    if(m_g == Vector2::Zero) {
+        return;
+    }
+    const auto count = store.size();
+    for(std::size_t i = 0u; i < count; ++i) {
+        if(store.flags[i] & RigidBodyStore::Gravity) {
+            store.force[i] += m_g;
+        }
+    }
+}
+
 void GravityForceGenerator::SetGravity(const Vector2& newGravity) noexcept {
     m_g = newGravity;
 }
@@ -3,6 +3,8 @@
 #include "Engine/Math/Vector2.hpp"
 #include "Engine/Physics/ForceGenerator.hpp"
 
+class RigidBodyStore;
+
 class GravityForceGenerator : public ForceGenerator {
 public:
     GravityForceGenerator() noexcept = default;
@@ -13,6 +15,8 @@ public:
     GravityForceGenerator& operator=(GravityForceGenerator&& other) noexcept = default;
     virtual ~GravityForceGenerator() noexcept = default;
     void notify([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) const noexcept override;
+    //Applies to every body in the store with the matching flag set, ignoring attached observers.
+    void apply(RigidBodyStore& store) const noexcept;
 
     void SetGravity(const Vector2& newGravity) noexcept;
 
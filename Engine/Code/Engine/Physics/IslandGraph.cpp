@@ -0,0 +1,127 @@
+#include "Engine/Physics/IslandGraph.hpp"
+
+#include <numeric>
+
+void IslandGraph::Build(std::size_t body_count, const std::vector<Link>& contacts, const std::vector<Link>& joints) noexcept {
+    m_parent.resize(body_count);
+    std::iota(std::begin(m_parent), std::end(m_parent), Index{0u});
+    const auto link = [this](const Link& l) {
+        if(l.first != invalid_index && l.second != invalid_index) {
+            Union(l.first, l.second);
+        }
+    };
+    for(const auto& l : contacts) {
+        link(l);
+    }
+    for(const auto& l : joints) {
+        link(l);
+    }
+
+    //Number islands in order of their lowest body index so the result does not depend on union order.
+    m_islands.clear();
+    m_island_of_body.assign(body_count, invalid_index);
+    for(Index body = 0u; body < body_count; ++body) {
+        const auto root = Find(body);
+        if(m_island_of_body[root] == invalid_index) {
+            m_island_of_body[root] = m_islands.size();
+            m_islands.emplace_back();
+        }
+        m_island_of_body[body] = m_island_of_body[root];
+        ++m_islands[m_island_of_body[body]].body_count;
+    }
+    std::size_t offset = 0u;
+    for(auto& island : m_islands) {
+        island.first_body = offset;
+        offset += island.body_count;
+    }
+    m_bodies.resize(body_count);
+    m_cursor.assign(m_islands.size(), 0u);
+    for(Index body = 0u; body < body_count; ++body) {
+        const auto& island = m_islands[m_island_of_body[body]];
+        m_bodies[island.first_body + m_cursor[m_island_of_body[body]]++] = body;
+    }
+    Distribute(contacts, m_contacts, &Island::first_contact, &Island::contact_count);
+    Distribute(joints, m_joints, &Island::first_joint, &Island::joint_count);
+}
+
+void IslandGraph::Distribute(const std::vector<Link>& links, std::vector<Index>& out, std::size_t Island::*first, std::size_t Island::*count) noexcept {
+    for(const auto& l : links) {
+        if(const auto island = IslandOfLink(l); island != invalid_index) {
+            ++(m_islands[island].*count);
+        }
+    }
+    std::size_t offset = 0u;
+    for(auto& island : m_islands) {
+        island.*first = offset;
+        offset += island.*count;
+    }
+    out.resize(offset);
+    m_cursor.assign(m_islands.size(), 0u);
+    for(Index i = 0u; i < links.size(); ++i) {
+        if(const auto island = IslandOfLink(links[i]); island != invalid_index) {
+            out[m_islands[island].*first + m_cursor[island]++] = i;
+        }
+    }
+}
+
+void IslandGraph::Clear() noexcept {
+    m_parent.clear();
+    m_island_of_body.clear();
+    m_islands.clear();
+    m_bodies.clear();
+    m_contacts.clear();
+    m_joints.clear();
+    m_cursor.clear();
+}
+
+const std::vector<IslandGraph::Island>& IslandGraph::GetIslands() const noexcept {
+    return m_islands;
+}
+
+std::size_t IslandGraph::GetIslandOf(Index body) const noexcept {
+    return body < m_island_of_body.size() ? m_island_of_body[body] : invalid_index;
+}
+
+const std::vector<IslandGraph::Index>& IslandGraph::GetBodies() const noexcept {
+    return m_bodies;
+}
+
+const std::vector<IslandGraph::Index>& IslandGraph::GetContacts() const noexcept {
+    return m_contacts;
+}
+
+const std::vector<IslandGraph::Index>& IslandGraph::GetJoints() const noexcept {
+    return m_joints;
+}
+
+IslandGraph::Index IslandGraph::Find(Index body) noexcept {
+    //Path halving.
+    while(m_parent[body] != body) {
+        m_parent[body] = m_parent[m_parent[body]];
+        body = m_parent[body];
+    }
+    return body;
+}
+
+void IslandGraph::Union(Index a, Index b) noexcept {
+    a = Find(a);
+    b = Find(b);
+    if(a == b) {
+        return;
+    }
+    //Keep the smaller index as the root.
+    if(b < a) {
+        std::swap(a, b);
+    }
+    m_parent[b] = a;
+}
+
+std::size_t IslandGraph::IslandOfLink(const Link& link) const noexcept {
+    if(link.first != invalid_index) {
+        return GetIslandOf(link.first);
+    }
+    if(link.second != invalid_index) {
+        return GetIslandOf(link.second);
+    }
+    return invalid_index;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+//Groups bodies that can affect each other through contacts or joints into islands using union-find.
+//Bodies are identified by dense indices (RigidBodyStore indices); contacts and joints by their position in the link lists.
+//Islands do not share bodies that can move, so they can be solved concurrently.
+class IslandGraph {
+public:
+    using Index = std::size_t;
+    static constexpr Index invalid_index = static_cast<Index>(-1);
+    //A link merges the islands of its two bodies. A link with one invalid side belongs to the island of the other side.
+    using Link = std::pair<Index, Index>;
+
+    struct Island {
+        std::size_t first_body{0u};
+        std::size_t body_count{0u};
+        std::size_t first_contact{0u};
+        std::size_t contact_count{0u};
+        std::size_t first_joint{0u};
+        std::size_t joint_count{0u};
+    };
+
+    //Rebuilds all islands. Links with no valid side are not part of any island.
+    void Build(std::size_t body_count, const std::vector<Link>& contacts, const std::vector<Link>& joints) noexcept;
+    void Clear() noexcept;
+
+    [[nodiscard]] const std::vector<Island>& GetIslands() const noexcept;
+    [[nodiscard]] std::size_t GetIslandOf(Index body) const noexcept;
+    //Indices of the bodies, contacts and joints of every island, stored contiguously per island.
+    [[nodiscard]] const std::vector<Index>& GetBodies() const noexcept;
+    [[nodiscard]] const std::vector<Index>& GetContacts() const noexcept;
+    [[nodiscard]] const std::vector<Index>& GetJoints() const noexcept;
+
+protected:
+private:
+    [[nodiscard]] Index Find(Index body) noexcept;
+    void Union(Index a, Index b) noexcept;
+    [[nodiscard]] std::size_t IslandOfLink(const Link& link) const noexcept;
+    void Distribute(const std::vector<Link>& links, std::vector<Index>& out, std::size_t Island::*first, std::size_t Island::*count) noexcept;
+
+    std::vector<Index> m_parent{};
+    std::vector<std::size_t> m_island_of_body{};
+    std::vector<Island> m_islands{};
+    std::vector<Index> m_bodies{};
+    std::vector<Index> m_contacts{};
+    std::vector<Index> m_joints{};
+    std::vector<std::size_t> m_cursor{};
+};
@@ -0,0 +1,294 @@
+#include "Engine/Physics/NarrowPhase.hpp"
+
+#include <xmmintrin.h>
+
+namespace {
+
+constexpr std::size_t lane_count = 4u;
+
+//Loads four floats starting at index; lanes past count read as zero.
+[[nodiscard]] __m128 Load(const std::vector<float>& values, std::size_t index, std::size_t count) noexcept {
+    if(index + lane_count <= count) {
+        return _mm_loadu_ps(values.data() + index);
+    }
+    alignas(16) float tail[lane_count]{};
+    for(std::size_t i = 0u; index + i < count; ++i) {
+        tail[i] = values[index + i];
+    }
+    return _mm_load_ps(tail);
+}
+
+void Store(std::vector<float>& values, std::size_t index, std::size_t count, __m128 value) noexcept {
+    if(index + lane_count <= count) {
+        _mm_storeu_ps(values.data() + index, value);
+        return;
+    }
+    alignas(16) float tail[lane_count]{};
+    _mm_store_ps(tail, value);
+    for(std::size_t i = 0u; index + i < count; ++i) {
+        values[index + i] = tail[i];
+    }
+}
+
+void StoreMask(std::vector<std::uint8_t>& values, std::size_t index, std::size_t count, __m128 mask) noexcept {
+    const auto bits = _mm_movemask_ps(mask);
+    for(std::size_t i = 0u; i < lane_count && index + i < count; ++i) {
+        values[index + i] = static_cast<std::uint8_t>((bits >> i) & 1);
+    }
+}
+
+[[nodiscard]] __m128 Abs(__m128 value) noexcept {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+//+1 or -1 carrying the sign bit of value.
+[[nodiscard]] __m128 Sign(__m128 value) noexcept {
+    return _mm_or_ps(_mm_set1_ps(1.0f), _mm_and_ps(_mm_set1_ps(-0.0f), value));
+}
+
+[[nodiscard]] __m128 Select(__m128 mask, __m128 if_true, __m128 if_false) noexcept {
+    return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+}
+
+[[nodiscard]] __m128 Dot(__m128 ax, __m128 ay, __m128 bx, __m128 by) noexcept {
+    return _mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by));
+}
+
+} // namespace
+
+void NarrowPhase::ContactResults::Resize(std::size_t count) noexcept {
+    distance.resize(count);
+    normal_x.resize(count);
+    normal_y.resize(count);
+    collides.resize(count);
+}
+
+Vector2 NarrowPhase::ContactResults::GetNormal(std::size_t index) const noexcept {
+    return Vector2{normal_x[index], normal_y[index]};
+}
+
+void NarrowPhase::CircleBatch::Add(const Vector2& centerA, float radiusA, const Vector2& centerB, float radiusB) noexcept {
+    a_x.push_back(centerA.x);
+    a_y.push_back(centerA.y);
+    a_radius.push_back(radiusA);
+    b_x.push_back(centerB.x);
+    b_y.push_back(centerB.y);
+    b_radius.push_back(radiusB);
+}
+
+void NarrowPhase::CircleBatch::Clear() noexcept {
+    a_x.clear();
+    a_y.clear();
+    a_radius.clear();
+    b_x.clear();
+    b_y.clear();
+    b_radius.clear();
+}
+
+std::size_t NarrowPhase::CircleBatch::size() const noexcept {
+    return a_x.size();
+}
+
+void NarrowPhase::AABBBatch::Add(const Vector2& centerA, const Vector2& halfExtentsA, const Vector2& centerB, const Vector2& halfExtentsB) noexcept {
+    a_x.push_back(centerA.x);
+    a_y.push_back(centerA.y);
+    a_half_x.push_back(halfExtentsA.x);
+    a_half_y.push_back(halfExtentsA.y);
+    b_x.push_back(centerB.x);
+    b_y.push_back(centerB.y);
+    b_half_x.push_back(halfExtentsB.x);
+    b_half_y.push_back(halfExtentsB.y);
+}
+
+void NarrowPhase::AABBBatch::Clear() noexcept {
+    a_x.clear();
+    a_y.clear();
+    a_half_x.clear();
+    a_half_y.clear();
+    b_x.clear();
+    b_y.clear();
+    b_half_x.clear();
+    b_half_y.clear();
+}
+
+std::size_t NarrowPhase::AABBBatch::size() const noexcept {
+    return a_x.size();
+}
+
+void NarrowPhase::OBBBatch::Add(const Vector2& centerA, const Vector2& halfExtentsA, const Vector2& rightA, const Vector2& upA, const Vector2& centerB, const Vector2& halfExtentsB, const Vector2& rightB, const Vector2& upB) noexcept {
+    a_x.push_back(centerA.x);
+    a_y.push_back(centerA.y);
+    a_half_x.push_back(halfExtentsA.x);
+    a_half_y.push_back(halfExtentsA.y);
+    a_right_x.push_back(rightA.x);
+    a_right_y.push_back(rightA.y);
+    a_up_x.push_back(upA.x);
+    a_up_y.push_back(upA.y);
+    b_x.push_back(centerB.x);
+    b_y.push_back(centerB.y);
+    b_half_x.push_back(halfExtentsB.x);
+    b_half_y.push_back(halfExtentsB.y);
+    b_right_x.push_back(rightB.x);
+    b_right_y.push_back(rightB.y);
+    b_up_x.push_back(upB.x);
+    b_up_y.push_back(upB.y);
+}
+
+void NarrowPhase::OBBBatch::Clear() noexcept {
+    a_x.clear();
+    a_y.clear();
+    a_half_x.clear();
+    a_half_y.clear();
+    a_right_x.clear();
+    a_right_y.clear();
+    a_up_x.clear();
+    a_up_y.clear();
+    b_x.clear();
+    b_y.clear();
+    b_half_x.clear();
+    b_half_y.clear();
+    b_right_x.clear();
+    b_right_y.clear();
+    b_up_x.clear();
+    b_up_y.clear();
+}
+
+std::size_t NarrowPhase::OBBBatch::size() const noexcept {
+    return a_x.size();
+}
+
+void NarrowPhase::CollideCircles(const CircleBatch& batch, ContactResults& results) noexcept {
+    const auto count = batch.size();
+    results.Resize(count);
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps(1.0f);
+    const auto epsilon = _mm_set1_ps(1e-6f);
+    for(std::size_t i = 0u; i < count; i += lane_count) {
+        const auto dx = _mm_sub_ps(Load(batch.b_x, i, count), Load(batch.a_x, i, count));
+        const auto dy = _mm_sub_ps(Load(batch.b_y, i, count), Load(batch.a_y, i, count));
+        const auto radii = _mm_add_ps(Load(batch.a_radius, i, count), Load(batch.b_radius, i, count));
+        const auto distance_sq = Dot(dx, dy, dx, dy);
+        const auto collides = _mm_cmplt_ps(distance_sq, _mm_mul_ps(radii, radii));
+        const auto distance = _mm_sqrt_ps(distance_sq);
+        //Concentric circles have no preferred direction; push along +x like EPA's default.
+        const auto separated = _mm_cmpgt_ps(distance, epsilon);
+        const auto inv_distance = _mm_div_ps(one, _mm_max_ps(distance, epsilon));
+        Store(results.distance, i, count, _mm_sub_ps(radii, distance));
+        Store(results.normal_x, i, count, Select(separated, _mm_mul_ps(dx, inv_distance), one));
+        Store(results.normal_y, i, count, Select(separated, _mm_mul_ps(dy, inv_distance), zero));
+        StoreMask(results.collides, i, count, collides);
+    }
+}
+
+void NarrowPhase::CollideAABBs(const AABBBatch& batch, ContactResults& results) noexcept {
+    const auto count = batch.size();
+    results.Resize(count);
+    const auto zero = _mm_setzero_ps();
+    for(std::size_t i = 0u; i < count; i += lane_count) {
+        const auto dx = _mm_sub_ps(Load(batch.b_x, i, count), Load(batch.a_x, i, count));
+        const auto dy = _mm_sub_ps(Load(batch.b_y, i, count), Load(batch.a_y, i, count));
+        const auto overlap_x = _mm_sub_ps(_mm_add_ps(Load(batch.a_half_x, i, count), Load(batch.b_half_x, i, count)), Abs(dx));
+        const auto overlap_y = _mm_sub_ps(_mm_add_ps(Load(batch.a_half_y, i, count), Load(batch.b_half_y, i, count)), Abs(dy));
+        const auto collides = _mm_and_ps(_mm_cmpgt_ps(overlap_x, zero), _mm_cmpgt_ps(overlap_y, zero));
+        const auto use_x = _mm_cmple_ps(overlap_x, overlap_y);
+        Store(results.distance, i, count, Select(use_x, overlap_x, overlap_y));
+        Store(results.normal_x, i, count, Select(use_x, Sign(dx), zero));
+        Store(results.normal_y, i, count, Select(use_x, zero, Sign(dy)));
+        StoreMask(results.collides, i, count, collides);
+    }
+}
+
+void NarrowPhase::CollideOBBs(const OBBBatch& batch, ContactResults& results) noexcept {
+    const auto count = batch.size();
+    results.Resize(count);
+    const auto zero = _mm_setzero_ps();
+    for(std::size_t i = 0u; i < count; i += lane_count) {
+        const auto dx = _mm_sub_ps(Load(batch.b_x, i, count), Load(batch.a_x, i, count));
+        const auto dy = _mm_sub_ps(Load(batch.b_y, i, count), Load(batch.a_y, i, count));
+        const auto a_half_x = Load(batch.a_half_x, i, count);
+        const auto a_half_y = Load(batch.a_half_y, i, count);
+        const auto a_right_x = Load(batch.a_right_x, i, count);
+        const auto a_right_y = Load(batch.a_right_y, i, count);
+        const auto a_up_x = Load(batch.a_up_x, i, count);
+        const auto a_up_y = Load(batch.a_up_y, i, count);
+        const auto b_half_x = Load(batch.b_half_x, i, count);
+        const auto b_half_y = Load(batch.b_half_y, i, count);
+        const auto b_right_x = Load(batch.b_right_x, i, count);
+        const auto b_right_y = Load(batch.b_right_y, i, count);
+        const auto b_up_x = Load(batch.b_up_x, i, count);
+        const auto b_up_y = Load(batch.b_up_y, i, count);
+
+        //Absolute cosines between the axes of a and b; each box's projected radius on the other's axes.
+        const auto right_right = Abs(Dot(a_right_x, a_right_y, b_right_x, b_right_y));
+        const auto right_up = Abs(Dot(a_right_x, a_right_y, b_up_x, b_up_y));
+        const auto up_right = Abs(Dot(a_up_x, a_up_y, b_right_x, b_right_y));
+        const auto up_up = Abs(Dot(a_up_x, a_up_y, b_up_x, b_up_y));
+
+        const auto s0 = Dot(dx, dy, a_right_x, a_right_y);
+        const auto s1 = Dot(dx, dy, a_up_x, a_up_y);
+        const auto s2 = Dot(dx, dy, b_right_x, b_right_y);
+        const auto s3 = Dot(dx, dy, b_up_x, b_up_y);
+        const auto o0 = _mm_sub_ps(_mm_add_ps(a_half_x, _mm_add_ps(_mm_mul_ps(b_half_x, right_right), _mm_mul_ps(b_half_y, right_up))), Abs(s0));
+        const auto o1 = _mm_sub_ps(_mm_add_ps(a_half_y, _mm_add_ps(_mm_mul_ps(b_half_x, up_right), _mm_mul_ps(b_half_y, up_up))), Abs(s1));
+        const auto o2 = _mm_sub_ps(_mm_add_ps(b_half_x, _mm_add_ps(_mm_mul_ps(a_half_x, right_right), _mm_mul_ps(a_half_y, up_right))), Abs(s2));
+        const auto o3 = _mm_sub_ps(_mm_add_ps(b_half_y, _mm_add_ps(_mm_mul_ps(a_half_x, right_up), _mm_mul_ps(a_half_y, up_up))), Abs(s3));
+        const auto collides = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(o0, zero), _mm_cmpgt_ps(o1, zero)), _mm_and_ps(_mm_cmpgt_ps(o2, zero), _mm_cmpgt_ps(o3, zero)));
+
+        auto best = o0;
+        auto normal_x = _mm_mul_ps(a_right_x, Sign(s0));
+        auto normal_y = _mm_mul_ps(a_right_y, Sign(s0));
+        const auto keep_smaller = [&](__m128 overlap, __m128 axis_x, __m128 axis_y, __m128 separation) {
+            const auto smaller = _mm_cmplt_ps(overlap, best);
+            best = Select(smaller, overlap, best);
+            normal_x = Select(smaller, _mm_mul_ps(axis_x, Sign(separation)), normal_x);
+            normal_y = Select(smaller, _mm_mul_ps(axis_y, Sign(separation)), normal_y);
+        };
+        keep_smaller(o1, a_up_x, a_up_y, s1);
+        keep_smaller(o2, b_right_x, b_right_y, s2);
+        keep_smaller(o3, b_up_x, b_up_y, s3);
+
+        Store(results.distance, i, count, best);
+        Store(results.normal_x, i, count, normal_x);
+        Store(results.normal_y, i, count, normal_y);
+        StoreMask(results.collides, i, count, collides);
+    }
+}
+
+void NarrowPhase::ContactCache::BeginStep() noexcept {
+    ++m_step;
+}
+
+NarrowPhase::CachedContact& NarrowPhase::ContactCache::Touch(const RigidBody* a, const RigidBody* b) noexcept {
+    auto& contact = m_contacts[BodyPair{a, b}];
+    contact.last_step = m_step;
+    return contact;
+}
+
+NarrowPhase::CachedContact* NarrowPhase::ContactCache::Find(const RigidBody* a, const RigidBody* b) noexcept {
+    if(const auto found = m_contacts.find(BodyPair{a, b}); found != std::end(m_contacts)) {
+        return &found->second;
+    }
+    return nullptr;
+}
+
+void NarrowPhase::ContactCache::EndStep() noexcept {
+    std::erase_if(m_contacts, [step = m_step](const auto& entry) { return entry.second.last_step != step; });
+}
+
+void NarrowPhase::ContactCache::Remove(const RigidBody* body) noexcept {
+    std::erase_if(m_contacts, [body](const auto& entry) { return entry.first.first == body || entry.first.second == body; });
+}
+
+void NarrowPhase::ContactCache::Clear() noexcept {
+    m_contacts.clear();
+}
+
+std::size_t NarrowPhase::ContactCache::size() const noexcept {
+    return m_contacts.size();
+}
+
+std::size_t NarrowPhase::ContactCache::BodyPairHasher::operator()(const BodyPair& pair) const noexcept {
+    const auto first = std::hash<const RigidBody*>{}(pair.first);
+    const auto second = std::hash<const RigidBody*>{}(pair.second);
+    return first ^ (second + 0x9e3779b9u + (first << 6) + (first >> 2));
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Engine/Math/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class RigidBody;
+
+//Closed-form contact tests for the collider pairs that have one, evaluated four pairs per SSE instruction.
+//Each batch is a structure of arrays filled with Add(); results are written in the order the pairs were added.
+//Normals point from a to b and distance is the penetration depth, the same convention as PhysicsUtils::EPA.
+namespace NarrowPhase {
+
+struct ContactResults {
+    std::vector<float> distance{};
+    std::vector<float> normal_x{};
+    std::vector<float> normal_y{};
+    std::vector<std::uint8_t> collides{};
+
+    void Resize(std::size_t count) noexcept;
+    [[nodiscard]] Vector2 GetNormal(std::size_t index) const noexcept;
+};
+
+struct CircleBatch {
+    std::vector<float> a_x{};
+    std::vector<float> a_y{};
+    std::vector<float> a_radius{};
+    std::vector<float> b_x{};
+    std::vector<float> b_y{};
+    std::vector<float> b_radius{};
+
+    void Add(const Vector2& centerA, float radiusA, const Vector2& centerB, float radiusB) noexcept;
+    void Clear() noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+};
+
+struct AABBBatch {
+    std::vector<float> a_x{};
+    std::vector<float> a_y{};
+    std::vector<float> a_half_x{};
+    std::vector<float> a_half_y{};
+    std::vector<float> b_x{};
+    std::vector<float> b_y{};
+    std::vector<float> b_half_x{};
+    std::vector<float> b_half_y{};
+
+    void Add(const Vector2& centerA, const Vector2& halfExtentsA, const Vector2& centerB, const Vector2& halfExtentsB) noexcept;
+    void Clear() noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+};
+
+//Box axes are stored as the unit right and up vectors so the kernel never evaluates a trig function.
+struct OBBBatch {
+    std::vector<float> a_x{};
+    std::vector<float> a_y{};
+    std::vector<float> a_half_x{};
+    std::vector<float> a_half_y{};
+    std::vector<float> a_right_x{};
+    std::vector<float> a_right_y{};
+    std::vector<float> a_up_x{};
+    std::vector<float> a_up_y{};
+    std::vector<float> b_x{};
+    std::vector<float> b_y{};
+    std::vector<float> b_half_x{};
+    std::vector<float> b_half_y{};
+    std::vector<float> b_right_x{};
+    std::vector<float> b_right_y{};
+    std::vector<float> b_up_x{};
+    std::vector<float> b_up_y{};
+
+    void Add(const Vector2& centerA, const Vector2& halfExtentsA, const Vector2& rightA, const Vector2& upA, const Vector2& centerB, const Vector2& halfExtentsB, const Vector2& rightB, const Vector2& upB) noexcept;
+    void Clear() noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+};
+
+void CollideCircles(const CircleBatch& batch, ContactResults& results) noexcept;
+void CollideAABBs(const AABBBatch& batch, ContactResults& results) noexcept;
+//Separating axis test on the four face normals; the contact normal is the axis of least overlap.
+void CollideOBBs(const OBBBatch& batch, ContactResults& results) noexcept;
+
+//What the narrow phase remembers about a pair of bodies between steps.
+struct CachedContact {
+    Vector2 search_direction{Vector2::X_Axis}; //Last GJK search direction; seeds the next GJK query.
+    Vector2 normal{};
+    float distance{0.0f};
+    float normal_impulse{0.0f};                 //Accumulated solver impulses used to warm start the next step.
+    float tangent_impulse{0.0f};
+    std::uint32_t last_step{0u};
+    bool touching{false};
+};
+
+//Persistent per-pair contact state keyed by the (a, b) body pair as the broad phase reports it.
+//Entries not touched during a step are evicted by EndStep.
+class ContactCache {
+public:
+    void BeginStep() noexcept;
+    [[nodiscard]] CachedContact& Touch(const RigidBody* a, const RigidBody* b) noexcept;
+    [[nodiscard]] CachedContact* Find(const RigidBody* a, const RigidBody* b) noexcept;
+    void EndStep() noexcept;
+    void Remove(const RigidBody* body) noexcept;
+    void Clear() noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+protected:
+private:
+    using BodyPair = std::pair<const RigidBody*, const RigidBody*>;
+    struct BodyPairHasher {
+        [[nodiscard]] std::size_t operator()(const BodyPair& pair) const noexcept;
+    };
+    std::unordered_map<BodyPair, CachedContact, BodyPairHasher> m_contacts{};
+    std::uint32_t m_step{0u};
+};
+
+} // namespace NarrowPhase
@@ -5,6 +5,9 @@
 #include "Engine/Physics/Particles/ParticleEmitterDefinition.hpp"
 #include "Engine/Physics/Particles/ParticleEffectDefinition.hpp"
 
+#include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IJobSystemService.hpp"
+
 #include <algorithm>
 
 ParticleEffect::ParticleEffect(const XMLElement& element) noexcept
@@ -59,10 +62,14 @@ void ParticleEffect::BeginFrame() {
 
 void ParticleEffect::Update(float time, float deltaSeconds) {
     position += velocity * deltaSeconds;
-    for(auto& emitter : m_emitters) {
-        if(m_is_playing) {
-            emitter.Update(time, deltaSeconds);
-        }
+    if(m_is_playing) {
+        //Emitters share nothing but the read-only parent effect, so each one updates on its own job.
+        auto* js = ServiceLocator::get<IJobSystemService>();
+        js->ParallelFor(0u, m_emitters.size(), 1u, [this, time, deltaSeconds](std::size_t first, std::size_t last) {
+            for(auto i = first; i < last; ++i) {
+                m_emitters[i].Update(time, deltaSeconds);
+            }
+        });
     }
     if(IsFinished()) {
         SetPlay(false);
@@ -11,19 +11,28 @@
 #include "Engine/Renderer/Texture2D.hpp"
 
 #include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IJobSystemService.hpp"
 #include "Engine/Services/IRendererService.hpp"
 
 #include <algorithm>
 #include <numeric>
 
 ParticleEmitter::ParticleEmitter(const std::string& name) noexcept
-: m_name(name) {
-    const auto* definition = ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name);
-    if(definition->m_spawnPerSecond > 0.0f) {
-        m_spawnClock.SetFrequency(static_cast<unsigned int>(definition->m_spawnPerSecond));
+: m_name(name)
+, m_definition(ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name)) {
+    if(m_definition->m_spawnPerSecond > 0.0f) {
+        m_spawnClock.SetFrequency(static_cast<unsigned int>(m_definition->m_spawnPerSecond));
     } else {
         m_spawnClock.SetSeconds(TimeUtils::FPSeconds{0.016f});
     }
+    const auto&& [sr, sg, sb, sa] = m_definition->m_startColor.GetAsFloats();
+    const auto&& [er, eg, eb, ea] = m_definition->m_endColor.GetAsFloats();
+    m_appearance.start_color = Vector4{sr, sg, sb, sa};
+    m_appearance.end_color = Vector4{er, eg, eb, ea};
+    m_appearance.start_scale = m_definition->m_startScale;
+    m_appearance.end_scale = m_definition->m_endScale;
+    m_material = ServiceLocator::get<IRendererService>()->GetMaterial(m_definition->m_materialName);
+    BuildMesh(Matrix4::I);
 }
 
 void ParticleEmitter::Initialize() {
@@ -47,8 +56,8 @@ void ParticleEmitter::Prewarm(TimeUtils::FPSeconds secondsToWarm) {
     m_isWarming = false;
 }
 
-void ParticleEmitter::Update(float time, float deltaSeconds) {
-    auto* definition = ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name);
+void ParticleEmitter::Update([[maybe_unused]] float time, float deltaSeconds) {
+    const auto* definition = m_definition;
     if(m_age < definition->m_lifetime) {
         if(!m_isWarming) {
             m_age += deltaSeconds;
@@ -95,22 +104,21 @@ void ParticleEmitter::Update(float time, float deltaSeconds) {
             break;
         }
 
-        Rgba c = definition->m_particleRenderState.GetStartColor();
-        Rgba ec = definition->m_particleRenderState.GetEndColor();
-        Vector3 s = definition->m_particleRenderState.GetStartScale();
-        Vector3 es = definition->m_particleRenderState.GetEndScale();
-        auto particle_count = m_spawnClock.DecrementAll();
-        auto* renderer = ServiceLocator::get<IRendererService>();
+        const auto particle_count = m_spawnClock.DecrementAll();
+        m_pool.Reserve(m_pool.size() + particle_count);
         for(unsigned int i = 0; i < particle_count; ++i) {
-            SpawnParticle(new_particle_position, new_particle_velocity, definition->m_particleLifetime, c, ec, s, es, renderer->GetMaterial(definition->m_materialName), definition->m_mass);
+            m_pool.Spawn(new_particle_position, new_particle_velocity, definition->m_particleLifetime);
         }
     }
-    UpdateParticles(time, deltaSeconds);
+    UpdateParticles(deltaSeconds);
 }
 
 void ParticleEmitter::Render() const {
+    if(m_instances.empty()) {
+        return;
+    }
     const auto p = Matrix4::CreateTranslationMatrix(parent_effect->position);
-    const auto t = Matrix4::CreateTranslationMatrix(ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name)->m_position);
+    const auto t = Matrix4::CreateTranslationMatrix(m_definition->m_position);
     const auto s = Matrix4::I;
     const auto r = Matrix4::I;
 
@@ -118,15 +126,14 @@ void ParticleEmitter::Render() const {
 
     auto* renderer = ServiceLocator::get<IRendererService>();
     renderer->SetModelMatrix(pointlight_model);
-
-    for(auto& particle : m_particles) {
-        particle.Render(m_builder);
+    if(m_definition->m_isBillboarded) {
+        BuildMesh(renderer->GetCamera().GetInverseViewMatrix().GetRotation());
     }
-    Mesh::Render(m_builder);
+    MeshInstanced::Render(m_builder, m_instances, m_instances.size());
 }
 
 void ParticleEmitter::EndFrame() {
-    m_particles.erase(std::remove_if(std::begin(m_particles), std::end(m_particles), [](const Particle& a) { return a.IsDead(); }), std::end(m_particles));
+    /* DO NOTHING */
 }
 
 float ParticleEmitter::GetAge() const {
@@ -134,15 +141,15 @@ float ParticleEmitter::GetAge() const {
 }
 
 float ParticleEmitter::GetLifetime() const {
-    return ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name)->m_lifetime;
+    return m_definition->m_lifetime;
 }
 
 std::size_t ParticleEmitter::GetParticleCount() const {
-    return m_particles.size();
+    return m_pool.size();
 }
 
 bool ParticleEmitter::HasAliveParticles() const {
-    return !m_particles.empty();
+    return !m_pool.empty();
 }
 
 void ParticleEmitter::LoadFromXML(const XMLElement& element) {
@@ -167,45 +174,63 @@ void ParticleEmitter::MakeAlive() {
     m_spawnClock.Reset();
 }
 
-Mesh::Builder& ParticleEmitter::GetMeshBuilder() noexcept {
+MeshInstanced::Builder& ParticleEmitter::GetMeshBuilder() noexcept {
     return m_builder;
 }
 
-void ParticleEmitter::UpdateParticles(float time, float deltaSeconds) {
-    std::sort(std::begin(m_particles), std::end(m_particles));
-    auto* definition = ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name);
-    const auto loc = Matrix4::CreateTranslationMatrix(definition->m_position);
-    auto* renderer = ServiceLocator::get<IRendererService>();
-    const auto billboard = definition->m_isBillboarded ? renderer->GetCamera().GetInverseViewMatrix() : Matrix4::I;
-    const auto result = Matrix4::MakeRT(billboard, loc);
-    for(Particle& p : m_particles) {
-        renderer->AppendModelMatrix(result);
-        p.Update(time, deltaSeconds);
+void ParticleEmitter::UpdateParticles(float deltaSeconds) {
+    m_instances.resize(m_pool.size());
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    js->ParallelFor(0u, m_pool.size(), 4096u, [this, deltaSeconds](std::size_t first, std::size_t last) {
+        m_pool.Update(first, last, deltaSeconds, m_appearance, m_instances);
+    });
+    m_pool.RemoveDead(m_instances);
+}
+
+void ParticleEmitter::BuildMesh(const Matrix4& orientation) const noexcept {
+    const auto corner = [&orientation](float x, float y, float z) { return orientation.TransformDirection(Vector3{x, y, z}); };
+    m_builder.Clear();
+    m_builder.Begin(PrimitiveType::Triangles);
+    m_builder.SetColor(Rgba::White);
+    switch(m_definition->m_shape) {
+    case ParticleShape::Quad: {
+        m_builder.SetNormal(orientation.TransformDirection(Vector3::Z_Axis));
+        m_builder.SetUV(Vector2{0.0f, 1.0f});
+        m_builder.AddVertex(corner(-0.5f, 0.5f, 0.0f));
+        m_builder.SetUV(Vector2{0.0f, 0.0f});
+        m_builder.AddVertex(corner(-0.5f, -0.5f, 0.0f));
+        m_builder.SetUV(Vector2{1.0f, 0.0f});
+        m_builder.AddVertex(corner(0.5f, -0.5f, 0.0f));
+        m_builder.SetUV(Vector2{1.0f, 1.0f});
+        m_builder.AddVertex(corner(0.5f, 0.5f, 0.0f));
+        m_builder.AddIndicies(MeshInstanced::Builder::Primitive::Quad);
+        break;
     }
-}
-
-void ParticleEmitter::SpawnParticle(const Vector3& initialPosition, const Vector3& initialVelocity, float ttl, const Rgba& color /*= Rgba::WHITE*/, const Rgba& endColor /*= Rgba::WHITE*/, const Vector3& scale /*= Vector3::ONE*/, const Vector3& endScale /*= Vector3::ONE*/, Material* initialMaterial /*= nullptr*/, float initialMass /*= 1.0f*/) {
-    ParticleState initialState;
-    initialState.mass = initialMass;
-    initialState.position = initialPosition;
-    initialState.velocity = initialVelocity;
-    initialState.acceleration = Vector3::Zero;
-
-    ParticleRenderState initialRender;
-    initialRender.SetColors(color, endColor);
-    initialRender.SetScales(scale, endScale);
-    initialRender.SetLifetime(ttl);
-    initialRender.SetMaterial(initialMaterial);
-    initialRender.SetBillboarding(ParticleEmitterDefinition::GetParticleEmitterDefinition(m_name)->m_isBillboarded);
-
-    m_particles.emplace_back(initialRender, initialState);
-}
-
-void ParticleEmitter::DestroyDeadEntities() {
-    if(m_particles.empty()) {
-        return;
+    case ParticleShape::Cube: {
+        const auto v_ldf = corner(-0.5f, -0.5f, -0.5f);
+        const auto v_ldb = corner(-0.5f, -0.5f, 0.5f);
+        const auto v_luf = corner(-0.5f, 0.5f, -0.5f);
+        const auto v_lub = corner(-0.5f, 0.5f, 0.5f);
+        const auto v_ruf = corner(0.5f, 0.5f, -0.5f);
+        const auto v_rub = corner(0.5f, 0.5f, 0.5f);
+        const auto v_rdf = corner(0.5f, -0.5f, -0.5f);
+        const auto v_rdb = corner(0.5f, -0.5f, 0.5f);
+        const auto face = [this, &orientation](const Vector3& normal, const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d) {
+            m_builder.SetNormal(orientation.TransformDirection(normal));
+            m_builder.AddVertex(a);
+            m_builder.AddVertex(b);
+            m_builder.AddVertex(c);
+            m_builder.AddVertex(d);
+            m_builder.AddIndicies(MeshInstanced::Builder::Primitive::Quad);
+        };
+        face(-Vector3::Z_Axis, v_rdf, v_ldf, v_luf, v_ruf);
+        face(Vector3::Z_Axis, v_ldb, v_rdb, v_rub, v_lub);
+        face(-Vector3::X_Axis, v_ldf, v_ldb, v_lub, v_luf);
+        face(Vector3::X_Axis, v_rdb, v_rdf, v_ruf, v_rub);
+        face(Vector3::Y_Axis, v_ruf, v_luf, v_lub, v_rub);
+        face(-Vector3::Y_Axis, v_rdb, v_ldb, v_ldf, v_rdf);
+        break;
     }
-
-    m_particles.erase(
-    std::remove_if(m_particles.begin(), m_particles.end(), [](const Particle& p) { return p.IsDead(); }), m_particles.end());
+    }
+    m_builder.End(m_material);
 }
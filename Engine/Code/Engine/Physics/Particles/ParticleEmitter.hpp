@@ -4,14 +4,18 @@
 #include "Engine/Core/Stopwatch.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 
-#include "Engine/Renderer/Mesh.hpp"
+#include "Engine/Math/Matrix4.hpp"
 
-#include "Engine/Physics/Particles/Particle.hpp"
+#include "Engine/Renderer/MeshInstanced.hpp"
+#include "Engine/Renderer/Vertex3DInstanced.hpp"
+
+#include "Engine/Physics/Particles/ParticlePool.hpp"
 
 #include <string>
 #include <vector>
 
 class ParticleEmitterDefinition;
+class Material;
 class Texture2D;
 class ParticleEffect;
 
@@ -46,19 +50,23 @@ public:
 
     ParticleEffect* parent_effect = nullptr;
 
-    Mesh::Builder& GetMeshBuilder() noexcept;
+    MeshInstanced::Builder& GetMeshBuilder() noexcept;
 protected:
 private:
     void LoadFromXML(const XMLElement& element);
 
-    void SpawnParticle(const Vector3& initialPosition, const Vector3& initialVelocity, float ttl, const Rgba& color /*= Rgba::WHITE*/, const Rgba& endColor /*= Rgba::WHITE*/, const Vector3& scale /*= Vector3::ONE*/, const Vector3& endScale /*= Vector3::ONE*/, Material* initialMaterial /*= nullptr*/, float initialMass /*= 1.0f*/);
-    void UpdateParticles(float time, float deltaSeconds);
-    void DestroyDeadEntities();
+    //Builds the single particle every instance draws, turned by orientation.
+    void BuildMesh(const Matrix4& orientation) const noexcept;
+    void UpdateParticles(float deltaSeconds);
 
     std::string m_name{};
+    const ParticleEmitterDefinition* m_definition{nullptr};
     Stopwatch m_spawnClock{};
-    std::vector<Particle> m_particles{};
-    mutable Mesh::Builder m_builder{};
+    ParticlePool m_pool{};
+    ParticleAppearance m_appearance{};
+    std::vector<Vertex3DInstanced> m_instances{};
+    Material* m_material{nullptr};
+    mutable MeshInstanced::Builder m_builder{};
     float m_age{0.0f};
     bool m_isWarming{false};
 };
@@ -110,13 +110,15 @@ ParticleEmitterDefinition::ParticleEmitterDefinition(const XMLElement& element)
         DataUtils::ValidateXmlElement(*xml_color, "color", "", "", "linear");
         if(bool has_children = DataUtils::GetChildElementCount(*xml_color, "linear"); !has_children) {
             Rgba color = DataUtils::ParseXmlElementText(*xml_color, Rgba::White);
-            m_particleRenderState.SetColors(color, color);
+            m_startColor = color;
+            m_endColor = color;
         } else {
             auto xml_color_linear = xml_color->FirstChildElement("linear");
             DataUtils::ValidateXmlElement(*xml_color_linear, "linear", "", "start,end");
             Rgba start_color = DataUtils::ParseXmlAttribute(*xml_color_linear, "start", Rgba::White);
             Rgba end_color = DataUtils::ParseXmlAttribute(*xml_color_linear, "end", Rgba::White);
-            m_particleRenderState.SetColors(start_color, end_color);
+            m_startColor = start_color;
+            m_endColor = end_color;
         }
     }
 
@@ -124,7 +126,8 @@ ParticleEmitterDefinition::ParticleEmitterDefinition(const XMLElement& element)
         DataUtils::ValidateXmlElement(*xml_scale, "scale", "", "", "linear");
         if(bool has_children = DataUtils::GetChildElementCount(*xml_scale, "linear"); !has_children) {
             Vector3 scale = DataUtils::ParseXmlElementText(*xml_scale, Vector3::One);
-            m_particleRenderState.SetScales(scale, scale);
+            m_startScale = scale;
+            m_endScale = scale;
         } else {
             auto xml_scale_linear = xml_scale->FirstChildElement("linear");
             DataUtils::ValidateXmlElement(*xml_scale_linear, "linear", "", "start,end");
@@ -132,7 +135,8 @@ ParticleEmitterDefinition::ParticleEmitterDefinition(const XMLElement& element)
             float end = DataUtils::ParseXmlAttribute(*xml_scale_linear, "end", 1.0f);
             Vector3 end_scale(end, end, end);
             Vector3 start_scale(start, start, start);
-            m_particleRenderState.SetScales(start_scale, end_scale);
+            m_startScale = start_scale;
+            m_endScale = end_scale;
         }
     }
 
@@ -143,7 +147,7 @@ ParticleEmitterDefinition::ParticleEmitterDefinition(const XMLElement& element)
 
     if(auto* xml_material = element.FirstChildElement("material"); xml_material) {
         DataUtils::ValidateXmlElement(*xml_material, "material", "", "src");
-        std::string material_src = DataUtils::ParseXmlAttribute(*xml_material, "src", std::string{"__2D"});
+        std::string material_src = DataUtils::ParseXmlAttribute(*xml_material, "src", m_materialName);
         m_materialName = material_src;
     }
 }
@@ -5,9 +5,8 @@
 
 #include "Engine/Math/Vector3.hpp"
 
-#include "Engine/Physics/Particles/Particle.hpp"
-
 #include <map>
+#include <memory>
 #include <string>
 
 enum class EmitterType : unsigned char {
@@ -19,6 +18,11 @@ enum class EmitterType : unsigned char {
     Max,
 };
 
+enum class ParticleShape : unsigned char {
+    Quad,
+    Cube,
+};
+
 struct EmitterDefinition {
     EmitterType type{EmitterType::Point};
     Vector3 start{Vector3::Zero};
@@ -49,8 +53,11 @@ private:
 
     static std::unique_ptr<ParticleEmitterDefinition> CreateParticleEmitterDefinition(const XMLElement& element) noexcept;
 
-    ParticleState m_initialState{};
-    ParticleRenderState m_particleRenderState{};
+    Rgba m_startColor{Rgba::White};
+    Rgba m_endColor{Rgba::White};
+    Vector3 m_startScale{Vector3::One};
+    Vector3 m_endScale{Vector3::One};
+    ParticleShape m_shape{ParticleShape::Quad};
 
     EmitterDefinition m_emitterPositionDefinition{};
     EmitterDefinition m_emitterVelocityDefinition{};
@@ -62,7 +69,8 @@ private:
     float m_lifetime{0.0f};
     float m_particleLifetime{0.0f};
     float m_mass{0.0f};
-    std::string m_materialName{};
+    //Particles draw instanced, so the material's vertex shader places them from the INSTANCE_* inputs; "__particle" does.
+    std::string m_materialName{"__particle"};
     std::string m_name{};
     Rgba m_particleColor{Rgba::White};
     bool m_isPrewarmed{false};
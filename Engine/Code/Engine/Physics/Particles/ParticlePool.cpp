@@ -0,0 +1,178 @@
+#include "Engine/Physics/Particles/ParticlePool.hpp"
+
+#include <algorithm>
+
+#include <xmmintrin.h>
+
+namespace {
+
+constexpr std::size_t lane_count = 4u;
+
+//a + (b - a) * t
+[[nodiscard]] __m128 Lerp(__m128 a, __m128 b, __m128 t) noexcept {
+    return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+}
+
+[[nodiscard]] float Lerp(float a, float b, float t) noexcept {
+    return a + (b - a) * t;
+}
+
+} // namespace
+
+void ParticlePool::Reserve(std::size_t count) noexcept {
+    m_position_x.reserve(count);
+    m_position_y.reserve(count);
+    m_position_z.reserve(count);
+    m_velocity_x.reserve(count);
+    m_velocity_y.reserve(count);
+    m_velocity_z.reserve(count);
+    m_age.reserve(count);
+    m_inverse_lifetime.reserve(count);
+}
+
+void ParticlePool::Spawn(const Vector3& position, const Vector3& velocity, float lifetimeSeconds) noexcept {
+    if(lifetimeSeconds <= 0.0f) {
+        return;
+    }
+    m_position_x.push_back(position.x);
+    m_position_y.push_back(position.y);
+    m_position_z.push_back(position.z);
+    m_velocity_x.push_back(velocity.x);
+    m_velocity_y.push_back(velocity.y);
+    m_velocity_z.push_back(velocity.z);
+    m_age.push_back(lifetimeSeconds);
+    m_inverse_lifetime.push_back(1.0f / lifetimeSeconds);
+}
+
+void ParticlePool::Clear() noexcept {
+    m_position_x.clear();
+    m_position_y.clear();
+    m_position_z.clear();
+    m_velocity_x.clear();
+    m_velocity_y.clear();
+    m_velocity_z.clear();
+    m_age.clear();
+    m_inverse_lifetime.clear();
+}
+
+void ParticlePool::Update(std::size_t first, std::size_t last, float deltaSeconds, const ParticleAppearance& appearance, std::vector<Vertex3DInstanced>& instances) noexcept {
+    last = (std::min)(last, size());
+    const auto dt = _mm_set1_ps(deltaSeconds);
+    const auto zero = _mm_setzero_ps();
+    const auto start_r = _mm_set1_ps(appearance.start_color.x);
+    const auto start_g = _mm_set1_ps(appearance.start_color.y);
+    const auto start_b = _mm_set1_ps(appearance.start_color.z);
+    const auto start_a = _mm_set1_ps(appearance.start_color.w);
+    const auto end_r = _mm_set1_ps(appearance.end_color.x);
+    const auto end_g = _mm_set1_ps(appearance.end_color.y);
+    const auto end_b = _mm_set1_ps(appearance.end_color.z);
+    const auto end_a = _mm_set1_ps(appearance.end_color.w);
+    const auto start_sx = _mm_set1_ps(appearance.start_scale.x);
+    const auto start_sy = _mm_set1_ps(appearance.start_scale.y);
+    const auto start_sz = _mm_set1_ps(appearance.start_scale.z);
+    const auto end_sx = _mm_set1_ps(appearance.end_scale.x);
+    const auto end_sy = _mm_set1_ps(appearance.end_scale.y);
+    const auto end_sz = _mm_set1_ps(appearance.end_scale.z);
+    auto i = first;
+    for(; i + lane_count <= last; i += lane_count) {
+        const auto age = _mm_sub_ps(_mm_loadu_ps(m_age.data() + i), dt);
+        _mm_storeu_ps(m_age.data() + i, age);
+        //Interpolate "backwards" because the age ratio starts at 1 and goes to 0.
+        const auto ratio = _mm_max_ps(_mm_mul_ps(age, _mm_loadu_ps(m_inverse_lifetime.data() + i)), zero);
+        _mm_storeu_ps(m_position_x.data() + i, _mm_add_ps(_mm_loadu_ps(m_position_x.data() + i), _mm_mul_ps(_mm_loadu_ps(m_velocity_x.data() + i), dt)));
+        _mm_storeu_ps(m_position_y.data() + i, _mm_add_ps(_mm_loadu_ps(m_position_y.data() + i), _mm_mul_ps(_mm_loadu_ps(m_velocity_y.data() + i), dt)));
+        _mm_storeu_ps(m_position_z.data() + i, _mm_add_ps(_mm_loadu_ps(m_position_z.data() + i), _mm_mul_ps(_mm_loadu_ps(m_velocity_z.data() + i), dt)));
+
+        alignas(16) float r[lane_count];
+        alignas(16) float g[lane_count];
+        alignas(16) float b[lane_count];
+        alignas(16) float a[lane_count];
+        alignas(16) float sx[lane_count];
+        alignas(16) float sy[lane_count];
+        alignas(16) float sz[lane_count];
+        _mm_store_ps(r, Lerp(end_r, start_r, ratio));
+        _mm_store_ps(g, Lerp(end_g, start_g, ratio));
+        _mm_store_ps(b, Lerp(end_b, start_b, ratio));
+        _mm_store_ps(a, Lerp(end_a, start_a, ratio));
+        _mm_store_ps(sx, Lerp(end_sx, start_sx, ratio));
+        _mm_store_ps(sy, Lerp(end_sy, start_sy, ratio));
+        _mm_store_ps(sz, Lerp(end_sz, start_sz, ratio));
+
+        //The instance buffer is interleaved, so the results are scattered one particle at a time.
+        //Components are written directly; the vector constructors are not inline.
+        for(std::size_t lane = 0u; lane < lane_count; ++lane) {
+            auto& instance = instances[i + lane];
+            instance.position.x = m_position_x[i + lane];
+            instance.position.y = m_position_y[i + lane];
+            instance.position.z = m_position_z[i + lane];
+            instance.color.x = r[lane];
+            instance.color.y = g[lane];
+            instance.color.z = b[lane];
+            instance.color.w = a[lane];
+            instance.tangent.x = sx[lane];
+            instance.tangent.y = sy[lane];
+            instance.tangent.z = sz[lane];
+        }
+    }
+    for(; i < last; ++i) {
+        UpdateOne(i, deltaSeconds, appearance, instances[i]);
+    }
+}
+
+void ParticlePool::UpdateOne(std::size_t index, float deltaSeconds, const ParticleAppearance& appearance, Vertex3DInstanced& instance) noexcept {
+    m_age[index] -= deltaSeconds;
+    const auto ratio = (std::max)(m_age[index] * m_inverse_lifetime[index], 0.0f);
+    m_position_x[index] += m_velocity_x[index] * deltaSeconds;
+    m_position_y[index] += m_velocity_y[index] * deltaSeconds;
+    m_position_z[index] += m_velocity_z[index] * deltaSeconds;
+    instance.position = Vector3{m_position_x[index], m_position_y[index], m_position_z[index]};
+    const auto& s = appearance.start_color;
+    const auto& e = appearance.end_color;
+    instance.color = Vector4{Lerp(e.x, s.x, ratio), Lerp(e.y, s.y, ratio), Lerp(e.z, s.z, ratio), Lerp(e.w, s.w, ratio)};
+    const auto& ss = appearance.start_scale;
+    const auto& es = appearance.end_scale;
+    instance.tangent = Vector3{Lerp(es.x, ss.x, ratio), Lerp(es.y, ss.y, ratio), Lerp(es.z, ss.z, ratio)};
+}
+
+void ParticlePool::RemoveDead(std::vector<Vertex3DInstanced>& instances) noexcept {
+    auto count = size();
+    for(std::size_t i = 0u; i < count;) {
+        if(0.0f < m_age[i]) {
+            ++i;
+            continue;
+        }
+        --count;
+        if(i != count) {
+            Move(count, i);
+            instances[i] = instances[count];
+        }
+    }
+    m_position_x.resize(count);
+    m_position_y.resize(count);
+    m_position_z.resize(count);
+    m_velocity_x.resize(count);
+    m_velocity_y.resize(count);
+    m_velocity_z.resize(count);
+    m_age.resize(count);
+    m_inverse_lifetime.resize(count);
+    instances.resize(count);
+}
+
+void ParticlePool::Move(std::size_t from, std::size_t to) noexcept {
+    m_position_x[to] = m_position_x[from];
+    m_position_y[to] = m_position_y[from];
+    m_position_z[to] = m_position_z[from];
+    m_velocity_x[to] = m_velocity_x[from];
+    m_velocity_y[to] = m_velocity_y[from];
+    m_velocity_z[to] = m_velocity_z[from];
+    m_age[to] = m_age[from];
+    m_inverse_lifetime[to] = m_inverse_lifetime[from];
+}
+
+std::size_t ParticlePool::size() const noexcept {
+    return m_age.size();
+}
+
+bool ParticlePool::empty() const noexcept {
+    return m_age.empty();
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector4.hpp"
+#include "Engine/Renderer/Vertex3DInstanced.hpp"
+
+#include <cstddef>
+#include <vector>
+
+//How an emitter's particles change over their life. Every particle of an emitter shares it,
+//so it is stored once instead of per particle.
+struct ParticleAppearance {
+    Vector4 start_color{Vector4::One};
+    Vector4 end_color{Vector4::One};
+    Vector3 start_scale{Vector3::One};
+    Vector3 end_scale{Vector3::One};
+};
+
+//Structure-of-arrays storage for one emitter's particles.
+//Dead particles are swap-removed, so particle order is not stable between updates.
+class ParticlePool {
+public:
+    void Reserve(std::size_t count) noexcept;
+    void Spawn(const Vector3& position, const Vector3& velocity, float lifetimeSeconds) noexcept;
+    void Clear() noexcept;
+
+    //Ages and moves particles [first, last) and writes their interpolated color and scale to the same range of instances.
+    //Instance position is the particle's position, color its color and tangent its scale, read by shaders as INSTANCE_POSITION, INSTANCE_COLOR and INSTANCE_TANGENT.
+    void Update(std::size_t first, std::size_t last, float deltaSeconds, const ParticleAppearance& appearance, std::vector<Vertex3DInstanced>& instances) noexcept;
+    //Swap-removes every particle whose age ran out, keeping instances in step with the pool.
+    void RemoveDead(std::vector<Vertex3DInstanced>& instances) noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+protected:
+private:
+    void UpdateOne(std::size_t index, float deltaSeconds, const ParticleAppearance& appearance, Vertex3DInstanced& instance) noexcept;
+    void Move(std::size_t from, std::size_t to) noexcept;
+
+    std::vector<float> m_position_x{};
+    std::vector<float> m_position_y{};
+    std::vector<float> m_position_z{};
+    std::vector<float> m_velocity_x{};
+    std::vector<float> m_velocity_y{};
+    std::vector<float> m_velocity_z{};
+    std::vector<float> m_age{};               //Seconds left to live.
+    std::vector<float> m_inverse_lifetime{};
+};
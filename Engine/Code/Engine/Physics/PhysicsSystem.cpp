@@ -1,9 +1,12 @@
 #include "Engine/Physics/PhysicsSystem.hpp"
 
 #include "Engine/Math/Plane2.hpp"
+#include "Engine/Memory/FrameArena.hpp"
 #include "Engine/Physics/PhysicsUtils.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 
 #include "Engine/Services/ServiceLocator.hpp"
+#include "Engine/Services/IJobSystemService.hpp"
 #include "Engine/Services/IRendererService.hpp"
 
 #ifdef PROFILE_BUILD
@@ -11,6 +14,8 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <mutex>
 
 void PhysicsSystem::Enable(bool enable) {
@@ -71,7 +76,7 @@ void PhysicsSystem::SetWorldDescription(const PhysicsSystemDesc& new_desc) {
     m_desc = new_desc;
     m_gravityFG.SetGravity(m_desc.gravity);
     m_dragFG.SetCoefficients(m_desc.dragK1K2);
-    //_world_partition.SetWorldBounds(_desc.world_bounds);
+    m_broadphase.SetMargin(m_desc.broadphase_margin);
 }
 
 void PhysicsSystem::EnablePhysics(bool isPhysicsEnabled) noexcept {
@@ -121,6 +126,7 @@ PhysicsSystem::PhysicsSystem(const PhysicsSystemDesc& desc /*= PhysicsSystemDesc
     ZoneScopedC(0xFF0000);
 #endif
     m_desc = desc;
+    m_broadphase.SetMargin(m_desc.broadphase_margin);
 }
 
 PhysicsSystem::~PhysicsSystem() {
@@ -150,19 +156,11 @@ void PhysicsSystem::BeginFrame() noexcept {
     //_rigidBodies.reserve(_rigidBodies.size() + _pending_addition.size());
     for(auto* a : m_pending_addition) {
         m_rigidBodies.emplace_back(a);
+        m_body_store.Add(a);
+        AddToBroadPhase(a);
     }
     m_pending_addition.clear();
     m_pending_addition.shrink_to_fit();
-    //_world_partition.Clear();
-    //_world_partition.Add(_rigidBodies);
-
-    for(auto* body : m_rigidBodies) {
-        const auto is_gravity_enabled = body->IsGravityEnabled();
-        const auto is_drag_enabled = body->IsDragEnabled();
-        is_gravity_enabled ? m_gravityFG.attach(body) : m_gravityFG.detach(body);
-        is_drag_enabled ? m_dragFG.attach(body) : m_dragFG.detach(body);
-        body->BeginFrame();
-    }
 }
 
 void PhysicsSystem::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
@@ -173,40 +171,62 @@ void PhysicsSystem::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
         return;
     }
     m_deltaSeconds = deltaSeconds;
-    m_accumulatedTime += m_deltaSeconds;
-    if(m_accumulatedTime >= m_targetFrameRate) {
-        m_accumulatedTime -= m_targetFrameRate;
-        return;
+    const TimeUtils::FPSeconds step = m_targetFrameRate;
+    //After a long frame only max_steps_per_update steps are owed; the rest is dropped so the
+    //catch-up cannot take longer than the frame that caused it.
+    const auto max_owed = step * static_cast<float>((std::max)(m_desc.max_steps_per_update, 1));
+    m_accumulatedTime = (std::min)(m_accumulatedTime + m_deltaSeconds, max_owed);
+    while(m_accumulatedTime >= step) {
+        Step(step);
+        m_accumulatedTime -= step;
     }
-    ApplyGravityAndDrag(m_targetFrameRate);
-    ApplyCustomAndJointForces(m_targetFrameRate);
-    auto* renderer = ServiceLocator::get<IRendererService>();
-    const auto camera_position = Vector2(renderer->GetCamera().GetPosition());
-    const auto half_extents = Vector2(renderer->GetOutput()->GetDimensions()) * 0.5f;
-    const auto query_area = AABB2(camera_position - half_extents, camera_position + half_extents);
-    const auto potential_collisions = BroadPhaseCollision(query_area);
-    const auto actual_collisions = NarrowPhaseCollision(potential_collisions, PhysicsUtils::GJK, PhysicsUtils::EPA);
-    SolveCollision(actual_collisions);
-    SolveConstraints();
-    UpdateBodiesInBounds(m_targetFrameRate);
-    SolveConstraints();
+}
+
+void PhysicsSystem::Step(TimeUtils::FPSeconds deltaSeconds) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    ApplyGravityAndDrag(deltaSeconds);
+    ApplyCustomAndJointForces(deltaSeconds);
+    const auto& potential_collisions = BroadPhaseCollision();
+    const auto actual_collisions = NarrowPhaseCollision(potential_collisions);
+    BuildIslands(actual_collisions);
+    SolveContacts(deltaSeconds);
+    UpdateBodiesInBounds(deltaSeconds);
+    SolveConstraints(deltaSeconds);
 }
 
 void PhysicsSystem::UpdateBodiesInBounds(TimeUtils::FPSeconds deltaSeconds) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    for(auto* body : m_rigidBodies) {
-        if(!body) {
-            continue;
+    auto& store = m_body_store;
+    store.dt = deltaSeconds;
+    const auto count = store.size();
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    js->ParallelFor(0u, count, 256u, [&store, deltaSeconds](std::size_t first, std::size_t last) {
+        store.Integrate(first, last, deltaSeconds);
+    });
+    //Child bodies read their ancestors' transforms, so only root bodies are updated in parallel.
+    js->ParallelFor(0u, count, 64u, [&store](std::size_t first, std::size_t last) {
+        for(auto i = first; i < last; ++i) {
+            auto* body = store.owner[i];
+            if(body->HasParent()) {
+                continue;
+            }
+            body->UpdateTransform();
+            //if(!MathUtils::DoOBBsOverlap(OBB2(_desc.world_bounds), body->GetBounds())) {
+            //    body->FellOutOfWorld();
+            //}
+            //if(MathUtils::IsPointInFrontOfPlane(body->GetPosition(), Plane2(Vector2::Y_AXIS, _desc.kill_plane_distance))) {
+            //    body->FellOutOfWorld();
+            //}
+        }
+    });
+    for(auto* body : store.owner) {
+        if(body->HasParent()) {
+            body->UpdateTransform();
         }
-        body->Update(deltaSeconds);
-        //if(!MathUtils::DoOBBsOverlap(OBB2(_desc.world_bounds), body->GetBounds())) {
-        //    body->FellOutOfWorld();
-        //}
-        //if(MathUtils::IsPointInFrontOfPlane(body->GetPosition(), Plane2(Vector2::Y_AXIS, _desc.kill_plane_distance))) {
-        //    body->FellOutOfWorld();
-        //}
     }
 }
 
@@ -217,112 +237,421 @@ void PhysicsSystem::ApplyCustomAndJointForces(TimeUtils::FPSeconds deltaSeconds)
     for(auto&& fg : m_forceGenerators) {
         fg->notify(deltaSeconds);
     }
+    //Joints between sleeping or static bodies would only wake them.
+    const auto is_awake = [](const RigidBody* body) { return body && body->IsAwake(); };
     for(auto&& joint : m_joints) {
-        joint->Notify(deltaSeconds);
+        if(is_awake(joint->GetBodyA()) || is_awake(joint->GetBodyB())) {
+            joint->Notify(deltaSeconds);
+        }
+    }
+    //The contact solver needs every force of this step before it runs.
+    auto& store = m_body_store;
+    for(std::size_t i = 0u; i < store.size(); ++i) {
+        if(store.flags[i] & RigidBodyStore::HasTimedForces) {
+            store.owner[i]->AccumulateTimedForces(deltaSeconds);
+        }
     }
 }
 
-void PhysicsSystem::ApplyGravityAndDrag(TimeUtils::FPSeconds deltaSeconds) noexcept {
+void PhysicsSystem::ApplyGravityAndDrag([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    m_gravityFG.notify(deltaSeconds);
-    m_dragFG.notify(deltaSeconds);
+    m_gravityFG.apply(m_body_store);
+    m_dragFG.apply(m_body_store);
 }
 
-std::vector<RigidBody*> PhysicsSystem::BroadPhaseCollision(const AABB2& /*query_area*/) noexcept {
+void PhysicsSystem::AddToBroadPhase(RigidBody* body) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    std::vector<RigidBody*> potential_collisions{};
-    for(auto iterA = std::begin(m_rigidBodies); iterA != std::end(m_rigidBodies); ++iterA) {
-        for(auto iterB = iterA + 1; iterB != std::end(m_rigidBodies); ++iterB) {
-            auto* bodyA = *iterA;
-            auto* bodyB = *iterB;
-            if(!bodyA || !bodyB) {
-                continue;
-            }
-            const auto bodyABoundsAsAABB2 = AABB2{bodyA->GetBounds()};
-            const auto bodyBBoundsAsAABB2 = AABB2{bodyB->GetBounds()};
-            //if(!MathUtils::DoAABBsOverlap(query_area, bodyBoundsAsAABB2)) {
-            //    continue;
-            //}
-            if(MathUtils::DoAABBsOverlap(bodyABoundsAsAABB2, bodyBBoundsAsAABB2)) {
-                //const auto queried_bodies = _world_partition.Query(query_area);
-                //for(auto* query : queried_bodies) {
-                //potential_collisions.push_back(query);
-                //}
-                potential_collisions.push_back(bodyA);
-                potential_collisions.push_back(bodyB);
-            }
-        }
+    //The proxy id may be stale if the body was copied from one already in the world.
+    if(!body || m_broadphase.IsProxyOf(body->m_broadphase_proxy, body)) {
+        return;
     }
-    return potential_collisions;
+    body->m_broadphase_proxy = m_broadphase.CreateProxy(AABB2{body->GetBounds()}, body);
+    body->m_broadphase_position = body->GetPosition();
+    m_broadphase_moved.push_back(body->m_broadphase_proxy);
 }
 
-void PhysicsSystem::SolveCollision(const PhysicsSystem::CollisionDataSet& actual_collisions) noexcept {
+void PhysicsSystem::RemoveFromBroadPhase(RigidBody* body) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    for(auto& collision : actual_collisions) {
-        auto* a = collision.a;
-        auto* b = collision.b;
-        const auto& aPos = a->GetPosition();
-        const auto& bPos = b->GetPosition();
-        const auto& aMass = a->GetMass();
-        const auto& bMass = b->GetMass();
-        const auto massSum = aMass + bMass;
-        const auto aNormal = Vector2{-collision.normal};
-        const auto bNormal = Vector2{collision.normal};
-        const auto aDeltaContribution = (aMass / massSum);
-        const auto bDeltaContribution = (bMass / massSum);
-        const auto aForceContribution = aNormal * aDeltaContribution;
-        const auto bForceContribution = bNormal * bDeltaContribution;
-        const auto aDistanceContribution = collision.distance * aDeltaContribution;
-        const auto bDistanceContribution = collision.distance * bDeltaContribution;
-        a->SetPosition(aPos + aDistanceContribution * aNormal);
-        b->SetPosition(bPos + bDistanceContribution * bNormal);
-        //collision.a->ApplyForceAt(aPos, aForceContribution, TimeUtils::FPSeconds::zero());
-        //collision.b->ApplyForceAt(bPos, bForceContribution, TimeUtils::FPSeconds::zero());
-        collision.a->ApplyImpulseAt(aPos, aForceContribution);
-        collision.b->ApplyImpulseAt(bPos, bForceContribution);
+    if(!body || !m_broadphase.IsProxyOf(body->m_broadphase_proxy, body)) {
+        return;
     }
+    const auto proxy = body->m_broadphase_proxy;
+    body->m_broadphase_proxy = DynamicAABBTree<RigidBody>::null_node;
+    m_broadphase.DestroyProxy(proxy);
+    //Proxy ids are recycled, so nothing may keep referring to this one.
+    std::erase(m_broadphase_moved, proxy);
+    std::erase_if(m_broadphase_pairs, [proxy](const ProxyPair& pair) { return pair.first == proxy || pair.second == proxy; });
+    m_contact_cache.Remove(body);
 }
 
-void PhysicsSystem::SolveConstraints() const noexcept {
+const std::vector<PhysicsSystem::ProxyPair>& PhysicsSystem::BroadPhaseCollision() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    for(int i = 0; i < m_desc.position_solver_iterations; ++i) {
-        SolvePositionConstraints();
+    //Only bodies that left their fat bounds are reinserted and only those can form new pairs.
+    for(auto* body : m_rigidBodies) {
+        if(!body || body->m_broadphase_proxy == DynamicAABBTree<RigidBody>::null_node) {
+            continue;
+        }
+        const auto& position = body->GetPosition();
+        const auto displacement = position - body->m_broadphase_position;
+        if(m_broadphase.MoveProxy(body->m_broadphase_proxy, AABB2{body->GetBounds()}, displacement)) {
+            body->m_broadphase_position = position;
+            m_broadphase_moved.push_back(body->m_broadphase_proxy);
+        }
     }
-    for(int i = 0; i < m_desc.velocity_solver_iterations; ++i) {
-        SolveVelocityConstraints();
+
+    //Pairs persist until their fat bounds separate.
+    std::erase_if(m_broadphase_pairs, [this](const ProxyPair& pair) {
+        return !MathUtils::DoAABBsOverlap(m_broadphase.GetFatBounds(pair.first), m_broadphase.GetFatBounds(pair.second));
+    });
+    if(!m_broadphase_moved.empty()) {
+        for(const auto moved : m_broadphase_moved) {
+            m_broadphase.Query(m_broadphase.GetFatBounds(moved), [this, moved](int other) {
+                if(other != moved) {
+                    m_broadphase_pairs.emplace_back((std::min)(moved, other), (std::max)(moved, other));
+                }
+                return true;
+            });
+        }
+        m_broadphase_moved.clear();
+        std::sort(std::begin(m_broadphase_pairs), std::end(m_broadphase_pairs));
+        m_broadphase_pairs.erase(std::unique(std::begin(m_broadphase_pairs), std::end(m_broadphase_pairs)), std::end(m_broadphase_pairs));
     }
+    return m_broadphase_pairs;
 }
 
-void PhysicsSystem::SolvePositionConstraints() const noexcept {
+PhysicsSystem::CollisionDataSet PhysicsSystem::NarrowPhaseCollision(const std::vector<ProxyPair>& potential_collisions) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    for(auto&& joint : m_joints) {
-        if(joint->ConstraintViolated()) {
-            joint->SolvePositionConstraint();
+    static auto& pairs_tested = Metrics::GetCounter("physics.pairs_tested");
+    pairs_tested.Add(potential_collisions.size());
+    CollisionDataSet result{FrameArena::GetResource()};
+    if(potential_collisions.empty()) {
+        m_contacts.clear();
+        m_contact_cache.Clear();
+        return result;
+    }
+    m_circle_batch.Clear();
+    m_aabb_batch.Clear();
+    m_obb_batch.Clear();
+    m_circle_pairs.clear();
+    m_aabb_pairs.clear();
+    m_obb_pairs.clear();
+    m_polygon_pairs.clear();
+    m_sleeping_pairs.clear();
+    const auto is_box = [](ColliderType type) { return type == ColliderType::AABB || type == ColliderType::OBB; };
+    const auto get_axes = [](const Collider& collider) -> std::pair<Vector2, Vector2> {
+        //ColliderAABB is a polygon rotated 45 degrees internally; its bounds' orientation is not its axes.
+        if(collider.GetType() == ColliderType::AABB) {
+            return {Vector2::X_Axis, Vector2::Y_Axis};
+        }
+        const auto bounds = collider.GetBounds();
+        return {bounds.GetRight(), bounds.GetUp()};
+    };
+    for(const auto& [proxy_a, proxy_b] : potential_collisions) {
+        auto* const body_a = m_broadphase.GetElement(proxy_a);
+        auto* const body_b = m_broadphase.GetElement(proxy_b);
+        if(!MathUtils::DoAABBsOverlap(AABB2{body_a->GetBounds()}, AABB2{body_b->GetBounds()})) {
+            continue;
+        }
+        //Pairs where neither body is simulated cannot have moved; a resting contact is kept as it was
+        //so sleeping stacks stay connected in the island graph without being tested again.
+        if(!(body_a->Flags() & RigidBodyStore::Simulated) && !(body_b->Flags() & RigidBodyStore::Simulated)) {
+            if(auto* cached = m_contact_cache.Find(body_a, body_b); cached && cached->touching) {
+                m_sleeping_pairs.emplace_back(body_a, body_b);
+            }
+            continue;
+        }
+        const auto& collider_a = *body_a->GetCollider();
+        const auto& collider_b = *body_b->GetCollider();
+        const auto type_a = collider_a.GetType();
+        const auto type_b = collider_b.GetType();
+        if(type_a == ColliderType::Circle && type_b == ColliderType::Circle) {
+            m_circle_batch.Add(collider_a.CalcCenter(), collider_a.GetHalfExtents().x, collider_b.CalcCenter(), collider_b.GetHalfExtents().x);
+            m_circle_pairs.emplace_back(body_a, body_b);
+        } else if(type_a == ColliderType::AABB && type_b == ColliderType::AABB) {
+            m_aabb_batch.Add(collider_a.CalcCenter(), collider_a.GetHalfExtents(), collider_b.CalcCenter(), collider_b.GetHalfExtents());
+            m_aabb_pairs.emplace_back(body_a, body_b);
+        } else if(is_box(type_a) && is_box(type_b)) {
+            const auto [right_a, up_a] = get_axes(collider_a);
+            const auto [right_b, up_b] = get_axes(collider_b);
+            m_obb_batch.Add(collider_a.CalcCenter(), collider_a.GetHalfExtents(), right_a, up_a, collider_b.CalcCenter(), collider_b.GetHalfExtents(), right_b, up_b);
+            m_obb_pairs.emplace_back(body_a, body_b);
+        } else {
+            m_polygon_pairs.emplace_back(body_a, body_b);
+        }
+    }
+
+    m_contact_cache.BeginStep();
+    const auto add_contact = [this, &result](RigidBody* a, RigidBody* b, float distance, const Vector2& normal) {
+        auto& cached = m_contact_cache.Touch(a, b);
+        //Impulses accumulated along a different normal would push the wrong way.
+        if(!cached.touching || MathUtils::DotProduct(cached.normal, normal) < 0.95f) {
+            cached.normal_impulse = 0.0f;
+            cached.tangent_impulse = 0.0f;
+        }
+        cached.touching = true;
+        cached.normal = normal;
+        cached.distance = distance;
+        const auto contact = CollisionData{a, b, distance, Vector3{normal}};
+        if(const auto&& [_, was_inserted] = result.insert(contact); was_inserted) {
+            while(m_contacts.size() >= 10) {
+                m_contacts.pop_front();
+            }
+            m_contacts.push_back(contact);
+        }
+    };
+    const auto add_batch_contacts = [this, &add_contact](const std::vector<BodyPair>& pairs) {
+        for(std::size_t i = 0u; i < pairs.size(); ++i) {
+            if(m_batch_results.collides[i]) {
+                add_contact(pairs[i].first, pairs[i].second, m_batch_results.distance[i], m_batch_results.GetNormal(i));
+            }
+        }
+    };
+    NarrowPhase::CollideCircles(m_circle_batch, m_batch_results);
+    add_batch_contacts(m_circle_pairs);
+    NarrowPhase::CollideAABBs(m_aabb_batch, m_batch_results);
+    add_batch_contacts(m_aabb_pairs);
+    NarrowPhase::CollideOBBs(m_obb_batch, m_batch_results);
+    add_batch_contacts(m_obb_pairs);
+
+    for(const auto& [body_a, body_b] : m_polygon_pairs) {
+        const auto& collider_a = *body_a->GetCollider();
+        const auto& collider_b = *body_b->GetCollider();
+        auto& cached = m_contact_cache.Touch(body_a, body_b);
+        const auto gjk = PhysicsUtils::GJK(collider_a, collider_b, cached.search_direction);
+        cached.search_direction = Vector2{gjk.direction};
+        if(gjk.collides) {
+            const auto epa = PhysicsUtils::EPA(gjk, collider_a, collider_b);
+            add_contact(body_a, body_b, epa.distance, Vector2{epa.normal});
+        } else {
+            cached.touching = false;
+        }
+    }
+    for(const auto& [body_a, body_b] : m_sleeping_pairs) {
+        const auto& cached = m_contact_cache.Touch(body_a, body_b);
+        result.emplace(body_a, body_b, cached.distance, Vector3{cached.normal});
+    }
+    m_contact_cache.EndStep();
+    return result;
+}
+
+IslandGraph::Index PhysicsSystem::GetStoreIndex(const RigidBody* body) const noexcept {
+    if(body && body->m_store == &m_body_store) {
+        return body->m_store_index;
+    }
+    return IslandGraph::invalid_index;
+}
+
+void PhysicsSystem::BuildIslands(const PhysicsSystem::CollisionDataSet& actual_collisions) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto& store = m_body_store;
+    //Only bodies the solver can move join islands through contacts; a static body would otherwise merge everything resting on it.
+    const auto can_move = [&store](IslandGraph::Index index) {
+        return index != IslandGraph::invalid_index && (store.flags[index] & (RigidBodyStore::Simulated | RigidBodyStore::Asleep)) != 0;
+    };
+    m_contact_links.clear();
+    m_contact_constraints.clear();
+    for(const auto& collision : actual_collisions) {
+        auto a = GetStoreIndex(collision.a);
+        auto b = GetStoreIndex(collision.b);
+        m_contact_links.emplace_back(can_move(a) ? a : IslandGraph::invalid_index, can_move(b) ? b : IslandGraph::invalid_index);
+        auto& constraint = m_contact_constraints.emplace_back();
+        constraint.a = a;
+        constraint.b = b;
+        constraint.normal = Vector2{collision.normal};
+        constraint.depth = collision.distance;
+        constraint.friction = std::sqrt(collision.a->m_rigidbodyDesc.physicsMaterial.friction * collision.b->m_rigidbodyDesc.physicsMaterial.friction);
+        constraint.cached = m_contact_cache.Find(collision.a, collision.b);
+    }
+    //Joints link whatever they connect, static bodies included, because solving a joint may move both of its bodies.
+    m_joint_links.clear();
+    for(const auto& joint : m_joints) {
+        m_joint_links.emplace_back(GetStoreIndex(joint->GetBodyA()), GetStoreIndex(joint->GetBodyB()));
+    }
+    m_islands.Build(store.size(), m_contact_links, m_joint_links);
+
+    //An island is awake if any of its bodies is. Waking it wakes every sleeping body in it.
+    const auto& islands = m_islands.GetIslands();
+    const auto& bodies = m_islands.GetBodies();
+    m_island_awake.assign(islands.size(), std::uint8_t{0u});
+    for(std::size_t k = 0u; k < islands.size(); ++k) {
+        const auto& island = islands[k];
+        bool has_awake = false;
+        bool has_asleep = false;
+        for(auto i = island.first_body; i < island.first_body + island.body_count; ++i) {
+            const auto flags = store.flags[bodies[i]];
+            has_awake |= (flags & RigidBodyStore::Simulated) != 0;
+            has_asleep |= (flags & RigidBodyStore::Asleep) != 0;
         }
+        if(has_awake && has_asleep) {
+            for(auto i = island.first_body; i < island.first_body + island.body_count; ++i) {
+                if(store.flags[bodies[i]] & RigidBodyStore::Asleep) {
+                    store.owner[bodies[i]]->Wake();
+                }
+            }
+        }
+        m_island_awake[k] = has_awake ? 1u : 0u;
+    }
+    for(auto& constraint : m_contact_constraints) {
+        const auto inverse_mass = [&store](IslandGraph::Index index) {
+            return index != IslandGraph::invalid_index && (store.flags[index] & RigidBodyStore::Simulated) ? store.inverse_mass[index] : 0.0f;
+        };
+        constraint.inverse_mass_a = inverse_mass(constraint.a);
+        constraint.inverse_mass_b = inverse_mass(constraint.b);
     }
 }
 
-void PhysicsSystem::SolveVelocityConstraints() const noexcept {
+void PhysicsSystem::SolveContacts(TimeUtils::FPSeconds deltaSeconds) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    for(auto&& joint : m_joints) {
+    auto& store = m_body_store;
+    const auto dt = deltaSeconds.count();
+    if(m_contact_constraints.empty() || dt <= 0.0f) {
+        return;
+    }
+    //Integration turns this step's force into velocity as force * inverse_mass * dt, so the solver works on that
+    //predicted velocity and converts the result back into force. Bodies the solver cannot move stay at zero.
+    m_solver_velocities.assign(store.size(), Vector2::Zero);
+    const auto& islands = m_islands.GetIslands();
+    const auto& bodies = m_islands.GetBodies();
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    js->ParallelFor(0u, islands.size(), 0u, [&](std::size_t first, std::size_t last) {
+        for(auto k = first; k < last; ++k) {
+            const auto& island = islands[k];
+            if(!m_island_awake[k] || island.contact_count == 0u) {
+                continue;
+            }
+            for(auto i = island.first_body; i < island.first_body + island.body_count; ++i) {
+                const auto body = bodies[i];
+                if(store.flags[body] & RigidBodyStore::Simulated) {
+                    m_solver_velocities[body] = store.force[body] * store.inverse_mass[body] * dt;
+                }
+            }
+            ContactSolver::Prepare(m_contact_constraints, m_islands, island, dt, m_desc.contact_baumgarte, m_desc.contact_slop);
+            ContactSolver::WarmStart(m_contact_constraints, m_islands, island, m_solver_velocities);
+            for(int iteration = 0; iteration < m_desc.velocity_solver_iterations; ++iteration) {
+                ContactSolver::SolveVelocities(m_contact_constraints, m_islands, island, m_solver_velocities);
+            }
+            ContactSolver::StoreImpulses(m_contact_constraints, m_islands, island);
+            for(auto i = island.first_body; i < island.first_body + island.body_count; ++i) {
+                const auto body = bodies[i];
+                if(store.flags[body] & RigidBodyStore::Simulated) {
+                    store.force[body] = m_solver_velocities[body] / (store.inverse_mass[body] * dt);
+                }
+            }
+        }
+    });
+}
+
+void PhysicsSystem::SolveConstraints(TimeUtils::FPSeconds deltaSeconds) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto& islands = m_islands.GetIslands();
+    auto* js = ServiceLocator::get<IJobSystemService>();
+    js->ParallelFor(0u, islands.size(), 0u, [this, &islands, deltaSeconds](std::size_t first, std::size_t last) {
+        for(auto k = first; k < last; ++k) {
+            if(!m_island_awake[k]) {
+                continue;
+            }
+            const auto& island = islands[k];
+            if(island.joint_count) {
+                for(int i = 0; i < m_desc.position_solver_iterations; ++i) {
+                    SolvePositionConstraints(island);
+                }
+                for(int i = 0; i < m_desc.velocity_solver_iterations; ++i) {
+                    SolveVelocityConstraints(island);
+                }
+            }
+            UpdateSleep(island, deltaSeconds);
+        }
+    });
+    //Joints whose bodies are not in the world yet belong to no island.
+    for(std::size_t i = 0u; i < m_joint_links.size(); ++i) {
+        if(m_joint_links[i].first != IslandGraph::invalid_index || m_joint_links[i].second != IslandGraph::invalid_index) {
+            continue;
+        }
+        const auto& joint = m_joints[i];
+        for(int iteration = 0; iteration < m_desc.position_solver_iterations; ++iteration) {
+            if(joint->ConstraintViolated()) {
+                joint->SolvePositionConstraint();
+            }
+        }
+        for(int iteration = 0; iteration < m_desc.velocity_solver_iterations; ++iteration) {
+            if(joint->ConstraintViolated()) {
+                joint->SolveVelocityConstraint();
+            }
+        }
+    }
+}
+
+void PhysicsSystem::SolvePositionConstraints(const IslandGraph::Island& island) const noexcept {
+    const auto& joints = m_islands.GetJoints();
+    for(auto i = island.first_joint; i < island.first_joint + island.joint_count; ++i) {
+        const auto& joint = m_joints[joints[i]];
+        if(joint->ConstraintViolated()) {
+            joint->SolvePositionConstraint();
+        }
+    }
+}
+
+void PhysicsSystem::SolveVelocityConstraints(const IslandGraph::Island& island) const noexcept {
+    const auto& joints = m_islands.GetJoints();
+    for(auto i = island.first_joint; i < island.first_joint + island.joint_count; ++i) {
+        const auto& joint = m_joints[joints[i]];
         if(joint->ConstraintViolated()) {
             joint->SolveVelocityConstraint();
         }
     }
 }
 
+void PhysicsSystem::UpdateSleep(const IslandGraph::Island& island, TimeUtils::FPSeconds deltaSeconds) noexcept {
+    if(!m_desc.enable_sleeping) {
+        return;
+    }
+    auto& store = m_body_store;
+    const auto& bodies = m_islands.GetBodies();
+    const auto dt = deltaSeconds.count();
+    const auto linear_threshold_sq = m_desc.sleep_linear_threshold * m_desc.sleep_linear_threshold;
+    auto min_sleep_time = std::numeric_limits<float>::infinity();
+    for(auto i = island.first_body; i < island.first_body + island.body_count; ++i) {
+        const auto body = bodies[i];
+        if(!(store.flags[body] & RigidBodyStore::Simulated)) {
+            continue;
+        }
+        const auto angular_speed = dt > 0.0f ? std::abs(store.orientation[body] - store.prev_orientation[body]) / dt : 0.0f;
+        if(store.velocity[body].CalcLengthSquared() > linear_threshold_sq || angular_speed > m_desc.sleep_angular_threshold) {
+            store.sleep_time[body] = 0.0f;
+        } else {
+            store.sleep_time[body] += dt;
+        }
+        min_sleep_time = (std::min)(min_sleep_time, store.sleep_time[body]);
+    }
+    //Infinity means the island has nothing that can sleep.
+    if(min_sleep_time < m_desc.time_to_sleep || min_sleep_time == std::numeric_limits<float>::infinity()) {
+        return;
+    }
+    for(auto i = island.first_body; i < island.first_body + island.body_count; ++i) {
+        const auto body = bodies[i];
+        if(store.flags[body] & RigidBodyStore::Simulated) {
+            store.velocity[body] = Vector2::Zero;
+            store.owner[body]->Sleep();
+        }
+    }
+}
+
 void PhysicsSystem::Render() const noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
@@ -339,7 +668,7 @@ void PhysicsSystem::Render() const noexcept {
         }
     }
     if(m_show_world_partition) {
-        m_world_partition.DebugRender();
+        m_broadphase.DebugRender();
     }
     if(m_show_contacts) {
         renderer->SetModelMatrix(Matrix4::I);
@@ -355,9 +684,9 @@ void PhysicsSystem::EndFrame() noexcept {
         body->Endframe();
     }
     for(auto* r : m_pending_removal) {
+        RemoveFromBroadPhase(r);
+        m_body_store.Remove(r);
         m_rigidBodies.erase(std::remove_if(std::begin(m_rigidBodies), std::end(m_rigidBodies), [this, r](const RigidBody* b) { return b == r; }), std::end(m_rigidBodies));
-        m_gravityFG.detach(r);
-        m_dragFG.detach(r);
         for(auto&& fg : m_forceGenerators) {
             fg->detach(r);
         }
@@ -418,6 +747,21 @@ void PhysicsSystem::RemoveAllObjectsImmediately() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    for(auto* body : m_rigidBodies) {
+        if(body) {
+            body->m_broadphase_proxy = DynamicAABBTree<RigidBody>::null_node;
+        }
+    }
+    m_body_store.Clear();
+    m_broadphase.Clear();
+    m_broadphase_moved.clear();
+    m_broadphase_pairs.clear();
+    m_contact_cache.Clear();
+    m_islands.Clear();
+    m_island_awake.clear();
+    m_contact_links.clear();
+    m_joint_links.clear();
+    m_contact_constraints.clear();
     m_rigidBodies.clear();
     m_rigidBodies.shrink_to_fit();
     m_gravityFG.detach_all();
@@ -5,15 +5,19 @@
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/Vector2.hpp"
 #include "Engine/Physics/CableJoint.hpp"
+#include "Engine/Physics/ContactSolver.hpp"
 #include "Engine/Physics/DragForceGenerator.hpp"
+#include "Engine/Physics/DynamicAABBTree.hpp"
 #include "Engine/Physics/ForceGenerator.hpp"
 #include "Engine/Physics/GravityForceGenerator.hpp"
+#include "Engine/Physics/IslandGraph.hpp"
 #include "Engine/Physics/Joint.hpp"
+#include "Engine/Physics/NarrowPhase.hpp"
 #include "Engine/Physics/PhysicsTypes.hpp"
 #include "Engine/Physics/RigidBody.hpp"
+#include "Engine/Physics/RigidBodyStore.hpp"
 #include "Engine/Physics/RodJoint.hpp"
 #include "Engine/Physics/SpringJoint.hpp"
-#include "Engine/Physics/QuadTree.hpp"
 #include "Engine/Profiling/ProfileLogScope.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 
@@ -25,6 +29,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory_resource>
 #include <queue>
 #include <set>
 #include <thread>
@@ -92,19 +97,33 @@ public:
 
 protected:
 private:
+    //One fixed step of the whole pipeline; Update runs as many as the accumulated time allows.
+    void Step(TimeUtils::FPSeconds deltaSeconds) noexcept;
     void UpdateBodiesInBounds(TimeUtils::FPSeconds deltaSeconds) noexcept;
     void ApplyCustomAndJointForces(TimeUtils::FPSeconds deltaSeconds) noexcept;
     void ApplyGravityAndDrag(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    [[nodiscard]] std::vector<RigidBody*> BroadPhaseCollision(const AABB2& query_area) noexcept;
 
-    using CollisionDataSet = std::set<CollisionData>;
-    template<typename CollisionDetectionFunction, typename CollisionResolutionFunction>
-    [[nodiscard]] CollisionDataSet NarrowPhaseCollision(const std::vector<RigidBody*>& potential_collisions, CollisionDetectionFunction&& cd, CollisionResolutionFunction&& cr) noexcept;
-
-    void SolveCollision(const CollisionDataSet& actual_collisions) noexcept;
-    void SolveConstraints() const noexcept;
-    void SolvePositionConstraints() const noexcept;
-    void SolveVelocityConstraints() const noexcept;
+    //Pair of broad-phase proxy ids, smaller id first.
+    using ProxyPair = std::pair<int, int>;
+    void AddToBroadPhase(RigidBody* body) noexcept;
+    void RemoveFromBroadPhase(RigidBody* body) noexcept;
+    [[nodiscard]] const std::vector<ProxyPair>& BroadPhaseCollision() noexcept;
+
+    //Rebuilt every step and dropped before the next, so it lives in the frame arena.
+    using CollisionDataSet = std::pmr::set<CollisionData>;
+    //Sorts pairs into per-shape batches, runs the closed-form kernels on them and GJK/EPA on the rest.
+    [[nodiscard]] CollisionDataSet NarrowPhaseCollision(const std::vector<ProxyPair>& potential_collisions) noexcept;
+
+    //Groups bodies into islands through contacts and joints and wakes islands that touch an awake body.
+    void BuildIslands(const CollisionDataSet& actual_collisions) noexcept;
+    //Sequential-impulse contact solve, one awake island per task.
+    void SolveContacts(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    //Joint constraints and sleep bookkeeping after integration, one awake island per task.
+    void SolveConstraints(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    void SolvePositionConstraints(const IslandGraph::Island& island) const noexcept;
+    void SolveVelocityConstraints(const IslandGraph::Island& island) const noexcept;
+    void UpdateSleep(const IslandGraph::Island& island, TimeUtils::FPSeconds deltaSeconds) noexcept;
+    [[nodiscard]] IslandGraph::Index GetStoreIndex(const RigidBody* body) const noexcept;
 
     bool m_is_running = false;
     std::deque<CollisionData> m_contacts{};
@@ -112,7 +131,27 @@ private:
     std::vector<RigidBody*> m_pending_addition{};
     GravityForceGenerator m_gravityFG{Vector2::Zero};
     DragForceGenerator m_dragFG{Vector2::Zero};
-    QuadTree<RigidBody> m_world_partition{};
+    RigidBodyStore m_body_store{};
+    DynamicAABBTree<RigidBody> m_broadphase{};
+    std::vector<int> m_broadphase_moved{};
+    std::vector<ProxyPair> m_broadphase_pairs{};
+    using BodyPair = std::pair<RigidBody*, RigidBody*>;
+    NarrowPhase::CircleBatch m_circle_batch{};
+    NarrowPhase::AABBBatch m_aabb_batch{};
+    NarrowPhase::OBBBatch m_obb_batch{};
+    std::vector<BodyPair> m_circle_pairs{};
+    std::vector<BodyPair> m_aabb_pairs{};
+    std::vector<BodyPair> m_obb_pairs{};
+    std::vector<BodyPair> m_polygon_pairs{};
+    std::vector<BodyPair> m_sleeping_pairs{};
+    NarrowPhase::ContactResults m_batch_results{};
+    NarrowPhase::ContactCache m_contact_cache{};
+    IslandGraph m_islands{};
+    std::vector<std::uint8_t> m_island_awake{};
+    std::vector<IslandGraph::Link> m_contact_links{};
+    std::vector<IslandGraph::Link> m_joint_links{};
+    std::vector<ContactConstraint> m_contact_constraints{};
+    std::vector<Vector2> m_solver_velocities{};
     TimeUtils::FPSeconds m_deltaSeconds = TimeUtils::FPSeconds::zero();
     TimeUtils::FPSeconds m_accumulatedTime = TimeUtils::FPSeconds::zero();
     TimeUtils::FPFrames m_targetFrameRate = TimeUtils::FPFrames{1};
@@ -122,36 +161,3 @@ private:
     bool m_show_contacts = false;
     bool m_show_joints = false;
 };
-
-template<typename CollisionDetectionFunction, typename CollisionResolutionFunction>
-PhysicsSystem::CollisionDataSet PhysicsSystem::NarrowPhaseCollision(const std::vector<RigidBody*>& potential_collisions, CollisionDetectionFunction&& cd, CollisionResolutionFunction&& cr) noexcept {
-#ifdef PROFILE_BUILD
-    ZoneScopedC(0xFF0000);
-#endif
-    CollisionDataSet result;
-    if(potential_collisions.size() < 2) {
-        m_contacts.clear();
-        return {};
-    }
-    for(auto iter_a = std::begin(potential_collisions); iter_a != std::end(potential_collisions); ++iter_a) {
-        for(auto iter_b = iter_a + 1; iter_b != std::end(potential_collisions); ++iter_b) {
-            auto* const cur_body = *iter_a;
-            auto* const next_body = *iter_b;
-            if(cur_body == next_body) {
-                continue;
-            }
-            const auto cdResult = std::invoke(cd, *cur_body->GetCollider(), *next_body->GetCollider());
-            if(cdResult.collides) {
-                const auto crResult = std::invoke(cr, cdResult, *cur_body->GetCollider(), *next_body->GetCollider());
-                const auto contact = CollisionData{cur_body, next_body, crResult.distance, crResult.normal};
-                if(const auto&& [_, was_inserted] = result.insert(contact); was_inserted) {
-                    while(m_contacts.size() >= 10) {
-                        m_contacts.pop_front();
-                    }
-                    m_contacts.push_back(contact);
-                }
-            }
-        }
-    }
-    return result;
-}
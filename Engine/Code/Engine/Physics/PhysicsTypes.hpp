@@ -14,8 +14,16 @@ struct PhysicsSystemDesc {
     Vector2 dragK1K2{1.0f, 1.0f};
     float world_scale{100.0f};
     float kill_plane_distance{10000.0f};
-    int position_solver_iterations{6};
-    int velocity_solver_iterations{8};
+    int position_solver_iterations{6};  //Joint position passes per step.
+    int velocity_solver_iterations{8};  //Contact and joint velocity passes per step.
+    float broadphase_margin{10.0f}; //World units added to each side of a body's broad-phase bounds. Bodies moving less than this are not reinserted.
+    float contact_baumgarte{0.2f};   //Fraction of the remaining penetration removed each step.
+    float contact_slop{0.5f};        //Penetration in world units left alone so resting contacts do not jitter.
+    bool enable_sleeping{true};
+    float sleep_linear_threshold{1.0f};   //World units per second.
+    float sleep_angular_threshold{2.0f};  //Degrees per second.
+    float time_to_sleep{0.5f};            //Seconds an island must stay below both thresholds before it sleeps.
+    int max_steps_per_update{4};          //Fixed steps one Update may run to catch up; accumulated time beyond that is dropped.
 };
 
 struct PhysicsMaterial {
@@ -99,6 +107,7 @@ private:
 struct GJKResult {
     bool collides{false};
     std::vector<Vector3> simplex;
+    Vector3 direction{}; //Search direction when GJK terminated. Seeds the next query of the same pair.
 };
 
 struct EPAResult {
@@ -43,14 +43,21 @@ bool PhysicsUtils::GJKIntersect(const Collider& a, const Collider& b) {
     return GJK(a, b).collides;
 }
 
-//TODO: Multi-collision causes large simplex.
 GJKResult PhysicsUtils::GJK(const Collider& a, const Collider& b) {
+    return GJK(a, b, Vector2::X_Axis);
+}
+
+//TODO: Multi-collision causes large simplex.
+GJKResult PhysicsUtils::GJK(const Collider& a, const Collider& b, const Vector2& initialDirection) {
     using Simplex = std::vector<Vector3>;
     const auto calcMinkowskiDiff = [](const Vector2& direction, const Collider& a) { return a.Support(direction); };
     const auto support = [&](const Vector2& direction) { return calcMinkowskiDiff(direction, a) - calcMinkowskiDiff(-direction, b); };
-    const auto initialDisplacement = b.CalcCenter() - a.CalcCenter();
-    const auto initialDirection = initialDisplacement.GetNormalize();
-    auto A = support(Vector2::X_Axis);
+    const auto seed = MathUtils::IsEquivalentToZero(initialDirection) ? Vector2::X_Axis : initialDirection;
+    auto A = support(seed);
+    if(MathUtils::DotProduct(A, seed) < 0.0f) {
+        //The seed is still a separating axis: no point of the Minkowski difference reaches the origin.
+        return GJKResult{false, Simplex{Vector3{A}}, Vector3{seed}};
+    }
     Simplex simplex{Vector3{A}};
     auto D = Vector3{-A};
     const auto doSimplexLine = [&](Simplex& simplex, Vector3& D) {
@@ -132,7 +139,7 @@ GJKResult PhysicsUtils::GJK(const Collider& a, const Collider& b) {
             }
         }
     }(simplex, D); //IIIL
-    return GJKResult{result, simplex};
+    return GJKResult{result, simplex, D};
 }
 
 EPAResult PhysicsUtils::EPA(GJKResult gjk, const Collider& a, const Collider& b) {
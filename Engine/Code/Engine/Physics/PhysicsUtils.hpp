@@ -6,6 +6,9 @@ class Collider;
 
 namespace PhysicsUtils {
 [[nodiscard]] GJKResult GJK(const Collider& a, const Collider& b);
+//Starts the search from initialDirection instead of the x-axis. Passing the previous result's direction
+//lets a pair that has not moved much terminate in one or two iterations.
+[[nodiscard]] GJKResult GJK(const Collider& a, const Collider& b, const Vector2& initialDirection);
 [[nodiscard]] bool GJKIntersect(const Collider& a, const Collider& b);
 
 [[nodiscard]] EPAResult EPA(GJKResult gjk, const Collider& a, const Collider& b);
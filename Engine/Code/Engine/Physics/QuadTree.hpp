@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <memory_resource>
 #include <type_traits>
 #include <vector>
 
@@ -34,9 +35,13 @@ public:
 
     void SetWorldBounds(const AABB2& bounds) noexcept;
     [[nodiscard]] std::vector<std::add_pointer_t<T>> Query(const AABB2& area) noexcept;
+    //Appends the results to result, e.g. a vector built on FrameArena::GetResource() for a per-frame query.
+    void Query(const AABB2& area, std::pmr::vector<std::add_pointer_t<T>>& result) noexcept;
 
 protected:
 private:
+    template<typename Container>
+    void QueryInto(const AABB2& area, Container& result) noexcept;
     explicit QuadTree(QuadTree<T>* parent, const AABB2& bounds);
     explicit QuadTree(QuadTree<T>* parent, const AABB2& bounds, const std::vector<T>& elements);
     // clang-format off
@@ -89,12 +94,23 @@ private:
 template<typename T>
 std::vector<std::add_pointer_t<T>> QuadTree<T>::Query(const AABB2& area) noexcept {
     std::vector<std::add_pointer_t<T>> result{};
+    QueryInto(area, result);
+    return result;
+}
+
+template<typename T>
+void QuadTree<T>::Query(const AABB2& area, std::pmr::vector<std::add_pointer_t<T>>& result) noexcept {
+    QueryInto(area, result);
+}
+
+template<typename T>
+template<typename Container>
+void QuadTree<T>::QueryInto(const AABB2& area, Container& result) noexcept {
     if(MathUtils::DoAABBsOverlap(area, m_bounds)) {
         if(!IsLeaf(*this)) {
             for(const auto& c : m_children) {
                 if(c) {
-                    auto inner_result = c->Query(area);
-                    result.insert(std::end(result), std::begin(inner_result), std::end(inner_result));
+                    c->QueryInto(area, result);
                 }
             }
         } else {
@@ -107,7 +123,6 @@ std::vector<std::add_pointer_t<T>> QuadTree<T>::Query(const AABB2& area) noexcep
             }
         }
     }
-    return result;
 }
 
 template<typename T>
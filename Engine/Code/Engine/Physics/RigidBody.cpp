@@ -33,6 +33,88 @@ RigidBody::RigidBody(const RigidBodyDesc& desc /*= RigidBodyDesc{}*/)
     }
 }
 
+RigidBody::RigidBody(const RigidBody& other) noexcept {
+    *this = other;
+}
+
+RigidBody& RigidBody::operator=(const RigidBody& rhs) noexcept {
+    if(this == &rhs) {
+        return *this;
+    }
+    if(m_store) {
+        m_store->Remove(this);
+    }
+    transform = rhs.transform;
+    m_rigidbodyDesc = rhs.m_rigidbodyDesc;
+    m_parent = rhs.m_parent;
+    m_children = rhs.m_children;
+    m_angular_acceleration = rhs.m_angular_acceleration;
+    m_linear_forces = rhs.m_linear_forces;
+    m_angular_forces = rhs.m_angular_forces;
+    m_is_colliding = rhs.m_is_colliding;
+    m_is_awake = rhs.m_is_awake;
+    m_should_kill = rhs.m_should_kill;
+    m_should_lock_rotation = rhs.m_should_lock_rotation;
+    m_broadphase_proxy = rhs.m_broadphase_proxy;
+    m_broadphase_position = rhs.m_broadphase_position;
+    CopyStateFrom(rhs);
+    return *this;
+}
+
+RigidBody::RigidBody(RigidBody&& other) noexcept {
+    *this = std::move(other);
+}
+
+RigidBody& RigidBody::operator=(RigidBody&& rhs) noexcept {
+    if(this == &rhs) {
+        return *this;
+    }
+    if(m_store) {
+        m_store->Remove(this);
+    }
+    transform = std::move(rhs.transform);
+    m_rigidbodyDesc = std::move(rhs.m_rigidbodyDesc);
+    m_parent = rhs.m_parent;
+    m_children = std::move(rhs.m_children);
+    m_angular_acceleration = rhs.m_angular_acceleration;
+    m_linear_forces = std::move(rhs.m_linear_forces);
+    m_angular_forces = std::move(rhs.m_angular_forces);
+    m_is_colliding = rhs.m_is_colliding;
+    m_is_awake = rhs.m_is_awake;
+    m_should_kill = rhs.m_should_kill;
+    m_should_lock_rotation = rhs.m_should_lock_rotation;
+    m_broadphase_proxy = rhs.m_broadphase_proxy;
+    m_broadphase_position = rhs.m_broadphase_position;
+    CopyStateFrom(rhs);
+    //Take over the slot so the store keeps pointing at a live body.
+    if(rhs.m_store) {
+        m_store = rhs.m_store;
+        m_store_index = rhs.m_store_index;
+        m_store->owner[m_store_index] = this;
+        rhs.m_store = nullptr;
+        rhs.m_store_index = RigidBodyStore::invalid_index;
+    }
+    return *this;
+}
+
+RigidBody::~RigidBody() noexcept {
+    if(m_store) {
+        m_store->Remove(this);
+    }
+}
+
+void RigidBody::CopyStateFrom(const RigidBody& other) noexcept {
+    m_position = other.Position();
+    m_velocity = other.Velocity();
+    m_acceleration = other.Acceleration();
+    m_force = other.m_store ? other.m_store->force[other.m_store_index] : other.m_force;
+    m_torque = other.m_store ? other.m_store->torque[other.m_store_index] : other.m_torque;
+    m_orientationDegrees = other.Orientation();
+    m_prev_orientationDegrees = other.PrevOrientation();
+    m_time_since_last_move = other.m_store ? other.m_store->time_since_last_move[other.m_store_index] : other.m_time_since_last_move;
+    m_dt = other.m_store ? other.m_store->dt : other.m_dt;
+}
+
 void RigidBody::BeginFrame() {
     static constexpr auto pred = [](const auto& force) { return force.second.count() <= 0.0f; };
     if(!m_linear_forces.empty()) {
@@ -44,21 +126,52 @@ void RigidBody::BeginFrame() {
 }
 
 void RigidBody::Update(TimeUtils::FPSeconds deltaSeconds) {
-    if(!(IsPhysicsEnabled() && IsDynamic() && IsAwake()) || MathUtils::IsEquivalentToZero(GetInverseMass())) {
-        m_linear_impulses.clear();
-        m_angular_impulses.clear();
+    AccumulateTimedForces(deltaSeconds);
+    Integrate(deltaSeconds);
+    UpdateTransform();
+}
+
+void RigidBody::AccumulateTimedForces(TimeUtils::FPSeconds deltaSeconds) noexcept {
+    if(m_linear_forces.empty() && m_angular_forces.empty()) {
+        return;
+    }
+    if(!(Flags() & RigidBodyStore::Simulated)) {
         m_linear_forces.clear();
         m_angular_forces.clear();
-        Integrate(deltaSeconds);
-        return;
+    } else {
+        for(auto& force : m_linear_forces) {
+            Force() += force.first;
+            force.second -= deltaSeconds;
+        }
+        for(auto& force : m_angular_forces) {
+            Torque() += force.first;
+            force.second -= deltaSeconds;
+        }
+        static constexpr auto pred = [](const auto& force) { return force.second.count() <= 0.0f; };
+        m_linear_forces.erase(std::remove_if(m_linear_forces.begin(), m_linear_forces.end(), pred), m_linear_forces.end());
+        m_angular_forces.erase(std::remove_if(m_angular_forces.begin(), m_angular_forces.end(), pred), m_angular_forces.end());
     }
+    if(m_store && m_linear_forces.empty() && m_angular_forces.empty()) {
+        m_store->flags[m_store_index] &= ~RigidBodyStore::HasTimedForces;
+    }
+}
 
-    Integrate(deltaSeconds);
+void RigidBody::Integrate(TimeUtils::FPSeconds deltaSeconds) noexcept {
+    m_dt = deltaSeconds;
+    const auto& desc = m_rigidbodyDesc.physicsDesc;
+    RigidBodyStore::IntegrateOne(Position(), Velocity(), Acceleration(), Force(), Orientation(), PrevOrientation(), Torque(), TimeSinceLastMove(), GetInverseMass(), desc.linearDamping, desc.angularDamping, desc.maxAngularSpeed, Flags(), deltaSeconds.count());
+}
 
+void RigidBody::UpdateTransform() noexcept {
+    if(!(Flags() & RigidBodyStore::Simulated)) {
+        return;
+    }
     if(auto* const collider = GetCollider(); collider != nullptr) {
+        const auto& position = Position();
+        const auto orientation = Orientation();
         const auto S = Matrix4::CreateScaleMatrix(collider->GetHalfExtents());
-        const auto R = Matrix4::Create2DRotationDegreesMatrix(m_orientationDegrees);
-        const auto T = Matrix4::CreateTranslationMatrix(m_position);
+        const auto R = Matrix4::Create2DRotationDegreesMatrix(orientation);
+        const auto T = Matrix4::CreateTranslationMatrix(position);
         const auto M = Matrix4::MakeSRT(S, R, T);
         auto new_transform = Matrix4::I;
         if(!m_parent) {
@@ -71,99 +184,71 @@ void RigidBody::Update(TimeUtils::FPSeconds deltaSeconds) {
             }
         }
         transform = new_transform;
-        collider->SetPosition(m_position);
-        collider->SetOrientationDegrees(m_orientationDegrees);
+        collider->SetPosition(position);
+        collider->SetOrientationDegrees(orientation);
     }
+}
 
-    for(auto& force : m_linear_forces) {
-        force.second -= deltaSeconds;
-    }
-    for(auto& force : m_angular_forces) {
-        force.second -= deltaSeconds;
+void RigidBody::SyncStore() noexcept {
+    if(m_store) {
+        m_store->SyncFromBody(m_store_index);
     }
 }
 
-void RigidBody::Integrate(TimeUtils::FPSeconds deltaSeconds) noexcept {
-    const auto inv_mass = GetInverseMass();
-    const auto linear_impulse_sum = std::accumulate(std::begin(m_linear_impulses), std::end(m_linear_impulses), Vector2::Zero);
-    m_linear_impulses.clear();
+Vector2& RigidBody::Position() noexcept {
+    return m_store ? m_store->position[m_store_index] : m_position;
+}
 
-    using LinearForceType = typename std::decay<decltype(*m_linear_forces.begin())>::type;
-    const auto linear_acc = [](const LinearForceType& a, const LinearForceType& b) { return std::make_pair(a.first + b.first, TimeUtils::FPSeconds::zero()); };
-    const auto linear_force_sum = std::accumulate(std::begin(m_linear_forces), std::end(m_linear_forces), std::make_pair(Vector2::Zero, TimeUtils::FPSeconds::zero()), linear_acc);
+const Vector2& RigidBody::Position() const noexcept {
+    return m_store ? m_store->position[m_store_index] : m_position;
+}
 
-    const auto dt = deltaSeconds.count();
+Vector2& RigidBody::Velocity() noexcept {
+    return m_store ? m_store->velocity[m_store_index] : m_velocity;
+}
 
-    auto new_acceleration = (linear_impulse_sum + linear_force_sum.first) * inv_mass;
-    {
-        const bool is_near_zero = MathUtils::IsEquivalentToZero(new_acceleration);
-        const bool is_valid = MathUtils::IsValid(new_acceleration);
-        if(const bool should_clamp = is_near_zero || !is_valid; should_clamp) {
-            new_acceleration = Vector2::Zero;
-        }
-    }
-    auto new_velocity = new_acceleration * dt;
-    {
-        const bool is_near_zero = MathUtils::IsEquivalentToZero(new_velocity);
-        const bool is_valid = MathUtils::IsValid(new_velocity);
-        if(const bool should_clamp = is_near_zero || !is_valid; should_clamp) {
-            new_velocity = Vector2::Zero;
-        }
-    }
-    new_velocity *= std::clamp(1.0f - m_rigidbodyDesc.physicsDesc.linearDamping, 0.0f, 1.0f);
-    auto new_position = GetPosition() + new_velocity * dt;
-    {
-        const bool is_near_zero = MathUtils::IsEquivalentToZero(new_position);
-        const bool is_valid = MathUtils::IsValid(new_position);
-        if(const bool should_clamp = is_near_zero || !is_valid; should_clamp) {
-            new_position = Vector2::Zero;
-        }
-    }
+const Vector2& RigidBody::Velocity() const noexcept {
+    return m_store ? m_store->velocity[m_store_index] : m_velocity;
+}
 
-    SetPosition(new_position, true);
-    SetVelocity(new_velocity);
-    SetAcceleration(new_acceleration);
-
-    const auto& maxAngularSpeed = m_rigidbodyDesc.physicsDesc.maxAngularSpeed;
-    auto new_angular_velocity = std::clamp((2.0f * m_orientationDegrees - m_prev_orientationDegrees) / dt, -maxAngularSpeed, maxAngularSpeed);
-    {
-        const bool is_near_zero = MathUtils::IsEquivalentToZero(new_angular_velocity);
-        const bool is_inf = std::isinf(new_angular_velocity);
-        const bool is_nan = std::isnan(new_angular_velocity);
-        const bool should_clamp = is_near_zero || is_nan || is_inf;
-        if(should_clamp) {
-            new_angular_velocity = 0.0f;
-        }
-    }
-    new_angular_velocity *= std::clamp(1.0f - m_rigidbodyDesc.physicsDesc.angularDamping, 0.0f, 1.0f);
-
-    const auto new_angular_acceleration = [this, inv_mass]() {
-        auto result{0.0f};
-        if(!IsRotationLocked()) {
-            const auto angular_impulse_sum = std::accumulate(std::begin(m_angular_impulses), std::end(m_angular_impulses), 0.0f);
-            using AngularForceType = typename std::decay<decltype(*m_angular_forces.begin())>::type;
-            const auto angular_acc = [](const AngularForceType& a, const AngularForceType& b) { return std::make_pair(a.first + b.first, TimeUtils::FPSeconds::zero()); };
-            const auto angular_force_sum = std::accumulate(std::begin(m_angular_forces), std::end(m_angular_forces), std::make_pair(0.0f, TimeUtils::FPSeconds::zero()), angular_acc);
-            result = (angular_impulse_sum + angular_force_sum.first) * inv_mass;
-        }
-        m_angular_impulses.clear();
-        return result;
-    }();
+Vector2& RigidBody::Acceleration() noexcept {
+    return m_store ? m_store->acceleration[m_store_index] : m_acceleration;
+}
 
-    m_dt = deltaSeconds;
+const Vector2& RigidBody::Acceleration() const noexcept {
+    return m_store ? m_store->acceleration[m_store_index] : m_acceleration;
+}
 
-    const auto new_orientationDegrees = MathUtils::Wrap(new_angular_velocity + new_angular_acceleration * dt * dt, 0.0f, 360.0f);
-    m_prev_orientationDegrees = m_orientationDegrees;
-    m_orientationDegrees = new_orientationDegrees;
+Vector2& RigidBody::Force() noexcept {
+    return m_store ? m_store->force[m_store_index] : m_force;
+}
 
-    auto deltaPosition = m_position - new_position;
-    auto deltaOrientation = m_orientationDegrees - m_prev_orientationDegrees;
-    if(MathUtils::IsEquivalentToZero(deltaPosition)
-       && MathUtils::IsEquivalentToZero(deltaOrientation)) {
-        m_time_since_last_move += m_dt;
-    } else {
-        m_time_since_last_move = TimeUtils::FPSeconds{0.0f};
-    }
+float& RigidBody::Orientation() noexcept {
+    return m_store ? m_store->orientation[m_store_index] : m_orientationDegrees;
+}
+
+float RigidBody::Orientation() const noexcept {
+    return m_store ? m_store->orientation[m_store_index] : m_orientationDegrees;
+}
+
+float& RigidBody::PrevOrientation() noexcept {
+    return m_store ? m_store->prev_orientation[m_store_index] : m_prev_orientationDegrees;
+}
+
+float RigidBody::PrevOrientation() const noexcept {
+    return m_store ? m_store->prev_orientation[m_store_index] : m_prev_orientationDegrees;
+}
+
+float& RigidBody::Torque() noexcept {
+    return m_store ? m_store->torque[m_store_index] : m_torque;
+}
+
+float& RigidBody::TimeSinceLastMove() noexcept {
+    return m_store ? m_store->time_since_last_move[m_store_index] : m_time_since_last_move;
+}
+
+std::uint8_t RigidBody::Flags() const noexcept {
+    return m_store ? m_store->flags[m_store_index] : RigidBodyStore::CalcFlags(*this);
 }
 
 void RigidBody::DebugRender() const {
@@ -184,14 +269,17 @@ void RigidBody::Endframe() {
 
 void RigidBody::EnablePhysics(bool enabled) {
     m_rigidbodyDesc.physicsDesc.enablePhysics = enabled;
+    SyncStore();
 }
 
 void RigidBody::EnableGravity(bool enabled) {
     m_rigidbodyDesc.physicsDesc.enableGravity = IsDynamic() && enabled;
+    SyncStore();
 }
 
 void RigidBody::EnableDrag(bool enabled) {
     m_rigidbodyDesc.physicsDesc.enableDrag = IsDynamic() && enabled;
+    SyncStore();
 }
 
 bool RigidBody::IsPhysicsEnabled() const {
@@ -212,6 +300,10 @@ bool RigidBody::IsDynamic() const noexcept {
 
 void RigidBody::SetAwake(bool awake) noexcept {
     m_is_awake = IsDynamic() && awake;
+    if(m_is_awake && m_store) {
+        m_store->sleep_time[m_store_index] = 0.0f;
+    }
+    SyncStore();
 }
 
 void RigidBody::Wake() noexcept {
@@ -244,8 +336,13 @@ Matrix4 RigidBody::GetParentTransform() const {
     return Matrix4::I;
 }
 
+bool RigidBody::HasParent() const noexcept {
+    return m_parent != nullptr;
+}
+
 void RigidBody::ApplyImpulse(const Vector2& impulse) {
-    m_linear_impulses.push_back(impulse);
+    Wake();
+    Force() += impulse;
 }
 
 void RigidBody::ApplyImpulse(const Vector2& direction, float magnitude) {
@@ -253,7 +350,11 @@ void RigidBody::ApplyImpulse(const Vector2& direction, float magnitude) {
 }
 
 void RigidBody::ApplyForce(const Vector2& force, const TimeUtils::FPSeconds& duration) {
+    Wake();
     m_linear_forces.push_back(std::make_pair(force, duration));
+    if(m_store) {
+        m_store->flags[m_store_index] |= RigidBodyStore::HasTimedForces;
+    }
 }
 
 void RigidBody::ApplyForce(const Vector2& direction, float magnitude, const TimeUtils::FPSeconds& duration) {
@@ -262,10 +363,14 @@ void RigidBody::ApplyForce(const Vector2& direction, float magnitude, const Time
 
 void RigidBody::ApplyTorque(float force, const TimeUtils::FPSeconds& duration) {
     if(!IsRotationLocked()) {
+        Wake();
         if(duration == TimeUtils::FPSeconds::zero()) {
-            m_angular_impulses.push_back(force);
+            Torque() += force;
         } else {
             m_angular_forces.push_back(std::make_pair(force, duration));
+            if(m_store) {
+                m_store->flags[m_store_index] |= RigidBodyStore::HasTimedForces;
+            }
         }
     }
 }
@@ -277,14 +382,14 @@ void RigidBody::ApplyTorqueAt(const Vector2& position_on_object, const Vector2&
 void RigidBody::ApplyTorqueAt(const Vector2& position_on_object, const Vector2& force, const TimeUtils::FPSeconds& duration) {
     if(auto* const collider = GetCollider(); collider != nullptr) {
         const auto point_of_collision = MathUtils::CalcClosestPoint(position_on_object, *collider);
-        const auto r = m_position - point_of_collision;
+        const auto r = Position() - point_of_collision;
         const auto torque = MathUtils::CrossProduct(force, r);
         ApplyTorque(torque, duration);
     }
 }
 
 void RigidBody::ApplyTorque(const Vector2& direction, float magnitude, const TimeUtils::FPSeconds& duration) {
-    ApplyTorqueAt(m_position, direction * magnitude, duration);
+    ApplyTorqueAt(Position(), direction * magnitude, duration);
 }
 
 void RigidBody::ApplyForceAt(const Vector2& position_on_object, const Vector2& direction, float magnitude, const TimeUtils::FPSeconds& duration) {
@@ -294,9 +399,9 @@ void RigidBody::ApplyForceAt(const Vector2& position_on_object, const Vector2& d
 void RigidBody::ApplyForceAt(const Vector2& position_on_object, const Vector2& force, const TimeUtils::FPSeconds& duration) {
     if(auto* const collider = GetCollider(); collider != nullptr) {
         const auto point_of_collision = MathUtils::CalcClosestPoint(position_on_object, *collider);
-        auto r = m_position - point_of_collision;
+        auto r = Position() - point_of_collision;
         if(MathUtils::IsEquivalentToZero(r)) {
-            r = m_position;
+            r = Position();
         }
         const auto&& [parallel, perpendicular] = MathUtils::DivideIntoProjectAndReject(force, r);
         const auto angular_result = force - parallel;
@@ -313,7 +418,7 @@ void RigidBody::ApplyImpulseAt(const Vector2& position_on_object, const Vector2&
 void RigidBody::ApplyImpulseAt(const Vector2& position_on_object, const Vector2& force) {
     if(auto* const collider = GetCollider(); collider != nullptr) {
         const auto point_of_collision = MathUtils::CalcClosestPoint(position_on_object, *collider);
-        const auto r = m_position - point_of_collision;
+        const auto r = Position() - point_of_collision;
         const auto&& [parallel, perpendicular] = MathUtils::DivideIntoProjectAndReject(force, r);
         const auto angular_result = force - parallel;
         const auto linear_result = force - perpendicular;
@@ -331,27 +436,27 @@ const OBB2 RigidBody::GetBounds() const {
 
 void RigidBody::SetPosition(const Vector2& newPosition, bool teleport /*= false*/) noexcept {
     if(teleport) {
-        m_position = newPosition;
+        Position() = newPosition;
     } else {
         Wake();
-        m_position = newPosition;
+        Position() = newPosition;
     }
 }
 
 const Vector2& RigidBody::GetPosition() const {
-    return m_position;
+    return Position();
 }
 
 void RigidBody::SetVelocity(const Vector2& newVelocity) noexcept {
-    m_velocity = newVelocity;
+    Velocity() = newVelocity;
 }
 
 const Vector2& RigidBody::GetVelocity() const {
-    return m_velocity;
+    return Velocity();
 }
 
 const Vector2& RigidBody::GetAcceleration() const {
-    return m_acceleration;
+    return Acceleration();
 }
 
 Vector2 RigidBody::CalcDimensions() const {
@@ -362,11 +467,12 @@ Vector2 RigidBody::CalcDimensions() const {
 }
 
 float RigidBody::GetOrientationDegrees() const {
-    return m_orientationDegrees;
+    return Orientation();
 }
 
 float RigidBody::GetAngularVelocityDegrees() const {
-    return (m_orientationDegrees - m_prev_orientationDegrees) / m_dt.count();
+    const auto dt = m_store ? m_store->dt : m_dt;
+    return (Orientation() - PrevOrientation()) / dt.count();
 }
 
 float RigidBody::GetAngularAccelerationDegrees() const {
@@ -395,19 +501,17 @@ const bool RigidBody::IsRotationLocked() const noexcept {
 
 void RigidBody::LockRotation(bool shouldLockRotation) noexcept {
     m_should_lock_rotation = shouldLockRotation;
+    SyncStore();
 }
 
 void RigidBody::SetAcceleration(const Vector2& newAccleration) noexcept {
-    m_acceleration = newAccleration;
+    Acceleration() = newAccleration;
 }
 
 Vector2 RigidBody::CalcForceVector() noexcept {
-    //const auto inv_mass = GetInverseMass();
-    const auto linear_impulse_sum = std::accumulate(std::begin(m_linear_impulses), std::end(m_linear_impulses), Vector2::Zero);
-
     using LinearForceType = typename std::decay<decltype(*m_linear_forces.begin())>::type;
     const auto linear_acc = [](const LinearForceType& a, const LinearForceType& b) { return std::make_pair(a.first + b.first, TimeUtils::FPSeconds::zero()); };
     const auto linear_force_sum = std::accumulate(std::begin(m_linear_forces), std::end(m_linear_forces), std::make_pair(Vector2::Zero, TimeUtils::FPSeconds::zero()), linear_acc);
 
-    return linear_impulse_sum + linear_force_sum.first;
+    return Force() + linear_force_sum.first;
 }
@@ -4,6 +4,7 @@
 #include "Engine/Math/Vector2.hpp"
 #include "Engine/Physics/Collider.hpp"
 #include "Engine/Physics/PhysicsTypes.hpp"
+#include "Engine/Physics/RigidBodyStore.hpp"
 
 #include <memory>
 
@@ -94,12 +95,13 @@ public:
     explicit RigidBody(const RigidBodyDesc& desc = RigidBodyDesc{});
 
     RigidBody() = delete;
-    RigidBody(RigidBody&& other) noexcept = default;
-    RigidBody& operator=(RigidBody&& rhs) noexcept = default;
+    //Moving a body keeps its slot in the owning store; copies start outside of any store.
+    RigidBody(RigidBody&& other) noexcept;
+    RigidBody& operator=(RigidBody&& rhs) noexcept;
 
-    RigidBody(const RigidBody& other) noexcept = default;
-    RigidBody& operator=(const RigidBody& rhs) noexcept = default;
-    ~RigidBody() noexcept = default;
+    RigidBody(const RigidBody& other) noexcept;
+    RigidBody& operator=(const RigidBody& rhs) noexcept;
+    ~RigidBody() noexcept;
 
     Matrix4 transform{};
 
@@ -125,6 +127,7 @@ public:
     [[nodiscard]] float GetInverseMass() const;
 
     [[nodiscard]] Matrix4 GetParentTransform() const;
+    [[nodiscard]] bool HasParent() const noexcept;
 
     [[nodiscard]] Vector2 CalcForceVector() noexcept;
 
@@ -172,26 +175,53 @@ protected:
 private:
     void SetAcceleration(const Vector2& newAccleration) noexcept;
     void Integrate(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    //Adds forces that have a duration into this step's accumulators and ages them.
+    void AccumulateTimedForces(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    //Rebuilds the transform and moves the collider to match the integrated state.
+    void UpdateTransform() noexcept;
+    void SyncStore() noexcept;
+    void CopyStateFrom(const RigidBody& other) noexcept;
+
+    //Simulation state lives in the store while the body is in one.
+    [[nodiscard]] Vector2& Position() noexcept;
+    [[nodiscard]] const Vector2& Position() const noexcept;
+    [[nodiscard]] Vector2& Velocity() noexcept;
+    [[nodiscard]] const Vector2& Velocity() const noexcept;
+    [[nodiscard]] Vector2& Acceleration() noexcept;
+    [[nodiscard]] const Vector2& Acceleration() const noexcept;
+    [[nodiscard]] Vector2& Force() noexcept;
+    [[nodiscard]] float& Orientation() noexcept;
+    [[nodiscard]] float Orientation() const noexcept;
+    [[nodiscard]] float& PrevOrientation() noexcept;
+    [[nodiscard]] float PrevOrientation() const noexcept;
+    [[nodiscard]] float& Torque() noexcept;
+    [[nodiscard]] float& TimeSinceLastMove() noexcept;
+    [[nodiscard]] std::uint8_t Flags() const noexcept;
 
     RigidBodyDesc m_rigidbodyDesc{};
     RigidBody* m_parent = nullptr;
     std::vector<RigidBody*> m_children{};
+    RigidBodyStore* m_store = nullptr;
+    RigidBodyStore::Index m_store_index = RigidBodyStore::invalid_index;
     Vector2 m_position{};
     Vector2 m_velocity{};
     Vector2 m_acceleration{};
+    Vector2 m_force{};
+    float m_torque = 0.0f;
     float m_prev_orientationDegrees = 0.0f;
     float m_orientationDegrees = 0.0f;
     float m_angular_acceleration = 0.0f;
     TimeUtils::FPSeconds m_dt{};
-    TimeUtils::FPSeconds m_time_since_last_move{};
+    float m_time_since_last_move = 0.0f;
     std::vector<std::pair<Vector2, TimeUtils::FPSeconds>> m_linear_forces{};
-    std::vector<Vector2> m_linear_impulses{};
     std::vector<std::pair<float, TimeUtils::FPSeconds>> m_angular_forces{};
-    std::vector<float> m_angular_impulses{};
     bool m_is_colliding = false;
     bool m_is_awake = true;
     bool m_should_kill = false;
     bool m_should_lock_rotation = false;
+    int m_broadphase_proxy = -1;
+    Vector2 m_broadphase_position{};
 
     friend class PhysicsSystem;
+    friend class RigidBodyStore;
 };
@@ -0,0 +1,193 @@
+#include "Engine/Physics/RigidBodyStore.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Physics/RigidBody.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+RigidBodyStore::~RigidBodyStore() noexcept {
+    Clear();
+}
+
+RigidBodyStore::Index RigidBodyStore::Add(RigidBody* body) noexcept {
+    if(!body) {
+        return invalid_index;
+    }
+    if(body->m_store == this) {
+        return body->m_store_index;
+    }
+    if(body->m_store) {
+        body->m_store->Remove(body);
+    }
+    const auto index = owner.size();
+    owner.push_back(body);
+    position.push_back(body->m_position);
+    velocity.push_back(body->m_velocity);
+    acceleration.push_back(body->m_acceleration);
+    force.push_back(body->m_force);
+    orientation.push_back(body->m_orientationDegrees);
+    prev_orientation.push_back(body->m_prev_orientationDegrees);
+    torque.push_back(body->m_torque);
+    time_since_last_move.push_back(body->m_time_since_last_move);
+    sleep_time.push_back(0.0f);
+    inverse_mass.push_back(body->GetInverseMass());
+    linear_damping.push_back(body->m_rigidbodyDesc.physicsDesc.linearDamping);
+    angular_damping.push_back(body->m_rigidbodyDesc.physicsDesc.angularDamping);
+    max_angular_speed.push_back(body->m_rigidbodyDesc.physicsDesc.maxAngularSpeed);
+    flags.push_back(CalcFlags(*body));
+    body->m_store = this;
+    body->m_store_index = index;
+    return index;
+}
+
+void RigidBodyStore::Remove(RigidBody* body) noexcept {
+    if(!body || body->m_store != this) {
+        return;
+    }
+    const auto index = body->m_store_index;
+    body->m_position = position[index];
+    body->m_velocity = velocity[index];
+    body->m_acceleration = acceleration[index];
+    body->m_force = force[index];
+    body->m_orientationDegrees = orientation[index];
+    body->m_prev_orientationDegrees = prev_orientation[index];
+    body->m_torque = torque[index];
+    body->m_time_since_last_move = time_since_last_move[index];
+    body->m_dt = dt;
+    body->m_store = nullptr;
+    body->m_store_index = invalid_index;
+
+    const auto last = owner.size() - 1u;
+    if(index != last) {
+        owner[index] = owner[last];
+        position[index] = position[last];
+        velocity[index] = velocity[last];
+        acceleration[index] = acceleration[last];
+        force[index] = force[last];
+        orientation[index] = orientation[last];
+        prev_orientation[index] = prev_orientation[last];
+        torque[index] = torque[last];
+        time_since_last_move[index] = time_since_last_move[last];
+        sleep_time[index] = sleep_time[last];
+        inverse_mass[index] = inverse_mass[last];
+        linear_damping[index] = linear_damping[last];
+        angular_damping[index] = angular_damping[last];
+        max_angular_speed[index] = max_angular_speed[last];
+        flags[index] = flags[last];
+        owner[index]->m_store_index = index;
+    }
+    owner.pop_back();
+    position.pop_back();
+    velocity.pop_back();
+    acceleration.pop_back();
+    force.pop_back();
+    orientation.pop_back();
+    prev_orientation.pop_back();
+    torque.pop_back();
+    time_since_last_move.pop_back();
+    sleep_time.pop_back();
+    inverse_mass.pop_back();
+    linear_damping.pop_back();
+    angular_damping.pop_back();
+    max_angular_speed.pop_back();
+    flags.pop_back();
+}
+
+void RigidBodyStore::Clear() noexcept {
+    while(!owner.empty()) {
+        Remove(owner.back());
+    }
+}
+
+std::size_t RigidBodyStore::size() const noexcept {
+    return owner.size();
+}
+
+bool RigidBodyStore::empty() const noexcept {
+    return owner.empty();
+}
+
+void RigidBodyStore::SyncFromBody(Index index) noexcept {
+    const auto& body = *owner[index];
+    inverse_mass[index] = body.GetInverseMass();
+    linear_damping[index] = body.m_rigidbodyDesc.physicsDesc.linearDamping;
+    angular_damping[index] = body.m_rigidbodyDesc.physicsDesc.angularDamping;
+    max_angular_speed[index] = body.m_rigidbodyDesc.physicsDesc.maxAngularSpeed;
+    flags[index] = CalcFlags(body);
+}
+
+void RigidBodyStore::Integrate(Index first, Index last, TimeUtils::FPSeconds deltaSeconds) noexcept {
+    const auto dt_count = deltaSeconds.count();
+    for(auto i = first; i < last; ++i) {
+        if(flags[i] & Asleep) {
+            force[i] = Vector2::Zero;
+            torque[i] = 0.0f;
+            continue;
+        }
+        IntegrateOne(position[i], velocity[i], acceleration[i], force[i], orientation[i], prev_orientation[i], torque[i], time_since_last_move[i], inverse_mass[i], linear_damping[i], angular_damping[i], max_angular_speed[i], flags[i], dt_count);
+    }
+}
+
+void RigidBodyStore::IntegrateOne(Vector2& position, Vector2& velocity, Vector2& acceleration, Vector2& force, float& orientation, float& prevOrientation, float& torque, float& timeSinceLastMove, float inverseMass, float linearDamping, float angularDamping, float maxAngularSpeed, std::uint8_t flags, float dt) noexcept {
+    //Bodies that are not simulated drop whatever was applied to them this step.
+    const bool simulated = (flags & Simulated) != 0;
+    const auto linear_force = simulated ? force : Vector2::Zero;
+    const auto angular_force = simulated && (flags & RotationLocked) == 0 ? torque : 0.0f;
+    force = Vector2::Zero;
+    torque = 0.0f;
+
+    auto new_acceleration = linear_force * inverseMass;
+    if(MathUtils::IsEquivalentToZero(new_acceleration) || !MathUtils::IsValid(new_acceleration)) {
+        new_acceleration = Vector2::Zero;
+    }
+    auto new_velocity = new_acceleration * dt;
+    if(MathUtils::IsEquivalentToZero(new_velocity) || !MathUtils::IsValid(new_velocity)) {
+        new_velocity = Vector2::Zero;
+    }
+    new_velocity *= std::clamp(1.0f - linearDamping, 0.0f, 1.0f);
+    auto new_position = position + new_velocity * dt;
+    if(MathUtils::IsEquivalentToZero(new_position) || !MathUtils::IsValid(new_position)) {
+        new_position = Vector2::Zero;
+    }
+    const auto delta_position = new_position - position;
+    position = new_position;
+    velocity = new_velocity;
+    acceleration = new_acceleration;
+
+    auto new_angular_velocity = std::clamp((2.0f * orientation - prevOrientation) / dt, -maxAngularSpeed, maxAngularSpeed);
+    if(MathUtils::IsEquivalentToZero(new_angular_velocity) || std::isnan(new_angular_velocity) || std::isinf(new_angular_velocity)) {
+        new_angular_velocity = 0.0f;
+    }
+    new_angular_velocity *= std::clamp(1.0f - angularDamping, 0.0f, 1.0f);
+    const auto new_angular_acceleration = angular_force * inverseMass;
+    const auto new_orientation = MathUtils::Wrap(new_angular_velocity + new_angular_acceleration * dt * dt, 0.0f, 360.0f);
+    prevOrientation = orientation;
+    orientation = new_orientation;
+
+    if(MathUtils::IsEquivalentToZero(delta_position) && MathUtils::IsEquivalentToZero(orientation - prevOrientation)) {
+        timeSinceLastMove += dt;
+    } else {
+        timeSinceLastMove = 0.0f;
+    }
+}
+
+std::uint8_t RigidBodyStore::CalcFlags(const RigidBody& body) noexcept {
+    std::uint8_t result{0u};
+    if(body.IsPhysicsEnabled() && body.IsDynamic() && !MathUtils::IsEquivalentToZero(body.GetInverseMass())) {
+        result |= body.IsAwake() ? Simulated : Asleep;
+    }
+    if(body.IsGravityEnabled()) {
+        result |= Gravity;
+    }
+    if(body.IsDragEnabled()) {
+        result |= Drag;
+    }
+    if(body.IsRotationLocked()) {
+        result |= RotationLocked;
+    }
+    if(!body.m_linear_forces.empty() || !body.m_angular_forces.empty()) {
+        result |= HasTimedForces;
+    }
+    return result;
+}
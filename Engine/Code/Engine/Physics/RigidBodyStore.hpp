@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class RigidBody;
+
+//Structure-of-arrays storage for the per-step simulation state of every body in the PhysicsSystem.
+//A RigidBody added to a store keeps only an index into these arrays; its accessors read and write here.
+//Indices are dense: removing a body moves the last body into its slot.
+class RigidBodyStore {
+public:
+    using Index = std::size_t;
+    static constexpr Index invalid_index = static_cast<Index>(-1);
+
+    enum Flags : std::uint8_t {
+        Simulated = 1u << 0,       //Physics enabled, dynamic, awake and has finite mass.
+        Gravity = 1u << 1,
+        Drag = 1u << 2,
+        RotationLocked = 1u << 3,
+        HasTimedForces = 1u << 4,  //Body has forces with a duration that must be accumulated before integration.
+        Asleep = 1u << 5,          //Would be simulated but its island is sleeping. Not integrated; forces applied meanwhile are dropped.
+    };
+
+    RigidBodyStore() noexcept = default;
+    RigidBodyStore(const RigidBodyStore& other) = delete;
+    RigidBodyStore(RigidBodyStore&& other) = delete;
+    RigidBodyStore& operator=(const RigidBodyStore& other) = delete;
+    RigidBodyStore& operator=(RigidBodyStore&& other) = delete;
+    ~RigidBodyStore() noexcept;
+
+    //Moves the body's simulation state into the store.
+    Index Add(RigidBody* body) noexcept;
+    //Moves the body's simulation state back into the body and releases its slot.
+    void Remove(RigidBody* body) noexcept;
+    void Clear() noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    //Refreshes flags and cached material values from the body's description. Called by RigidBody when those change.
+    void SyncFromBody(Index index) noexcept;
+
+    //Integrates bodies [first, last). Safe to call on disjoint ranges concurrently.
+    void Integrate(Index first, Index last, TimeUtils::FPSeconds deltaSeconds) noexcept;
+
+    //Single-body kernel shared by the store and bodies that are not in one.
+    static void IntegrateOne(Vector2& position, Vector2& velocity, Vector2& acceleration, Vector2& force, float& orientation, float& prevOrientation, float& torque, float& timeSinceLastMove, float inverseMass, float linearDamping, float angularDamping, float maxAngularSpeed, std::uint8_t flags, float dt) noexcept;
+    [[nodiscard]] static std::uint8_t CalcFlags(const RigidBody& body) noexcept;
+
+    std::vector<RigidBody*> owner{};
+    std::vector<Vector2> position{};
+    std::vector<Vector2> velocity{};
+    std::vector<Vector2> acceleration{};
+    std::vector<Vector2> force{};       //Accumulated force and impulse for the next step.
+    std::vector<float> orientation{};
+    std::vector<float> prev_orientation{};
+    std::vector<float> torque{};        //Accumulated torque and angular impulse for the next step.
+    std::vector<float> time_since_last_move{};
+    std::vector<float> sleep_time{};    //How long the body has been below the sleep thresholds.
+    std::vector<float> inverse_mass{};
+    std::vector<float> linear_damping{};
+    std::vector<float> angular_damping{};
+    std::vector<float> max_angular_speed{};
+    std::vector<std::uint8_t> flags{};
+    TimeUtils::FPSeconds dt{};
+
+protected:
+private:
+};
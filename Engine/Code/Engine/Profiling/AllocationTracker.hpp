@@ -3,7 +3,9 @@
 //C++17 - The Best Features - Nicolai Josuttis [ACCU 2018]
 
 #include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 
+#include <atomic>
 #include <format>
 #include <iostream>
 #include <new>
@@ -40,8 +42,34 @@ public:
         }
     };
 
+    struct job_pool_status_t {
+        std::size_t acquired = 0u;
+        std::size_t released = 0u;
+        std::size_t slabs = 0u;
+        std::size_t slab_bytes = 0u;
+        friend std::ostream& operator<<(std::ostream& os, [[maybe_unused]] const job_pool_status_t& s) noexcept {
+#ifdef TRACK_MEMORY
+            os << std::vformat("Job pool: {} acquired, {} released, {} slabs for {} bytes.\n", std::make_format_args(s.acquired, s.released, s.slabs, s.slab_bytes));
+#endif
+            return os;
+        }
+    };
+
+    struct frame_arena_status_t {
+        std::size_t high_water_bytes = 0u; //Most any one thread's frame arena used last frame.
+        std::size_t peak_bytes = 0u;       //Most any one thread's frame arena has used in a frame since tracking began.
+        std::size_t overflow_bytes = 0u;   //Total that spilled past an arena's block to the heap since tracking began.
+        friend std::ostream& operator<<(std::ostream& os, [[maybe_unused]] const frame_arena_status_t& s) noexcept {
+#ifdef TRACK_MEMORY
+            os << std::vformat("Frame arenas: {} bytes last frame, {} bytes peak, {} bytes overflowed.\n", std::make_format_args(s.high_water_bytes, s.peak_bytes, s.overflow_bytes));
+#endif
+            return os;
+        }
+    };
+
     [[nodiscard]] static void* allocate(std::size_t n) noexcept {
         if(is_enabled()) {
+            ++threadAllocCount;
             ++frameCount;
             frameSize += n;
             ++allocCount;
@@ -93,9 +121,15 @@ public:
     static void tick() noexcept {
 #ifdef TRACK_MEMORY
         if(is_enabled()) {
-            if(auto f = AllocationTracker::frame_status()) {
-                std::cout << f << '\n';
-            }
+            //Reported through Metrics rather than printed so a frame's numbers can be compared against the ones before it.
+            static auto& bytes_allocated = Metrics::GetCounter("memory.bytes_allocated");
+            static auto& allocations = Metrics::GetCounter("memory.allocations");
+            static auto& bytes_outstanding = Metrics::GetGauge("memory.bytes_outstanding");
+            static auto& frame_arena_bytes = Metrics::GetGauge("memory.frame_arena_high_water");
+            bytes_allocated.Add(frameSize);
+            allocations.Add(frameCount);
+            bytes_outstanding.Set(static_cast<double>(allocSize - freeSize));
+            frame_arena_bytes.Set(static_cast<double>(frameArenaHighWater.load(std::memory_order_relaxed)));
             ++frameCounter;
             resetframecounters();
         }
@@ -104,6 +138,7 @@ public:
 
     static void resetframecounters() noexcept {
 #ifdef TRACK_MEMORY
+        lastFrameArenaHighWater = frameArenaHighWater.exchange(0u, std::memory_order_relaxed);
         frameSize = 0u;
         frameCount = 0u;
         framefreeCount = 0u;
@@ -137,6 +172,54 @@ public:
         return {frameCounter, frameCount - framefreeCount, frameSize - framefreeSize};
     }
 
+    //Heap allocations made by the calling thread while tracking is enabled.
+    //Diff before and after a call to verify it does not allocate.
+    [[nodiscard]] static std::size_t thread_allocation_count() noexcept {
+        return threadAllocCount;
+    }
+
+    static void track_job_pool_acquire() noexcept {
+#ifdef TRACK_MEMORY
+        jobPoolAcquired.fetch_add(1u, std::memory_order_relaxed);
+#endif
+    }
+
+    static void track_job_pool_release() noexcept {
+#ifdef TRACK_MEMORY
+        jobPoolReleased.fetch_add(1u, std::memory_order_relaxed);
+#endif
+    }
+
+    static void track_job_pool_slab([[maybe_unused]] std::size_t bytes) noexcept {
+#ifdef TRACK_MEMORY
+        jobPoolSlabs.fetch_add(1u, std::memory_order_relaxed);
+        jobPoolSlabBytes.fetch_add(bytes, std::memory_order_relaxed);
+#endif
+    }
+
+    //Called by each thread's FrameArena as it resets, with what it used during the frame just ended.
+    static void track_frame_arena([[maybe_unused]] std::size_t used_bytes, [[maybe_unused]] std::size_t overflow_bytes) noexcept {
+#ifdef TRACK_MEMORY
+        const auto raise = [used_bytes](std::atomic<std::size_t>& value) {
+            auto current = value.load(std::memory_order_relaxed);
+            while(current < used_bytes && !value.compare_exchange_weak(current, used_bytes, std::memory_order_relaxed)) {
+                /* DO NOTHING */
+            }
+        };
+        raise(frameArenaHighWater);
+        raise(frameArenaPeak);
+        frameArenaOverflowBytes.fetch_add(overflow_bytes, std::memory_order_relaxed);
+#endif
+    }
+
+    [[nodiscard]] static frame_arena_status_t frame_arena_status() noexcept {
+        return {lastFrameArenaHighWater.load(std::memory_order_relaxed), frameArenaPeak.load(std::memory_order_relaxed), frameArenaOverflowBytes.load(std::memory_order_relaxed)};
+    }
+
+    [[nodiscard]] static job_pool_status_t job_pool_status() noexcept {
+        return {jobPoolAcquired.load(std::memory_order_relaxed), jobPoolReleased.load(std::memory_order_relaxed), jobPoolSlabs.load(std::memory_order_relaxed), jobPoolSlabBytes.load(std::memory_order_relaxed)};
+    }
+
     inline static std::size_t maxSize = 0u;
     inline static std::size_t maxCount = 0u;
     inline static std::size_t allocSize = 0u;
@@ -148,6 +231,15 @@ public:
     inline static std::size_t freeSize = 0u;
     inline static std::size_t framefreeCount = 0u;
     inline static std::size_t framefreeSize = 0u;
+    inline static thread_local std::size_t threadAllocCount = 0u;
+    inline static std::atomic<std::size_t> jobPoolAcquired = 0u;
+    inline static std::atomic<std::size_t> jobPoolReleased = 0u;
+    inline static std::atomic<std::size_t> jobPoolSlabs = 0u;
+    inline static std::atomic<std::size_t> jobPoolSlabBytes = 0u;
+    inline static std::atomic<std::size_t> frameArenaHighWater = 0u;
+    inline static std::atomic<std::size_t> lastFrameArenaHighWater = 0u;
+    inline static std::atomic<std::size_t> frameArenaPeak = 0u;
+    inline static std::atomic<std::size_t> frameArenaOverflowBytes = 0u;
 
 protected:
 private:
@@ -1,3 +1,245 @@
-/************************************************************************/
-/*                    INTENTIONALLY LEFT BLANK                          */
-/************************************************************************/
+#include "Engine/Profiling/Instrumentor.hpp"
+
+#include "Engine/Core/SpscRingBuffer.hpp"
+#include "Engine/Core/ThreadUtils.hpp"
+
+#include <array>
+#include <format>
+#include <iterator>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct TraceEvent {
+    const char* name{};
+    std::uint64_t start{};
+    std::uint64_t end{};
+};
+
+//Scopes a thread can record between flushes before new ones are dropped: 192 KiB per profiled thread.
+constexpr std::size_t events_per_thread = 8192u;
+constexpr auto flush_interval = std::chrono::milliseconds{50};
+
+unsigned int ToTraceThreadId(const std::jthread::id& id) noexcept {
+    std::ostringstream ss;
+    ss << id;
+    return static_cast<unsigned int>(std::stoull(ss.str()));
+}
+
+void AppendEscapedName(std::string& json, std::string_view name) noexcept {
+    for(const auto c : name) {
+        if(c == '"') {
+            json += '\'';
+        } else if(c == '\\') {
+            json += "\\\\";
+        } else {
+            json += c;
+        }
+    }
+}
+
+} // namespace
+
+struct Instrumentor::ThreadTrace {
+    SpscRingBuffer<TraceEvent> ring{events_per_thread};
+    std::atomic<std::uint64_t> dropped{0u};
+    unsigned long tid{ThreadUtils::GetThisThreadId()};
+};
+
+//Constant-initialized, so reading it needs no thread_local init guard.
+thread_local constinit Instrumentor::ThreadTrace* Instrumentor::s_thread_trace = nullptr;
+
+Instrumentor::~Instrumentor() noexcept {
+    EndSession();
+}
+
+Instrumentor& Instrumentor::Get() noexcept {
+    static Instrumentor instance;
+    return instance;
+}
+
+void Instrumentor::BeginSession(const std::string& name, const std::filesystem::path& filepath /*= "results.json"*/) noexcept {
+    EndSession();
+    m_OutputStream.open(filepath);
+    if(!m_OutputStream.is_open()) {
+        return;
+    }
+    WriteHeader();
+    m_CurrentSession = std::make_unique<InstrumentationSession>(name);
+    m_pid = ThreadUtils::GetProcessId();
+    m_session_start_time = std::chrono::steady_clock::now();
+    m_session_start_ticks = ReadTicks();
+    {
+        std::scoped_lock<std::mutex> lock(m_threads_cs);
+        m_dropped_reported = m_retired_dropped;
+        for(const auto& trace : m_threads) {
+            m_dropped_reported += trace->dropped.load(std::memory_order_relaxed);
+        }
+    }
+    s_active.store(this, std::memory_order_release);
+    m_flusher = std::jthread([this](std::stop_token stopToken) { FlushWorker(stopToken); });
+}
+
+void Instrumentor::EndSession() noexcept {
+    if(!m_OutputStream.is_open()) {
+        return;
+    }
+    s_active.store(nullptr, std::memory_order_release);
+    if(m_flusher.joinable()) {
+        m_flusher.request_stop();
+        m_flusher.join();
+    }
+    Flush();
+    WriteFooter();
+    m_OutputStream.close();
+    m_CurrentSession.reset();
+    m_ProfileCount = 0;
+}
+
+bool Instrumentor::IsSessionActive() const noexcept {
+    return GetActive() == this;
+}
+
+void Instrumentor::Record(const char* name, std::uint64_t startTicks, std::uint64_t endTicks) noexcept {
+    if(!IsSessionActive()) {
+        return;
+    }
+    auto& trace = GetThreadTrace();
+    if(!trace.ring.try_push(TraceEvent{name, startTicks, endTicks})) {
+        trace.dropped.fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+Instrumentor::ThreadTrace& Instrumentor::GetThreadTrace() noexcept {
+    if(s_thread_trace != nullptr) {
+        return *s_thread_trace;
+    }
+    //First scope on this thread. m_threads keeps a reference so scopes recorded just before the thread exits still reach the file.
+    thread_local std::shared_ptr<ThreadTrace> trace = [this] {
+        auto result = std::make_shared<ThreadTrace>();
+        std::scoped_lock<std::mutex> lock(m_threads_cs);
+        m_threads.push_back(result);
+        return result;
+    }();
+    s_thread_trace = trace.get();
+    return *trace;
+}
+
+void Instrumentor::FlushWorker(std::stop_token stopToken) noexcept {
+    while(!stopToken.stop_requested()) {
+        {
+            std::unique_lock<std::mutex> lock(m_flush_cs);
+            m_flush_signal.wait_for(lock, stopToken, flush_interval, [] { return false; });
+        }
+        Flush();
+    }
+}
+
+void Instrumentor::Flush() noexcept {
+    //Ticks to microseconds, calibrated over everything since BeginSession so the estimate sharpens as the session runs.
+    const auto now_ticks = ReadTicks();
+    const auto now_time = std::chrono::steady_clock::now();
+    const auto elapsed_us = std::chrono::duration<double, std::micro>(now_time - m_session_start_time).count();
+    const auto elapsed_ticks = now_ticks - m_session_start_ticks;
+    const auto us_per_tick = elapsed_ticks ? elapsed_us / static_cast<double>(elapsed_ticks) : 0.0;
+    const auto to_us = [&](std::uint64_t ticks) { return static_cast<double>(ticks - m_session_start_ticks) * us_per_tick; };
+
+    std::string json{};
+    std::size_t event_count = 0u;
+    std::uint64_t dropped = 0u;
+    std::array<TraceEvent, 512> batch{};
+    {
+        std::scoped_lock<std::mutex> lock(m_threads_cs);
+        dropped = m_retired_dropped;
+        for(const auto& trace : m_threads) {
+            while(const auto count = trace->ring.try_pop_n(batch)) {
+                json.reserve(json.size() + count * 160u);
+                for(std::size_t i = 0u; i < count; ++i) {
+                    const auto& event = batch[i];
+                    //Left over from a previous session by a scope that ended as that one was closing.
+                    if(event.start < m_session_start_ticks) {
+                        continue;
+                    }
+                    json += R"(,{"cat":"function","dur":)";
+                    std::format_to(std::back_inserter(json), "{:.3f}", static_cast<double>(event.end - event.start) * us_per_tick);
+                    json += R"(,"name":")";
+                    AppendEscapedName(json, event.name);
+                    std::format_to(std::back_inserter(json), R"(","ph":"X","pid":{},"tid":{},"ts":{:.3f}}})", m_pid, trace->tid, to_us(event.start));
+                    ++event_count;
+                }
+            }
+            dropped += trace->dropped.load(std::memory_order_relaxed);
+        }
+        std::erase_if(m_threads, [this](const std::shared_ptr<ThreadTrace>& trace) {
+            if(trace.use_count() != 1 || !trace->ring.empty()) {
+                return false;
+            }
+            m_retired_dropped += trace->dropped.load(std::memory_order_relaxed);
+            return true;
+        });
+    }
+    if(dropped > m_dropped_reported) {
+        std::format_to(std::back_inserter(json), R"(,{{"name":"dropped scopes","ph":"i","s":"g","pid":{},"tid":0,"ts":{:.3f},"args":{{"count":{}}}}})", m_pid, to_us(now_ticks), dropped - m_dropped_reported);
+        m_dropped_reported = dropped;
+        ++event_count;
+    }
+    if(json.empty()) {
+        return;
+    }
+    std::scoped_lock lock(m_cs);
+    //Every event was written with a leading comma; the first one in the file must not have it.
+    m_OutputStream << (m_ProfileCount == 0 ? std::string_view{json}.substr(1u) : std::string_view{json});
+    m_ProfileCount += static_cast<int>(event_count);
+}
+
+void Instrumentor::WriteSessionData(MetaDataCategory cat, const ProfileMetadata& data) noexcept {
+    if(!m_OutputStream.is_open()) {
+        return;
+    }
+    std::scoped_lock lock(m_cs);
+    if(m_ProfileCount++ > 0) {
+        m_OutputStream << ",";
+    }
+    const auto tid = ToTraceThreadId(data.threadID);
+    switch(cat) {
+    case MetaDataCategory::ProcessName:
+    {
+        constexpr auto fmt = R"({{"name": "process_name", "ph": "M", "pid": {}, "tid": {}, "args": {{ "name": "{}" }} }})";
+        m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.processName));
+        break;
+    }
+    case MetaDataCategory::ProcessLabels:
+        break;
+    case MetaDataCategory::ProcessSortIndex:
+    {
+        constexpr auto fmt = R"({{"name": "process_sort_index", "ph": "M", "pid": {}, "tid": {}, "args": {{ "sort_index": "{}" }} }})";
+        m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.processSortIndex));
+        break;
+    }
+    case MetaDataCategory::ThreadName:
+    {
+        constexpr auto fmt = R"({{"name": "thread_name", "ph": "M", "pid": {}, "tid": {}, "args": {{ "name": "{}" }} }})";
+        m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.threadName));
+        break;
+    }
+    case MetaDataCategory::ThreadSortIndex: {
+        constexpr auto fmt = R"({{"name": "thread_sort_index", "ph": "M", "pid": {}, "tid": {}, "args": {{ "sort_index": "{}" }} }})";
+        m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.threadSortIndex));
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void Instrumentor::WriteHeader() noexcept {
+    std::scoped_lock lock(m_cs);
+    m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
+}
+
+void Instrumentor::WriteFooter() noexcept {
+    std::scoped_lock lock(m_cs);
+    m_OutputStream << "]}";
+}
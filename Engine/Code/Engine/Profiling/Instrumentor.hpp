@@ -15,29 +15,23 @@
 #pragma once
 
 #include "Engine/Core/BuildConfig.hpp"
-#include "Engine/Core/StringUtils.hpp"
-#include "Engine/Core/ThreadUtils.hpp"
 
-#include "Engine/Platform/Win.hpp"
-
-#include <iostream>
-#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
-#include <format>
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <source_location>
 #include <string>
 #include <thread>
-#include <source_location>
+#include <vector>
 
-struct ProfileResult {
-    std::string Name;
-    long long Start;
-    long long End;
-    std::jthread::id ThreadID;
-};
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 struct ProfileMetadata {
     long long ProcessID{};
@@ -49,6 +43,7 @@ struct ProfileMetadata {
     std::string threadName{};
 };
 
+// clang-format off
 enum class MetaDataCategory {
     ProcessName
     ,ProcessLabels
@@ -56,159 +51,152 @@ enum class MetaDataCategory {
     ,ThreadName
     ,ThreadSortIndex
 };
+// clang-format on
 
 struct InstrumentationSession {
     std::string Name;
 };
 
+//Scopes are recorded as raw (name, start ticks, end ticks) into a ring owned by the recording thread; nothing is
+//formatted and no lock is taken on the hot path. A background thread drains the rings into the trace file while
+//the session runs and once more when it ends. Output is the Chrome trace event JSON format (chrome://tracing, Perfetto).
 class Instrumentor {
 public:
     Instrumentor() = default;
-    ~Instrumentor() {
-        EndSession();
-    }
+    Instrumentor(const Instrumentor& other) = delete;
+    Instrumentor(Instrumentor&& other) = delete;
+    Instrumentor& operator=(const Instrumentor& other) = delete;
+    Instrumentor& operator=(Instrumentor&& other) = delete;
+    ~Instrumentor() noexcept;
 
-    void BeginSession(const std::string& name, const std::filesystem::path& filepath = "results.json") {
-        m_OutputStream.open(filepath);
-        if(m_OutputStream.is_open()) {
-            WriteHeader();
-            m_CurrentSession = std::make_unique<InstrumentationSession>(name);
-        }
-    }
+    void BeginSession(const std::string& name, const std::filesystem::path& filepath = "results.json") noexcept;
+    void EndSession() noexcept;
 
-    void EndSession() {
-        if(m_OutputStream.is_open()) {
-            WriteFooter();
-            m_OutputStream.close();
-            m_CurrentSession.reset();
-            m_ProfileCount = 0;
-        }
-    }
+    void WriteSessionData(MetaDataCategory cat, const ProfileMetadata& data) noexcept;
 
-    void WriteSessionData(MetaDataCategory cat, const ProfileMetadata& data) {
-        if(!m_OutputStream.is_open()) {
-            return;
-        }
-        std::scoped_lock lock(m_cs);
-        if(m_ProfileCount++ > 0) {
-            m_OutputStream << ",";
-        }
-        switch(cat) {
-        case MetaDataCategory::ProcessName:
-        {
-            constexpr auto fmt = R"({{"name": "process_name", "ph": "M", "pid": {}, "tid": {}, "args": {{ "name": "{}" }} }})";
-            const auto tid = [&data]() -> unsigned int { std::ostringstream ss; ss << data.threadID; return static_cast<unsigned int>(std::stoull(ss.str())); }();
-            m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.processName));
-            break;
-        }
-        case MetaDataCategory::ProcessLabels:
-            break;
-        case MetaDataCategory::ProcessSortIndex:
-        {
-            constexpr auto fmt = R"({{"name": "process_sort_index", "ph": "M", "pid": {}, "tid": {}, "args": {{ "sort_index": "{}" }} }})";
-            const auto tid = [&data]() -> unsigned int { std::ostringstream ss; ss << data.threadID; return static_cast<unsigned int>(std::stoull(ss.str())); }();
-            m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.processSortIndex));
-            break;
-        }
-        case MetaDataCategory::ThreadName:
-        {
-            constexpr auto fmt = R"({{"name": "thread_name", "ph": "M", "pid": {}, "tid": {}, "args": {{ "name": "{}" }} }})";
-            const auto tid = [&data]() -> unsigned int { std::ostringstream ss; ss << data.threadID; return static_cast<unsigned int>(std::stoull(ss.str())); }();
-            m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.threadName));
-            break;
-        }
-        case MetaDataCategory::ThreadSortIndex: {
-            constexpr auto fmt = R"({{"name": "thread_sort_index", "ph": "M", "pid": {}, "tid": {}, "args": {{ "sort_index": "{}" }} }})";
-            const auto tid = [&data]() -> unsigned int { std::ostringstream ss; ss << data.threadID; return static_cast<unsigned int>(std::stoull(ss.str())); }();
-            m_OutputStream << std::vformat(fmt, std::make_format_args(data.ProcessID, tid, data.threadSortIndex));
-            break;
-        }
-        default:
-            break;
-        }
-    }
+    //name must outlive the session: a string literal or std::source_location::function_name().
+    void Record(const char* name, std::uint64_t startTicks, std::uint64_t endTicks) noexcept;
+    [[nodiscard]] bool IsSessionActive() const noexcept;
 
-    void WriteProfile(const ProfileResult& result) {
-        if(!m_OutputStream.is_open()) {
-            return;
-        }
-        std::scoped_lock lock(m_cs);
-        if(m_ProfileCount++ > 0)
-            m_OutputStream << ",";
-
-        std::string name = result.Name;
-        const auto tid = [result]() -> unsigned int { std::ostringstream ss; ss << result.ThreadID; return static_cast<unsigned int>(std::stoull(ss.str())); }();
-        std::replace(std::begin(name), std::end(name), '"', '\'');
-        constexpr auto fmt = R"({{"cat":"function","dur":{},"name":"{:s}","ph":"X","pid": {},"tid":{},"ts":{}}})";
-        const auto duration = result.End - result.Start;
-        const auto pid = ThreadUtils::GetProcessId();
-        m_OutputStream << std::vformat(fmt, std::make_format_args(
-                                            duration,
-                                            name,
-                                            pid,
-                                            tid,
-                                            result.Start));
-    }
+    //Invariant TSC where available, steady_clock nanoseconds otherwise. Converted to time at flush.
+    [[nodiscard]] static std::uint64_t ReadTicks() noexcept;
 
-    void WriteHeader() {
-        std::scoped_lock lock(m_cs);
-        m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
-    }
+    static Instrumentor& Get() noexcept;
+    //The instrumentor with a session running, or nullptr. A plain load, unlike Get's guarded static.
+    [[nodiscard]] static Instrumentor* GetActive() noexcept;
 
-    void WriteFooter() {
-        std::scoped_lock lock(m_cs);
-        m_OutputStream << "]}";
-    }
+private:
+    struct ThreadTrace;
 
-    static Instrumentor& Get() {
-        static Instrumentor instance;
-        return instance;
-    }
+    void FlushWorker(std::stop_token stopToken) noexcept;
+    void Flush() noexcept;
+    void WriteHeader() noexcept;
+    void WriteFooter() noexcept;
+    [[nodiscard]] ThreadTrace& GetThreadTrace() noexcept;
+
+    static constinit inline std::atomic<Instrumentor*> s_active{nullptr};
+    static thread_local ThreadTrace* s_thread_trace;
 
-private:
     std::unique_ptr<InstrumentationSession> m_CurrentSession{nullptr};
     std::ofstream m_OutputStream{};
     mutable std::mutex m_cs{};
+    std::mutex m_flush_cs{};
+    std::condition_variable_any m_flush_signal{};
+    std::jthread m_flusher{};
+    //Every thread that has recorded a scope. Owned here, not in a function-local static, so it outlives EndSession in the destructor.
+    std::mutex m_threads_cs{};
+    std::vector<std::shared_ptr<ThreadTrace>> m_threads{};
+    std::uint64_t m_retired_dropped{0u};
+    std::uint64_t m_session_start_ticks{0u};
+    std::chrono::steady_clock::time_point m_session_start_time{};
+    std::uint64_t m_dropped_reported{0u};
+    unsigned long m_pid{0ul};
     int m_ProfileCount{0};
 };
 
-class InstrumentationTimer {
+//Only the pointer is recorded, so the name has to live as long as the program. The constructor is consteval:
+//a string literal is accepted, while std::string::c_str() or a local buffer fails to compile.
+class ScopeName {
 public:
-    InstrumentationTimer(const char* name, std::source_location location = std::source_location::current())
-    : m_Name(name == nullptr ? location.function_name() : name)
-    , m_StartTimepoint(std::chrono::steady_clock::now())
+    consteval ScopeName(const char* name) noexcept
+    : m_name(name)
     {
         /* DO NOTHING */
     }
 
-    ~InstrumentationTimer() {
-        Stop();
+    [[nodiscard]] constexpr const char* Get() const noexcept {
+        return m_name;
     }
 
-    void Stop() {
-        auto endTimepoint = std::chrono::steady_clock::now();
+private:
+    const char* m_name{};
+};
+
+class InstrumentationTimer {
+public:
+    //Named after the enclosing function.
+    explicit InstrumentationTimer(std::source_location location = std::source_location::current()) noexcept
+    : InstrumentationTimer(location.function_name(), Instrumentor::GetActive())
+    {
+        /* DO NOTHING */
+    }
+
+    explicit InstrumentationTimer(ScopeName name) noexcept
+    : InstrumentationTimer(name.Get(), Instrumentor::GetActive())
+    {
+        /* DO NOTHING */
+    }
 
-        long long start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
-        long long end = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch().count();
+    ~InstrumentationTimer() noexcept {
+        Stop();
+    }
 
-        Instrumentor::Get().WriteProfile({m_Name, start, end, std::this_thread::get_id()});
+    void Stop() noexcept {
+        if(m_Instrumentor) {
+            m_Instrumentor->Record(m_Name, m_StartTicks, Instrumentor::ReadTicks());
+            m_Instrumentor = nullptr;
+        }
     }
 
 private:
+    //Without a session the counter is never read, so an idle scope costs one load.
+    InstrumentationTimer(const char* name, Instrumentor* instrumentor) noexcept
+    : m_Instrumentor(instrumentor)
+    , m_Name(name)
+    , m_StartTicks(instrumentor ? Instrumentor::ReadTicks() : 0u)
+    {
+        /* DO NOTHING */
+    }
+
+    Instrumentor* m_Instrumentor;
     const char* m_Name;
-    std::chrono::time_point<std::chrono::steady_clock> m_StartTimepoint;
+    std::uint64_t m_StartTicks;
 };
 
+inline Instrumentor* Instrumentor::GetActive() noexcept {
+    return s_active.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t Instrumentor::ReadTicks() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
 #ifdef PROFILE_BUILD
 
 #define PROFILE_BENCHMARK_BEGIN(name, filepath) Instrumentor::Get().BeginSession(name, filepath)
 #define PROFILE_BENCHMARK_END() Instrumentor::Get().EndSession()
 #define PROFILE_BENCHMARK_SCOPE(name) InstrumentationTimer TOKEN_PASTE(timer,__LINE__)(name)
-#define PROFILE_BENCHMARK_FUNCTION() PROFILE_BENCHMARK_SCOPE(nullptr)
+#define PROFILE_BENCHMARK_FUNCTION() InstrumentationTimer TOKEN_PASTE(timer,__LINE__){}
 
 #else
 
-#define PROFILE_BENCHMARK_BEGIN(name)
+#define PROFILE_BENCHMARK_BEGIN(name, filepath)
 #define PROFILE_BENCHMARK_END()
 #define PROFILE_BENCHMARK_SCOPE(name)
 #define PROFILE_BENCHMARK_FUNCTION()
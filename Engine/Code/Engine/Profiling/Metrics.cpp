@@ -0,0 +1,430 @@
+#include "Engine/Profiling/Metrics.hpp"
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <format>
+#include <fstream>
+#include <mutex>
+
+namespace {
+
+struct MetricsColumn {
+    std::string name{};
+    MetricKind kind{MetricKind::Counter};
+    std::size_t index{0u};
+    std::uint64_t last_total{0u}; //Counter total or histogram count at the previous snapshot.
+    std::uint64_t last_sum{0u}; //Histogram sum at the previous snapshot.
+    std::vector<std::uint64_t> last_buckets{}; //Histogram bucket counts at the previous snapshot, allocated on first use.
+};
+
+//How much one histogram bucket grew during a frame.
+struct MetricsBucketDelta {
+    std::uint32_t column{0u};
+    std::uint32_t bucket{0u};
+    std::uint64_t count{0u};
+};
+
+struct MetricsFrame {
+    std::uint64_t frame_id{0u};
+    //One per column that existed when the frame ended; metrics registered later are missing from older frames.
+    std::vector<double> values{};
+    //Histograms only: the buckets that grew and the sum of the values that arrived, so a window of frames can be
+    //summarized without keeping every histogram's full bucket array per frame.
+    std::vector<MetricsBucketDelta> bucket_deltas{};
+    std::vector<std::uint64_t> histogram_sums{};
+};
+
+struct MetricsRegistry {
+    MetricsRegistry() noexcept {
+        frame_time = &gauges.emplace_back();
+        columns.push_back(MetricsColumn{"frame.ms", MetricKind::Gauge, 0u, 0u});
+    }
+
+    std::mutex cs{};
+    //Deques so references handed out stay put as more metrics are registered.
+    std::deque<MetricsCounter> counters{};
+    std::deque<MetricsGauge> gauges{};
+    std::deque<MetricsHistogram> histograms{};
+    std::vector<MetricsColumn> columns{};
+    std::vector<MetricsFrame> history = std::vector<MetricsFrame>(Metrics::history_capacity);
+    std::size_t history_next{0u};
+    std::size_t history_size{0u};
+    std::uint64_t frame_id{0u};
+    MetricsGauge* frame_time{nullptr};
+    std::chrono::steady_clock::time_point last_frame_end{};
+    bool has_last_frame_end{false};
+};
+
+MetricsRegistry& GetMetricsRegistry() noexcept {
+    static MetricsRegistry registry{};
+    return registry;
+}
+
+template<typename T>
+T& FindOrAdd(std::deque<T>& store, MetricKind kind, std::string_view name) noexcept {
+    auto& registry = GetMetricsRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    const auto found = std::find_if(std::cbegin(registry.columns), std::cend(registry.columns), [kind, name](const MetricsColumn& column) { return column.kind == kind && column.name == name; });
+    if(found != std::cend(registry.columns)) {
+        return store[found->index];
+    }
+    auto& result = store.emplace_back();
+    registry.columns.push_back(MetricsColumn{std::string{name}, kind, store.size() - 1u, 0u});
+    return result;
+}
+
+//Same walk as MetricsHistogram::GetValueAtPercentile, over buckets summed from a window of frames.
+double PercentileOfBuckets(const std::vector<std::uint64_t>& buckets, std::uint64_t total, double percentile) noexcept {
+    if(!total) {
+        return 0.0;
+    }
+    const auto target = (std::max)(std::uint64_t{1u}, static_cast<std::uint64_t>(std::ceil((std::clamp)(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(total))));
+    std::uint64_t seen = 0u;
+    for(std::size_t i = 0u; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if(seen >= target) {
+            const auto lowest = MetricsHistogram::GetBucketLowestValue(i);
+            return static_cast<double>(lowest + (MetricsHistogram::GetBucketHighestValue(i) - lowest) / 2u);
+        }
+    }
+    return 0.0;
+}
+
+//Nearest-rank percentile of an already sorted range.
+double PercentileOfSorted(const std::vector<double>& sorted, double percentile) noexcept {
+    if(sorted.empty()) {
+        return 0.0;
+    }
+    const auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[(std::clamp)(rank, std::size_t{1u}, sorted.size()) - 1u];
+}
+
+std::string QuoteCsv(std::string_view text) noexcept {
+    if(text.find_first_of(",\"\n") == std::string_view::npos) {
+        return std::string{text};
+    }
+    std::string result{"\""};
+    for(const auto c : text) {
+        if(c == '"') {
+            result += '"';
+        }
+        result += c;
+    }
+    result += '"';
+    return result;
+}
+
+} // namespace
+
+void MetricsCounter::Add(std::uint64_t amount /*= 1u*/) noexcept {
+    m_value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+std::uint64_t MetricsCounter::Get() const noexcept {
+    return m_value.load(std::memory_order_relaxed);
+}
+
+void MetricsGauge::Set(double value) noexcept {
+    m_value.store(value, std::memory_order_relaxed);
+}
+
+double MetricsGauge::Get() const noexcept {
+    return m_value.load(std::memory_order_relaxed);
+}
+
+void MetricsHistogram::Record(std::uint64_t value) noexcept {
+    m_buckets[GetBucketIndex(value)].fetch_add(1u, std::memory_order_relaxed);
+    m_count.fetch_add(1u, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    auto current = m_max.load(std::memory_order_relaxed);
+    while(current < value && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        /* DO NOTHING */
+    }
+}
+
+void MetricsHistogram::Reset() noexcept {
+    for(auto& bucket : m_buckets) {
+        bucket.store(0u, std::memory_order_relaxed);
+    }
+    m_count.store(0u, std::memory_order_relaxed);
+    m_sum.store(0u, std::memory_order_relaxed);
+    m_max.store(0u, std::memory_order_relaxed);
+}
+
+std::uint64_t MetricsHistogram::GetCount() const noexcept {
+    return m_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t MetricsHistogram::GetSum() const noexcept {
+    return m_sum.load(std::memory_order_relaxed);
+}
+
+std::uint64_t MetricsHistogram::GetMax() const noexcept {
+    return m_max.load(std::memory_order_relaxed);
+}
+
+std::uint64_t MetricsHistogram::GetBucketCount(std::size_t index) const noexcept {
+    return m_buckets[index].load(std::memory_order_relaxed);
+}
+
+double MetricsHistogram::GetMean() const noexcept {
+    const auto count = GetCount();
+    return count ? static_cast<double>(m_sum.load(std::memory_order_relaxed)) / static_cast<double>(count) : 0.0;
+}
+
+std::uint64_t MetricsHistogram::GetValueAtPercentile(double percentile) const noexcept {
+    //Totals the buckets rather than trusting m_count so a Record landing mid-walk cannot leave the target unreachable.
+    std::uint64_t total = 0u;
+    for(const auto& bucket : m_buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if(!total) {
+        return 0u;
+    }
+    const auto target = (std::max)(std::uint64_t{1u}, static_cast<std::uint64_t>(std::ceil((std::clamp)(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(total))));
+    std::uint64_t seen = 0u;
+    for(std::size_t i = 0u; i < bucket_count; ++i) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if(seen >= target) {
+            const auto lowest = GetBucketLowestValue(i);
+            const auto middle = lowest + (GetBucketHighestValue(i) - lowest) / 2u;
+            return (std::min)(middle, GetMax());
+        }
+    }
+    return GetMax();
+}
+
+std::size_t MetricsHistogram::GetBucketIndex(std::uint64_t value) noexcept {
+    //Below two full octaves every value has its own bucket.
+    if(value < 2u * sub_bucket_count) {
+        return static_cast<std::size_t>(value);
+    }
+    const auto shift = static_cast<unsigned int>(std::bit_width(value)) - (sub_bucket_bits + 1u);
+    return (shift + 1u) * sub_bucket_count + static_cast<std::size_t>((value >> shift) - sub_bucket_count);
+}
+
+std::uint64_t MetricsHistogram::GetBucketLowestValue(std::size_t index) noexcept {
+    if(index < 2u * sub_bucket_count) {
+        return index;
+    }
+    const auto shift = index / sub_bucket_count - 1u;
+    const auto mantissa = static_cast<std::uint64_t>(index % sub_bucket_count + sub_bucket_count);
+    return mantissa << shift;
+}
+
+std::uint64_t MetricsHistogram::GetBucketHighestValue(std::size_t index) noexcept {
+    if(index < 2u * sub_bucket_count) {
+        return index;
+    }
+    const auto shift = index / sub_bucket_count - 1u;
+    return GetBucketLowestValue(index) + ((std::uint64_t{1u} << shift) - 1u);
+}
+
+MetricsCounter& Metrics::GetCounter(std::string_view name) noexcept {
+    return FindOrAdd(GetMetricsRegistry().counters, MetricKind::Counter, name);
+}
+
+MetricsGauge& Metrics::GetGauge(std::string_view name) noexcept {
+    return FindOrAdd(GetMetricsRegistry().gauges, MetricKind::Gauge, name);
+}
+
+MetricsHistogram& Metrics::GetHistogram(std::string_view name) noexcept {
+    return FindOrAdd(GetMetricsRegistry().histograms, MetricKind::Histogram, name);
+}
+
+void Metrics::EndFrame() noexcept {
+    auto& registry = GetMetricsRegistry();
+    const auto now = TimeUtils::Now();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    //The first call only starts the clock; everything reported so far lands in the next frame.
+    if(!registry.has_last_frame_end) {
+        registry.has_last_frame_end = true;
+        registry.last_frame_end = now;
+        return;
+    }
+    registry.frame_time->Set(std::chrono::duration<double, std::milli>(now - registry.last_frame_end).count());
+    registry.last_frame_end = now;
+
+    auto& frame = registry.history[registry.history_next];
+    frame.frame_id = registry.frame_id++;
+    frame.values.resize(registry.columns.size());
+    frame.bucket_deltas.clear();
+    frame.histogram_sums.assign(registry.columns.size(), 0u);
+    for(std::size_t i = 0u; i < registry.columns.size(); ++i) {
+        auto& column = registry.columns[i];
+        switch(column.kind) {
+        case MetricKind::Counter:
+        {
+            const auto total = registry.counters[column.index].Get();
+            frame.values[i] = static_cast<double>(total - column.last_total);
+            column.last_total = total;
+            break;
+        }
+        case MetricKind::Gauge:
+            frame.values[i] = registry.gauges[column.index].Get();
+            break;
+        case MetricKind::Histogram:
+        {
+            const auto& histogram = registry.histograms[column.index];
+            const auto total = histogram.GetCount();
+            frame.values[i] = 0.0;
+            //Nothing arrived: skip the bucket scan. A value recorded as the count was read shows up next frame.
+            if(total == column.last_total) {
+                break;
+            }
+            column.last_buckets.resize(MetricsHistogram::bucket_count);
+            std::uint64_t arrived = 0u;
+            for(std::size_t b = 0u; b < MetricsHistogram::bucket_count; ++b) {
+                const auto count = histogram.GetBucketCount(b);
+                if(const auto grown = count - column.last_buckets[b]) {
+                    frame.bucket_deltas.push_back(MetricsBucketDelta{static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(b), grown});
+                    column.last_buckets[b] = count;
+                    arrived += grown;
+                }
+            }
+            const auto sum = histogram.GetSum();
+            frame.values[i] = static_cast<double>(arrived);
+            frame.histogram_sums[i] = sum - column.last_sum;
+            column.last_sum = sum;
+            column.last_total = total;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    registry.history_next = (registry.history_next + 1u) % history_capacity;
+    registry.history_size = (std::min)(registry.history_size + 1u, history_capacity);
+}
+
+void Metrics::Reset() noexcept {
+    auto& registry = GetMetricsRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    registry.history_next = 0u;
+    registry.history_size = 0u;
+    for(auto& histogram : registry.histograms) {
+        histogram.Reset();
+    }
+    for(auto& column : registry.columns) {
+        if(column.kind == MetricKind::Histogram) {
+            column.last_total = 0u;
+            column.last_sum = 0u;
+            column.last_buckets.clear();
+        }
+    }
+}
+
+std::size_t Metrics::GetHistorySize() noexcept {
+    auto& registry = GetMetricsRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    return registry.history_size;
+}
+
+std::vector<MetricsSummary> Metrics::Summarize(std::size_t frame_count) noexcept {
+    auto& registry = GetMetricsRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    const auto count = (std::min)(frame_count, registry.history_size);
+    const auto first = (registry.history_next + history_capacity - count) % history_capacity;
+
+    std::vector<MetricsSummary> result{};
+    result.reserve(registry.columns.size());
+    std::vector<double> values{};
+    values.reserve(count);
+    std::vector<std::uint64_t> buckets{};
+    for(std::size_t i = 0u; i < registry.columns.size(); ++i) {
+        const auto& column = registry.columns[i];
+        auto& summary = result.emplace_back();
+        summary.name = column.name;
+        summary.kind = column.kind;
+        if(column.kind == MetricKind::Histogram) {
+            buckets.assign(MetricsHistogram::bucket_count, 0u);
+            std::uint64_t total = 0u;
+            std::uint64_t sum = 0u;
+            for(std::size_t f = 0u; f < count; ++f) {
+                const auto& frame = registry.history[(first + f) % history_capacity];
+                for(const auto& delta : frame.bucket_deltas) {
+                    if(delta.column == i) {
+                        buckets[delta.bucket] += delta.count;
+                        total += delta.count;
+                    }
+                }
+                if(i < frame.histogram_sums.size()) {
+                    sum += frame.histogram_sums[i];
+                }
+            }
+            if(!total) {
+                continue;
+            }
+            //Bucket midpoints, so the top value is only known to within its bucket; the lifetime max bounds it.
+            auto highest = buckets.size() - 1u;
+            while(!buckets[highest]) {
+                --highest;
+            }
+            const auto max = static_cast<double>((std::min)(MetricsHistogram::GetBucketHighestValue(highest), registry.histograms[column.index].GetMax()));
+            summary.samples = static_cast<std::size_t>(total);
+            summary.p50 = (std::min)(PercentileOfBuckets(buckets, total, 50.0), max);
+            summary.p95 = (std::min)(PercentileOfBuckets(buckets, total, 95.0), max);
+            summary.p99 = (std::min)(PercentileOfBuckets(buckets, total, 99.0), max);
+            summary.max = max;
+            summary.mean = static_cast<double>(sum) / static_cast<double>(total);
+            continue;
+        }
+        values.clear();
+        for(std::size_t f = 0u; f < count; ++f) {
+            const auto& frame = registry.history[(first + f) % history_capacity];
+            if(i < frame.values.size()) {
+                values.push_back(frame.values[i]);
+            }
+        }
+        if(values.empty()) {
+            continue;
+        }
+        std::sort(std::begin(values), std::end(values));
+        summary.samples = values.size();
+        summary.p50 = PercentileOfSorted(values, 50.0);
+        summary.p95 = PercentileOfSorted(values, 95.0);
+        summary.p99 = PercentileOfSorted(values, 99.0);
+        summary.max = values.back();
+        double sum = 0.0;
+        for(const auto value : values) {
+            sum += value;
+        }
+        summary.mean = sum / static_cast<double>(values.size());
+    }
+    return result;
+}
+
+bool Metrics::WriteCsv(const std::filesystem::path& path, std::size_t frame_count) noexcept {
+    auto& registry = GetMetricsRegistry();
+    std::scoped_lock<std::mutex> lock(registry.cs);
+    std::ofstream ofs{path};
+    if(!ofs) {
+        return false;
+    }
+    ofs << "frame";
+    for(const auto& column : registry.columns) {
+        ofs << ',' << QuoteCsv(column.name);
+    }
+    ofs << '\n';
+    const auto count = (std::min)(frame_count, registry.history_size);
+    const auto first = (registry.history_next + history_capacity - count) % history_capacity;
+    std::string row{};
+    for(std::size_t f = 0u; f < count; ++f) {
+        const auto& frame = registry.history[(first + f) % history_capacity];
+        row = std::format("{}", frame.frame_id);
+        for(std::size_t i = 0u; i < registry.columns.size(); ++i) {
+            row += ',';
+            if(i < frame.values.size()) {
+                row += std::format("{}", frame.values[i]);
+            }
+        }
+        row += '\n';
+        ofs << row;
+    }
+    return static_cast<bool>(ofs);
+}
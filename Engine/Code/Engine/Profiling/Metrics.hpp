@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//Named runtime metrics. Engine systems look a metric up once, keep the reference and update it from any thread
+//with a single relaxed atomic; nothing on the update path locks or allocates.
+//Usage:
+//  static auto& draw_calls = Metrics::GetCounter("renderer.draw_calls");
+//  draw_calls.Add();
+//Metrics::EndFrame snapshots every metric into a ring of recent frames; the "metrics" console command
+//summarizes that ring and exports it as CSV.
+
+// clang-format off
+enum class MetricKind : std::uint8_t {
+    Counter
+    ,Gauge
+    ,Histogram
+};
+// clang-format on
+
+//Monotonic total. Snapshots record how much it grew during each frame.
+class MetricsCounter {
+public:
+    void Add(std::uint64_t amount = 1u) noexcept;
+    [[nodiscard]] std::uint64_t Get() const noexcept;
+
+protected:
+private:
+    alignas(64) std::atomic<std::uint64_t> m_value{0u};
+};
+
+//Last value set. Snapshots record whatever it holds when the frame ends.
+class MetricsGauge {
+public:
+    void Set(double value) noexcept;
+    [[nodiscard]] double Get() const noexcept;
+
+protected:
+private:
+    alignas(64) std::atomic<double> m_value{0.0};
+};
+
+//Log-linear bucketed distribution in the style of HdrHistogram: each power of two is split into 32 equal
+//sub-buckets, so any recorded value is reported within about 3% of itself, from 0 to the full 64-bit range,
+//in a fixed 1920 counters. Snapshots keep the buckets that grew during each frame, so percentiles can be taken
+//over recent frames as well as over everything recorded since the last Reset.
+class MetricsHistogram {
+public:
+    static constexpr unsigned int sub_bucket_bits = 5u;
+    static constexpr std::size_t sub_bucket_count = std::size_t{1u} << sub_bucket_bits;
+    static constexpr std::size_t bucket_count = (64u - sub_bucket_bits + 1u) * sub_bucket_count;
+
+    void Record(std::uint64_t value) noexcept;
+    void Reset() noexcept;
+
+    [[nodiscard]] std::uint64_t GetCount() const noexcept;
+    [[nodiscard]] std::uint64_t GetSum() const noexcept;
+    [[nodiscard]] std::uint64_t GetMax() const noexcept;
+    [[nodiscard]] std::uint64_t GetBucketCount(std::size_t index) const noexcept;
+    [[nodiscard]] double GetMean() const noexcept;
+    //percentile is 0 to 100. Returns the middle of the bucket the percentile falls in.
+    [[nodiscard]] std::uint64_t GetValueAtPercentile(double percentile) const noexcept;
+
+    [[nodiscard]] static std::size_t GetBucketIndex(std::uint64_t value) noexcept;
+    [[nodiscard]] static std::uint64_t GetBucketLowestValue(std::size_t index) noexcept;
+    [[nodiscard]] static std::uint64_t GetBucketHighestValue(std::size_t index) noexcept;
+
+protected:
+private:
+    std::array<std::atomic<std::uint64_t>, bucket_count> m_buckets{};
+    alignas(64) std::atomic<std::uint64_t> m_count{0u};
+    std::atomic<std::uint64_t> m_sum{0u};
+    std::atomic<std::uint64_t> m_max{0u};
+};
+
+struct MetricsSummary {
+    std::string name{};
+    MetricKind kind{MetricKind::Counter};
+    std::size_t samples{0u};
+    double p50{0.0};
+    double p95{0.0};
+    double p99{0.0};
+    double max{0.0};
+    double mean{0.0};
+};
+
+class Metrics {
+public:
+    //Frames of snapshots kept for Summarize and WriteCsv.
+    static constexpr std::size_t history_capacity = 1024u;
+
+    //Each returns the metric registered under name, creating it the first time. The reference stays valid for the
+    //life of the program. Takes a lock; look metrics up once and keep the reference.
+    [[nodiscard]] static MetricsCounter& GetCounter(std::string_view name) noexcept;
+    [[nodiscard]] static MetricsGauge& GetGauge(std::string_view name) noexcept;
+    [[nodiscard]] static MetricsHistogram& GetHistogram(std::string_view name) noexcept;
+
+    //Call once per frame from the main thread after everything that frame has reported in. Also records "frame.ms".
+    static void EndFrame() noexcept;
+    //Clears the snapshot ring and every histogram. Counter totals and gauge values are kept.
+    static void Reset() noexcept;
+
+    [[nodiscard]] static std::size_t GetHistorySize() noexcept;
+    //Counters and gauges: percentiles of their per-frame values over the most recent frame_count frames.
+    //Histograms: percentiles of the values recorded during those frames; samples is how many there were.
+    [[nodiscard]] static std::vector<MetricsSummary> Summarize(std::size_t frame_count) noexcept;
+    //One row per frame, oldest first, one column per metric.
+    [[nodiscard]] static bool WriteCsv(const std::filesystem::path& path, std::size_t frame_count) noexcept;
+
+protected:
+private:
+};
@@ -1,20 +1,22 @@
 #include "Engine/Profiling/ProfileLogScope.hpp"
 
-#include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/TimeUtils.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 
 #include <format>
 
-ProfileLogScope::ProfileLogScope(const char* scopeName, std::source_location location) noexcept
-: m_scope_name(scopeName)
+ProfileLogScope::ProfileLogScope(MetricsHistogram& histogram) noexcept
+: m_histogram(&histogram)
 , m_time_at_creation(TimeUtils::Now())
-, m_location(location)
 {
     /* DO NOTHING */
 }
 
 ProfileLogScope::~ProfileLogScope() noexcept {
-    const auto now = TimeUtils::Now();
-    TimeUtils::FPMilliseconds elapsedTime = (now - m_time_at_creation);
-    DebuggerPrintf(std::format("ProfileLogScope {} in file {} on line {} took {:.2f} milliseconds.\n", m_scope_name != nullptr ? m_scope_name : m_location.function_name(), m_location.file_name(), m_location.line(), elapsedTime.count()));
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(TimeUtils::Now() - m_time_at_creation);
+    m_histogram->Record(static_cast<std::uint64_t>(elapsed.count()));
+}
+
+MetricsHistogram& ProfileLogScope::GetHistogram(const char* scopeName /*= nullptr*/, std::source_location location /*= std::source_location::current()*/) noexcept {
+    return Metrics::GetHistogram(std::format("{} [ns]", scopeName != nullptr ? scopeName : location.function_name()));
 }
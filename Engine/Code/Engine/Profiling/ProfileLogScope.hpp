@@ -5,9 +5,13 @@
 #include <chrono>
 #include <source_location>
 
+class MetricsHistogram;
+
+//Times a scope into a nanosecond histogram named after it, "<scope name> [ns]", instead of printing every pass.
+//See the "metrics" console command for the percentiles.
 class ProfileLogScope {
 public:
-    explicit ProfileLogScope(const char* scopeName = nullptr, std::source_location location = std::source_location::current()) noexcept;
+    explicit ProfileLogScope(MetricsHistogram& histogram) noexcept;
     ~ProfileLogScope() noexcept;
 
     ProfileLogScope() = delete;
@@ -16,13 +20,15 @@ public:
     ProfileLogScope& operator=(const ProfileLogScope&) = delete;
     ProfileLogScope& operator=(ProfileLogScope&&) = delete;
 
+    //Looks up the scope's histogram. The macros call this once per call site.
+    [[nodiscard]] static MetricsHistogram& GetHistogram(const char* scopeName = nullptr, std::source_location location = std::source_location::current()) noexcept;
+
 protected:
 private:
     using time_point_t = std::chrono::time_point<std::chrono::steady_clock>;
 
-    const char* m_scope_name = nullptr;
+    MetricsHistogram* m_histogram = nullptr;
     time_point_t m_time_at_creation{};
-    std::source_location m_location{};
 };
 
 #if defined PROFILE_LOG_SCOPE || defined PROFILE_LOG_SCOPE_FUNCTION
@@ -30,8 +36,8 @@ private:
     #undef PROFILE_LOG_SCOPE_FUNCTION
 #endif
 #ifdef PROFILE_BUILD
-    #define PROFILE_LOG_SCOPE(tag_str) auto TOKEN_PASTE(plscope_, __LINE__) = ProfileLogScope{tag_str}
-    #define PROFILE_LOG_SCOPE_FUNCTION() auto TOKEN_PASTE(plscope_, __LINE__) = ProfileLogScope{nullptr}
+    #define PROFILE_LOG_SCOPE(tag_str) static auto& TOKEN_PASTE(plhistogram_, __LINE__) = ProfileLogScope::GetHistogram(tag_str); auto TOKEN_PASTE(plscope_, __LINE__) = ProfileLogScope{TOKEN_PASTE(plhistogram_, __LINE__)}
+    #define PROFILE_LOG_SCOPE_FUNCTION() static auto& TOKEN_PASTE(plhistogram_, __LINE__) = ProfileLogScope::GetHistogram(nullptr); auto TOKEN_PASTE(plscope_, __LINE__) = ProfileLogScope{TOKEN_PASTE(plhistogram_, __LINE__)}
 #else
     #define PROFILE_LOG_SCOPE(tag_str)
     #define PROFILE_LOG_SCOPE_FUNCTION()
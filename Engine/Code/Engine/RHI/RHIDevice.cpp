@@ -561,13 +561,16 @@ std::unique_ptr<InputLayout> RHIDevice::CreateInputLayoutFromByteCode(RHIDevice&
     return il;
 }
 
-std::unique_ptr<InputLayoutInstanced> RHIDevice::CreateInputLayoutInstancedFromByteCode(RHIDevice& device, ID3DBlob* vs_bytecode) noexcept {
-    ID3D11ShaderReflection* vertexReflection = nullptr;
-    if(FAILED(::D3DReflect(vs_bytecode->GetBufferPointer(), vs_bytecode->GetBufferSize(), IID_ID3D11ShaderReflection, (void**)&vertexReflection))) {
-        return nullptr;
-    }
+std::unique_ptr<InputLayout> RHIDevice::CreateInputLayoutFromVertexLayout(RHIDevice& device, ID3DBlob* bytecode, const VertexLayoutDesc& layout) noexcept {
+    auto il = std::make_unique<InputLayout>();
+    il->PopulateInputLayoutUsingVertexLayout(layout);
+    RHIDevice::CreateInputLayout(*il, device, bytecode->GetBufferPointer(), bytecode->GetBufferSize());
+    return il;
+}
+
+std::unique_ptr<InputLayoutInstanced> RHIDevice::CreateInputLayoutInstancedFromVertexLayouts(RHIDevice& device, ID3DBlob* vs_bytecode, const VertexLayoutDesc& vertexLayout, const VertexLayoutDesc& instanceLayout) noexcept {
     auto il = std::make_unique<InputLayoutInstanced>(device);
-    il->PopulateInputLayoutUsingReflection(*vertexReflection);
+    il->PopulateInputLayoutUsingVertexLayouts(vertexLayout, instanceLayout);
     il->CreateInputLayout(vs_bytecode->GetBufferPointer(), vs_bytecode->GetBufferSize());
     return il;
 }
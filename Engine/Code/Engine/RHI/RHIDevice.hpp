@@ -33,6 +33,7 @@ class RHIOutput;
 class DepthStencilState;
 class InputLayout;
 class InputLayoutInstanced;
+struct VertexLayoutDesc;
 struct Vertex3D;
 struct Vertex3DInstanced;
 class ShaderProgram;
@@ -89,8 +90,11 @@ public:
     [[nodiscard]] static std::vector<std::unique_ptr<ConstantBuffer>> CreateConstantBuffersFromShaderProgram(RHIDevice& device, const ShaderProgram* shaderProgram) noexcept;
     [[nodiscard]] static std::vector<std::unique_ptr<ConstantBuffer>> CreateComputeConstantBuffersFromShaderProgram(RHIDevice& device, const ShaderProgram* shaderProgram) noexcept;
     [[nodiscard]] static std::unique_ptr<InputLayout> CreateInputLayoutFromByteCode(RHIDevice& device, ID3DBlob* bytecode) noexcept;
+    //Uses the formats the layout declares instead of the full-precision ones reflection would pick.
+    [[nodiscard]] static std::unique_ptr<InputLayout> CreateInputLayoutFromVertexLayout(RHIDevice& device, ID3DBlob* bytecode, const VertexLayoutDesc& layout) noexcept;
     [[nodiscard]] static std::vector<std::unique_ptr<ConstantBuffer>> CreateConstantBuffersUsingReflection(RHIDevice& device, ID3D11ShaderReflection& cbufferReflection) noexcept;
-    [[nodiscard]] static std::unique_ptr<InputLayoutInstanced> CreateInputLayoutInstancedFromByteCode(RHIDevice& device, ID3DBlob* vs_bytecode) noexcept;
+    //Vertex data in slot 0 and instance data in slot 1. Elements the shader does not read are ignored, so any program drawing Vertex3D can use it.
+    [[nodiscard]] static std::unique_ptr<InputLayoutInstanced> CreateInputLayoutInstancedFromVertexLayouts(RHIDevice& device, ID3DBlob* vs_bytecode, const VertexLayoutDesc& vertexLayout, const VertexLayoutDesc& instanceLayout) noexcept;
 
     [[nodiscard]] DisplayDesc GetDisplayModeMatchingDimensions(const std::vector<DisplayDesc>& descriptions, unsigned int w, unsigned int h) noexcept;
     
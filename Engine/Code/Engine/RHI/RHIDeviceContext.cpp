@@ -1,6 +1,7 @@
 #include "Engine/RHI/RHIDeviceContext.hpp"
 
 #include "Engine/Core/Rgba.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 #include "Engine/Renderer/BlendState.hpp"
 #include "Engine/Renderer/Buffer.hpp"
 #include "Engine/Renderer/ConstantBuffer.hpp"
@@ -20,6 +21,16 @@
 #include "Engine/Services/ServiceLocator.hpp"
 #include "Engine/Services/IRendererService.hpp"
 
+namespace {
+
+//Every draw the engine issues funnels through the four Draw* calls below.
+MetricsCounter& GetDrawCallCounter() noexcept {
+    static auto& draw_calls = Metrics::GetCounter("renderer.draw_calls");
+    return draw_calls;
+}
+
+} // namespace
+
 RHIDeviceContext::RHIDeviceContext(const RHIDevice& parentDevice, const Microsoft::WRL::ComPtr<ID3D11DeviceContext>& deviceContext) noexcept
 : m_device(parentDevice)
 , m_dx_context(deviceContext) {
@@ -181,18 +192,22 @@ void RHIDeviceContext::SetComputeStructuredBuffer(unsigned int index, Structured
 }
 
 void RHIDeviceContext::Draw(std::size_t vertexCount, std::size_t startVertex /*= 0*/) noexcept {
+    GetDrawCallCounter().Add();
     m_dx_context->Draw(static_cast<unsigned int>(vertexCount), static_cast<unsigned int>(startVertex));
 }
 
 void RHIDeviceContext::DrawInstanced(std::size_t vertexCountPerInstance, std::size_t instanceCount, std::size_t startVertexLocation, std::size_t startInstanceLocation) noexcept {
+    GetDrawCallCounter().Add();
     m_dx_context->DrawInstanced(static_cast<unsigned int>(vertexCountPerInstance), static_cast<unsigned int>(instanceCount), static_cast<unsigned int>(startVertexLocation), static_cast<unsigned int>(startInstanceLocation));
 }
 
 void RHIDeviceContext::DrawIndexed(std::size_t vertexCount, std::size_t startVertex /*= 0*/, std::size_t baseVertexLocation /*= 0*/) noexcept {
+    GetDrawCallCounter().Add();
     m_dx_context->DrawIndexed(static_cast<unsigned int>(vertexCount), static_cast<unsigned int>(startVertex), static_cast<int>(baseVertexLocation));
 }
 
 void RHIDeviceContext::DrawIndexedInstanced(std::size_t indexCountPerInstance, std::size_t instanceCount, std::size_t startIndexLocation, std::size_t baseVertexLocation, std::size_t startInstanceLocation) noexcept {
+    GetDrawCallCounter().Add();
     m_dx_context->DrawIndexedInstanced(static_cast<unsigned int>(indexCountPerInstance), static_cast<unsigned int>(instanceCount), static_cast<unsigned int>(startIndexLocation), static_cast<unsigned int>(baseVertexLocation), static_cast<unsigned int>(startInstanceLocation));
 }
 
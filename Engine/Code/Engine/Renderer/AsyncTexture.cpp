@@ -0,0 +1,34 @@
+#include "Engine/Renderer/AsyncTexture.hpp"
+
+#include "Engine/Core/AsyncImage.hpp"
+
+AsyncTexture::AsyncTexture(std::filesystem::path filepath, Texture* placeholder, std::shared_ptr<AsyncImage> image) noexcept
+: m_filepath(std::move(filepath))
+, m_image(std::move(image))
+, m_texture(placeholder)
+, m_is_loaded(m_image == nullptr) {
+    /* DO NOTHING */
+}
+
+Texture* AsyncTexture::GetTexture() const noexcept {
+    return m_texture.load();
+}
+
+bool AsyncTexture::IsLoaded() const noexcept {
+    return m_is_loaded.load();
+}
+
+const std::filesystem::path& AsyncTexture::GetFilepath() const noexcept {
+    return m_filepath;
+}
+
+AsyncImage* AsyncTexture::GetImage() const noexcept {
+    return m_image.get();
+}
+
+void AsyncTexture::Finish(Texture* texture) noexcept {
+    m_texture = texture;
+    m_is_loaded = true;
+    //The decoded texels are on the GPU now.
+    m_image.reset();
+}
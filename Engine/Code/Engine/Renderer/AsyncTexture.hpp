@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+
+class AsyncImage;
+class Texture;
+
+//A texture whose image is loading in the background.
+//GetTexture returns the placeholder until the renderer has uploaded the image, so a
+//caller can bind it every frame without checking whether it is ready yet.
+class AsyncTexture {
+public:
+    //A null image means the texture is already loaded and placeholder is the final texture.
+    AsyncTexture(std::filesystem::path filepath, Texture* placeholder, std::shared_ptr<AsyncImage> image) noexcept;
+    AsyncTexture(const AsyncTexture& other) = delete;
+    AsyncTexture& operator=(const AsyncTexture& other) = delete;
+    ~AsyncTexture() noexcept = default;
+
+    [[nodiscard]] Texture* GetTexture() const noexcept;
+    //True once the texture has been uploaded, or replaced by the invalid texture if loading failed.
+    [[nodiscard]] bool IsLoaded() const noexcept;
+    [[nodiscard]] const std::filesystem::path& GetFilepath() const noexcept;
+
+protected:
+private:
+    [[nodiscard]] AsyncImage* GetImage() const noexcept;
+    void Finish(Texture* texture) noexcept;
+
+    std::filesystem::path m_filepath{};
+    std::shared_ptr<AsyncImage> m_image{};
+    std::atomic<Texture*> m_texture{nullptr};
+    std::atomic_bool m_is_loaded{false};
+    friend class Renderer;
+};
@@ -0,0 +1,126 @@
+#include "Engine/Renderer/AtlasPacker.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <Thirdparty/stb/stb_rect_pack.h>
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+
+bool AtlasPlacement::IsPacked() const noexcept {
+    return page >= 0;
+}
+
+AtlasPacker::AtlasPacker(const AtlasPackerOptions& options /*= AtlasPackerOptions{}*/) noexcept
+: m_options{options} {
+    GUARANTEE_OR_DIE(m_options.page_dimensions.x > 0 && m_options.page_dimensions.y > 0, "AtlasPacker pages must have a positive size.");
+    m_options.padding = (std::max)(m_options.padding, 0);
+}
+
+std::size_t AtlasPacker::Add(const IntVector2& dimensions) noexcept {
+    m_placements.push_back(AtlasPlacement{-1, IntVector2::Zero, dimensions});
+    return m_placements.size() - 1u;
+}
+
+bool AtlasPacker::Pack() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto start = TimeUtils::Now();
+    const auto padding = m_options.padding;
+    const auto& page = m_options.page_dimensions;
+    m_page_dimensions.clear();
+    m_stats = AtlasPackerStats{};
+    m_stats.rects = m_placements.size();
+
+    std::vector<stbrp_rect> pending{};
+    pending.reserve(m_placements.size());
+    bool all_fit = true;
+    for(std::size_t i = 0u; i < m_placements.size(); ++i) {
+        auto& placement = m_placements[i];
+        placement.page = -1;
+        placement.position = IntVector2::Zero;
+        const auto width = (std::max)(placement.dimensions.x, 0) + 2 * padding;
+        const auto height = (std::max)(placement.dimensions.y, 0) + 2 * padding;
+        if(page.x < width || page.y < height) {
+            all_fit = false;
+            continue;
+        }
+        pending.push_back(stbrp_rect{static_cast<int>(i), width, height, 0, 0, 0});
+    }
+
+    //The skyline needs one node per texel of width to guarantee it never runs out.
+    auto nodes = std::make_unique<stbrp_node[]>(page.x);
+    IntVector2 last_page_extents{};
+    while(!pending.empty() && m_page_dimensions.size() < m_options.max_pages) {
+        stbrp_context context{};
+        stbrp_init_target(&context, page.x, page.y, nodes.get(), page.x);
+        stbrp_setup_heuristic(&context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+        stbrp_pack_rects(&context, pending.data(), static_cast<int>(pending.size()));
+
+        const auto page_index = static_cast<int>(m_page_dimensions.size());
+        last_page_extents = IntVector2::Zero;
+        const auto unplaced = std::partition(std::begin(pending), std::end(pending), [&](const stbrp_rect& rect) {
+            if(!rect.was_packed) {
+                return true;
+            }
+            auto& placement = m_placements[rect.id];
+            placement.page = page_index;
+            placement.position = IntVector2{rect.x + padding, rect.y + padding};
+            last_page_extents.x = (std::max)(last_page_extents.x, rect.x + rect.w);
+            last_page_extents.y = (std::max)(last_page_extents.y, rect.y + rect.h);
+            return false;
+        });
+        pending.erase(unplaced, std::end(pending));
+        m_page_dimensions.push_back(page);
+    }
+    if(!m_page_dimensions.empty()) {
+        const auto shrink = [](int extent, int limit) { return (std::min)(static_cast<int>(std::bit_ceil(static_cast<unsigned int>((std::max)(extent, 1)))), limit); };
+        m_page_dimensions.back() = IntVector2{shrink(last_page_extents.x, page.x), shrink(last_page_extents.y, page.y)};
+    }
+
+    m_stats.pages = m_page_dimensions.size();
+    for(const auto& placement : m_placements) {
+        if(placement.IsPacked()) {
+            ++m_stats.rects_packed;
+            m_stats.used_texels += static_cast<std::size_t>(placement.dimensions.x) * placement.dimensions.y;
+        }
+    }
+    for(const auto& dimensions : m_page_dimensions) {
+        m_stats.page_texels += static_cast<std::size_t>(dimensions.x) * dimensions.y;
+    }
+    m_stats.efficiency = m_stats.page_texels ? static_cast<float>(m_stats.used_texels) / static_cast<float>(m_stats.page_texels) : 0.0f;
+    m_stats.pack_time = std::chrono::duration_cast<TimeUtils::FPMilliseconds>(TimeUtils::Now() - start);
+    return all_fit && pending.empty();
+}
+
+void AtlasPacker::Clear() noexcept {
+    m_placements.clear();
+    m_page_dimensions.clear();
+    m_stats = AtlasPackerStats{};
+}
+
+const AtlasPlacement& AtlasPacker::GetPlacement(std::size_t id) const noexcept {
+    return m_placements[id];
+}
+
+const std::vector<AtlasPlacement>& AtlasPacker::GetPlacements() const noexcept {
+    return m_placements;
+}
+
+const std::vector<IntVector2>& AtlasPacker::GetPageDimensions() const noexcept {
+    return m_page_dimensions;
+}
+
+const AtlasPackerStats& AtlasPacker::GetStats() const noexcept {
+    return m_stats;
+}
+
+const AtlasPackerOptions& AtlasPacker::GetOptions() const noexcept {
+    return m_options;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+#include "Engine/Math/IntVector2.hpp"
+
+#include <cstddef>
+#include <vector>
+
+struct AtlasPackerOptions {
+    IntVector2 page_dimensions{2048, 2048}; //Largest page; the last page is shrunk to the smallest power of two that holds its rectangles.
+    int padding{1};                         //Texels kept clear on every side of each rectangle so filtering never reads a neighbor.
+    std::size_t max_pages{16u};
+};
+
+//Where one rectangle landed. position is the top-left of the unpadded rectangle on its page.
+struct AtlasPlacement {
+    int page{-1};
+    IntVector2 position{};
+    IntVector2 dimensions{};
+
+    [[nodiscard]] bool IsPacked() const noexcept;
+};
+
+struct AtlasPackerStats {
+    std::size_t rects{0u};
+    std::size_t rects_packed{0u};
+    std::size_t pages{0u};
+    std::size_t used_texels{0u}; //Unpadded area of the packed rectangles.
+    std::size_t page_texels{0u}; //Total area of the pages.
+    float efficiency{0.0f};      //used_texels / page_texels.
+    TimeUtils::FPMilliseconds pack_time{};
+};
+
+//Places rectangles on as few pages as possible using stb_rect_pack's skyline packer, one page at a time.
+//Knows nothing about pixels or textures, so it runs anywhere, including offline bakes.
+class AtlasPacker {
+public:
+    explicit AtlasPacker(const AtlasPackerOptions& options = AtlasPackerOptions{}) noexcept;
+
+    //Returns the id to look the rectangle's placement up by after packing.
+    [[nodiscard]] std::size_t Add(const IntVector2& dimensions) noexcept;
+    //Places every rectangle added so far, discarding any previous result.
+    //Returns false if any rectangle is larger than a page or the page limit was reached; those stay unpacked.
+    [[nodiscard]] bool Pack() noexcept;
+    void Clear() noexcept;
+
+    [[nodiscard]] const AtlasPlacement& GetPlacement(std::size_t id) const noexcept;
+    [[nodiscard]] const std::vector<AtlasPlacement>& GetPlacements() const noexcept;
+    [[nodiscard]] const std::vector<IntVector2>& GetPageDimensions() const noexcept;
+    [[nodiscard]] const AtlasPackerStats& GetStats() const noexcept;
+    [[nodiscard]] const AtlasPackerOptions& GetOptions() const noexcept;
+
+protected:
+private:
+    AtlasPackerOptions m_options{};
+    std::vector<AtlasPlacement> m_placements{};
+    std::vector<IntVector2> m_page_dimensions{};
+    AtlasPackerStats m_stats{};
+};
@@ -0,0 +1,44 @@
+cbuffer matrix_cb : register(b0) {
+    float4x4 g_MODEL;
+    float4x4 g_VIEW;
+    float4x4 g_PROJECTION;
+};
+
+struct vs_in_t {
+    float3 position : POSITION;
+    float4 color : COLOR;
+    float2 uv : UV;
+    float3 instance_position : INSTANCE_POSITION;
+    float4 instance_color : INSTANCE_COLOR;
+    float3 instance_scale : INSTANCE_TANGENT;
+};
+
+struct ps_in_t {
+    float4 position : SV_POSITION;
+    float4 color : COLOR;
+    float2 uv : UV;
+};
+
+SamplerState sSampler : register(s0);
+
+Texture2D<float4> tDiffuse    : register(t0);
+
+ps_in_t VertexFunction(vs_in_t input_vertex) {
+    ps_in_t output;
+
+    float4 local = float4(input_vertex.position * input_vertex.instance_scale + input_vertex.instance_position, 1.0f);
+    float4 world = mul(local, g_MODEL);
+    float4 view = mul(world, g_VIEW);
+    float4 clip = mul(view, g_PROJECTION);
+
+    output.position = clip;
+    output.color = input_vertex.color * input_vertex.instance_color;
+    output.uv = input_vertex.uv;
+
+    return output;
+}
+
+float4 PixelFunction(ps_in_t input_pixel) : SV_Target0 {
+    float4 albedo = tDiffuse.Sample(sSampler, input_pixel.uv);
+    return albedo * input_pixel.color;
+}
@@ -59,6 +59,8 @@ void Flipbook::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noexce
 void Flipbook::Render(const Matrix4& transform /*= Matrix4::I*/) const noexcept {
     auto* r = ServiceLocator::get<IRendererService>();
     auto* mat = r->GetMaterial("__unlit2DSprite");
+    //The frame index lives in a constant buffer shared by every sprite drawn with this material, so this quad cannot wait in a batch.
+    r->FlushSpriteBatch();
     if(const auto& cbs = mat->GetShader()->GetConstantBuffers(); !cbs.empty()) {
         auto& cb = cbs[0].get();
         IntVector4 data{m_currentFrame, 0, 0, 0};
@@ -67,6 +69,7 @@ void Flipbook::Render(const Matrix4& transform /*= Matrix4::I*/) const noexcept
     r->SetMaterial(mat);
     r->SetTexture(m_texture.get());
     r->DrawQuad2D(transform);
+    r->FlushSpriteBatch();
 }
  
 Vector2 Flipbook::GetDimensions() const noexcept {
@@ -3,6 +3,7 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/RHI/RHIDevice.hpp"
 #include "Engine/Renderer/DirectX/DX11.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
 
 void InputLayout::AddElement(std::size_t memberByteOffset, const ImageFormat& format, const char* semantic, unsigned int inputSlot /*= 0*/, bool isVertexData /*= true*/, unsigned int instanceDataStepRate /*= 0*/) noexcept {
     D3D11_INPUT_ELEMENT_DESC e_desc{};
@@ -36,6 +37,12 @@ void InputLayout::PopulateInputLayoutUsingReflection(ID3D11ShaderReflection& ver
     }
 }
 
+void InputLayout::PopulateInputLayoutUsingVertexLayout(const VertexLayoutDesc& layout) noexcept {
+    for(const auto& element : layout.elements) {
+        AddElement(element.offset, element.format, element.semantic);
+    }
+}
+
 D3D11_INPUT_ELEMENT_DESC InputLayout::CreateInputElementFromSignature(D3D11_SIGNATURE_PARAMETER_DESC& input_desc, unsigned int& last_input_slot) noexcept {
     D3D11_INPUT_ELEMENT_DESC elem{};
     elem.InputSlot = 0;
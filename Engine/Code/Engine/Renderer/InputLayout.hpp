@@ -6,6 +6,7 @@
 #include <vector>
 
 class RHIDevice;
+struct VertexLayoutDesc;
 
 class InputLayout {
 public:
@@ -16,6 +17,7 @@ public:
     void AddElement(const D3D11_INPUT_ELEMENT_DESC& desc) noexcept;
     [[nodiscard]] ID3D11InputLayout* GetDxInputLayout() const noexcept;
     void PopulateInputLayoutUsingReflection(ID3D11ShaderReflection& vertexReflection) noexcept;
+    void PopulateInputLayoutUsingVertexLayout(const VertexLayoutDesc& layout) noexcept;
 
 protected:
 private:
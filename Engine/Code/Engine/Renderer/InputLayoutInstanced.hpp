@@ -6,6 +6,7 @@
 #include <vector>
 
 class RHIDevice;
+struct VertexLayoutDesc;
 
 class InputLayoutInstanced {
 public:
@@ -16,12 +17,11 @@ public:
     void AddElement(const D3D11_INPUT_ELEMENT_DESC& desc) noexcept;
     void CreateInputLayout(void* byte_code, std::size_t byte_code_length) noexcept;
     [[nodiscard]] ID3D11InputLayout* GetDxInputLayout() const noexcept;
-    void PopulateInputLayoutUsingReflection(ID3D11ShaderReflection& vertexReflection) noexcept;
+    //Per-vertex elements of vertexLayout in slot 0 and per-instance elements of instanceLayout in slot 1.
+    void PopulateInputLayoutUsingVertexLayouts(const VertexLayoutDesc& vertexLayout, const VertexLayoutDesc& instanceLayout) noexcept;
 
 protected:
 private:
-    [[nodiscard]] D3D11_INPUT_ELEMENT_DESC CreateInputElementFromSignature(D3D11_SIGNATURE_PARAMETER_DESC& input_desc, unsigned int& last_input_slot) noexcept;
-
     std::vector<D3D11_INPUT_ELEMENT_DESC> m_elements{};
     Microsoft::WRL::ComPtr<ID3D11InputLayout> m_dx_input_layout{};
     const RHIDevice& m_parent_device;
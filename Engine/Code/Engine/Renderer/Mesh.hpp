@@ -1,9 +1,12 @@
 #pragma once
 
 #include "Engine/Renderer/Vertex3D.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
 #include "Engine/RHI/RHITypes.hpp"
 #include "Engine/Renderer/DrawInstruction.hpp"
 
+#include <functional>
+#include <span>
 #include <vector>
 
 class Mesh {
@@ -15,26 +18,34 @@ public:
     Mesh& operator=(Mesh&& other) = default;
     ~Mesh() = default;
 
-    class Builder {
+    // clang-format off
+    enum class BuilderPrimitive {
+        Point
+        , Line
+        , Triangle
+        , TriangleStrip
+        , Quad
+    };
+    // clang-format on
+
+    //Accumulates vertices as full-precision attributes and stores each one as VertexT,
+    //encoded as VertexLayout<VertexT> describes. Each Set call re-encodes only its own attribute,
+    //so AddVertex only has to encode the position.
+    template<typename VertexT>
+    class BasicBuilder {
     public:
-        // clang-format off
-        enum class Primitive {
-            Point
-            , Line
-            , Triangle
-            , TriangleStrip
-            , Quad
-        };
-        // clang-format on
-        Builder() = default;
-        Builder(const Builder& other) = default;
-        Builder(Builder&& other) = default;
-        Builder(const std::vector<Vertex3D>& verts, const std::vector<unsigned int>& indcs) noexcept;
-        Builder& operator=(const Builder& other) = default;
-        Builder& operator=(Builder&& other) = default;
-        ~Builder() = default;
-
-        std::vector<Vertex3D> verticies{};
+        using Primitive = BuilderPrimitive;
+        using vertex_t = VertexT;
+
+        BasicBuilder() = default;
+        BasicBuilder(const BasicBuilder& other) = default;
+        BasicBuilder(BasicBuilder&& other) = default;
+        BasicBuilder(const std::vector<VertexT>& verts, const std::vector<unsigned int>& indcs) noexcept;
+        BasicBuilder& operator=(const BasicBuilder& other) = default;
+        BasicBuilder& operator=(BasicBuilder&& other) = default;
+        ~BasicBuilder() = default;
+
+        std::vector<VertexT> verticies{};
         std::vector<unsigned int> indicies{};
         std::vector<DrawInstruction> draw_instructions{};
 
@@ -59,16 +70,180 @@ public:
 
     private:
         Vertex3D m_vertex_prototype{};
+        VertexT m_packed_prototype = PackVertex<VertexT>(Vertex3D{});
         DrawInstruction m_current_draw_instruction{};
     };
 
+    using Builder = BasicBuilder<Vertex3D>;
+
     Mesh(const Mesh::Builder& builder) noexcept;
     Mesh(Mesh::Builder&& builder) noexcept;
     static void Render(const Mesh::Builder& builder) noexcept;
+    //Draws a builder of packed vertices through an input layout generated from VertexLayout<VertexT>.
+    template<typename VertexT>
+    static void Render(const BasicBuilder<VertexT>& builder) noexcept {
+        RenderPacked(builder.draw_instructions, GetVertexLayoutDesc<VertexT>(), std::as_bytes(std::span<const VertexT>{builder.verticies}), builder.indicies);
+    }
     void Render() const noexcept;
 
 protected:
     Mesh::Builder m_builder{};
 
 private:
+    static void RenderPacked(const std::vector<DrawInstruction>& draw_instructions, const VertexLayoutDesc& layout, std::span<const std::byte> verticies, const std::vector<unsigned int>& indicies) noexcept;
+    static void RenderDrawInstructions(const std::vector<DrawInstruction>& draw_instructions, const std::function<void(const DrawInstruction&)>& draw) noexcept;
 };
+
+template<typename VertexT>
+Mesh::BasicBuilder<VertexT>::BasicBuilder(const std::vector<VertexT>& verts, const std::vector<unsigned int>& indcs) noexcept
+: verticies{verts}
+, indicies{indcs} {
+    /* DO NOTHING */
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::Begin(const PrimitiveType& type) noexcept {
+    m_current_draw_instruction.type = type;
+    m_current_draw_instruction.indexStart = indicies.size();
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::Begin(const PrimitiveType& type, std::size_t indexStart) noexcept {
+    m_current_draw_instruction.type = type;
+    m_current_draw_instruction.indexStart = indexStart;
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::End(Material* mat /* = nullptr */) noexcept {
+    m_current_draw_instruction.material = mat;
+    m_current_draw_instruction.indexCount = indicies.size() - m_current_draw_instruction.indexStart;
+    if(!draw_instructions.empty()) {
+        auto& last_inst = draw_instructions.back();
+        if(!mat) {
+            m_current_draw_instruction.material = last_inst.material;
+        }
+        if(last_inst == m_current_draw_instruction) {
+            ++last_inst.count;
+            last_inst.indexCount += m_current_draw_instruction.indexCount;
+        } else {
+            draw_instructions.push_back(m_current_draw_instruction);
+        }
+    } else {
+        draw_instructions.push_back(m_current_draw_instruction);
+    }
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::Clear() noexcept {
+    verticies.clear();
+    indicies.clear();
+    draw_instructions.clear();
+}
+
+template<typename VertexT>
+bool Mesh::BasicBuilder<VertexT>::IsEmpty() const noexcept {
+    return verticies.empty() && indicies.empty() && draw_instructions.empty();
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetTangent(const Vector3& tangent) noexcept {
+    m_vertex_prototype.tangent = tangent;
+    PackVertexAttribute<VertexAttribute::Tangent>(m_packed_prototype, m_vertex_prototype);
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetBitangent(const Vector3& bitangent) noexcept {
+    m_vertex_prototype.bitangent = bitangent;
+    PackVertexAttribute<VertexAttribute::Bitangent>(m_packed_prototype, m_vertex_prototype);
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetNormal(const Vector3& normal) noexcept {
+    m_vertex_prototype.normal = normal;
+    PackVertexAttribute<VertexAttribute::Normal>(m_packed_prototype, m_vertex_prototype);
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetAlpha(unsigned char value) noexcept {
+    SetAlpha(value / 255.0f);
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetAlpha(float value) noexcept {
+    m_vertex_prototype.color.w = value;
+    PackVertexAttribute<VertexAttribute::Color>(m_packed_prototype, m_vertex_prototype);
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetColor(const Rgba& color) noexcept {
+    auto&& [r, g, b, a] = color.GetAsFloats();
+    SetColor(Vector4{r, g, b, a});
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetColor(const Vector4& color) noexcept {
+    m_vertex_prototype.color = color;
+    PackVertexAttribute<VertexAttribute::Color>(m_packed_prototype, m_vertex_prototype);
+}
+
+template<typename VertexT>
+void Mesh::BasicBuilder<VertexT>::SetUV(const Vector2& uv) noexcept {
+    m_vertex_prototype.texcoords = uv;
+    PackVertexAttribute<VertexAttribute::TexCoords>(m_packed_prototype, m_vertex_prototype);
+}
+
+template<typename VertexT>
+std::size_t Mesh::BasicBuilder<VertexT>::AddVertex(const Vector3& position) noexcept {
+    m_vertex_prototype.position = position;
+    PackVertexAttribute<VertexAttribute::Position>(m_packed_prototype, m_vertex_prototype);
+    verticies.push_back(m_packed_prototype);
+    return verticies.size() - 1;
+}
+
+template<typename VertexT>
+std::size_t Mesh::BasicBuilder<VertexT>::AddVertex(const Vector2& position) noexcept {
+    return AddVertex(Vector3{position, 0.0f});
+}
+
+template<typename VertexT>
+std::size_t Mesh::BasicBuilder<VertexT>::AddIndicies(const Primitive& type) noexcept {
+    switch(type) {
+    case Primitive::Point:
+        indicies.push_back(static_cast<unsigned int>(verticies.size()) - 1u);
+        break;
+    case Primitive::Line: {
+        const auto v_s = verticies.size();
+        indicies.push_back(static_cast<unsigned int>(v_s) - 2);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 1);
+        break;
+    }
+    case Primitive::Triangle: {
+        const auto v_s = verticies.size();
+        indicies.push_back(static_cast<unsigned int>(v_s) - 3u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 2u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 1u);
+        break;
+    }
+    case Primitive::TriangleStrip: {
+        const auto v_s = verticies.size();
+        indicies.push_back(static_cast<unsigned int>(v_s) - 4u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 3u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 2u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 1u);
+        break;
+    }
+    case Primitive::Quad: {
+        const auto v_s = verticies.size();
+        indicies.push_back(static_cast<unsigned int>(v_s) - 4u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 3u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 2u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 4u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 2u);
+        indicies.push_back(static_cast<unsigned int>(v_s) - 1u);
+        break;
+    }
+    default:
+        break;
+    }
+    return indicies.size() - 1;
+}
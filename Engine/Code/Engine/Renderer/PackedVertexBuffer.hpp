@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Engine/Renderer/ArrayBuffer.hpp"
+
+#include <cstddef>
+#include <vector>
+
+class RHIDevice;
+class RHIDeviceContext;
+
+//Untyped vertex storage for the packed vertex formats. The stride comes from the VertexLayoutDesc the vertices are drawn with.
+class PackedVertexBuffer : public ArrayBuffer<std::byte> {
+public:
+    PackedVertexBuffer(const RHIDevice& owner, const buffer_t& buffer, const BufferUsage& usage, const BufferBindUsage& bindUsage) noexcept;
+    virtual ~PackedVertexBuffer() noexcept;
+
+    void Update(RHIDeviceContext& context, const buffer_t& buffer) noexcept;
+
+protected:
+private:
+};
@@ -1,6 +1,7 @@
 #include "Engine/Renderer/Renderer.hpp"
 
 #include "Engine/Core/ArgumentParser.hpp"
+#include "Engine/Core/AsyncImage.hpp"
 #include "Engine/Core/BuildConfig.hpp"
 #include "Engine/Core/Config.hpp"
 #include "Engine/Core/Console.hpp"
@@ -21,6 +22,8 @@
 #include "Engine/Math/OBB2.hpp"
 #include "Engine/Math/Polygon2.hpp"
 #include "Engine/Math/Vector2.hpp"
+#include "Engine/Memory/FrameArena.hpp"
+#include "Engine/Profiling/Metrics.hpp"
 #include "Engine/Profiling/ProfileLogScope.hpp"
 #include "Engine/RHI/RHIDevice.hpp"
 #include "Engine/RHI/RHIDeviceContext.hpp"
@@ -44,10 +47,12 @@
 #include "Engine/Renderer/ShaderProgram.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Renderer/StructuredBuffer.hpp"
+#include "Engine/Renderer/TextLayoutCache.hpp"
 #include "Engine/Renderer/Texture1D.hpp"
 #include "Engine/Renderer/Texture2D.hpp"
 #include "Engine/Renderer/Texture3D.hpp"
 #include "Engine/Renderer/TextureArray2D.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
 #include "Engine/Renderer/Vertex3D.hpp"
 #include "Engine/Renderer/Window.hpp"
 
@@ -74,6 +79,15 @@
 #include <tuple>
 #include <utility>
 
+namespace {
+
+MetricsCounter& GetVerticesUploadedCounter() noexcept {
+    static auto& vertices_uploaded = Metrics::GetCounter("renderer.vertices_uploaded");
+    return vertices_uploaded;
+}
+
+} // namespace
+
 ComputeJob::ComputeJob(std::size_t uavCount,
                        const std::vector<Texture*>& uavTextures,
                        Shader* computeShader,
@@ -162,30 +176,28 @@ Renderer::~Renderer() noexcept {
     UnbindAllShaderResources();
     UnbindComputeShaderResources();
 
-    m_temp_vbo.reset();
-    m_temp_vbio.reset();
-    m_circle_vbo.reset();
-    m_temp_ibo.reset();
+    m_vbo_stream.reset();
+    m_vbio_stream.reset();
+    m_vbco_stream.reset();
+    m_ibo_stream.reset();
+    m_packed_vbo_stream.reset();
 
     m_matrix_cb.reset();
     m_time_cb.reset();
     m_lighting_cb.reset();
     m_roundedrec_cb.reset();
 
-    m_textures.clear();
-    m_textures.shrink_to_fit();
-    m_shader_programs.clear();
-    m_shader_programs.shrink_to_fit();
-    m_materials.clear();
-    m_materials.shrink_to_fit();
-    m_shaders.clear();
-    m_shaders.shrink_to_fit();
+    m_pending_textures.clear();
+    m_textures.Clear();
+    m_shader_programs.Clear();
+    m_materials.Clear();
+    m_shaders.Clear();
     m_samplers.clear();
     m_samplers.shrink_to_fit();
     m_rasters.clear();
     m_rasters.shrink_to_fit();
-    m_fonts.clear();
-    m_fonts.shrink_to_fit();
+    m_text_layout_cache.Clear();
+    m_fonts.Clear();
     m_depthstencils.clear();
     m_depthstencils.shrink_to_fit();
 
@@ -446,19 +458,13 @@ void Renderer::CreateWorkingVboAndIbo() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    VertexBuffer::buffer_t default_vbo(1024);
-    IndexBuffer::buffer_t default_ibo(1024);
-    VertexCircleBuffer::buffer_t default_circle_vbo(1024);
-    VertexBufferInstanced::buffer_t default_vbio(1024);
-
-    m_temp_vbo = CreateVertexBuffer(default_vbo);
-    m_temp_ibo = CreateIndexBuffer(default_ibo);
-    m_circle_vbo = CreateVertexCircleBuffer(default_circle_vbo);
-
-    m_current_vbo_size = default_vbo.size();
-    m_current_vbco_size = default_circle_vbo.size();
-    m_current_ibo_size = default_ibo.size();
-    m_current_vbio_size = default_vbio.size();
+    //Sized so a typical frame of immediate-mode draws fits without wrapping; they grow if a single draw does not fit.
+    m_vbo_stream = std::make_unique<StreamingBuffer>(std::make_unique<ArrayBufferStreamingTarget<VertexBuffer>>(*m_rhi_context, [this](const VertexBuffer::buffer_t& vbo) { return CreateVertexBuffer(vbo); }, std::size_t{65536u}));
+    m_ibo_stream = std::make_unique<StreamingBuffer>(std::make_unique<ArrayBufferStreamingTarget<IndexBuffer>>(*m_rhi_context, [this](const IndexBuffer::buffer_t& ibo) { return CreateIndexBuffer(ibo); }, std::size_t{131072u}));
+    m_vbco_stream = std::make_unique<StreamingBuffer>(std::make_unique<ArrayBufferStreamingTarget<VertexCircleBuffer>>(*m_rhi_context, [this](const VertexCircleBuffer::buffer_t& vbco) { return CreateVertexCircleBuffer(vbco); }, std::size_t{16384u}));
+    m_vbio_stream = std::make_unique<StreamingBuffer>(std::make_unique<ArrayBufferStreamingTarget<VertexBufferInstanced>>(*m_rhi_context, [this](const VertexBufferInstanced::buffer_t& vbio) { return CreateVertexBufferInstanced(vbio); }, std::size_t{16384u}));
+    //Sized in bytes: the packed formats share one stream whatever their stride.
+    m_packed_vbo_stream = std::make_unique<StreamingBuffer>(std::make_unique<ArrayBufferStreamingTarget<PackedVertexBuffer>>(*m_rhi_context, [this](const PackedVertexBuffer::buffer_t& vbo) { return m_rhi_device->CreateVertexBuffer<PackedVertexBuffer>(vbo, BufferUsage::Dynamic, BufferBindUsage::Vertex_Buffer); }, std::size_t{2u * 1024u * 1024u}));
 }
 
 void Renderer::LogAvailableDisplays() noexcept {
@@ -547,9 +553,10 @@ void Renderer::UnbindWorkingVboAndIbo() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    //Setting the current sizes to zero forces them to be recreated next time they are updated.
-    m_current_ibo_size = 0;
-    m_current_vbo_size = 0;
+    //Forces the buffers to be recreated next time they are updated.
+    m_ibo_stream->Invalidate();
+    m_vbo_stream->Invalidate();
+    m_packed_vbo_stream->Invalidate();
 }
 
 void Renderer::SetDepthComparison(ComparisonFunction cf) noexcept {
@@ -651,6 +658,14 @@ void Renderer::BeginFrame() noexcept {
     ZoneScopedC(0xFF0000);
 #endif
     UnbindAllShaderResources();
+    m_vbo_stream->BeginFrame();
+    m_vbco_stream->BeginFrame();
+    m_vbio_stream->BeginFrame();
+    m_ibo_stream->BeginFrame();
+    m_packed_vbo_stream->BeginFrame();
+    m_sprite_batch.BeginFrame();
+    m_text_layout_cache.BeginFrame();
+    UploadLoadedTextures(max_texture_uploads_per_frame);
 }
 
 void Renderer::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
@@ -814,40 +829,81 @@ bool Renderer::RegisterTexture(const std::string& name, std::unique_ptr<Texture>
     if(texture.get() == nullptr) {
         return false;
     }
-    std::filesystem::path p(name);
-    if(!StringUtils::StartsWith(p.string(), "__") && std::filesystem::exists(p)) {
-        std::error_code ec{};
-        p = std::filesystem::canonical(p, ec);
-        if(ec) {
-            std::cout << ec.message();
-            return false;
-        }
-    }
-    p.make_preferred();
-    if(auto found_texture = std::find_if(std::cbegin(m_textures), std::cend(m_textures), [&p](const auto& t) { return t.first == p.string(); }); found_texture == m_textures.end()) {
-        texture->SetDebugName(name);
-        m_textures.emplace_back(std::make_pair(name, std::move(texture)));
-        return true;
-    } else {
+    const auto key = CanonicalizeResourceName(name);
+    if(m_textures.Contains(StringId{key})) {
         return false;
     }
+    texture->SetDebugName(name);
+    m_textures.Register(key, std::move(texture));
+    AddResourceAliases(m_textures, name, key);
+    return true;
 }
 
 Texture* Renderer::GetTexture(const std::string& nameOrFile) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return FindByNormalizedName(m_textures, nameOrFile);
+}
+
+Texture* Renderer::GetTexture(const StringId& id) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return m_textures.Find(id);
+}
+
+std::string Renderer::CanonicalizeResourceName(const std::string& nameOrFile) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
     namespace FS = std::filesystem;
-    FS::path p(nameOrFile);
-    if(!StringUtils::StartsWith(p.string(), "__") && std::filesystem::exists(nameOrFile)) {
-        p = FS::canonical(p);
+    if(StringUtils::StartsWith(nameOrFile, "__")) {
+        return nameOrFile;
+    }
+    FS::path p{nameOrFile};
+    std::error_code ec{};
+    if(FS::exists(p, ec)) {
+        if(auto canonical = FS::canonical(p, ec); !ec) {
+            p = std::move(canonical);
+        }
     }
     p.make_preferred();
-    if(auto found_texture = std::find_if(std::cbegin(m_textures), std::cend(m_textures), [&p](const auto& t) { return t.first == p.string(); }); found_texture == std::end(m_textures)) {
-        return nullptr;
-    } else {
-        return (*found_texture).second.get();
+    return p.string();
+}
+
+std::string Renderer::NormalizeResourceName(const std::string& nameOrFile) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    if(StringUtils::StartsWith(nameOrFile, "__")) {
+        return nameOrFile;
     }
+    auto p = std::filesystem::path{nameOrFile}.lexically_normal();
+    p.make_preferred();
+    return p.string();
+}
+
+std::string Renderer::GetWorkingDirectoryRelativeName(const std::string& key) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    namespace FS = std::filesystem;
+    const auto p = FS::path{key};
+    if(!p.is_absolute()) {
+        return {};
+    }
+    std::error_code ec{};
+    const auto cwd = FS::current_path(ec);
+    if(ec) {
+        return {};
+    }
+    auto relative = p.lexically_relative(cwd);
+    if(relative.empty() || *relative.begin() == "..") {
+        return {};
+    }
+    relative.make_preferred();
+    return relative.string();
 }
 
 void Renderer::DrawPoint(const Vertex3D& point) noexcept {
@@ -1146,50 +1202,104 @@ void Renderer::Draw(const PrimitiveType& topology, const std::vector<Vertex3D>&
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbo(vbo);
-    Draw(topology, m_temp_vbo.get(), vbo.size());
+    const auto start_vertex = UpdateVbo(vbo);
+    if(start_vertex == StreamingBuffer::npos) {
+        return;
+    }
+    Draw(topology, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), vbo.size(), start_vertex);
 }
 
 void Renderer::Draw(const PrimitiveType& topology, const std::vector<VertexCircle2D>& vbo) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbco(vbo);
-    Draw(topology, m_circle_vbo.get(), vbo.size());
+    const auto start_vertex = UpdateVbco(vbo);
+    if(start_vertex == StreamingBuffer::npos) {
+        return;
+    }
+    Draw(topology, GetStreamBuffer<VertexCircleBuffer>(*m_vbco_stream), vbo.size(), start_vertex);
 }
 
 void Renderer::Draw(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, std::size_t vertex_count) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbo(vbo);
-    Draw(topology, m_temp_vbo.get(), vertex_count);
+    const auto start_vertex = UpdateVbo(vbo);
+    if(start_vertex == StreamingBuffer::npos) {
+        return;
+    }
+    Draw(topology, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), vertex_count, start_vertex);
 }
 
 void Renderer::Draw(const PrimitiveType& topology, const std::vector<VertexCircle2D>& vbo, std::size_t vertex_count) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbco(vbo);
-    Draw(topology, m_circle_vbo.get(), vertex_count);
+    const auto start_vertex = UpdateVbco(vbo);
+    if(start_vertex == StreamingBuffer::npos) {
+        return;
+    }
+    Draw(topology, GetStreamBuffer<VertexCircleBuffer>(*m_vbco_stream), vertex_count, start_vertex);
 }
 
 void Renderer::DrawIndexed(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbo(vbo);
-    UpdateIbo(ibo);
-    DrawIndexed(topology, m_temp_vbo.get(), m_temp_ibo.get(), ibo.size());
+    DrawIndexedTransient(topology, vbo, ibo);
+}
+
+void Renderer::DrawIndexedTransient(const PrimitiveType& topology, std::span<const Vertex3D> vbo, std::span<const unsigned int> ibo) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto base_vertex = UpdateVbo(vbo);
+    const auto start_index = UpdateIbo(ibo);
+    if(base_vertex == StreamingBuffer::npos || start_index == StreamingBuffer::npos) {
+        return;
+    }
+    DrawIndexed(topology, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), GetStreamBuffer<IndexBuffer>(*m_ibo_stream), ibo.size(), start_index, base_vertex);
 }
 
 void Renderer::DrawIndexed(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, std::size_t index_count, std::size_t startVertex /*= 0*/, std::size_t baseVertexLocation /*= 0*/) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbo(vbo);
-    UpdateIbo(ibo);
-    DrawIndexed(topology, m_temp_vbo.get(), m_temp_ibo.get(), index_count, startVertex, baseVertexLocation);
+    const auto base_vertex = UpdateVbo(vbo);
+    const auto start_index = UpdateIbo(ibo);
+    if(base_vertex == StreamingBuffer::npos || start_index == StreamingBuffer::npos) {
+        return;
+    }
+    DrawIndexed(topology, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), GetStreamBuffer<IndexBuffer>(*m_ibo_stream), index_count, start_index + startVertex, base_vertex + baseVertexLocation);
+}
+
+void Renderer::Draw(const PrimitiveType& topology, const VertexLayoutDesc& layout, std::span<const std::byte> vbo) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto start_vertex = UpdatePackedVbo(layout, vbo);
+    if(start_vertex == StreamingBuffer::npos) {
+        return;
+    }
+    BindPackedVertices(topology, layout);
+    m_rhi_context->Draw(vbo.size() / layout.stride, start_vertex);
+    RestoreMaterialInputLayout();
+}
+
+void Renderer::DrawIndexed(const PrimitiveType& topology, const VertexLayoutDesc& layout, std::span<const std::byte> vbo, const std::vector<unsigned int>& ibo, std::size_t index_count, std::size_t startVertex /*= 0*/, std::size_t baseVertexLocation /*= 0*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto base_vertex = UpdatePackedVbo(layout, vbo);
+    const auto start_index = UpdateIbo(ibo);
+    if(base_vertex == StreamingBuffer::npos || start_index == StreamingBuffer::npos) {
+        return;
+    }
+    BindPackedVertices(topology, layout);
+    const auto dx_ibo_buffer = GetStreamBuffer<IndexBuffer>(*m_ibo_stream)->GetDxBuffer();
+    m_rhi_context->GetDxContext()->IASetIndexBuffer(dx_ibo_buffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+    m_rhi_context->DrawIndexed(index_count, start_index + startVertex, base_vertex + baseVertexLocation);
+    RestoreMaterialInputLayout();
 }
 
 void Renderer::DrawInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, std::size_t instanceCount) noexcept {
@@ -1203,9 +1313,12 @@ void Renderer::DrawInstanced(const PrimitiveType& topology, const std::vector<Ve
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbo(vbo);
-    UpdateVbio(vbio);
-    DrawInstanced(topology, m_temp_vbo.get(), m_temp_vbio.get(), vertexCount, instanceCount, std::size_t{0u}, std::size_t{0u});
+    const auto start_vertex = UpdateVbo(vbo);
+    const auto start_instance = UpdateVbio(vbio);
+    if(start_vertex == StreamingBuffer::npos || start_instance == StreamingBuffer::npos) {
+        return;
+    }
+    DrawInstanced(topology, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), GetStreamBuffer<VertexBufferInstanced>(*m_vbio_stream), vertexCount, instanceCount, start_vertex, start_instance);
 }
 
 void Renderer::DrawIndexedInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, const std::vector<unsigned int>& ibo, std::size_t instanceCount) noexcept {
@@ -1219,10 +1332,13 @@ void Renderer::DrawIndexedInstanced(const PrimitiveType& topology, const std::ve
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    UpdateVbo(vbo);
-    UpdateVbio(vbio);
-    UpdateIbo(ibo);
-    DrawIndexedInstanced(topology, m_temp_vbo.get(), m_temp_vbio.get(), m_temp_ibo.get(), ibo.size(), instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+    const auto base_vertex = UpdateVbo(vbo);
+    const auto start_instance = UpdateVbio(vbio);
+    const auto start_index = UpdateIbo(ibo);
+    if(base_vertex == StreamingBuffer::npos || start_instance == StreamingBuffer::npos || start_index == StreamingBuffer::npos) {
+        return;
+    }
+    DrawIndexedInstanced(topology, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), GetStreamBuffer<VertexBufferInstanced>(*m_vbio_stream), GetStreamBuffer<IndexBuffer>(*m_ibo_stream), ibo.size(), instanceCount, start_index + startIndexLocation, base_vertex + baseVertexLocation, start_instance + startInstanceLocation);
 }
 
 
@@ -1429,6 +1545,23 @@ std::shared_ptr<SpriteSheet> Renderer::CreateSpriteSheet(const XMLElement& elem)
     return std::make_shared<SpriteSheet>(elem);
 }
 
+std::shared_ptr<SpriteSheet> Renderer::CreateSpriteSheet(const TextureAtlas& atlas, const std::string& regionName, unsigned int width /*= 1*/, unsigned int height /*= 1*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto* region = atlas.GetRegion(regionName);
+    if(region == nullptr) {
+        DebuggerPrintf(std::format("Texture atlas {} has no region named {}.\n", atlas.GetName(), regionName));
+        return nullptr;
+    }
+    auto* page = atlas.GetPageTexture(region->page);
+    if(page == nullptr) {
+        DebuggerPrintf(std::format("Texture atlas {} has not been uploaded. Call CreateTextures first.\n", atlas.GetName()));
+        return nullptr;
+    }
+    return std::shared_ptr<SpriteSheet>(new SpriteSheet(page, region->uvs, static_cast<int>(width), static_cast<int>(height)));
+}
+
 std::shared_ptr<SpriteSheet> Renderer::CreateSpriteSheet(Texture* texture, int tilesWide, int tilesHigh) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
@@ -1476,13 +1609,14 @@ void Renderer::DrawInstanced(const PrimitiveType& topology, VertexBuffer* vbo, V
     GUARANTEE_OR_DIE(m_current_material, "Attempting to call Draw function without a material set!\n");
     D3D11_PRIMITIVE_TOPOLOGY d3d_prim = PrimitiveTypeToD3dTopology(topology);
     m_rhi_context->GetDxContext()->IASetPrimitiveTopology(d3d_prim);
-    unsigned int stride = sizeof(VertexBuffer::arraybuffer_t);
-    unsigned int offsets = 0;
-    const auto dx_vbo_buffer = vbo->GetDxBuffer();
-    const auto dx_vbio_buffer = vbio->GetDxBuffer();
+    //One stride and offset per bound buffer.
+    const unsigned int strides[] = {sizeof(VertexBuffer::arraybuffer_t), sizeof(VertexBufferInstanced::arraybuffer_t)};
+    const unsigned int offsets[] = {0u, 0u};
     ID3D11Buffer* const dx_buffers[] = {vbo->GetDxBuffer().Get(), vbio->GetDxBuffer().Get()};
-    m_rhi_context->GetDxContext()->IASetVertexBuffers(0, 2, dx_buffers, &stride, &offsets);
+    m_rhi_context->GetDxContext()->IASetVertexBuffers(0, 2, dx_buffers, strides, offsets);
+    BindInstancedInputLayout();
     m_rhi_context->DrawInstanced(vertexPerInstanceCount, instanceCount, startVertexLocation, startInstanceLocation);
+    RestoreMaterialInputLayout();
 }
 
 //TODO (Casey): Audit template usage
@@ -1506,15 +1640,16 @@ void Renderer::DrawIndexedInstanced(const PrimitiveType& topology, VertexBuffer*
     GUARANTEE_OR_DIE(m_current_material, "Attempting to call Draw function without a material set!\n");
     D3D11_PRIMITIVE_TOPOLOGY d3d_prim = PrimitiveTypeToD3dTopology(topology);
     m_rhi_context->GetDxContext()->IASetPrimitiveTopology(d3d_prim);
-    unsigned int stride = sizeof(VertexBuffer::arraybuffer_t);
-    unsigned int offsets = 0;
-    const auto dx_vbo_buffer = vbo->GetDxBuffer();
-    const auto dx_vbio_buffer = vbio->GetDxBuffer();
+    //One stride and offset per bound buffer.
+    const unsigned int strides[] = {sizeof(VertexBuffer::arraybuffer_t), sizeof(VertexBufferInstanced::arraybuffer_t)};
+    const unsigned int offsets[] = {0u, 0u};
     ID3D11Buffer* const dx_buffers[] = {vbo->GetDxBuffer().Get(), vbio->GetDxBuffer().Get()};
     auto dx_ibo_buffer = ibo->GetDxBuffer();
-    m_rhi_context->GetDxContext()->IASetVertexBuffers(0, 2, dx_buffers, &stride, &offsets);
-    m_rhi_context->GetDxContext()->IASetIndexBuffer(dx_ibo_buffer.Get(), DXGI_FORMAT_R32_UINT, offsets);
+    m_rhi_context->GetDxContext()->IASetVertexBuffers(0, 2, dx_buffers, strides, offsets);
+    m_rhi_context->GetDxContext()->IASetIndexBuffer(dx_ibo_buffer.Get(), DXGI_FORMAT_R32_UINT, 0u);
+    BindInstancedInputLayout();
     m_rhi_context->DrawIndexedInstanced(indexPerInstanceCount, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+    RestoreMaterialInputLayout();
 }
 
 
@@ -1585,8 +1720,13 @@ void Renderer::DrawQuad2D(float left, float bottom, float right, float top, cons
     Vector2 uv_lb = Vector2(texCoords.x, texCoords.w);
     Vector2 uv_rt = Vector2(texCoords.z, texCoords.y);
     Vector2 uv_rb = Vector2(texCoords.z, texCoords.w);
-    std::vector<Vertex3D> vbo = {
+    const SpriteBatch::Quad corners = {
     Vertex3D(v_lb, color, uv_lb), Vertex3D(v_lt, color, uv_lt), Vertex3D(v_rt, color, uv_rt), Vertex3D(v_rb, color, uv_rb)};
+    if(QueueSprite(m_current_material, GetCurrentSpriteTexture(), corners)) {
+        m_sprite_batch.CountSubmittedDraw();
+        return;
+    }
+    std::vector<Vertex3D> vbo(std::cbegin(corners), std::cend(corners));
     std::vector<unsigned int> ibo = {
     0, 1, 2, 0, 2, 3};
     DrawIndexed(PrimitiveType::Triangles, vbo, ibo);
@@ -1682,7 +1822,7 @@ void Renderer::DrawFilledCircle2D(const Vector2& center, float radius, const Rgb
 #endif
     const auto num_sides = std::size_t{64};
     const auto size = num_sides + 1u;
-    std::vector<Vector3> verts{};
+    std::pmr::vector<Vector3> verts{FrameArena::GetResource()};
     verts.reserve(size);
     verts.emplace_back(center);
     const auto anglePerVertex = 360.0f / static_cast<float>(num_sides);
@@ -1693,19 +1833,19 @@ void Renderer::DrawFilledCircle2D(const Vector2& center, float radius, const Rgb
         verts.emplace_back(Vector2(pX, pY), 0.0f);
     }
 
-    std::vector<Vertex3D> vbo;
+    std::pmr::vector<Vertex3D> vbo{FrameArena::GetResource()};
     vbo.reserve(verts.size());
     for(const auto& vert : verts) {
         vbo.emplace_back(vert, color);
     }
 
-    std::vector<unsigned int> ibo((num_sides - 1) * 3);
+    std::pmr::vector<unsigned int> ibo((num_sides - 1) * 3, FrameArena::GetResource());
     unsigned int j = 1u;
     for(std::size_t i = 1; i < ibo.size() - 1; i += 3) {
         ibo[i] = (j++) % num_sides;
         ibo[i + 1] = (j == num_sides ? 1 : j) % num_sides;
     }
-    DrawIndexed(PrimitiveType::Triangles, vbo, ibo);
+    DrawIndexedTransient(PrimitiveType::Triangles, vbo, ibo);
 }
 
 void Renderer::DrawAABB2(const AABB2& bounds, const Rgba& edgeColor, const Rgba& fillColor, const Vector2& edgeHalfExtents /*= Vector2::ZERO*/) noexcept {
@@ -1861,7 +2001,7 @@ void Renderer::DrawFilledRoundedRectangle2D(const AABB2& bounds, const Rgba& col
         }
         const auto num_sides = std::size_t{64};
         const auto size = num_sides + 1u;
-        std::vector<Vector3> verts{};
+        std::pmr::vector<Vector3> verts{FrameArena::GetResource()};
         verts.reserve(size);
         verts.emplace_back(Vector2::Zero);
         const auto max_angle_degrees = end_degrees - start_degrees;
@@ -1873,13 +2013,13 @@ void Renderer::DrawFilledRoundedRectangle2D(const AABB2& bounds, const Rgba& col
             verts.emplace_back(Vector2(pX, pY), 0.0f);
         }
 
-        std::vector<Vertex3D> vbo;
+        std::pmr::vector<Vertex3D> vbo{FrameArena::GetResource()};
         vbo.reserve(verts.size());
         for(const auto& vert : verts) {
             vbo.emplace_back(vert, color);
         }
 
-        std::vector<unsigned int> ibo(num_sides * 3);
+        std::pmr::vector<unsigned int> ibo(num_sides * 3, FrameArena::GetResource());
         unsigned int j = 1u;
         for(std::size_t i = 1; i < ibo.size(); i += 3) {
             ibo[i] = (j++) % (num_sides + 1);
@@ -1890,7 +2030,7 @@ void Renderer::DrawFilledRoundedRectangle2D(const AABB2& bounds, const Rgba& col
         const auto T = Matrix4::CreateTranslationMatrix(center);
         const auto M = Matrix4::MakeSRT(S, R, T);
         SetModelMatrix(M);
-        DrawIndexed(PrimitiveType::Triangles, vbo, ibo);
+        DrawIndexedTransient(PrimitiveType::Triangles, vbo, ibo);
     };
 
     const auto draw_edges = [&]() {
@@ -2110,7 +2250,7 @@ void Renderer::DrawPolygon2D(float centerX, float centerY, float radius, std::si
     ZoneScopedC(0xFF0000);
 #endif
     auto num_sides_as_float = static_cast<float>(numSides);
-    std::vector<Vector3> verts;
+    std::pmr::vector<Vector3> verts{FrameArena::GetResource()};
     verts.reserve(numSides);
     float anglePerVertex = 360.0f / num_sides_as_float;
     for(float degrees = 0.0f; degrees < 360.0f; degrees += anglePerVertex) {
@@ -2120,18 +2260,18 @@ void Renderer::DrawPolygon2D(float centerX, float centerY, float radius, std::si
         verts.emplace_back(Vector2(pX, pY), 0.0f);
     }
 
-    std::vector<Vertex3D> vbo;
+    std::pmr::vector<Vertex3D> vbo{FrameArena::GetResource()};
     vbo.resize(verts.size());
     for(std::size_t i = 0; i < vbo.size(); ++i) {
         vbo[i] = Vertex3D(verts[i], color);
     }
 
-    std::vector<unsigned int> ibo;
+    std::pmr::vector<unsigned int> ibo{FrameArena::GetResource()};
     ibo.resize(numSides + 1);
     for(std::size_t i = 0; i < ibo.size(); ++i) {
         ibo[i] = static_cast<unsigned int>(i % numSides);
     }
-    DrawIndexed(PrimitiveType::LinesStrip, vbo, ibo);
+    DrawIndexedTransient(PrimitiveType::LinesStrip, vbo, ibo);
 }
 
 void Renderer::DrawPolygon2D(const Vector2& center, float radius, std::size_t numSides /*= 3*/, const Rgba& color /*= Rgba::WHITE*/) noexcept {
@@ -2168,7 +2308,7 @@ void Renderer::DrawFilledPolygon2D(float centerX, float centerY, float radius, s
     ZoneScopedC(0xFF0000);
 #endif
     auto num_sides_as_float = static_cast<float>(numSides);
-    std::vector<Vector3> verts;
+    std::pmr::vector<Vector3> verts{FrameArena::GetResource()};
     verts.reserve(numSides);
     float anglePerVertex = 360.0f / num_sides_as_float;
     for(float degrees = 0.0f; degrees < 360.0f; degrees += anglePerVertex) {
@@ -2178,18 +2318,18 @@ void Renderer::DrawFilledPolygon2D(float centerX, float centerY, float radius, s
         verts.emplace_back(Vector2(pX, pY), 0.0f);
     }
 
-    std::vector<Vertex3D> vbo;
+    std::pmr::vector<Vertex3D> vbo{FrameArena::GetResource()};
     vbo.resize(verts.size());
     for(std::size_t i = 0; i < vbo.size(); ++i) {
         vbo[i] = Vertex3D(verts[i], color);
     }
 
-    std::vector<unsigned int> ibo;
+    std::pmr::vector<unsigned int> ibo{FrameArena::GetResource()};
     ibo.resize(numSides + 1);
     for(std::size_t i = 0; i < ibo.size(); ++i) {
         ibo[i] = static_cast<unsigned int>(i % numSides);
     }
-    DrawIndexed(PrimitiveType::TriangleStrip, vbo, ibo);
+    DrawIndexedTransient(PrimitiveType::TriangleStrip, vbo, ibo);
 }
 
 void Renderer::DrawFilledPolygon2D(const Vector2& center, float radius, std::size_t numSides /*= 3*/, const Rgba& color /*= Rgba::White*/) noexcept {
@@ -2261,63 +2401,22 @@ void Renderer::DrawTextLine(const a2de::IFont* font, const std::string& text, co
     if(text.empty()) {
         return;
     }
-    float cursor_x = 0.0f;
-    float cursor_y = 0.0f;
-
-    std::size_t text_size = text.size();
+    const auto& layout = m_text_layout_cache.Get(*font, text, 1.0f, GlyphOffsetX::Subtract);
 
     Mesh::Builder builder;
-    builder.verticies.reserve(text_size * 4);
-    builder.indicies.reserve(text_size * 6);
-
     builder.Begin(PrimitiveType::Triangles);
-    
-    builder.SetColor(color);
-
-    for(auto text_iter = text.begin(); text_iter != text.end(); /* DO NOTHING */) {
-        int c = *text_iter;
-        const auto uvs = font->GetGlyphUVs(c);
-        const auto offsets = font->GetGlyphOffsets(c);
-        const auto dimensions = font->GetGlyphDimensions(c);
-
-        float char_uvl = uvs.mins.x;
-        float char_uvt = uvs.mins.y;
-        float char_uvr = uvs.maxs.x;
-        float char_uvb = uvs.maxs.y;
-
-
-        float quad_top = cursor_y - offsets.y;
-        float quad_bottom = quad_top + dimensions.y;
-        float quad_left = cursor_x - offsets.x;
-        float quad_right = quad_left + dimensions.x;
-
-        builder.SetUV(Vector2{char_uvl, char_uvb});
-        builder.AddVertex(Vector2(quad_left, quad_bottom));
-
-        builder.SetUV(Vector2{char_uvl, char_uvt});
-        builder.AddVertex(Vector2(quad_left, quad_top));
-
-        builder.SetUV(Vector2{char_uvr, char_uvt});
-        builder.AddVertex(Vector2(quad_right, quad_top));
-
-        builder.SetUV(Vector2{char_uvr, char_uvb});
-        builder.AddVertex(Vector2{quad_right, quad_bottom});
-
-        builder.AddIndicies(Mesh::Builder::Primitive::Quad);
-
-        if (std::string::const_iterator previous_char = text_iter++; text_iter != text.end()) {
-            int kern_value = font->GetKerningValue(*previous_char, *text_iter);
-            int advance = font->GetGlyphAdvance(c);
-            cursor_x += (advance + kern_value);
-        }
-    }
-
+    TextLayoutCache::AppendQuads(layout, Vector2::Zero, color, builder.verticies, builder.indicies);
     builder.End(font->GetMaterial());
     if(const auto& cbs = font->GetMaterial()->GetShader()->GetConstantBuffers(); !cbs.empty()) {
+        //Every queued line shares this buffer, so lines queued under the other channel value are drawn first.
+        FlushSpriteBatch();
         auto& font_cb = cbs[0].get();
         Vector4 channel{1.0f, 1.0f, 1.0f, 0.0f};
         font_cb.Update(*m_rhi_context, &channel);
     }
+    if(QueueTextLine(font->GetMaterial(), builder.verticies)) {
+        return;
+    }
     Mesh::Render(builder);
 }
 
@@ -2331,58 +2430,16 @@ void Renderer::DrawTextLine(const Matrix4& transform, const a2de::IFont* font, c
     if(text.empty()) {
         return;
     }
-    float cursor_x = 0.0f;
-    float cursor_y = 0.0f;
-
-    std::size_t text_size = text.size();
+    const auto& layout = m_text_layout_cache.Get(*font, text, 1.0f, GlyphOffsetX::Add);
 
     Mesh::Builder builder;
-    builder.verticies.reserve(text_size * 4);
-    builder.indicies.reserve(text_size * 6);
-
     builder.Begin(PrimitiveType::Triangles);
-
-    builder.SetColor(color);
-
-    for(auto text_iter = std::cbegin(text); text_iter != std::cend(text); /* DO NOTHING */) {
-        int c = *text_iter;
-        
-        const auto uvs = font->GetGlyphUVs(c);
-        float char_uvl = uvs.mins.x;
-        float char_uvt = uvs.mins.y;
-        float char_uvr = uvs.maxs.x;
-        float char_uvb = uvs.maxs.y;
-
-        const auto offsets = font->GetGlyphOffsets(c);
-        const auto dimensions = font->GetGlyphDimensions(c);
-        float quad_top = cursor_y - offsets.y;
-        float quad_bottom = quad_top + dimensions.y;
-        float quad_left = cursor_x + offsets.x;
-        float quad_right = quad_left + dimensions.x;
-
-        builder.SetUV(Vector2{char_uvl, char_uvb});
-        builder.AddVertex(Vector2(quad_left, quad_bottom));
-
-        builder.SetUV(Vector2{char_uvl, char_uvt});
-        builder.AddVertex(Vector2(quad_left, quad_top));
-
-        builder.SetUV(Vector2{char_uvr, char_uvt});
-        builder.AddVertex(Vector2(quad_right, quad_top));
-
-        builder.SetUV(Vector2{char_uvr, char_uvb});
-        builder.AddVertex(Vector2{quad_right, quad_bottom});
-
-        builder.AddIndicies(Mesh::Builder::Primitive::Quad);
-
-        if(std::string::const_iterator previous_char = text_iter++; text_iter != text.end()) {
-            int kern_value = font->GetKerningValue(*previous_char, *text_iter);
-            int advance = font->GetGlyphAdvance(c);
-            cursor_x += (advance + kern_value);
-        }
-    }
-
+    TextLayoutCache::AppendQuads(layout, Vector2::Zero, color, builder.verticies, builder.indicies);
     builder.End(font->GetMaterial());
     SetModelMatrix(transform);
+    if(QueueTextLine(font->GetMaterial(), builder.verticies)) {
+        return;
+    }
     Mesh::Render(builder);
 }
 
@@ -2403,10 +2460,14 @@ void Renderer::DrawMultilineText(const a2de::IFont* font, const std::string& tex
         AppendMultiLineTextBuffer(font, line, draw_loc, color, vbo, ibo);
     }
     if(const auto& cbs = font->GetMaterial()->GetShader()->GetConstantBuffers(); !cbs.empty()) {
+        FlushSpriteBatch();
         auto& font_cb = cbs[0].get();
         Vector4 channel{1.0f, 1.0f, 1.0f, 1.0f};
         font_cb.Update(*m_rhi_context, &channel);
     }
+    if(QueueTextLine(font->GetMaterial(), vbo)) {
+        return;
+    }
     SetMaterial(font->GetMaterial());
     DrawIndexed(PrimitiveType::Triangles, vbo, ibo);
 }
@@ -2421,49 +2482,22 @@ void Renderer::AppendMultiLineTextBuffer(const a2de::IFont* font, const std::str
     if(text.empty()) {
         return;
     }
+    const auto& layout = m_text_layout_cache.Get(*font, text, 1.0f, GlyphOffsetX::Subtract);
+    TextLayoutCache::AppendQuads(layout, start_position, color, vbo, ibo);
+}
 
-    float cursor_x = start_position.x;
-    float cursor_y = start_position.y;
-
-    std::size_t text_size = text.size();
-    vbo.reserve(text_size * 4);
-    ibo.reserve(text_size * 6);
-
-    for(auto text_iter = text.begin(); text_iter != text.end(); /* DO NOTHING */) {
-        int c = *text_iter;
-
-        const auto uvs = font->GetGlyphUVs(c);
-        float char_uvl = uvs.mins.x;
-        float char_uvt = uvs.mins.y;
-        float char_uvr = uvs.maxs.x;
-        float char_uvb = uvs.maxs.y;
-
-        const auto offsets = font->GetGlyphOffsets(c);
-        const auto dimensions = font->GetGlyphDimensions(c);
-        float quad_top = cursor_y - offsets.y;
-        float quad_bottom = quad_top + dimensions.y;
-        float quad_left = cursor_x - offsets.x;
-        float quad_right = quad_left + dimensions.x;
-
-        vbo.emplace_back(Vector3(quad_left, quad_bottom, 0.0f), color, Vector2(char_uvl, char_uvb));
-        vbo.emplace_back(Vector3(quad_left, quad_top, 0.0f), color, Vector2(char_uvl, char_uvt));
-        vbo.emplace_back(Vector3(quad_right, quad_top, 0.0f), color, Vector2(char_uvr, char_uvt));
-        vbo.emplace_back(Vector3(quad_right, quad_bottom, 0.0f), color, Vector2(char_uvr, char_uvb));
-
-        auto s = static_cast<unsigned int>(vbo.size());
-        ibo.push_back(s - 4);
-        ibo.push_back(s - 3);
-        ibo.push_back(s - 2);
-        ibo.push_back(s - 4);
-        ibo.push_back(s - 2);
-        ibo.push_back(s - 1);
-
-        if(std::string::const_iterator previous_char = text_iter++; text_iter != text.end()) {
-            int kern_value = font->GetKerningValue(*previous_char, *text_iter);
-            int advance = font->GetGlyphAdvance(c);
-            cursor_x += (advance + kern_value);
-        }
-    }
+TextLayoutCacheStats Renderer::GetTextLayoutCacheStats() const noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return m_text_layout_cache.GetStats();
+}
+
+void Renderer::InvalidateTextLayouts(const a2de::IFont* font) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    m_text_layout_cache.Invalidate(font);
 }
 
 std::vector<std::unique_ptr<ConstantBuffer>> Renderer::CreateConstantBuffersFromShaderProgram(RHIDevice& device, const ShaderProgram* _shader_program) noexcept {
@@ -2726,6 +2760,10 @@ void Renderer::CreateAndRegisterDefaultShaderPrograms() noexcept {
     auto webp_sp = CreateDefaultUnlit2DSpriteShaderProgram();
     name = webp_sp->GetName();
     RegisterShaderProgram(name, std::move(webp_sp));
+
+    auto particle_sp = CreateDefaultParticleShaderProgram();
+    name = particle_sp->GetName();
+    RegisterShaderProgram(name, std::move(particle_sp));
 }
 
 std::unique_ptr<ShaderProgram> Renderer::CreateDefaultShaderProgram() noexcept {
@@ -4096,6 +4134,95 @@ std::unique_ptr<ShaderProgram> Renderer::CreateDefaultUnlit2DSpriteShaderProgram
     return std::make_unique<ShaderProgram>(std::move(desc));
 }
 
+std::unique_ptr<ShaderProgram> Renderer::CreateDefaultParticleShaderProgram() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    //Each instance places, scales and tints the one particle mesh its emitter built.
+    //The per-instance inputs are only bound by instanced draws. Source: Shaders/particle.hlsl.
+#if 0
+    std::string program =
+    R"(
+
+cbuffer matrix_cb : register(b0) {
+    float4x4 g_MODEL;
+    float4x4 g_VIEW;
+    float4x4 g_PROJECTION;
+};
+
+struct vs_in_t {
+    float3 position : POSITION;
+    float4 color : COLOR;
+    float2 uv : UV;
+    float3 instance_position : INSTANCE_POSITION;
+    float4 instance_color : INSTANCE_COLOR;
+    float3 instance_scale : INSTANCE_TANGENT;
+};
+
+struct ps_in_t {
+    float4 position : SV_POSITION;
+    float4 color : COLOR;
+    float2 uv : UV;
+};
+
+SamplerState sSampler : register(s0);
+
+Texture2D<float4> tDiffuse    : register(t0);
+
+ps_in_t VertexFunction(vs_in_t input_vertex) {
+    ps_in_t output;
+
+    float4 local = float4(input_vertex.position * input_vertex.instance_scale + input_vertex.instance_position, 1.0f);
+    float4 world = mul(local, g_MODEL);
+    float4 view = mul(world, g_VIEW);
+    float4 clip = mul(view, g_PROJECTION);
+
+    output.position = clip;
+    output.color = input_vertex.color * input_vertex.instance_color;
+    output.uv = input_vertex.uv;
+
+    return output;
+}
+
+float4 PixelFunction(ps_in_t input_pixel) : SV_Target0 {
+    float4 albedo = tDiffuse.Sample(sSampler, input_pixel.uv);
+    return albedo * input_pixel.color;
+}
+
+)";
+#endif
+
+#pragma region g_VertexFunction Byte Code
+    static constexpr const std::array<uint8_t, 1568> g_VertexFunction{68, 88, 66, 67, 138, 195, 119, 118, 203, 76, 197, 38, 9, 206, 139, 181, 91, 161, 122, 191, 1, 0, 0, 0, 32, 6, 0, 0, 5, 0, 0, 0, 52, 0, 0, 0, 168, 1, 0, 0, 140, 2, 0, 0, 252, 2, 0, 0, 132, 5, 0, 0, 82, 68, 69, 70, 108, 1, 0, 0, 1, 0, 0, 0, 104, 0, 0, 0, 1, 0, 0, 0, 60, 0, 0, 0, 0, 5, 254, 255, 16, 129, 4, 0, 68, 1, 0, 0, 82, 68, 49, 49, 60, 0, 0, 0, 24, 0, 0, 0, 32, 0, 0, 0, 40, 0, 0, 0, 36, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 109, 97, 116, 114, 105, 120, 95, 99, 98, 0, 171, 171, 92, 0, 0, 0, 3, 0, 0, 0, 128, 0, 0, 0, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 2, 0, 0, 0, 12, 1, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 48, 1, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 2, 0, 0, 0, 12, 1, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 55, 1, 0, 0, 128, 0, 0, 0, 64, 0, 0, 0, 2, 0, 0, 0, 12, 1, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 103, 95, 77, 79, 68, 69, 76, 0, 102, 108, 111, 97, 116, 52, 120, 52, 0, 171, 171, 171, 3, 0, 3, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 103, 95, 86, 73, 69, 87, 0, 103, 95, 80, 82, 79, 74, 69, 67, 84, 73, 79, 78, 0, 77, 105, 99, 114, 111, 115, 111, 102, 116, 32, 40, 82, 41, 32, 72, 76, 83, 76, 32, 83, 104, 97, 100, 101, 114, 32, 67, 111, 109, 112, 105, 108, 101, 114, 32, 49, 48, 46, 49, 0, 73, 83, 71, 78, 220, 0, 0, 0, 6, 0, 0, 0, 8, 0, 0, 0, 152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 15, 15, 0, 0, 167, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 3, 3, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 7, 7, 0, 0, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 15, 15, 0, 0, 203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 5, 0, 0, 0, 7, 7, 0, 0, 80, 79, 83, 73, 84, 73, 79, 78, 0, 67, 79, 76, 79, 82, 0, 85, 86, 0, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79, 78, 0, 73, 78, 83, 84, 65, 78, 67, 69, 95, 67, 79, 76, 79, 82, 0, 73, 78, 83, 84, 65, 78, 67, 69, 95, 84, 65, 78, 71, 69, 78, 84, 0, 79, 83, 71, 78, 104, 0, 0, 0, 3, 0, 0, 0, 8, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 15, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 3, 12, 0, 0, 83, 86, 95, 80, 79, 83, 73, 84, 73, 79, 78, 0, 67, 79, 76, 79, 82, 0, 85, 86, 0, 171, 171, 171, 83, 72, 69, 88, 128, 2, 0, 0, 80, 0, 1, 0, 160, 0, 0, 0, 106, 8, 0, 1, 89, 0, 0, 4, 70, 142, 32, 0, 0, 0, 0, 0, 12, 0, 0, 0, 95, 0, 0, 3, 114, 16, 16, 0, 0, 0, 0, 0, 95, 0, 0, 3, 242, 16, 16, 0, 1, 0, 0, 0, 95, 0, 0, 3, 50, 16, 16, 0, 2, 0, 0, 0, 95, 0, 0, 3, 114, 16, 16, 0, 3, 0, 0, 0, 95, 0, 0, 3, 242, 16, 16, 0, 4, 0, 0, 0, 95, 0, 0, 3, 114, 16, 16, 0, 5, 0, 0, 0, 103, 0, 0, 4, 242, 32, 16, 0, 0, 0, 0, 0, 1, 0, 0, 0, 101, 0, 0, 3, 242, 32, 16, 0, 1, 0, 0, 0, 101, 0, 0, 3, 50, 32, 16, 0, 2, 0, 0, 0, 104, 0, 0, 2, 2, 0, 0, 0, 50, 0, 0, 9, 114, 0, 16, 0, 0, 0, 0, 0, 70, 18, 16, 0, 0, 0, 0, 0, 70, 18, 16, 0, 5, 0, 0, 0, 70, 18, 16, 0, 3, 0, 0, 0, 54, 0, 0, 5, 130, 0, 16, 0, 0, 0, 0, 0, 1, 64, 0, 0, 0, 0, 128, 63, 17, 0, 0, 8, 18, 0, 16, 0, 1, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 8, 34, 0, 16, 0, 1, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 8, 66, 0, 16, 0, 1, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 2, 0, 0, 0, 17, 0, 0, 8, 130, 0, 16, 0, 1, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 3, 0, 0, 0, 17, 0, 0, 8, 18, 0, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 1, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 4, 0, 0, 0, 17, 0, 0, 8, 34, 0, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 1, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 5, 0, 0, 0, 17, 0, 0, 8, 66, 0, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 1, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 6, 0, 0, 0, 17, 0, 0, 8, 130, 0, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 1, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 8, 18, 32, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 8, 0, 0, 0, 17, 0, 0, 8, 34, 32, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 9, 0, 0, 0, 17, 0, 0, 8, 66, 32, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 10, 0, 0, 0, 17, 0, 0, 8, 130, 32, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 142, 32, 0, 0, 0, 0, 0, 11, 0, 0, 0, 56, 0, 0, 7, 242, 32, 16, 0, 1, 0, 0, 0, 70, 30, 16, 0, 1, 0, 0, 0, 70, 30, 16, 0, 4, 0, 0, 0, 54, 0, 0, 5, 50, 32, 16, 0, 2, 0, 0, 0, 70, 16, 16, 0, 2, 0, 0, 0, 62, 0, 0, 1, 83, 84, 65, 84, 148, 0, 0, 0, 17, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+#pragma endregion
+#pragma region g_PixelFunction Byte Code
+    static constexpr const std::array<uint8_t, 732> g_PixelFunction{68, 88, 66, 67, 159, 89, 228, 8, 27, 100, 31, 188, 127, 130, 159, 32, 197, 80, 105, 3, 1, 0, 0, 0, 220, 2, 0, 0, 5, 0, 0, 0, 52, 0, 0, 0, 244, 0, 0, 0, 100, 1, 0, 0, 152, 1, 0, 0, 64, 2, 0, 0, 82, 68, 69, 70, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 60, 0, 0, 0, 0, 5, 255, 255, 16, 129, 4, 0, 142, 0, 0, 0, 82, 68, 49, 49, 60, 0, 0, 0, 24, 0, 0, 0, 32, 0, 0, 0, 40, 0, 0, 0, 36, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 133, 0, 0, 0, 2, 0, 0, 0, 5, 0, 0, 0, 4, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 115, 83, 97, 109, 112, 108, 101, 114, 0, 116, 68, 105, 102, 102, 117, 115, 101, 0, 77, 105, 99, 114, 111, 115, 111, 102, 116, 32, 40, 82, 41, 32, 72, 76, 83, 76, 32, 83, 104, 97, 100, 101, 114, 32, 67, 111, 109, 112, 105, 108, 101, 114, 32, 49, 48, 46, 49, 0, 171, 171, 73, 83, 71, 78, 104, 0, 0, 0, 3, 0, 0, 0, 8, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 15, 15, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 3, 3, 0, 0, 83, 86, 95, 80, 79, 83, 73, 84, 73, 79, 78, 0, 67, 79, 76, 79, 82, 0, 85, 86, 0, 171, 171, 171, 79, 83, 71, 78, 44, 0, 0, 0, 1, 0, 0, 0, 8, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 83, 86, 95, 84, 97, 114, 103, 101, 116, 0, 171, 171, 83, 72, 69, 88, 160, 0, 0, 0, 80, 0, 0, 0, 40, 0, 0, 0, 106, 8, 0, 1, 90, 0, 0, 3, 0, 96, 16, 0, 0, 0, 0, 0, 88, 24, 0, 4, 0, 112, 16, 0, 0, 0, 0, 0, 85, 85, 0, 0, 98, 16, 0, 3, 242, 16, 16, 0, 1, 0, 0, 0, 98, 16, 0, 3, 50, 16, 16, 0, 2, 0, 0, 0, 101, 0, 0, 3, 242, 32, 16, 0, 0, 0, 0, 0, 104, 0, 0, 2, 1, 0, 0, 0, 69, 0, 0, 139, 194, 0, 0, 128, 67, 85, 21, 0, 242, 0, 16, 0, 0, 0, 0, 0, 70, 16, 16, 0, 2, 0, 0, 0, 70, 126, 16, 0, 0, 0, 0, 0, 0, 96, 16, 0, 0, 0, 0, 0, 56, 0, 0, 7, 242, 32, 16, 0, 0, 0, 0, 0, 70, 14, 16, 0, 0, 0, 0, 0, 70, 30, 16, 0, 1, 0, 0, 0, 62, 0, 0, 1, 83, 84, 65, 84, 148, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+#pragma endregion
+
+    ShaderProgramDesc desc{};
+    desc.name = "__particle";
+    {
+        ID3D11VertexShader* vs = nullptr;
+        m_rhi_device->GetDxDevice()->CreateVertexShader(g_VertexFunction.data(), g_VertexFunction.size(), nullptr, &vs);
+        ID3DBlob* blob = nullptr;
+        ::D3DCreateBlob(g_VertexFunction.size(), &blob);
+        std::memcpy(blob->GetBufferPointer(), g_VertexFunction.data(), g_VertexFunction.size());
+        desc.vs = vs;
+        desc.vs_bytecode = blob;
+        desc.input_layout = RHIDevice::CreateInputLayoutFromByteCode(*GetDevice(), blob);
+    }
+    {
+        ID3D11PixelShader* ps = nullptr;
+        m_rhi_device->GetDxDevice()->CreatePixelShader(g_PixelFunction.data(), g_PixelFunction.size(), nullptr, &ps);
+        ID3DBlob* blob = nullptr;
+        ::D3DCreateBlob(g_PixelFunction.size(), &blob);
+        std::memcpy(blob->GetBufferPointer(), g_PixelFunction.data(), g_PixelFunction.size());
+        desc.ps = ps;
+        desc.ps_bytecode = blob;
+    }
+    return std::make_unique<ShaderProgram>(std::move(desc));
+}
+
 void Renderer::CreateAndRegisterDefaultMaterials() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
@@ -4135,6 +4262,10 @@ void Renderer::CreateAndRegisterDefaultMaterials() noexcept {
     auto mat_webp = CreateDefaultUnlit2DSpriteMaterial();
     name = mat_webp->GetName();
     RegisterMaterial(name, std::move(mat_webp));
+
+    auto mat_particle = CreateDefaultParticleMaterial();
+    name = mat_particle->GetName();
+    RegisterMaterial(name, std::move(mat_particle));
 }
 
 std::unique_ptr<Material> Renderer::CreateDefaultMaterial() noexcept {
@@ -4315,6 +4446,25 @@ std::unique_ptr<Material> Renderer::CreateDefaultRoundedRectangle2DMaterial() no
     mat->ClearAllTextureSlots();
     return mat;
 }
+
+std::unique_ptr<Material> Renderer::CreateDefaultParticleMaterial() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    std::string material =
+    R"(
+<material name="__particle">
+    <shader src="__particle" />
+</material>
+)";
+
+    tinyxml2::XMLDocument doc;
+    auto parse_result = doc.Parse(material.c_str(), material.size());
+    if(parse_result != tinyxml2::XML_SUCCESS) {
+        return nullptr;
+    }
+    return std::make_unique<Material>(*doc.RootElement());
+}
 //
 //std::unique_ptr<Material> Renderer::CreateMaterialFromFont(a2de::IFont* font) noexcept {
 //    //TODO: Fix Font Registration from client side
@@ -5778,12 +5928,7 @@ void Renderer::RegisterShader(const std::string& name, std::unique_ptr<Shader> s
     if(!shader) {
         return;
     }
-    auto found_iter = std::find_if(std::begin(m_shaders), std::end(m_shaders), [&name](const auto& s) { return s.first == name; });
-    if(found_iter != m_shaders.end()) {
-        found_iter->second.reset();
-        m_shaders.erase(found_iter);
-    }
-    m_shaders.emplace_back(name, std::move(shader));
+    m_shaders.Register(name, std::move(shader));
 }
 
 bool Renderer::RegisterShader(std::filesystem::path filepath) noexcept {
@@ -5825,13 +5970,10 @@ void Renderer::RegisterShader(std::unique_ptr<Shader> shader) noexcept {
         return;
     }
     std::string name = shader->GetName();
-    auto found_iter = std::find_if(std::begin(m_shaders), std::end(m_shaders), [&name](const auto& s) { return s.first == name; });
-    if(found_iter != m_shaders.end()) {
+    if(m_shaders.Contains(StringId{name})) {
         DebuggerPrintf(std::format("Shader \"{}\" already exists. Overwriting.\n", name));
-        found_iter->second.reset();
-        m_shaders.erase(found_iter);
     }
-    m_shaders.emplace_back(name, std::move(shader));
+    m_shaders.Register(name, std::move(shader));
 }
 
 void Renderer::RegisterFont(const std::string& name, std::unique_ptr<a2de::IFont> font) noexcept {
@@ -5841,12 +5983,7 @@ void Renderer::RegisterFont(const std::string& name, std::unique_ptr<a2de::IFont
     if(font == nullptr) {
         return;
     }
-    auto found_iter = std::find_if(std::begin(m_fonts), std::end(m_fonts), [&name](const auto& s) { return s.first == name; });
-    if(found_iter != m_fonts.end()) {
-        found_iter->second.reset();
-        m_fonts.erase(found_iter);
-    }
-    m_fonts.emplace_back(name, std::move(font));
+    ReplaceFont(name, std::move(font));
 }
 
 void Renderer::RegisterFont(std::unique_ptr<a2de::IFont> font) noexcept {
@@ -5857,12 +5994,18 @@ void Renderer::RegisterFont(std::unique_ptr<a2de::IFont> font) noexcept {
         return;
     }
     std::string name = font->GetName();
-    auto found_iter = std::find_if(std::begin(m_fonts), std::end(m_fonts), [&name](const auto& s) { return s.first == name; });
-    if(found_iter != m_fonts.end()) {
-        found_iter->second.reset();
-        m_fonts.erase(found_iter);
+    ReplaceFont(name, std::move(font));
+}
+
+void Renderer::ReplaceFont(const std::string& name, std::unique_ptr<a2de::IFont> font) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    //Register destroys the font already under name.
+    if(const auto* old_font = m_fonts.Find(name); old_font != nullptr && old_font != font.get()) {
+        m_text_layout_cache.Invalidate(old_font);
     }
-    m_fonts.emplace_back(name, std::move(font));
+    m_fonts.Register(name, std::move(font));
 }
 
 bool Renderer::RegisterFont(std::filesystem::path filepath) noexcept {
@@ -6103,6 +6246,10 @@ void Renderer::CreateAndRegisterDefaultShaders() noexcept {
     auto default_unlit2DSprite = CreateDefaultUnlit2DSpriteShader();
     name = default_unlit2DSprite->GetName();
     RegisterShader(name, std::move(default_unlit2DSprite));
+
+    auto default_particle = CreateDefaultParticleShader();
+    name = default_particle->GetName();
+    RegisterShader(name, std::move(default_particle));
 }
 
 std::unique_ptr<Shader> Renderer::CreateDefaultShader() noexcept {
@@ -6352,6 +6499,36 @@ std::unique_ptr<Shader> Renderer::CreateDefaultInvalidShader() noexcept {
     return std::make_unique<Shader>(*doc.RootElement());
 }
 
+std::unique_ptr<Shader> Renderer::CreateDefaultParticleShader() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    std::string shader =
+    R"(
+<shader name="__particle">
+    <shaderprogram src="__particle" />
+    <raster>
+        <fill>solid</fill>
+        <cull>none</cull>
+    </raster>
+    <sampler src="__default" />
+    <blends>
+        <blend enable="true">
+            <color src="src_alpha" dest="inv_src_alpha" op="add" />
+        </blend>
+    </blends>
+    <depth enable="true" writable="false" />
+</shader>
+)";
+    tinyxml2::XMLDocument doc;
+    auto parse_result = doc.Parse(shader.c_str(), shader.size());
+    if(parse_result != tinyxml2::XML_SUCCESS) {
+        return nullptr;
+    }
+
+    return std::make_unique<Shader>(*doc.RootElement());
+}
+
 std::unique_ptr<Shader> Renderer::CreateDefaultFontShader() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
@@ -6406,13 +6583,10 @@ void Renderer::RegisterMaterial(const std::string& name, std::unique_ptr<Materia
     if(mat == nullptr) {
         return;
     }
-    auto found_iter = std::find_if(std::begin(m_materials), std::end(m_materials), [&name](const auto& m) { return m.first == name; });
-    if(found_iter != m_materials.end()) {
+    if(m_materials.Contains(StringId{name})) {
         DebuggerPrintf(std::format("Material \"{}\" already exists. Overwriting.\n", name));
-        found_iter->second.reset();
-        m_materials.erase(found_iter);
     }
-    m_materials.emplace_back(name, std::move(mat));
+    m_materials.Register(name, std::move(mat));
 }
 
 void Renderer::RegisterMaterial(std::unique_ptr<Material> mat) noexcept {
@@ -6423,13 +6597,10 @@ void Renderer::RegisterMaterial(std::unique_ptr<Material> mat) noexcept {
         return;
     }
     std::string name = mat->GetName();
-    auto found_iter = std::find_if(std::begin(m_materials), std::end(m_materials), [&name](const auto& m) { return m.first == name; });
-    if(found_iter != m_materials.end()) {
+    if(m_materials.Contains(StringId{name})) {
         DebuggerPrintf(std::format("Material \"{}\" already exists. Overwriting.\n", name));
-        found_iter->second.reset();
-        m_materials.erase(found_iter);
     }
-    m_materials.emplace_back(name, std::move(mat));
+    m_materials.Register(name, std::move(mat));
 }
 
 bool Renderer::RegisterMaterial(std::filesystem::path filepath) noexcept {
@@ -6477,16 +6648,17 @@ void Renderer::ReloadMaterials() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    m_textures.clear();
+    m_textures.Clear();
 
     CreateAndRegisterDefaultTextures();
 
-    m_materials.clear();
+    m_materials.Clear();
     CreateAndRegisterDefaultMaterials();
     RegisterMaterialsFromFolder(FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::EngineMaterials));
     RegisterMaterialsFromFolder(FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameMaterials));
 
-    m_fonts.clear();
+    m_text_layout_cache.Clear();
+    m_fonts.Clear();
     CreateAndRegisterDefaultFonts();
     RegisterMaterialsFromFolder(FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::EngineFonts));
     RegisterMaterialsFromFolder(FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameFonts));
@@ -6499,57 +6671,248 @@ void Renderer::RegisterShaderProgram(const std::string& name, std::unique_ptr<Sh
     if(!sp) {
         return;
     }
-    auto found_iter = std::find_if(std::begin(m_shader_programs), std::end(m_shader_programs), [&name](const auto& sp) { return sp.first == name; });
-    if(found_iter != m_shader_programs.end()) {
-        sp->SetDescription(std::move(found_iter->second->GetDescription()));
-        found_iter->second.reset(nullptr);
-        m_shader_programs.erase(found_iter);
+    const auto key = CanonicalizeResourceName(name);
+    if(auto* found = m_shader_programs.Find(StringId{key}); found != nullptr) {
+        sp->SetDescription(std::move(found->GetDescription()));
+    }
+    m_shader_programs.Register(key, std::move(sp));
+    AddResourceAliases(m_shader_programs, name, key);
+}
+
+std::size_t Renderer::UpdateVbo(std::span<const Vertex3D> vbo) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    FlushSpriteBatch();
+    GetVerticesUploadedCounter().Add(vbo.size());
+    return m_vbo_stream->WriteElements(vbo.data(), vbo.size(), sizeof(Vertex3D));
+}
+
+std::size_t Renderer::UpdateVbco(const VertexCircleBuffer::buffer_t& vbco) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    FlushSpriteBatch();
+    GetVerticesUploadedCounter().Add(vbco.size());
+    return m_vbco_stream->Write(vbco);
+}
+
+std::size_t Renderer::UpdateVbio(const VertexBufferInstanced::buffer_t& vbio) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    FlushSpriteBatch();
+    return m_vbio_stream->Write(vbio);
+}
+
+std::size_t Renderer::UpdateIbo(std::span<const unsigned int> ibo) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return m_ibo_stream->WriteElements(ibo.data(), ibo.size(), sizeof(unsigned int));
+}
+
+std::size_t Renderer::UpdatePackedVbo(const VertexLayoutDesc& layout, std::span<const std::byte> vbo) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    FlushSpriteBatch();
+    GetVerticesUploadedCounter().Add(vbo.size() / layout.stride);
+    return m_packed_vbo_stream->WriteElements(vbo.data(), vbo.size() / layout.stride, layout.stride);
+}
+
+void Renderer::BindPackedVertices(const PrimitiveType& topology, const VertexLayoutDesc& layout) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    GUARANTEE_OR_DIE(m_current_material, "Attempting to call Draw function without a material set!\n");
+    auto* program = m_current_material->GetShader()->GetShaderProgram();
+    auto* il = program->GetInputLayout(layout);
+    if(!il) {
+        auto created = RHIDevice::CreateInputLayoutFromVertexLayout(*m_rhi_device, program->GetVSByteCode(), layout);
+        il = created.get();
+        program->AddInputLayout(layout, std::move(created));
+    }
+    auto* dx_context = m_rhi_context->GetDxContext();
+    dx_context->IASetPrimitiveTopology(PrimitiveTypeToD3dTopology(topology));
+    dx_context->IASetInputLayout(il->GetDxInputLayout());
+    unsigned int stride = layout.stride;
+    unsigned int offsets = 0;
+    const auto dx_vbo_buffer = GetStreamBuffer<PackedVertexBuffer>(*m_packed_vbo_stream)->GetDxBuffer();
+    dx_context->IASetVertexBuffers(0, 1, dx_vbo_buffer.GetAddressOf(), &stride, &offsets);
+}
+
+void Renderer::BindInstancedInputLayout() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto* program = m_current_material->GetShader()->GetShaderProgram();
+    auto* il = program->GetInputLayoutInstanced();
+    if(!il) {
+        auto created = RHIDevice::CreateInputLayoutInstancedFromVertexLayouts(*m_rhi_device, program->GetVSByteCode(), GetVertexLayoutDesc<Vertex3D>(), GetVertexLayoutDesc<Vertex3DInstanced>());
+        il = created.get();
+        program->SetInputLayoutInstanced(std::move(created));
+    }
+    m_rhi_context->GetDxContext()->IASetInputLayout(il->GetDxInputLayout());
+}
+
+void Renderer::RestoreMaterialInputLayout() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto* il = m_current_material->GetShader()->GetShaderProgram()->GetInputLayout();
+    m_rhi_context->GetDxContext()->IASetInputLayout(il ? il->GetDxInputLayout() : nullptr);
+}
+
+StreamingBufferStats Renderer::GetStreamingStats() const noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    StreamingBufferStats result{};
+    result += m_vbo_stream->GetLastFrameStats();
+    result += m_vbco_stream->GetLastFrameStats();
+    result += m_vbio_stream->GetLastFrameStats();
+    result += m_ibo_stream->GetLastFrameStats();
+    result += m_packed_vbo_stream->GetLastFrameStats();
+    return result;
+}
+
+SpriteBatchStats Renderer::GetSpriteBatchStats() const noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return m_sprite_batch.GetLastFrameStats();
+}
+
+void Renderer::BeginSpriteBatch() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    FlushSpriteBatch();
+    m_sprite_batch_open = true;
+}
+
+void Renderer::EndSpriteBatch() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    FlushSpriteBatch();
+    m_sprite_batch_open = false;
+}
+
+void Renderer::FlushSpriteBatch() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    if(m_sprite_batch.empty()) {
+        return;
+    }
+    m_sprite_batch.Build();
+    //Written straight to the streams: going through UpdateVbo would flush again.
+    const auto base_vertex = m_vbo_stream->Write(m_sprite_batch.GetVbo());
+    const auto start_index = m_ibo_stream->Write(m_sprite_batch.GetIbo());
+    if(base_vertex == StreamingBuffer::npos || start_index == StreamingBuffer::npos) {
+        //The batch's geometry never reached the GPU; drop it rather than draw whatever the buffers held.
+        m_sprite_batch.Clear();
+        return;
+    }
+    auto* const previous_material = m_current_material;
+    const auto* const previous_texture_override = m_sprite_texture_override;
+    const auto previous_model = m_matrix_data.model;
+    SetModelMatrix(Matrix4::I);
+    const auto& draw_instructions = m_sprite_batch.GetDrawInstructions();
+    const auto& draw_textures = m_sprite_batch.GetDrawTextures();
+    for(std::size_t i = 0u; i < draw_instructions.size(); ++i) {
+        const auto& run = draw_instructions[i];
+        SetMaterial(run.material);
+        if(const auto* texture = draw_textures[i]; texture && texture != m_current_material->GetTexture(Material::TextureID::Diffuse)) {
+            //Binding only reads the texture.
+            SetTexture(const_cast<Texture*>(texture));
+        }
+        DrawIndexed(run.type, GetStreamBuffer<VertexBuffer>(*m_vbo_stream), GetStreamBuffer<IndexBuffer>(*m_ibo_stream), run.indexCount, start_index + run.indexStart, base_vertex + run.baseVertexLocation);
+    }
+    m_sprite_batch.Clear();
+    //SetMaterial also rebinds the material's own constant buffers.
+    if(previous_material) {
+        SetMaterial(previous_material);
+        if(previous_texture_override) {
+            SetTexture(const_cast<Texture*>(previous_texture_override));
+        }
+    } else {
+        ResetMaterial();
     }
-    m_shader_programs.emplace_back(name, std::move(sp));
+    SetModelMatrix(previous_model);
 }
 
-void Renderer::UpdateVbo(const VertexBuffer::buffer_t& vbo) noexcept {
+void Renderer::SetSpriteLayer(int layer) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    if(m_current_vbo_size < vbo.size()) {
-        m_temp_vbo = std::move(m_rhi_device->CreateVertexBuffer<VertexBuffer>(vbo, BufferUsage::Dynamic, BufferBindUsage::Vertex_Buffer));
-        m_current_vbo_size = vbo.size();
+    m_sprite_layer = layer;
+}
+
+void Renderer::DrawSprite(const SpriteSheet& sheet, int spriteIndex, const Matrix4& transform, const Rgba& color /*= Rgba::White*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto uvs = sheet.GetTexCoordsFromSpriteIndex(spriteIndex);
+    SetTexture(const_cast<Texture*>(sheet.GetTexture()));
+    DrawQuad2D(transform, color, Vector4(uvs.mins, uvs.maxs));
+}
+
+void Renderer::DrawSprite(const AnimatedSprite& sprite, const Matrix4& transform, const Rgba& color /*= Rgba::White*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    if(auto* material = sprite.GetMaterial(); material && material != m_current_material) {
+        SetMaterial(material);
     }
-    m_temp_vbo->Update(*m_rhi_context, vbo);
+    const auto uvs = sprite.GetCurrentTexCoords();
+    SetTexture(const_cast<Texture*>(sprite.GetTexture()));
+    DrawQuad2D(transform, color, Vector4(uvs.mins, uvs.maxs));
 }
 
-void Renderer::UpdateVbco(const VertexCircleBuffer::buffer_t& vbco) noexcept {
+bool Renderer::QueueSprite(Material* material, const Texture* texture, SpriteBatch::Quad corners) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    if(m_current_vbco_size < vbco.size()) {
-        m_circle_vbo = std::move(m_rhi_device->CreateVertexBuffer<VertexCircleBuffer>(vbco, BufferUsage::Dynamic, BufferBindUsage::Vertex_Buffer));
-        m_current_vbco_size = vbco.size();
+    if(!m_sprite_batch_open) {
+        return false;
+    }
+    for(auto& corner : corners) {
+        corner.position = m_matrix_data.model.TransformPosition(corner.position);
     }
-    m_circle_vbo->Update(*m_rhi_context, vbco);
+    if(!m_sprite_batch.Add(m_sprite_layer, material, texture, corners)) {
+        FlushSpriteBatch();
+        const auto added = m_sprite_batch.Add(m_sprite_layer, material, texture, corners);
+        GUARANTEE_OR_DIE(added, "Sprite batch could not accept a quad after flushing.");
+    }
+    return true;
 }
 
-void Renderer::UpdateVbio(const VertexBufferInstanced::buffer_t& vbio) noexcept {
+bool Renderer::QueueTextLine(Material* material, const std::vector<Vertex3D>& verticies) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    if(m_current_vbio_size < vbio.size()) {
-        m_temp_vbio = std::move(m_rhi_device->CreateVertexBufferInstanced(vbio, BufferUsage::Dynamic, BufferBindUsage::Vertex_Buffer));
-        m_current_vbio_size = vbio.size();
+    if(!m_sprite_batch_open) {
+        return false;
+    }
+    const auto* texture = material ? material->GetTexture(Material::TextureID::Diffuse) : nullptr;
+    for(std::size_t v = 0u; v + 3u < verticies.size(); v += 4u) {
+        [[maybe_unused]] const auto queued = QueueSprite(material, texture, SpriteBatch::Quad{verticies[v + 0u], verticies[v + 1u], verticies[v + 2u], verticies[v + 3u]});
     }
-    m_temp_vbio->Update(*m_rhi_context, vbio);
+    m_sprite_batch.CountSubmittedDraw();
+    return true;
 }
 
-void Renderer::UpdateIbo(const IndexBuffer::buffer_t& ibo) noexcept {
+const Texture* Renderer::GetCurrentSpriteTexture() const noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    if(m_current_ibo_size < ibo.size()) {
-        m_temp_ibo = std::move(m_rhi_device->CreateIndexBuffer(ibo, BufferUsage::Dynamic, BufferBindUsage::Index_Buffer));
-        m_current_ibo_size = ibo.size();
+    if(m_sprite_texture_override) {
+        return m_sprite_texture_override;
     }
-    m_temp_ibo->Update(*m_rhi_context, ibo);
+    return m_current_material ? m_current_material->GetTexture(Material::TextureID::Diffuse) : nullptr;
 }
 
 RHIDeviceContext* Renderer::GetDeviceContext() const noexcept {
@@ -6584,17 +6947,7 @@ ShaderProgram* Renderer::GetShaderProgram(const std::string& nameOrFile) noexcep
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    namespace FS = std::filesystem;
-    FS::path p{nameOrFile};
-    if(!StringUtils::StartsWith(p.string(), "__")) {
-        p = FS::canonical(p);
-    }
-    p.make_preferred();
-    auto found_iter = std::find_if(std::cbegin(m_shader_programs), std::cend(m_shader_programs), [&p](const auto& sp) { return sp.first == p.string(); });
-    if(found_iter == m_shader_programs.end()) {
-        return nullptr;
-    }
-    return found_iter->second.get();
+    return FindByNormalizedName(m_shader_programs, nameOrFile);
 }
 
 std::unique_ptr<ShaderProgram> Renderer::CreateShaderProgramFromCsoFile(std::filesystem::path filepath, const PipelineStage& target) const noexcept {
@@ -6684,11 +7037,18 @@ Material* Renderer::GetMaterial(const std::string& nameOrFile) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    auto found_iter = std::find_if(std::cbegin(m_materials), std::cend(m_materials), [&nameOrFile](const auto& m) { return m.first == nameOrFile; });
-    if(found_iter == m_materials.end()) {
-        return GetMaterial("__invalid");
+    return GetMaterial(StringId{nameOrFile});
+}
+
+Material* Renderer::GetMaterial(const StringId& id) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    if(auto* material = m_materials.Find(id); material != nullptr) {
+        return material;
     }
-    return found_iter->second.get();
+    static constexpr StringId invalid_material_id{"__invalid"};
+    return m_materials.Find(invalid_material_id);
 }
 
 void Renderer::SetMaterial(Material* material) noexcept {
@@ -6724,6 +7084,7 @@ void Renderer::ResetMaterial() noexcept {
     m_current_raster_state = nullptr;
     m_current_depthstencil_state = nullptr;
     m_current_sampler = nullptr;
+    m_sprite_texture_override = nullptr;
     m_materials_need_updating = true;
 }
 
@@ -6731,17 +7092,7 @@ bool Renderer::IsTextureLoaded(const std::string& nameOrFile) const noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    namespace FS = std::filesystem;
-    FS::path p{nameOrFile};
-    if(!StringUtils::StartsWith(p.string(), "__") && std::filesystem::is_regular_file(p)) {
-        std::error_code ec{};
-        p = FS::canonical(p, ec);
-        if(ec) {
-            return false;
-        }
-    }
-    const auto found_iter = std::find_if(std::cbegin(m_textures), std::cend(m_textures), [&p](const auto& t) { return t.first == p.string(); });
-    return found_iter != std::cend(m_textures);
+    return FindByNormalizedName(m_textures, nameOrFile) != nullptr;
 }
 
 bool Renderer::IsTextureNotLoaded(const std::string& nameOrFile) const noexcept {
@@ -6755,11 +7106,14 @@ Shader* Renderer::GetShader(const std::string& nameOrFile) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    const auto found_iter = std::find_if(std::cbegin(m_shaders), std::cend(m_shaders), [&nameOrFile](const auto& s) { return s.first == nameOrFile; });
-    if(found_iter == m_shaders.end()) {
-        return nullptr;
-    }
-    return found_iter->second.get();
+    return m_shaders.Find(StringId{nameOrFile});
+}
+
+Shader* Renderer::GetShader(const StringId& id) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return m_shaders.Find(id);
 }
 
 std::string Renderer::GetShaderName(const std::filesystem::path filepath) noexcept {
@@ -6788,18 +7142,21 @@ void Renderer::SetComputeShader(Shader* shader) noexcept {
 }
 
 a2de::IFont* Renderer::GetDefaultFont() noexcept {
-    return m_fonts[0].second.get();
+    return m_fonts.Get(0u);
 }
 
 a2de::IFont* Renderer::GetFont(const std::string& nameOrFile) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    auto found_iter = std::find_if(std::cbegin(m_fonts), std::cend(m_fonts), [&nameOrFile](const auto& f) { return f.first == nameOrFile; });
-    if(found_iter == m_fonts.end()) {
-        return nullptr;
-    }
-    return found_iter->second.get();
+    return m_fonts.Find(StringId{nameOrFile});
+}
+
+a2de::IFont* Renderer::GetFont(const StringId& id) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    return m_fonts.Find(id);
 }
 
 a2de::IFont* Renderer::GetFontById(uint16_t index) noexcept {
@@ -6809,20 +7166,14 @@ a2de::IFont* Renderer::GetFontById(uint16_t index) noexcept {
     if(index >= m_fonts.size()) {
         index = uint16_t{0u};
     }
-    return m_fonts[index].second.get();
+    return m_fonts.Get(index);
 }
 
 std::size_t Renderer::GetFontId(const std::string& nameOrFile) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    const auto size = m_fonts.size();
-    for(std::size_t i = 0u; i < size; ++i) {
-        if(m_fonts[i].first == nameOrFile) {
-            return i;
-        }
-    }
-    return size;
+    return m_fonts.FindIndex(StringId{nameOrFile});
 }
 
 void Renderer::SetModelMatrix(const Matrix4& mat /*= Matrix4::I*/) noexcept {
@@ -6838,6 +7189,7 @@ void Renderer::SetViewMatrix(const Matrix4& mat /*= Matrix4::I*/) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     m_matrix_data.view = mat;
     m_matrix_cb->Update(*m_rhi_context, &m_matrix_data);
     SetConstantBuffer(GetMatrixBufferIndex(), m_matrix_cb.get());
@@ -6847,6 +7199,7 @@ void Renderer::SetProjectionMatrix(const Matrix4& mat /*= Matrix4::I*/) noexcept
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     m_matrix_data.projection = mat;
     m_matrix_cb->Update(*m_rhi_context, &m_matrix_data);
     SetConstantBuffer(GetMatrixBufferIndex(), m_matrix_cb.get());
@@ -7081,7 +7434,7 @@ void Renderer::DrawBezier(const Vector2& p0, const Vector2& p1, const Vector2& p
 #endif
     Vector2 prevPointOnCurve = p0;
 
-    std::vector<Vector3> verts;
+    std::pmr::vector<Vector3> verts{FrameArena::GetResource()};
     resolution = (std::max)(std::size_t{1u}, resolution);
     verts.reserve(std::size_t{2u} * resolution);
     for(int i = 0; i < resolution; ++i) {
@@ -7092,16 +7445,16 @@ void Renderer::DrawBezier(const Vector2& p0, const Vector2& p1, const Vector2& p
         prevPointOnCurve = nextPointOnCurve;
     }
 
-    std::vector<Vertex3D> vbo{};
+    std::pmr::vector<Vertex3D> vbo{FrameArena::GetResource()};
     vbo.reserve(verts.size());
     for (const auto v : verts) {
         vbo.emplace_back(v, color);
     }
 
-    std::vector<unsigned int> ibo{};
+    std::pmr::vector<unsigned int> ibo{FrameArena::GetResource()};
     ibo.resize(vbo.size());
     std::iota(std::begin(ibo), std::end(ibo), 0u);
-    DrawIndexed(PrimitiveType::LinesStrip, vbo, ibo);
+    DrawIndexedTransient(PrimitiveType::LinesStrip, vbo, ibo);
 }
 
 void Renderer::DrawCube(const Vector3& position /*= Vector3::ZERO*/, const Vector3& halfExtents /*= Vector3::ONE * 0.5f*/, const Rgba& color /*= Rgba::White*/) {
@@ -7227,6 +7580,7 @@ void Renderer::SetRenderTarget(FrameBuffer& frameBuffer) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     frameBuffer.Bind();
 }
 
@@ -7234,6 +7588,7 @@ void Renderer::SetRenderTarget(Texture* color_target /*= nullptr*/, Texture* dep
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     if(color_target != nullptr) {
         m_current_target = color_target;
     } else {
@@ -7333,6 +7688,7 @@ void Renderer::SetViewport(float x, float y, float width, float height) noexcept
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     D3D11_VIEWPORT viewport;
     memset(&viewport, 0, sizeof(viewport));
 
@@ -7371,6 +7727,7 @@ void Renderer::SetViewports(const std::vector<AABB3>& viewports) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     std::vector<D3D11_VIEWPORT> dxViewports{};
     dxViewports.resize(viewports.size());
 
@@ -7389,6 +7746,7 @@ void Renderer::SetScissor(unsigned int x, unsigned int y, unsigned int width, un
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     D3D11_RECT scissor{};
     scissor.left = x;
     scissor.right = x + width;
@@ -7447,6 +7805,7 @@ void Renderer::SetScissors(const std::vector<AABB2>& scissors) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     std::vector<D3D11_RECT> dxScissors{};
     dxScissors.resize(scissors.size());
 
@@ -7528,6 +7887,7 @@ void Renderer::ClearColor(const Rgba& color) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     m_rhi_context->ClearColorTarget(m_current_target, color);
 }
 
@@ -7542,6 +7902,7 @@ void Renderer::ClearDepthStencilBuffer() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    FlushSpriteBatch();
     m_rhi_context->ClearDepthStencilTarget(m_current_depthstencil);
 }
 
@@ -7556,6 +7917,7 @@ void Renderer::Present() noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
+    EndSpriteBatch();
     m_rhi_output->Present(m_vsync);
 }
 
@@ -7563,19 +7925,27 @@ Texture* Renderer::CreateOrGetTexture(const std::filesystem::path& filepath, con
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
-    namespace FS = std::filesystem;
-    FS::path p(filepath);
-    p = FS::canonical(p);
-    p.make_preferred();
-    auto texture_iter = std::find_if(std::cbegin(m_textures), std::cend(m_textures), [&p](const auto& t) { return t.first == p.string(); });
-    if(texture_iter == m_textures.end()) {
-        return CreateTexture(p.string(), dimensions);
-    } else {
-        return GetTexture(p.string());
+    if(auto* texture = GetTexture(filepath.string()); texture != nullptr) {
+        return texture;
     }
+    return CreateTexture(filepath, dimensions);
 }
 
 void Renderer::RegisterTexturesFromFolder(std::filesystem::path folderpath, bool recursive /*= false*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    namespace FS = std::filesystem;
+    if(!FS::exists(folderpath)) {
+        DebuggerPrintf(std::format("Attempting to Register Textures from unknown path: {}\n", FS::absolute(folderpath)));
+        return;
+    }
+    //Decode every image in parallel, then wait so callers still see every texture registered on return.
+    RegisterTexturesFromFolderAsync(folderpath, recursive);
+    WaitForTextureLoads();
+}
+
+void Renderer::RegisterTexturesFromFolderAsync(std::filesystem::path folderpath, bool recursive /*= false*/) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
 #endif
@@ -7588,6 +7958,11 @@ void Renderer::RegisterTexturesFromFolder(std::filesystem::path folderpath, bool
     folderpath.make_preferred();
     auto cb =
     [this](const FS::path& p) {
+        if(Image::IsSupportedExtension(p.extension())) {
+            [[maybe_unused]] const auto texture = CreateOrGetTextureAsync(p);
+            return;
+        }
+        //Everything Image cannot decode goes through the synchronous path.
         if(!RegisterTexture(p)) {
             DebuggerPrintf(std::format("Failed to load texture at {}\n", p));
         }
@@ -7595,6 +7970,64 @@ void Renderer::RegisterTexturesFromFolder(std::filesystem::path folderpath, bool
     FileUtils::ForEachFileInFolder(folderpath, std::string{}, cb, recursive);
 }
 
+std::shared_ptr<AsyncTexture> Renderer::CreateOrGetTextureAsync(const std::filesystem::path& filepath) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto key = CanonicalizeResourceName(filepath.string());
+    if(auto* texture = m_textures.Find(StringId{key}); texture != nullptr) {
+        return std::make_shared<AsyncTexture>(key, texture, nullptr);
+    }
+    const auto found = std::find_if(std::cbegin(m_pending_textures), std::cend(m_pending_textures), [&key](const auto& pending) { return pending->GetFilepath() == key; });
+    if(found != std::cend(m_pending_textures)) {
+        return *found;
+    }
+    auto result = std::make_shared<AsyncTexture>(key, GetTexture("__default"), AsyncImage::Load(key));
+    m_pending_textures.push_back(result);
+    return result;
+}
+
+void Renderer::WaitForTextureLoads() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    for(const auto& pending : m_pending_textures) {
+        pending->GetImage()->Wait();
+    }
+    UploadLoadedTextures(m_pending_textures.size());
+}
+
+void Renderer::UploadLoadedTextures(std::size_t maxUploads) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    std::size_t upload_count = 0u;
+    for(auto iter = std::begin(m_pending_textures); iter != std::end(m_pending_textures) && upload_count < maxUploads;) {
+        auto& pending = *iter;
+        const auto* image = pending->GetImage();
+        if(!image->IsDone()) {
+            ++iter;
+            continue;
+        }
+        const auto& filepath = pending->GetFilepath();
+        Texture* texture = nullptr;
+        if(image->IsReady()) {
+            texture = Create2DTextureFromImage(filepath, image->GetImage(), BufferUsage::Static, BufferBindUsage::Shader_Resource, ImageFormat::R8G8B8A8_UNorm);
+            //Someone may have loaded the same file synchronously while this one was decoding.
+            if(texture == nullptr) {
+                texture = GetTexture(filepath.string());
+            }
+        }
+        if(texture == nullptr) {
+            DebuggerPrintf(std::format("Failed to load texture at {}\n", filepath));
+            texture = GetTexture("__invalid");
+        }
+        pending->Finish(texture);
+        iter = m_pending_textures.erase(iter);
+        ++upload_count;
+    }
+}
+
 bool Renderer::RegisterTexture(const std::filesystem::path& filepath) noexcept {
 #ifdef PROFILE_BUILD
     ZoneScopedC(0xFF0000);
@@ -7628,6 +8061,9 @@ void Renderer::SetTexture(Texture* texture, unsigned int registerIndex /*= 0*/)
     ZoneScopedC(0xFF0000);
 #endif
     m_current_target = texture;
+    if(registerIndex == 0u) {
+        m_sprite_texture_override = texture;
+    }
     m_rhi_context->SetTexture(registerIndex, m_current_target);
 }
 std::unique_ptr<Texture> Renderer::CreateDepthStencil(const RHIDevice& owner, uint32_t width, uint32_t height) noexcept {
@@ -8013,7 +8449,13 @@ Texture* Renderer::Create2DTexture(std::filesystem::path filepath, const BufferU
     filepath = FS::canonical(filepath);
     filepath.make_preferred();
     Image img = Image(filepath);
+    return Create2DTextureFromImage(filepath, img, bufferUsage, bindUsage, imageFormat);
+}
 
+Texture* Renderer::Create2DTextureFromImage(const std::filesystem::path& filepath, const Image& img, const BufferUsage& bufferUsage, const BufferBindUsage& bindUsage, const ImageFormat& imageFormat) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
     const auto is_gif = filepath.has_extension() && StringUtils::ToLowerCase(filepath.extension().string()) == ".gif";
     D3D11_TEXTURE2D_DESC tex_desc{};
     tex_desc.Width = img.GetDimensions().x;                        // width...
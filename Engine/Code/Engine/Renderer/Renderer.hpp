@@ -10,6 +10,8 @@
 #include "Engine/Core/Image.hpp"
 #include "Engine/Core/IFont.hpp"
 #include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/ResourceRegistry.hpp"
+#include "Engine/Core/StringId.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/AABB3.hpp"
@@ -21,8 +23,13 @@
 #include "Engine/Renderer/FrameBuffer.hpp"
 #include "Engine/Renderer/Flipbook.hpp"
 #include "Engine/Renderer/IndexBuffer.hpp"
+#include "Engine/Renderer/PackedVertexBuffer.hpp"
 #include "Engine/Renderer/RenderTargetStack.hpp"
 #include "Engine/Renderer/RendererTypes.hpp"
+#include "Engine/Renderer/SpriteBatch.hpp"
+#include "Engine/Renderer/TextLayoutCache.hpp"
+#include "Engine/Renderer/StreamingBuffer.hpp"
+#include "Engine/Renderer/StreamingBufferTarget.hpp"
 #include "Engine/Renderer/StructuredBuffer.hpp"
 #include "Engine/Renderer/VertexBuffer.hpp"
 #include "Engine/Renderer/Vertex3D.hpp"
@@ -30,6 +37,7 @@
 #include "Engine/Renderer/VertexBuffer.hpp"
 #include "Engine/Renderer/VertexCircleBuffer.hpp"
 #include "Engine/Renderer/VertexBufferInstanced.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
 
 #include "Engine/Services/IRendererService.hpp"
 
@@ -40,6 +48,7 @@
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -132,10 +141,14 @@ public:
 
     [[nodiscard]] Texture* CreateOrGetTexture(const std::filesystem::path& filepath, const IntVector3& dimensions) noexcept override;
     void RegisterTexturesFromFolder(std::filesystem::path folderpath, bool recursive = false) noexcept override;
+    [[nodiscard]] std::shared_ptr<AsyncTexture> CreateOrGetTextureAsync(const std::filesystem::path& filepath) noexcept override;
+    void RegisterTexturesFromFolderAsync(std::filesystem::path folderpath, bool recursive = false) noexcept override;
+    void WaitForTextureLoads() noexcept override;
     [[nodiscard]] bool RegisterTexture(const std::string& name, std::unique_ptr<Texture> texture) noexcept override;
     void SetTexture(Texture* texture, unsigned int registerIndex = 0) noexcept override;
 
     [[nodiscard]] Texture* GetTexture(const std::string& nameOrFile) noexcept override;
+    [[nodiscard]] Texture* GetTexture(const StringId& id) noexcept override;
 
     [[nodiscard]] std::unique_ptr<Texture> CreateDepthStencil(const RHIDevice& owner, uint32_t width, uint32_t height) noexcept override;
     [[nodiscard]] std::unique_ptr<Texture> CreateDepthStencil(const RHIDevice& owner, const IntVector2& dimensions) noexcept override;
@@ -180,6 +193,7 @@ public:
 
     [[nodiscard]] std::shared_ptr<SpriteSheet> CreateSpriteSheet(const std::filesystem::path& filepath, unsigned int width = 1, unsigned int height = 1) noexcept override;
     [[nodiscard]] std::shared_ptr<SpriteSheet> CreateSpriteSheet(const XMLElement& elem) noexcept override;
+    [[nodiscard]] std::shared_ptr<SpriteSheet> CreateSpriteSheet(const TextureAtlas& atlas, const std::string& regionName, unsigned int width = 1, unsigned int height = 1) noexcept override;
     [[nodiscard]] std::unique_ptr<AnimatedSprite> CreateAnimatedSprite(std::filesystem::path filepath) noexcept override;
     [[nodiscard]] std::unique_ptr<AnimatedSprite> CreateAnimatedSprite(const AnimatedSpriteDesc& desc) noexcept override;
     [[nodiscard]] std::unique_ptr<AnimatedSprite> CreateAnimatedSprite(std::shared_ptr<SpriteSheet> sheet, const IntVector2& startSpriteCoords = IntVector2::Zero) noexcept override;
@@ -240,6 +254,8 @@ public:
 
     void DrawIndexed(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo) noexcept override;
     void DrawIndexed(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, std::size_t index_count, std::size_t startVertex = 0, std::size_t baseVertexLocation = 0) noexcept override;
+    void Draw(const PrimitiveType& topology, const VertexLayoutDesc& layout, std::span<const std::byte> vbo) noexcept override;
+    void DrawIndexed(const PrimitiveType& topology, const VertexLayoutDesc& layout, std::span<const std::byte> vbo, const std::vector<unsigned int>& ibo, std::size_t index_count, std::size_t startVertex = 0, std::size_t baseVertexLocation = 0) noexcept override;
     void DrawInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, std::size_t instanceCount) noexcept override;
     void DrawInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, std::size_t instanceCount, std::size_t vertexCount) noexcept override;
     void DrawIndexedInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, const std::vector<unsigned int>& ibo, std::size_t instanceCount) noexcept override;
@@ -287,6 +303,7 @@ public:
     void ReloadMaterials() noexcept override;
 
     [[nodiscard]] Material* GetMaterial(const std::string& nameOrFile) noexcept override;
+    [[nodiscard]] Material* GetMaterial(const StringId& id) noexcept override;
     void SetMaterial(Material* material) noexcept override;
     void SetMaterial(const std::string& nameOrFile) noexcept override;
     void ResetMaterial() noexcept override;
@@ -298,6 +315,7 @@ public:
     void RegisterShader(std::unique_ptr<Shader> shader) noexcept override;
 
     [[nodiscard]] Shader* GetShader(const std::string& nameOrFile) noexcept override;
+    [[nodiscard]] Shader* GetShader(const StringId& id) noexcept override;
     [[nodiscard]] std::string GetShaderName(const std::filesystem::path filepath) noexcept override;
 
     void SetComputeShader(Shader* shader) noexcept override;
@@ -305,6 +323,7 @@ public:
 
     [[nodiscard]] a2de::IFont* GetDefaultFont() noexcept override;
     [[nodiscard]] a2de::IFont* GetFont(const std::string& nameOrFile) noexcept override;
+    [[nodiscard]] a2de::IFont* GetFont(const StringId& id) noexcept override;
     [[nodiscard]] a2de::IFont* GetFontById(uint16_t index) noexcept override;
     [[nodiscard]] std::size_t GetFontId(const std::string& nameOrFile) noexcept override;
     void RegisterFont(std::unique_ptr<a2de::IFont> font) noexcept override;
@@ -329,6 +348,15 @@ public:
     void SetCamera(const Camera3D& camera) noexcept override;
     void SetCamera(const Camera2D& camera) noexcept override;
     [[nodiscard]] Camera3D GetCamera() const noexcept override;
+    [[nodiscard]] StreamingBufferStats GetStreamingStats() const noexcept override;
+    [[nodiscard]] SpriteBatchStats GetSpriteBatchStats() const noexcept override;
+
+    void BeginSpriteBatch() noexcept override;
+    void EndSpriteBatch() noexcept override;
+    void FlushSpriteBatch() noexcept override;
+    void SetSpriteLayer(int layer) noexcept override;
+    void DrawSprite(const SpriteSheet& sheet, int spriteIndex, const Matrix4& transform, const Rgba& color = Rgba::White) noexcept override;
+    void DrawSprite(const AnimatedSprite& sprite, const Matrix4& transform, const Rgba& color = Rgba::White) noexcept override;
 
     [[nodiscard]] Vector2 ConvertWorldToScreenCoords(const Vector3& worldCoords) const noexcept override;
     [[nodiscard]] Vector2 ConvertWorldToScreenCoords(const Vector2& worldCoords) const noexcept override;
@@ -390,6 +418,8 @@ public:
     void DrawTextLine(const Matrix4& transform, const a2de::IFont* font, const std::string& text, const Rgba& color = Rgba::White) noexcept override;
     void DrawMultilineText(const a2de::IFont* font, const std::string& text, const Rgba& color = Rgba::White) noexcept override;
     void AppendMultiLineTextBuffer(const a2de::IFont* font, const std::string& text, const Vector2& start_position, const Rgba& color, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) noexcept override;
+    [[nodiscard]] TextLayoutCacheStats GetTextLayoutCacheStats() const noexcept override;
+    void InvalidateTextLayouts(const a2de::IFont* font) noexcept override;
 
     void CopyTexture(const Texture* src, Texture* dst) const noexcept override;
     void ResizeBuffers() noexcept override;
@@ -413,6 +443,8 @@ public:
 
 protected:
 private:
+    //Keeps a burst of finished decodes from stalling a single frame with uploads.
+    static constexpr std::size_t max_texture_uploads_per_frame = 8u;
 
     [[nodiscard]] Image GetBackbufferAsImage() const noexcept;
 
@@ -432,14 +464,70 @@ private:
     void CreateDefaultConstantBuffers() noexcept;
     void CreateWorkingVboAndIbo() noexcept;
 
-    void UpdateVbo(const VertexBuffer::buffer_t& vbo) noexcept;
-    void UpdateVbco(const VertexCircleBuffer::buffer_t& vbco) noexcept;
-    void UpdateVbio(const VertexBufferInstanced::buffer_t& vbio) noexcept;
-    void UpdateIbo(const IndexBuffer::buffer_t& ibo) noexcept;
+    //Each returns the location of the first element written to its streaming buffer,
+    //or StreamingBuffer::npos if the buffer could not be mapped and the draw should be skipped.
+    [[nodiscard]] std::size_t UpdateVbo(std::span<const Vertex3D> vbo) noexcept;
+    [[nodiscard]] std::size_t UpdateVbco(const VertexCircleBuffer::buffer_t& vbco) noexcept;
+    [[nodiscard]] std::size_t UpdateVbio(const VertexBufferInstanced::buffer_t& vbio) noexcept;
+    [[nodiscard]] std::size_t UpdateIbo(std::span<const unsigned int> ibo) noexcept;
+    [[nodiscard]] std::size_t UpdatePackedVbo(const VertexLayoutDesc& layout, std::span<const std::byte> vbo) noexcept;
+    //Binds the packed vertex stream and an input layout for layout built against the current material's shader.
+    void BindPackedVertices(const PrimitiveType& topology, const VertexLayoutDesc& layout) noexcept;
+    //Streams spans of per-frame scratch (usually FrameArena-backed pmr vectors) through the same path as the vector DrawIndexed.
+    void DrawIndexedTransient(const PrimitiveType& topology, std::span<const Vertex3D> vbo, std::span<const unsigned int> ibo) noexcept;
+    //Binds an input layout reading Vertex3D from slot 0 and Vertex3DInstanced from slot 1, built against the current material's shader.
+    void BindInstancedInputLayout() noexcept;
+    //Puts back the input layout SetMaterial bound, for draws that follow without setting a new material.
+    void RestoreMaterialInputLayout() noexcept;
+
+    //Queues a quad in the open sprite batch, moving its corners by the current model matrix. Returns false when no batch is open.
+    [[nodiscard]] bool QueueSprite(Material* material, const Texture* texture, SpriteBatch::Quad corners) noexcept;
+    //The texture the current material's quads sample: one bound with SetTexture since the material was set, else its diffuse texture.
+    [[nodiscard]] const Texture* GetCurrentSpriteTexture() const noexcept;
+    //Queues each four-vertex quad of a text line's vertices. Returns false when no batch is open.
+    [[nodiscard]] bool QueueTextLine(Material* material, const std::vector<Vertex3D>& verticies) noexcept;
+
+    //Uploads at most maxUploads decoded asynchronous textures. Must be called on the thread that owns the device context.
+    void UploadLoadedTextures(std::size_t maxUploads) noexcept;
+    [[nodiscard]] Texture* Create2DTextureFromImage(const std::filesystem::path& filepath, const Image& img, const BufferUsage& bufferUsage, const BufferBindUsage& bindUsage, const ImageFormat& imageFormat) noexcept;
+
+    //Canonical, preferred-separator form of a file path, or nameOrFile unchanged for "__" names and names that are not files.
+    //Touches the filesystem, so it is only used when registering or loading, never when looking up.
+    [[nodiscard]] static std::string CanonicalizeResourceName(const std::string& nameOrFile) noexcept;
+    //Lexically normal, preferred-separator form of nameOrFile. Pure string work, for the lookup path.
+    [[nodiscard]] static std::string NormalizeResourceName(const std::string& nameOrFile) noexcept;
+    //key relative to the working directory, or empty when key is not an absolute path inside it.
+    [[nodiscard]] static std::string GetWorkingDirectoryRelativeName(const std::string& key) noexcept;
+
+    //Makes every spelling a lookup normalizes to find the resource registered as key:
+    //the name it was registered with and, for files under the working directory, the relative path.
+    template<typename T>
+    static void AddResourceAliases(ResourceRegistry<T>& registry, const std::string& name, const std::string& key) noexcept {
+        const auto index = registry.FindIndex(StringId{key});
+        for(const auto& alias : {name, NormalizeResourceName(name), GetWorkingDirectoryRelativeName(key)}) {
+            if(!alias.empty() && alias != key) {
+                registry.AddAlias(alias, index);
+            }
+        }
+    }
+
+    //Read-only: neither the filesystem nor the registry is touched, so a miss costs two hash lookups.
+    template<typename T>
+    [[nodiscard]] static T* FindByNormalizedName(const ResourceRegistry<T>& registry, const std::string& nameOrFile) noexcept {
+        if(auto* resource = registry.Find(StringId{nameOrFile}); resource != nullptr) {
+            return resource;
+        }
+        return registry.Find(StringId{NormalizeResourceName(nameOrFile)});
+    }
+
+    template<typename ArrayBufferType>
+    [[nodiscard]] static ArrayBufferType* GetStreamBuffer(const StreamingBuffer& stream) noexcept {
+        return static_cast<ArrayBufferStreamingTarget<ArrayBufferType>&>(stream.GetTarget()).GetBuffer();
+    }
 
     //void Draw(const PrimitiveType& topology, VertexBuffer* vbo, std::size_t vertex_count) noexcept;
     template<typename ArrayBufferType>
-    void Draw(const PrimitiveType& topology, ArrayBufferType* vbo, std::size_t vertex_count) noexcept {
+    void Draw(const PrimitiveType& topology, ArrayBufferType* vbo, std::size_t vertex_count, std::size_t startVertex = 0) noexcept {
         GUARANTEE_OR_DIE(m_current_material, "Attempting to call Draw function without a material set!\n");
         #ifdef PROFILE_BUILD
         ZoneScopedC(0xFF0000);
@@ -450,7 +538,7 @@ private:
         unsigned int offsets = 0;
         const auto dx_vbo_buffer = vbo->GetDxBuffer();
         m_rhi_context->GetDxContext()->IASetVertexBuffers(0, 1, dx_vbo_buffer.GetAddressOf(), &stride, &offsets);
-        m_rhi_context->Draw(vertex_count);
+        m_rhi_context->Draw(vertex_count, startVertex);
     }
 
     void DrawInstanced(const PrimitiveType& topology, VertexBuffer* vbo, VertexBufferInstanced* vbio, std::size_t vertexPerInstanceCount, std::size_t instanceCount, std::size_t startVertexLocation, std::size_t startInstanceLocation) noexcept;
@@ -505,6 +593,7 @@ private:
     [[nodiscard]] std::unique_ptr<ShaderProgram> CreateDefaultCircle2DShaderProgram() noexcept;
     [[nodiscard]] std::unique_ptr<ShaderProgram> CreateDefaultRoundedRectangle2DShaderProgram() noexcept;
     [[nodiscard]] std::unique_ptr<ShaderProgram> CreateDefaultUnlit2DSpriteShaderProgram() noexcept;
+    [[nodiscard]] std::unique_ptr<ShaderProgram> CreateDefaultParticleShaderProgram() noexcept;
 
     [[nodiscard]] void CreateAndRegisterDefaultShaders() noexcept;
     [[nodiscard]] std::unique_ptr<Shader> CreateDefaultShader() noexcept;
@@ -517,6 +606,7 @@ private:
     [[nodiscard]] std::unique_ptr<Shader> CreateDefaultNormalMapShader() noexcept;
     [[nodiscard]] std::unique_ptr<Shader> CreateDefaultInvalidShader() noexcept;
     [[nodiscard]] std::unique_ptr<Shader> CreateDefaultFontShader() noexcept;
+    [[nodiscard]] std::unique_ptr<Shader> CreateDefaultParticleShader() noexcept;
     [[nodiscard]] std::unique_ptr<Shader> CreateShaderFromFile(std::filesystem::path filepath) noexcept;
 
     void CreateAndRegisterDefaultMaterials() noexcept;
@@ -529,6 +619,7 @@ private:
     [[nodiscard]] std::unique_ptr<Material> CreateDefaultCircle2DMaterial() noexcept;
     [[nodiscard]] std::unique_ptr<Material> CreateDefaultRoundedRectangle2DMaterial() noexcept;
     [[nodiscard]] std::unique_ptr<Material> CreateDefaultUnlit2DSpriteMaterial() noexcept;
+    [[nodiscard]] std::unique_ptr<Material> CreateDefaultParticleMaterial() noexcept;
 
     void CreateAndRegisterDefaultEngineFonts() noexcept;
 
@@ -558,6 +649,8 @@ private:
 
     void CreateAndRegisterDefaultFonts() noexcept;
     [[nodiscard]] std::unique_ptr<a2de::IFont> CreateDefaultSystem32Font() noexcept;
+    //Registers font as name and drops the cached layouts of the font it replaces.
+    void ReplaceFont(const std::string& name, std::unique_ptr<a2de::IFont> font) noexcept;
 
     void UnbindAllResourcesAndBuffers() noexcept;
     void UnbindAllResources() noexcept;
@@ -581,10 +674,6 @@ private:
     time_buffer_t m_time_data{};
     lighting_buffer_t m_lighting_data{};
     roundedrec_buffer_t m_roundedrec_data{};
-    std::size_t m_current_vbo_size = 0;
-    std::size_t m_current_vbco_size = 0;
-    std::size_t m_current_vbio_size = 0;
-    std::size_t m_current_ibo_size = 0;
     std::unique_ptr<RHIInstance> m_rhi_instance = nullptr;
     std::unique_ptr<RHIDevice> m_rhi_device = nullptr;
     std::unique_ptr<RHIDeviceContext> m_rhi_context = nullptr;
@@ -599,22 +688,29 @@ private:
     Material* m_current_material = nullptr;
     IntVector2 m_window_dimensions = IntVector2::Zero;
     RHIOutputMode m_current_outputMode = RHIOutputMode::Windowed;
-    std::unique_ptr<VertexBuffer> m_temp_vbo = nullptr;
-    std::unique_ptr<VertexCircleBuffer> m_circle_vbo = nullptr;
-    std::unique_ptr<VertexBufferInstanced> m_temp_vbio = nullptr;
-    std::unique_ptr<IndexBuffer> m_temp_ibo = nullptr;
+    std::unique_ptr<StreamingBuffer> m_vbo_stream = nullptr;
+    std::unique_ptr<StreamingBuffer> m_vbco_stream = nullptr;
+    std::unique_ptr<StreamingBuffer> m_vbio_stream = nullptr;
+    std::unique_ptr<StreamingBuffer> m_ibo_stream = nullptr;
+    std::unique_ptr<StreamingBuffer> m_packed_vbo_stream = nullptr;
+    SpriteBatch m_sprite_batch{};
+    TextLayoutCache m_text_layout_cache{};
+    const Texture* m_sprite_texture_override = nullptr;
+    int m_sprite_layer = 0;
+    bool m_sprite_batch_open = false;
     std::unique_ptr<ConstantBuffer> m_matrix_cb = nullptr;
     std::unique_ptr<ConstantBuffer> m_time_cb = nullptr;
     std::unique_ptr<ConstantBuffer> m_lighting_cb = nullptr;
     std::unique_ptr<ConstantBuffer> m_roundedrec_cb = nullptr;
-    std::vector<std::pair<std::string, std::unique_ptr<Texture>>> m_textures{};
-    std::vector<std::pair<std::string, std::unique_ptr<ShaderProgram>>> m_shader_programs;
-    std::vector<std::pair<std::string, std::unique_ptr<Shader>>> m_shaders;
-    std::vector<std::pair<std::string, std::unique_ptr<Material>>> m_materials;
+    ResourceRegistry<Texture> m_textures{};
+    ResourceRegistry<ShaderProgram> m_shader_programs{};
+    ResourceRegistry<Shader> m_shaders{};
+    ResourceRegistry<Material> m_materials{};
     std::vector<std::pair<std::string, std::unique_ptr<Sampler>>> m_samplers;
     std::vector<std::pair<std::string, std::unique_ptr<RasterState>>> m_rasters;
     std::vector<std::pair<std::string, std::unique_ptr<DepthStencilState>>> m_depthstencils;
-    std::vector<std::pair<std::string, std::unique_ptr<a2de::IFont>>> m_fonts;
+    ResourceRegistry<a2de::IFont> m_fonts{};
+    std::vector<std::shared_ptr<AsyncTexture>> m_pending_textures{};
     mutable std::mutex m_cs{};
     screenshot_job_t m_screenshot{};
     std::filesystem::path m_last_screenshot_location{};
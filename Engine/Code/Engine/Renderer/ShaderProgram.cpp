@@ -3,12 +3,19 @@
 #include "Engine/Renderer/DirectX/DX11.hpp"
 #include "Engine/Renderer/InputLayout.hpp"
 #include "Engine/Renderer/InputLayoutInstanced.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
+
+#include <algorithm>
 
 ShaderProgram::ShaderProgram(ShaderProgramDesc&& desc) noexcept
 : m_desc(std::move(desc)) {
     /* DO NOTHING */
 }
 
+ShaderProgram::ShaderProgram(ShaderProgram&& other) noexcept = default;
+ShaderProgram& ShaderProgram::operator=(ShaderProgram&& other) noexcept = default;
+ShaderProgram::~ShaderProgram() noexcept = default;
+
 ShaderProgramDesc&& ShaderProgram::GetDescription() noexcept {
     return std::move(m_desc);
 }
@@ -53,6 +60,19 @@ InputLayoutInstanced* ShaderProgram::GetInputLayoutInstanced() const noexcept {
     return m_desc.input_layout_instanced.get();
 }
 
+void ShaderProgram::SetInputLayoutInstanced(std::unique_ptr<InputLayoutInstanced> input_layout) noexcept {
+    m_desc.input_layout_instanced = std::move(input_layout);
+}
+
+InputLayout* ShaderProgram::GetInputLayout(const VertexLayoutDesc& layout) const noexcept {
+    const auto found = std::find_if(std::cbegin(m_packed_input_layouts), std::cend(m_packed_input_layouts), [&layout](const auto& entry) { return entry.first == layout.elements.data(); });
+    return found != std::cend(m_packed_input_layouts) ? found->second.get() : nullptr;
+}
+
+void ShaderProgram::AddInputLayout(const VertexLayoutDesc& layout, std::unique_ptr<InputLayout> input_layout) noexcept {
+    m_packed_input_layouts.emplace_back(layout.elements.data(), std::move(input_layout));
+}
+
 ID3D11VertexShader* ShaderProgram::GetVS() const noexcept {
     return m_desc.vs;
 }
@@ -4,9 +4,13 @@
 
 #include <string>
 #include <memory>
+#include <utility>
+#include <vector>
 
 class InputLayout;
 class InputLayoutInstanced;
+struct VertexElement;
+struct VertexLayoutDesc;
 
 struct ShaderProgramDesc {
     std::string name{"UNNAMED SHADER PROGRAM"};
@@ -35,11 +39,11 @@ struct ShaderProgramDesc {
 class ShaderProgram {
 public:
     explicit ShaderProgram(ShaderProgramDesc&& desc) noexcept;
-    ShaderProgram(ShaderProgram&& other) = default;
-    ShaderProgram& operator=(ShaderProgram&& other) = default;
+    ShaderProgram(ShaderProgram&& other) noexcept;
+    ShaderProgram& operator=(ShaderProgram&& other) noexcept;
     ShaderProgram(const ShaderProgram& other) = delete;
     ShaderProgram& operator=(const ShaderProgram& other) = delete;
-    ~ShaderProgram() = default;
+    ~ShaderProgram() noexcept;
 
     [[nodiscard]] ShaderProgramDesc&& GetDescription() noexcept;
     void SetDescription(ShaderProgramDesc&& description) noexcept;
@@ -53,6 +57,10 @@ public:
     [[nodiscard]] ID3DBlob* GetCSByteCode() const noexcept;
     [[nodiscard]] InputLayout* GetInputLayout() const noexcept;
     [[nodiscard]] InputLayoutInstanced* GetInputLayoutInstanced() const noexcept;
+    void SetInputLayoutInstanced(std::unique_ptr<InputLayoutInstanced> input_layout) noexcept;
+    //Input layouts for packed vertex types, keyed by layout and created the first time each is drawn with this program.
+    [[nodiscard]] InputLayout* GetInputLayout(const VertexLayoutDesc& layout) const noexcept;
+    void AddInputLayout(const VertexLayoutDesc& layout, std::unique_ptr<InputLayout> input_layout) noexcept;
     [[nodiscard]] ID3D11VertexShader* GetVS() const noexcept;
     [[nodiscard]] bool HasVS() const noexcept;
     [[nodiscard]] ID3D11HullShader* GetHS() const noexcept;
@@ -69,4 +77,5 @@ public:
 protected:
 private:
     ShaderProgramDesc m_desc{};
+    std::vector<std::pair<const VertexElement*, std::unique_ptr<InputLayout>>> m_packed_input_layouts{};
 };
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "Engine/Renderer/SpriteBatch.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <utility>
+
+SpriteBatchStats& SpriteBatchStats::operator+=(const SpriteBatchStats& rhs) noexcept {
+    sprites += rhs.sprites;
+    draws_submitted += rhs.draws_submitted;
+    draws_issued += rhs.draws_issued;
+    flushes += rhs.flushes;
+    return *this;
+}
+
+bool SpriteBatch::Add(int layer, Material* material, const Texture* texture, const Quad& corners) noexcept {
+    const auto material_id = GetMaterialId(material);
+    const auto texture_id = GetTextureId(texture);
+    if(material_id == invalid_id || texture_id == invalid_id) {
+        return false;
+    }
+    //Flipping the sign bit makes negative layers sort below positive ones as unsigned integers.
+    const auto layer_bits = static_cast<std::uint32_t>(layer) ^ 0x80000000u;
+    m_keys.push_back((std::uint64_t{layer_bits} << 32u) | (std::uint64_t{material_id} << 16u) | std::uint64_t{texture_id});
+    m_sprites.push_back(Sprite{material, texture, corners});
+    ++m_frame_stats.sprites;
+    return true;
+}
+
+void SpriteBatch::CountSubmittedDraw() noexcept {
+    ++m_frame_stats.draws_submitted;
+}
+
+void SpriteBatch::Build() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    m_vbo.clear();
+    m_ibo.clear();
+    m_draw_instructions.clear();
+    m_draw_textures.clear();
+    if(m_sprites.empty()) {
+        return;
+    }
+    const auto sprite_count = m_sprites.size();
+    m_order.resize(sprite_count);
+    for(std::size_t i = 0u; i < sprite_count; ++i) {
+        m_order[i] = static_cast<std::uint32_t>(i);
+    }
+    RadixSort(m_keys, m_order, m_scratch);
+
+    m_vbo.reserve(sprite_count * 4u);
+    m_ibo.reserve(sprite_count * 6u);
+    auto previous_key = ~m_keys[m_order[0]];
+    for(const auto sprite_index : m_order) {
+        const auto& sprite = m_sprites[sprite_index];
+        if(const auto key = m_keys[sprite_index]; key != previous_key) {
+            DrawInstruction run{};
+            run.type = PrimitiveType::Triangles;
+            run.indexStart = m_ibo.size();
+            run.count = 0u;
+            run.material = sprite.material;
+            m_draw_instructions.push_back(run);
+            m_draw_textures.push_back(sprite.texture);
+            previous_key = key;
+        }
+        const auto v = static_cast<unsigned int>(m_vbo.size());
+        m_vbo.insert(std::end(m_vbo), std::begin(sprite.corners), std::end(sprite.corners));
+        m_ibo.insert(std::end(m_ibo), {v + 0u, v + 1u, v + 2u, v + 0u, v + 2u, v + 3u});
+        auto& run = m_draw_instructions.back();
+        run.indexCount += 6u;
+        ++run.count;
+    }
+    m_frame_stats.draws_issued += m_draw_instructions.size();
+    ++m_frame_stats.flushes;
+}
+
+void SpriteBatch::Clear() noexcept {
+    m_sprites.clear();
+    m_keys.clear();
+    m_material_ids.clear();
+    m_texture_ids.clear();
+    m_vbo.clear();
+    m_ibo.clear();
+    m_draw_instructions.clear();
+    m_draw_textures.clear();
+}
+
+bool SpriteBatch::empty() const noexcept {
+    return m_sprites.empty();
+}
+
+std::size_t SpriteBatch::size() const noexcept {
+    return m_sprites.size();
+}
+
+const std::vector<Vertex3D>& SpriteBatch::GetVbo() const noexcept {
+    return m_vbo;
+}
+
+const std::vector<unsigned int>& SpriteBatch::GetIbo() const noexcept {
+    return m_ibo;
+}
+
+const std::vector<DrawInstruction>& SpriteBatch::GetDrawInstructions() const noexcept {
+    return m_draw_instructions;
+}
+
+const std::vector<const Texture*>& SpriteBatch::GetDrawTextures() const noexcept {
+    return m_draw_textures;
+}
+
+void SpriteBatch::BeginFrame() noexcept {
+    m_last_frame_stats = std::exchange(m_frame_stats, SpriteBatchStats{});
+}
+
+const SpriteBatchStats& SpriteBatch::GetFrameStats() const noexcept {
+    return m_frame_stats;
+}
+
+const SpriteBatchStats& SpriteBatch::GetLastFrameStats() const noexcept {
+    return m_last_frame_stats;
+}
+
+void SpriteBatch::RadixSort(const std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& order, std::vector<std::uint32_t>& scratch) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    constexpr auto digit_count = sizeof(std::uint64_t);
+    const auto count = order.size();
+    if(count < 2u) {
+        return;
+    }
+    //Histogram every digit in one read of the keys.
+    std::array<std::array<std::size_t, 256>, digit_count> histograms{};
+    for(const auto index : order) {
+        const auto key = keys[index];
+        for(std::size_t digit = 0u; digit < digit_count; ++digit) {
+            ++histograms[digit][(key >> (digit * 8u)) & 0xFFu];
+        }
+    }
+    scratch.resize(count);
+    for(std::size_t digit = 0u; digit < digit_count; ++digit) {
+        auto& histogram = histograms[digit];
+        const auto shift = digit * 8u;
+        if(histogram[(keys[order[0]] >> shift) & 0xFFu] == count) {
+            continue;
+        }
+        std::size_t offset = 0u;
+        for(auto& bucket : histogram) {
+            offset += std::exchange(bucket, offset);
+        }
+        for(const auto index : order) {
+            scratch[histogram[(keys[index] >> shift) & 0xFFu]++] = index;
+        }
+        order.swap(scratch);
+    }
+}
+
+std::uint16_t SpriteBatch::GetMaterialId(Material* material) noexcept {
+    if(const auto found = m_material_ids.find(material); found != std::end(m_material_ids)) {
+        return found->second;
+    }
+    if(m_material_ids.size() >= invalid_id) {
+        return invalid_id;
+    }
+    const auto id = static_cast<std::uint16_t>(m_material_ids.size());
+    m_material_ids.emplace(material, id);
+    return id;
+}
+
+std::uint16_t SpriteBatch::GetTextureId(const Texture* texture) noexcept {
+    if(const auto found = m_texture_ids.find(texture); found != std::end(m_texture_ids)) {
+        return found->second;
+    }
+    if(m_texture_ids.size() >= invalid_id) {
+        return invalid_id;
+    }
+    const auto id = static_cast<std::uint16_t>(m_texture_ids.size());
+    m_texture_ids.emplace(texture, id);
+    return id;
+}
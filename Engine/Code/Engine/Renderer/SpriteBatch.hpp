@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Engine/Renderer/DrawInstruction.hpp"
+#include "Engine/Renderer/Vertex3D.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Material;
+class Texture;
+
+struct SpriteBatchStats {
+    std::size_t sprites{0u};
+    std::size_t draws_submitted{0u}; //Draw calls the batched sprites would have cost one at a time.
+    std::size_t draws_issued{0u};    //Draw calls actually made after sorting and merging.
+    std::size_t flushes{0u};
+
+    SpriteBatchStats& operator+=(const SpriteBatchStats& rhs) noexcept;
+};
+
+//Collects 2D quads and turns them into as few indexed draws as the state they need allows.
+//Quads are stably sorted by (layer, material, texture), so within one key submission order is kept
+//and sprites from sheets sharing an atlas texture end up in the same draw.
+//Corners arrive already transformed; the batch holds no matrices and draws with an identity model matrix.
+class SpriteBatch {
+public:
+    //Corners in bottom-left, top-left, top-right, bottom-right order, the order DrawQuad2D and Mesh::Builder emit quads.
+    using Quad = std::array<Vertex3D, 4>;
+
+    //Returns false without adding the quad when the batch has run out of material or texture ids; flush and add it again.
+    [[nodiscard]] bool Add(int layer, Material* material, const Texture* texture, const Quad& corners) noexcept;
+    //Counts one draw call a caller would have made without the batch, however many quads it added.
+    void CountSubmittedDraw() noexcept;
+
+    //Sorts the quads and fills the vertex, index and draw instruction lists.
+    //Each instruction's indexStart and baseVertexLocation are relative to the start of the built buffers.
+    void Build() noexcept;
+    void Clear() noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    [[nodiscard]] const std::vector<Vertex3D>& GetVbo() const noexcept;
+    [[nodiscard]] const std::vector<unsigned int>& GetIbo() const noexcept;
+    [[nodiscard]] const std::vector<DrawInstruction>& GetDrawInstructions() const noexcept;
+    //The texture each draw instruction samples, parallel to GetDrawInstructions.
+    [[nodiscard]] const std::vector<const Texture*>& GetDrawTextures() const noexcept;
+
+    //Starts a new frame's statistics; the finished frame's are available from GetLastFrameStats.
+    void BeginFrame() noexcept;
+    [[nodiscard]] const SpriteBatchStats& GetFrameStats() const noexcept;
+    [[nodiscard]] const SpriteBatchStats& GetLastFrameStats() const noexcept;
+
+    //Stable least-significant-digit radix sort of order by keys[order[i]], one byte per pass.
+    //Passes where every key has the same byte are skipped, so keys using few distinct layers and ids cost only a few passes.
+    static void RadixSort(const std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& order, std::vector<std::uint32_t>& scratch) noexcept;
+
+protected:
+private:
+    struct Sprite {
+        Material* material{};
+        const Texture* texture{};
+        Quad corners{};
+    };
+
+    [[nodiscard]] std::uint16_t GetMaterialId(Material* material) noexcept;
+    [[nodiscard]] std::uint16_t GetTextureId(const Texture* texture) noexcept;
+
+    static constexpr std::uint16_t invalid_id = 0xFFFFu;
+
+    std::vector<Sprite> m_sprites{};
+    std::vector<std::uint64_t> m_keys{};
+    std::vector<std::uint32_t> m_order{};
+    std::vector<std::uint32_t> m_scratch{};
+    std::unordered_map<const Material*, std::uint16_t> m_material_ids{};
+    std::unordered_map<const Texture*, std::uint16_t> m_texture_ids{};
+    std::vector<Vertex3D> m_vbo{};
+    std::vector<unsigned int> m_ibo{};
+    std::vector<DrawInstruction> m_draw_instructions{};
+    std::vector<const Texture*> m_draw_textures{};
+    SpriteBatchStats m_frame_stats{};
+    SpriteBatchStats m_last_frame_stats{};
+};
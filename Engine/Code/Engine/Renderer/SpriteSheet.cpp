@@ -6,6 +6,7 @@
 
 #include "Engine/Services/ServiceLocator.hpp"
 
+#include <cmath>
 #include <string>
 #include <sstream>
 
@@ -25,14 +26,22 @@ SpriteSheet::SpriteSheet(const std::filesystem::path& texturePath, int tilesWide
     /* DO NOTHING */
 }
 
+SpriteSheet::SpriteSheet(Texture* texture, const AABB2& region, int tilesWide, int tilesHigh) noexcept
+: m_spriteSheetTexture(texture)
+, m_spriteLayout(tilesWide, tilesHigh)
+, m_region(region) {
+    /* DO NOTHING */
+}
+
 AABB2 SpriteSheet::GetTexCoordsFromSpriteCoords(int spriteX, int spriteY) const noexcept {
-    const auto texCoords = Vector2{1.0f / m_spriteLayout.x, 1.0f / m_spriteLayout.y};
+    const auto region_dims = m_region.CalcDimensions();
+    const auto texCoords = Vector2{region_dims.x / m_spriteLayout.x, region_dims.y / m_spriteLayout.y};
 
     const auto dims = Vector2{static_cast<float>(m_spriteSheetTexture->GetDimensions().x), static_cast<float>(m_spriteSheetTexture->GetDimensions().y)};
     const auto epsilon = Vector2{1.0f / dims.x, 1.0f / dims.y};
 
-    auto mins = Vector2{texCoords.x * spriteX, texCoords.y * spriteY};
-    auto maxs = Vector2{texCoords.x * (spriteX + 1), texCoords.y * (spriteY + 1)};
+    auto mins = m_region.mins + Vector2{texCoords.x * spriteX, texCoords.y * spriteY};
+    auto maxs = m_region.mins + Vector2{texCoords.x * (spriteX + 1), texCoords.y * (spriteY + 1)};
 
     mins += epsilon;
     maxs -= epsilon;
@@ -55,11 +64,13 @@ int SpriteSheet::GetNumSprites() const noexcept {
 }
 
 int SpriteSheet::GetFrameWidth() const noexcept {
-    return ((*m_spriteSheetTexture).GetDimensions().x / m_spriteLayout.x);
+    const auto region_width = static_cast<int>(std::round((*m_spriteSheetTexture).GetDimensions().x * m_region.CalcDimensions().x));
+    return region_width / m_spriteLayout.x;
 }
 
 int SpriteSheet::GetFrameHeight() const noexcept {
-    return ((*m_spriteSheetTexture).GetDimensions().y / m_spriteLayout.y);
+    const auto region_height = static_cast<int>(std::round((*m_spriteSheetTexture).GetDimensions().y * m_region.CalcDimensions().y));
+    return region_height / m_spriteLayout.y;
 }
 
 IntVector2 SpriteSheet::GetFrameDimensions() const noexcept {
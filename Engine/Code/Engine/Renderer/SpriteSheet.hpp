@@ -29,10 +29,13 @@ protected:
 private:
     SpriteSheet(Texture* texture, int tilesWide, int tilesHigh) noexcept;
     SpriteSheet(const std::filesystem::path& texturePath, int tilesWide, int tilesHigh) noexcept;
+    //A sheet whose grid covers only region, in normalized texture coordinates, such as one image packed into a TextureAtlas page.
+    SpriteSheet(Texture* texture, const AABB2& region, int tilesWide, int tilesHigh) noexcept;
 
     void LoadFromXml(const XMLElement& elem) noexcept;
     Texture* m_spriteSheetTexture = nullptr;
     IntVector2 m_spriteLayout{1, 1};
+    AABB2 m_region{0.0f, 0.0f, 1.0f, 1.0f};
 
     friend class Renderer;
     friend class MapEditor;
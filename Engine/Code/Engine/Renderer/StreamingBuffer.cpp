@@ -0,0 +1,89 @@
+#include "Engine/Renderer/StreamingBuffer.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Profiling/Metrics.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+StreamingBufferStats& StreamingBufferStats::operator+=(const StreamingBufferStats& rhs) noexcept {
+    bytes_uploaded += rhs.bytes_uploaded;
+    map_calls += rhs.map_calls;
+    discards += rhs.discards;
+    resizes += rhs.resizes;
+    return *this;
+}
+
+StreamingBuffer::StreamingBuffer(std::unique_ptr<IStreamingBufferTarget> target) noexcept
+: m_target(std::move(target)) {
+    GUARANTEE_OR_DIE(m_target, "StreamingBuffer requires a target buffer.");
+}
+
+std::size_t StreamingBuffer::Write(const void* data, std::size_t byteCount, std::size_t alignment) noexcept {
+    if(!byteCount) {
+        return 0u;
+    }
+    alignment = (std::max)(alignment, std::size_t{1u});
+    const auto width = m_target->GetByteWidth();
+    if(m_needs_resize || width < byteCount) {
+        //Grow geometrically so a steadily increasing draw does not recreate the buffer every frame.
+        m_target->Resize(width < byteCount ? (std::max)(byteCount, width * 2u) : width);
+        ++m_frame_stats.resizes;
+        m_needs_resize = false;
+        m_needs_discard = true;
+    }
+    auto offset = (m_cursor + alignment - 1u) / alignment * alignment;
+    if(m_needs_discard || m_target->GetByteWidth() < offset + byteCount) {
+        offset = 0u;
+        m_needs_discard = true;
+    }
+    const auto mode = m_needs_discard ? IStreamingBufferTarget::MapMode::Discard : IStreamingBufferTarget::MapMode::NoOverwrite;
+    auto* mapped = static_cast<unsigned char*>(m_target->Map(mode));
+    ++m_frame_stats.map_calls;
+    if(!mapped) {
+        //Nothing was written, so the next write must not rely on the buffer's contents either.
+        m_needs_discard = true;
+        return npos;
+    }
+    std::memcpy(mapped + offset, data, byteCount);
+    m_target->Unmap();
+    if(m_needs_discard) {
+        ++m_frame_stats.discards;
+        m_needs_discard = false;
+    }
+    m_frame_stats.bytes_uploaded += byteCount;
+    static auto& bytes_uploaded = Metrics::GetCounter("renderer.bytes_uploaded");
+    bytes_uploaded.Add(byteCount);
+    m_cursor = offset + byteCount;
+    return offset;
+}
+
+std::size_t StreamingBuffer::WriteElements(const void* data, std::size_t elementCount, std::size_t stride) noexcept {
+    if(!stride) {
+        return npos;
+    }
+    const auto offset = Write(data, elementCount * stride, stride);
+    return offset == npos ? npos : offset / stride;
+}
+
+void StreamingBuffer::BeginFrame() noexcept {
+    m_last_frame_stats = m_frame_stats;
+    m_frame_stats = StreamingBufferStats{};
+}
+
+void StreamingBuffer::Invalidate() noexcept {
+    m_needs_resize = true;
+    m_cursor = 0u;
+}
+
+const StreamingBufferStats& StreamingBuffer::GetFrameStats() const noexcept {
+    return m_frame_stats;
+}
+
+const StreamingBufferStats& StreamingBuffer::GetLastFrameStats() const noexcept {
+    return m_last_frame_stats;
+}
+
+IStreamingBufferTarget& StreamingBuffer::GetTarget() const noexcept {
+    return *m_target;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+//The GPU buffer a StreamingBuffer writes into.
+//Kept free of any graphics API so the allocator can be driven by a CPU-side buffer.
+class IStreamingBufferTarget {
+public:
+    enum class MapMode {
+        Discard,     //Contents may be thrown away; the driver hands back fresh memory if the GPU still uses the old.
+        NoOverwrite, //Caller promises not to touch any range already written since the last discard.
+    };
+    virtual ~IStreamingBufferTarget() noexcept = default;
+
+    [[nodiscard]] virtual std::size_t GetByteWidth() const noexcept = 0;
+    //Recreates the buffer with room for at least byteWidth bytes. Previous contents are lost.
+    virtual void Resize(std::size_t byteWidth) noexcept = 0;
+    [[nodiscard]] virtual void* Map(MapMode mode) noexcept = 0;
+    virtual void Unmap() noexcept = 0;
+};
+
+struct StreamingBufferStats {
+    std::size_t bytes_uploaded{0u};
+    std::size_t map_calls{0u};
+    std::size_t discards{0u};
+    std::size_t resizes{0u};
+
+    StreamingBufferStats& operator+=(const StreamingBufferStats& rhs) noexcept;
+};
+
+//Linear allocator over one large dynamic buffer.
+//Each write is appended after the previous one and mapped no-overwrite, so many small draws share the buffer
+//without stalling. Only when the buffer is full does the cursor wrap to the start with a discard.
+class StreamingBuffer {
+public:
+    //Returned in place of an offset or index when the target could not be mapped and nothing was written.
+    static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+    explicit StreamingBuffer(std::unique_ptr<IStreamingBufferTarget> target) noexcept;
+
+    //Copies byteCount bytes to an offset that is a multiple of alignment and returns that offset, or npos.
+    [[nodiscard]] std::size_t Write(const void* data, std::size_t byteCount, std::size_t alignment) noexcept;
+    //Copies elementCount elements of stride bytes each and returns the index of the first one, or npos.
+    [[nodiscard]] std::size_t WriteElements(const void* data, std::size_t elementCount, std::size_t stride) noexcept;
+
+    //Returns the index of the first element written, suitable as a start vertex, index or instance location.
+    template<typename T>
+    [[nodiscard]] std::size_t Write(const std::vector<T>& elements) noexcept {
+        return WriteElements(elements.data(), elements.size(), sizeof(T));
+    }
+
+    //Starts a new frame's statistics; the finished frame's are available from GetLastFrameStats.
+    void BeginFrame() noexcept;
+    //Forces the buffer to be recreated on the next write.
+    void Invalidate() noexcept;
+
+    [[nodiscard]] const StreamingBufferStats& GetFrameStats() const noexcept;
+    [[nodiscard]] const StreamingBufferStats& GetLastFrameStats() const noexcept;
+    [[nodiscard]] IStreamingBufferTarget& GetTarget() const noexcept;
+
+protected:
+private:
+    std::unique_ptr<IStreamingBufferTarget> m_target{};
+    StreamingBufferStats m_frame_stats{};
+    StreamingBufferStats m_last_frame_stats{};
+    std::size_t m_cursor{0u};
+    bool m_needs_discard{true};
+    bool m_needs_resize{false};
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Engine/RHI/RHIDeviceContext.hpp"
+#include "Engine/Renderer/DirectX/DX11.hpp"
+#include "Engine/Renderer/StreamingBuffer.hpp"
+
+#include <functional>
+#include <memory>
+
+//Streams into one of the engine's dynamic array buffers, recreating it through the factory when it has to grow.
+template<typename ArrayBufferType>
+class ArrayBufferStreamingTarget : public IStreamingBufferTarget {
+public:
+    using element_t = typename ArrayBufferType::arraybuffer_t;
+    using factory_t = std::function<std::unique_ptr<ArrayBufferType>(const typename ArrayBufferType::buffer_t&)>;
+
+    ArrayBufferStreamingTarget(RHIDeviceContext& context, factory_t factory, std::size_t elementCount) noexcept
+    : m_context(context)
+    , m_factory(std::move(factory)) {
+        Resize(elementCount * sizeof(element_t));
+    }
+    virtual ~ArrayBufferStreamingTarget() noexcept = default;
+
+    [[nodiscard]] std::size_t GetByteWidth() const noexcept override {
+        return m_element_count * sizeof(element_t);
+    }
+
+    void Resize(std::size_t byteWidth) noexcept override {
+        m_element_count = (byteWidth + sizeof(element_t) - 1u) / sizeof(element_t);
+        m_buffer = m_factory(typename ArrayBufferType::buffer_t(m_element_count));
+    }
+
+    [[nodiscard]] void* Map(MapMode mode) noexcept override {
+        D3D11_MAPPED_SUBRESOURCE resource{};
+        const auto dx_mode = mode == MapMode::Discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+        if(FAILED(m_context.GetDxContext()->Map(m_buffer->GetDxBuffer().Get(), 0, dx_mode, 0U, &resource))) {
+            return nullptr;
+        }
+        return resource.pData;
+    }
+
+    void Unmap() noexcept override {
+        m_context.GetDxContext()->Unmap(m_buffer->GetDxBuffer().Get(), 0);
+    }
+
+    [[nodiscard]] ArrayBufferType* GetBuffer() const noexcept {
+        return m_buffer.get();
+    }
+
+protected:
+private:
+    RHIDeviceContext& m_context;
+    factory_t m_factory{};
+    std::unique_ptr<ArrayBufferType> m_buffer{};
+    std::size_t m_element_count{0u};
+};
@@ -0,0 +1,116 @@
+#include "Engine/Renderer/TextLayoutCache.hpp"
+
+#include "Engine/Core/IFont.hpp"
+#include "Engine/Core/Rgba.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <bit>
+#include <functional>
+#include <iterator>
+
+std::size_t TextLayoutCache::KeyHasher::operator()(const Key& key) const noexcept {
+    auto seed = key.text_hash;
+    const auto combine = [&seed](std::size_t value) { seed ^= value + 0x9E3779B9u + (seed << 6u) + (seed >> 2u); };
+    combine(std::hash<const a2de::IFont*>{}(key.font));
+    combine(std::bit_cast<std::uint32_t>(key.scale));
+    combine(static_cast<std::size_t>(key.offset_x));
+    return seed;
+}
+
+const TextLayout& TextLayoutCache::Get(const a2de::IFont& font, std::string_view text, float scale /*= 1.0f*/, GlyphOffsetX offset_x /*= GlyphOffsetX::Add*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    const auto key = Key{&font, std::hash<std::string_view>{}(text), scale, offset_x};
+    auto [iter, inserted] = m_entries.try_emplace(key);
+    auto& entry = iter->second;
+    entry.last_used_frame = m_frame;
+    if(!inserted && entry.text == text) {
+        ++m_stats.hits;
+        return entry.layout;
+    }
+    //New key, or a different string that hashed the same; either way the slot now belongs to this text.
+    ++m_stats.misses;
+    entry.text.assign(text);
+    entry.layout = Shape(font, text, scale, offset_x);
+    m_stats.entries = m_entries.size();
+    return entry.layout;
+}
+
+void TextLayoutCache::BeginFrame() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    ++m_frame;
+    if(m_frame < max_idle_frames) {
+        return;
+    }
+    const auto oldest_kept = m_frame - max_idle_frames;
+    m_stats.evictions += std::erase_if(m_entries, [oldest_kept](const auto& key_entry) { return key_entry.second.last_used_frame < oldest_kept; });
+    m_stats.entries = m_entries.size();
+}
+
+void TextLayoutCache::Invalidate(const a2de::IFont* font) noexcept {
+    m_stats.evictions += std::erase_if(m_entries, [font](const auto& key_entry) { return key_entry.first.font == font; });
+    m_stats.entries = m_entries.size();
+}
+
+void TextLayoutCache::Clear() noexcept {
+    m_stats.evictions += m_entries.size();
+    m_entries.clear();
+    m_stats.entries = 0u;
+}
+
+const TextLayoutCacheStats& TextLayoutCache::GetStats() const noexcept {
+    return m_stats;
+}
+
+TextLayout TextLayoutCache::Shape(const a2de::IFont& font, std::string_view text, float scale /*= 1.0f*/, GlyphOffsetX offset_x /*= GlyphOffsetX::Add*/) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    TextLayout layout{};
+    layout.glyphs.reserve(text.size());
+    const auto x_offset_sign = offset_x == GlyphOffsetX::Add ? 1.0f : -1.0f;
+    float cursor_x = 0.0f;
+    for(auto text_iter = std::cbegin(text); text_iter != std::cend(text); /* DO NOTHING */) {
+        const int c = *text_iter;
+        const auto offsets = font.GetGlyphOffsets(c);
+        const auto dimensions = font.GetGlyphDimensions(c);
+        const auto left = cursor_x + x_offset_sign * offsets.x;
+        const auto top = -offsets.y;
+        layout.glyphs.push_back(TextLayoutGlyph{AABB2{left * scale, top * scale, (left + dimensions.x) * scale, (top + dimensions.y) * scale}, font.GetGlyphUVs(c)});
+
+        const auto advance = static_cast<float>(font.GetGlyphAdvance(c));
+        if(const auto previous_char = text_iter++; text_iter != std::cend(text)) {
+            cursor_x += advance + font.GetKerningValue(static_cast<unsigned long>(*previous_char), static_cast<unsigned long>(*text_iter));
+        } else {
+            layout.width = (cursor_x + advance) * scale;
+        }
+    }
+    return layout;
+}
+
+void TextLayoutCache::AppendQuads(const TextLayout& layout, const Vector2& origin, const Rgba& color, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    vbo.reserve(vbo.size() + layout.glyphs.size() * 4u);
+    ibo.reserve(ibo.size() + layout.glyphs.size() * 6u);
+    for(const auto& glyph : layout.glyphs) {
+        const auto left = origin.x + glyph.bounds.mins.x;
+        const auto top = origin.y + glyph.bounds.mins.y;
+        const auto right = origin.x + glyph.bounds.maxs.x;
+        const auto bottom = origin.y + glyph.bounds.maxs.y;
+        const auto s = static_cast<unsigned int>(vbo.size());
+        vbo.emplace_back(Vector3(left, bottom, 0.0f), color, Vector2(glyph.uvs.mins.x, glyph.uvs.maxs.y));
+        vbo.emplace_back(Vector3(left, top, 0.0f), color, Vector2(glyph.uvs.mins.x, glyph.uvs.mins.y));
+        vbo.emplace_back(Vector3(right, top, 0.0f), color, Vector2(glyph.uvs.maxs.x, glyph.uvs.mins.y));
+        vbo.emplace_back(Vector3(right, bottom, 0.0f), color, Vector2(glyph.uvs.maxs.x, glyph.uvs.maxs.y));
+        ibo.insert(std::end(ibo), {s + 0u, s + 1u, s + 2u, s + 0u, s + 2u, s + 3u});
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Renderer/Vertex3D.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class Rgba;
+
+namespace a2de {
+class IFont;
+}
+
+// clang-format off
+//Which way a glyph's x offset moves it from the pen. DrawTextLine with a transform adds it;
+//the untransformed DrawTextLine and AppendMultiLineTextBuffer have always subtracted it.
+enum class GlyphOffsetX {
+    Add
+    ,Subtract
+};
+// clang-format on
+
+//One glyph quad relative to the start of the line. bounds.mins is the top-left corner, bounds.maxs the bottom-right.
+struct TextLayoutGlyph {
+    AABB2 bounds{};
+    AABB2 uvs{};
+};
+
+//A shaped line of text: finished glyph quads plus the pen advance, both already scaled.
+struct TextLayout {
+    std::vector<TextLayoutGlyph> glyphs{};
+    float width{0.0f};
+};
+
+struct TextLayoutCacheStats {
+    std::size_t hits{0u};
+    std::size_t misses{0u};
+    std::size_t evictions{0u};
+    std::size_t entries{0u};
+};
+
+//Remembers the glyph layout of recently drawn strings so redrawing the same text costs a copy instead of
+//a char def, kerning and UV lookup per glyph. Entries are keyed on (font, text hash, scale, offset mode);
+//the text itself is kept to reject hash collisions. Color is applied when quads are emitted and is not part of the key.
+class TextLayoutCache {
+public:
+    //Returns the cached layout, shaping the text first on a miss.
+    //The reference stays valid until the next Get, BeginFrame, Invalidate or Clear.
+    [[nodiscard]] const TextLayout& Get(const a2de::IFont& font, std::string_view text, float scale = 1.0f, GlyphOffsetX offset_x = GlyphOffsetX::Add) noexcept;
+
+    //Advances the frame counter and drops layouts that have gone unused for max_idle_frames.
+    void BeginFrame() noexcept;
+    //Forget every layout shaped with font. Call after its glyph metrics or UVs change, and before it is destroyed:
+    //a new font allocated at the same address would otherwise hit its layouts.
+    void Invalidate(const a2de::IFont* font) noexcept;
+    void Clear() noexcept;
+
+    [[nodiscard]] const TextLayoutCacheStats& GetStats() const noexcept;
+
+    //Lays text out without caching. Matches the glyph loop DrawTextLine has always used.
+    [[nodiscard]] static TextLayout Shape(const a2de::IFont& font, std::string_view text, float scale = 1.0f, GlyphOffsetX offset_x = GlyphOffsetX::Add) noexcept;
+    //Appends one quad per glyph, moved to origin and tinted color, in the corner order Mesh::Builder uses.
+    static void AppendQuads(const TextLayout& layout, const Vector2& origin, const Rgba& color, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) noexcept;
+
+    static constexpr std::uint64_t max_idle_frames = 120u;
+
+protected:
+private:
+    struct Key {
+        const a2de::IFont* font{nullptr};
+        std::size_t text_hash{0u};
+        float scale{1.0f};
+        GlyphOffsetX offset_x{GlyphOffsetX::Add};
+
+        [[nodiscard]] bool operator==(const Key& rhs) const noexcept = default;
+    };
+    struct KeyHasher {
+        [[nodiscard]] std::size_t operator()(const Key& key) const noexcept;
+    };
+    struct Entry {
+        std::string text{};
+        TextLayout layout{};
+        std::uint64_t last_used_frame{0u};
+    };
+
+    std::unordered_map<Key, Entry, KeyHasher> m_entries{};
+    TextLayoutCacheStats m_stats{};
+    std::uint64_t m_frame{0u};
+};
@@ -0,0 +1,232 @@
+#include "Engine/Renderer/TextureAtlas.hpp"
+
+#include "Engine/Core/DataUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/FileUtils.hpp"
+
+#include "Engine/Renderer/Material.hpp"
+#include "Engine/Renderer/Texture.hpp"
+
+#include "Engine/Services/IRendererService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#ifdef PROFILE_BUILD
+#include <Thirdparty/Tracy/tracy/Tracy.hpp>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <sstream>
+
+TextureAtlas::TextureAtlas(std::string name, const AtlasPackerOptions& options /*= AtlasPackerOptions{}*/) noexcept
+: m_name{std::move(name)}
+, m_packer{options} {
+    /* DO NOTHING */
+}
+
+bool TextureAtlas::Add(const std::string& name, Image&& image) noexcept {
+    if(image.GetDataLength() == 0u || m_regions.contains(name)) {
+        return false;
+    }
+    const auto is_pending = std::any_of(std::cbegin(m_pending), std::cend(m_pending), [&](const PendingImage& pending) { return pending.name == name; });
+    if(is_pending) {
+        return false;
+    }
+    m_pending.push_back(PendingImage{name, std::move(image)});
+    return true;
+}
+
+bool TextureAtlas::Add(const std::filesystem::path& filepath) noexcept {
+    //Image dies on a file it cannot open, so a missing one has to be turned away here.
+    if(!std::filesystem::exists(filepath)) {
+        return false;
+    }
+    return Add(filepath.string(), Image(filepath));
+}
+
+bool TextureAtlas::Build() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    m_packer.Clear();
+    m_pages.clear();
+    m_regions.clear();
+    for(const auto& pending : m_pending) {
+        [[maybe_unused]] const auto id = m_packer.Add(pending.image.GetDimensions());
+    }
+    const auto all_packed = m_packer.Pack();
+    for(const auto& dimensions : m_packer.GetPageDimensions()) {
+        m_pages.emplace_back(static_cast<unsigned int>(dimensions.x), static_cast<unsigned int>(dimensions.y));
+    }
+    const auto padding = m_packer.GetOptions().padding;
+    for(std::size_t i = 0u; i < m_pending.size(); ++i) {
+        const auto& placement = m_packer.GetPlacement(i);
+        if(!placement.IsPacked()) {
+            continue;
+        }
+        Blit(m_pages[placement.page], m_pending[i].image, placement.position, padding);
+        AddRegion(m_pending[i].name, placement.page, placement.position, placement.dimensions);
+    }
+    m_pending.clear();
+    return all_packed;
+}
+
+bool TextureAtlas::Export(const std::filesystem::path& filepath) const noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    std::ostringstream ss{};
+    ss << std::format("<atlas name=\"{}\">\n", m_name);
+    for(std::size_t page = 0u; page < m_pages.size(); ++page) {
+        auto page_path = filepath;
+        page_path.replace_filename(std::format("{}_{}.png", filepath.stem().string(), page));
+        if(!m_pages[page].Export(page_path)) {
+            return false;
+        }
+        ss << std::format("    <page id=\"{}\" src=\"{}\" />\n", page, page_path.filename().string());
+    }
+    for(const auto& [name, region] : m_regions) {
+        ss << std::format("    <region name=\"{}\" page=\"{}\" position=\"{},{}\" dimensions=\"{},{}\" />\n", name, region.page, region.position.x, region.position.y, region.dimensions.x, region.dimensions.y);
+    }
+    ss << "</atlas>\n";
+    return FileUtils::WriteBufferToFile(ss.str(), filepath);
+}
+
+bool TextureAtlas::LoadFromFile(const std::filesystem::path& filepath) noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    tinyxml2::XMLDocument doc;
+    if(doc.LoadFile(filepath.string().c_str()) != tinyxml2::XML_SUCCESS) {
+        return false;
+    }
+    const auto* xml_root = doc.RootElement();
+    if(xml_root == nullptr) {
+        return false;
+    }
+    DataUtils::ValidateXmlElement(*xml_root, "atlas", "page", "name", "region");
+    m_name = DataUtils::ParseXmlAttribute(*xml_root, "name", m_name);
+    m_pending.clear();
+    m_pages.clear();
+    m_regions.clear();
+    bool loaded = true;
+    DataUtils::ForEachChildElement(*xml_root, "page", [&](const XMLElement& elem) {
+        DataUtils::ValidateXmlElement(elem, "page", "", "id,src");
+        const auto id = DataUtils::ParseXmlAttribute(elem, "id", -1);
+        auto src = filepath;
+        src.replace_filename(DataUtils::ParseXmlAttribute(elem, "src", std::string{}));
+        if(id < 0) {
+            loaded = false;
+            return;
+        }
+        if(static_cast<std::size_t>(id) >= m_pages.size()) {
+            m_pages.resize(static_cast<std::size_t>(id) + 1u);
+        }
+        if(!std::filesystem::exists(src)) {
+            loaded = false;
+            return;
+        }
+        m_pages[id] = Image(src);
+        loaded &= m_pages[id].GetDataLength() != 0u;
+    });
+    DataUtils::ForEachChildElement(*xml_root, "region", [&](const XMLElement& elem) {
+        DataUtils::ValidateXmlElement(elem, "region", "", "name,page,position,dimensions");
+        const auto name = DataUtils::ParseXmlAttribute(elem, "name", std::string{});
+        const auto page = DataUtils::ParseXmlAttribute(elem, "page", -1);
+        if(page < 0 || static_cast<std::size_t>(page) >= m_pages.size()) {
+            loaded = false;
+            return;
+        }
+        AddRegion(name, page, DataUtils::ParseXmlAttribute(elem, "position", IntVector2::Zero), DataUtils::ParseXmlAttribute(elem, "dimensions", IntVector2::Zero));
+    });
+    return loaded;
+}
+
+void TextureAtlas::CreateTextures() noexcept {
+#ifdef PROFILE_BUILD
+    ZoneScopedC(0xFF0000);
+#endif
+    auto* renderer = ServiceLocator::get<IRendererService>();
+    m_page_textures.clear();
+    m_page_materials.clear();
+    for(std::size_t page = 0u; page < m_pages.size(); ++page) {
+        const auto& image = m_pages[page];
+        const auto& dimensions = image.GetDimensions();
+        const auto texture_name = GetPageName(page);
+        [[maybe_unused]] const auto registered = renderer->RegisterTexture(texture_name, renderer->Create2DTextureFromMemory(image.GetData(), static_cast<unsigned int>(dimensions.x), static_cast<unsigned int>(dimensions.y)));
+        m_page_textures.push_back(renderer->GetTexture(texture_name));
+
+        const auto material_name = texture_name + "_Material";
+        const auto material_string = std::format(R"(<material name="{}"><shader src="__2D" /><textures><diffuse src="{}" /></textures></material>)", material_name, texture_name);
+        tinyxml2::XMLDocument doc;
+        const auto result = doc.Parse(material_string.c_str(), material_string.size());
+        GUARANTEE_OR_DIE(result == tinyxml2::XML_SUCCESS, "Failed to create texture atlas material: Invalid XML.\n");
+        renderer->RegisterMaterial(std::make_unique<Material>(*doc.RootElement()));
+        m_page_materials.push_back(renderer->GetMaterial(material_name));
+    }
+}
+
+const TextureAtlasRegion* TextureAtlas::GetRegion(const std::string& name) const noexcept {
+    if(const auto found = m_regions.find(name); found != std::end(m_regions)) {
+        return &found->second;
+    }
+    return nullptr;
+}
+
+std::size_t TextureAtlas::GetPageCount() const noexcept {
+    return m_pages.size();
+}
+
+const Image& TextureAtlas::GetPageImage(std::size_t page) const noexcept {
+    return m_pages[page];
+}
+
+Texture* TextureAtlas::GetPageTexture(std::size_t page) const noexcept {
+    return page < m_page_textures.size() ? m_page_textures[page] : nullptr;
+}
+
+Material* TextureAtlas::GetPageMaterial(std::size_t page) const noexcept {
+    return page < m_page_materials.size() ? m_page_materials[page] : nullptr;
+}
+
+const AtlasPackerStats& TextureAtlas::GetStats() const noexcept {
+    return m_packer.GetStats();
+}
+
+const std::string& TextureAtlas::GetName() const noexcept {
+    return m_name;
+}
+
+std::string TextureAtlas::GetPageName(std::size_t page) const noexcept {
+    return std::format("__Atlas_{}_{}", m_name, page);
+}
+
+void TextureAtlas::AddRegion(const std::string& name, int page, const IntVector2& position, const IntVector2& dimensions) noexcept {
+    const auto page_dimensions = Vector2(m_pages[page].GetDimensions());
+    const auto mins = Vector2(position) / page_dimensions;
+    const auto maxs = Vector2(position + dimensions) / page_dimensions;
+    m_regions.insert_or_assign(name, TextureAtlasRegion{page, position, dimensions, AABB2(mins, maxs)});
+}
+
+void TextureAtlas::Blit(Image& page, const Image& source, const IntVector2& position, int padding) noexcept {
+    const auto& dimensions = source.GetDimensions();
+    const auto page_width = static_cast<std::size_t>(page.GetDimensions().x);
+    //Decoded files are always RGBA8, so interior rows copy whole; anything else goes texel by texel.
+    const auto is_rgba = source.GetBytesPerTexel() == 4 && page.GetBytesPerTexel() == 4;
+    for(int y = -padding; y < dimensions.y + padding; ++y) {
+        const auto source_y = std::clamp(y, 0, dimensions.y - 1);
+        for(int x = -padding; x < dimensions.x + padding; ++x) {
+            const auto is_interior = 0 <= y && y < dimensions.y && 0 <= x && x < dimensions.x;
+            if(is_interior && is_rgba) {
+                auto* row = page.GetData() + ((static_cast<std::size_t>(position.y) + y) * page_width + position.x) * 4u;
+                std::memcpy(row, source.GetData() + static_cast<std::size_t>(y) * dimensions.x * 4u, static_cast<std::size_t>(dimensions.x) * 4u);
+                x = dimensions.x - 1;
+                continue;
+            }
+            //Padding repeats the nearest edge texel so bilinear filtering at the border never blends in a neighbor.
+            const auto source_x = std::clamp(x, 0, dimensions.x - 1);
+            page.SetTexel(IntVector2{position.x + x, position.y + y}, source.GetTexel(IntVector2{source_x, source_y}));
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Engine/Core/Image.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVector2.hpp"
+#include "Engine/Renderer/AtlasPacker.hpp"
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Material;
+class Texture;
+
+//One image's place in the atlas. uvs span exactly its texels on the page; they are not inset.
+struct TextureAtlasRegion {
+    int page{-1};
+    IntVector2 position{};
+    IntVector2 dimensions{};
+    AABB2 uvs{};
+};
+
+//Packs many small images onto a few shared pages so sprites, glyphs and icons drawn from them batch together.
+//Build and Export touch only Images and run without a renderer, at load time or as an offline bake;
+//CreateTextures uploads the pages and registers a texture and an unlit 2D material for each.
+class TextureAtlas {
+public:
+    explicit TextureAtlas(std::string name, const AtlasPackerOptions& options = AtlasPackerOptions{}) noexcept;
+    TextureAtlas(const TextureAtlas& other) = delete;
+    TextureAtlas(TextureAtlas&& other) = default;
+    TextureAtlas& operator=(const TextureAtlas& other) = delete;
+    TextureAtlas& operator=(TextureAtlas&& other) = default;
+    ~TextureAtlas() = default;
+
+    //Queues an image for the next Build. Returns false if the name is taken or the image is empty.
+    [[nodiscard]] bool Add(const std::string& name, Image&& image) noexcept;
+    //Queues the image at filepath under its path as written. Returns false if the file does not exist.
+    [[nodiscard]] bool Add(const std::filesystem::path& filepath) noexcept;
+
+    //Packs the queued images and copies them onto the page images, extruding each image's edge texels into its padding.
+    //The queued images are released. Returns false if any did not fit; those have no region.
+    [[nodiscard]] bool Build() noexcept;
+    //Writes each page as a .png next to filepath and the regions to filepath as XML.
+    [[nodiscard]] bool Export(const std::filesystem::path& filepath) const noexcept;
+    //Reads pages and regions written by Export in place of Build. Returns false if the file or any page it lists is missing.
+    [[nodiscard]] bool LoadFromFile(const std::filesystem::path& filepath) noexcept;
+
+    //Uploads the pages through the renderer service. Page textures are named "__Atlas_<name>_<page>"; materials the same with "_Material".
+    void CreateTextures() noexcept;
+
+    [[nodiscard]] const TextureAtlasRegion* GetRegion(const std::string& name) const noexcept;
+    [[nodiscard]] std::size_t GetPageCount() const noexcept;
+    [[nodiscard]] const Image& GetPageImage(std::size_t page) const noexcept;
+    [[nodiscard]] Texture* GetPageTexture(std::size_t page) const noexcept;
+    [[nodiscard]] Material* GetPageMaterial(std::size_t page) const noexcept;
+    [[nodiscard]] const AtlasPackerStats& GetStats() const noexcept;
+    [[nodiscard]] const std::string& GetName() const noexcept;
+
+protected:
+private:
+    struct PendingImage {
+        std::string name{};
+        Image image{};
+    };
+
+    [[nodiscard]] std::string GetPageName(std::size_t page) const noexcept;
+    void AddRegion(const std::string& name, int page, const IntVector2& position, const IntVector2& dimensions) noexcept;
+    static void Blit(Image& page, const Image& source, const IntVector2& position, int padding) noexcept;
+
+    std::string m_name{};
+    AtlasPacker m_packer;
+    std::vector<PendingImage> m_pending{};
+    std::vector<Image> m_pages{};
+    std::vector<Texture*> m_page_textures{};
+    std::vector<Material*> m_page_materials{};
+    std::unordered_map<std::string, TextureAtlasRegion> m_regions{};
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
+#include "Engine/Renderer/VertexPacking.hpp"
+
+//32 bytes against Vertex3D's 72: 8-bit color, half-precision texture coordinates
+//and octahedral-encoded normal, tangent and bitangent.
+//The directions arrive in the shader as float2 and must be unfolded before use:
+//    float3 DecodeOctahedral(float2 e) {
+//        float3 n = float3(e, 1.0f - abs(e.x) - abs(e.y));
+//        float t = saturate(-n.z);
+//        n.xy += n.xy >= 0.0f ? -t : t;
+//        return normalize(n);
+//    }
+struct Vertex3DCompact {
+    // clang-format off
+    Vertex3DCompact(const Vector3& pos = Vector3::Zero
+                   ,const Rgba& color = Rgba::White
+                   ,const Vector2& tex_coords = Vector2::Zero
+                   ,const Vector3& normal = Vector3::Z_Axis
+                   ,const Vector3& tangent = Vector3::Zero
+                   ,const Vector3& bitangent = Vector3::Zero) noexcept
+    : position(pos)
+    , color(color)
+    , texcoords(VertexPacking::PackHalf2(tex_coords))
+    , normal(VertexPacking::PackOctahedral(normal))
+    , tangent(VertexPacking::PackOctahedral(tangent))
+    , bitangent(VertexPacking::PackOctahedral(bitangent)) {
+        /* DO NOTHING */
+    }
+    // clang-format on
+    Vertex3DCompact(const Vertex3DCompact& other) = default;
+    Vertex3DCompact(Vertex3DCompact&& other) = default;
+    Vertex3DCompact& operator=(const Vertex3DCompact& other) = default;
+    Vertex3DCompact& operator=(Vertex3DCompact&& other) = default;
+    Vector3 position = Vector3::Zero;
+    Rgba color = Rgba::White;
+    VertexPacking::Half2 texcoords{};
+    VertexPacking::Octahedral normal{};
+    VertexPacking::Octahedral tangent{};
+    VertexPacking::Octahedral bitangent{};
+
+protected:
+private:
+};
+
+template<>
+struct VertexLayout<Vertex3DCompact> {
+    // clang-format off
+    static constexpr std::array<VertexElement, 6> elements{{
+        {VertexAttribute::Position, ImageFormat::R32G32B32_Float, "POSITION", offsetof(Vertex3DCompact, position)}
+        , {VertexAttribute::Color, ImageFormat::R8G8B8A8_UNorm, "COLOR", offsetof(Vertex3DCompact, color)}
+        , {VertexAttribute::TexCoords, ImageFormat::R16G16_Float, "UV", offsetof(Vertex3DCompact, texcoords)}
+        , {VertexAttribute::Normal, ImageFormat::R16G16_SNorm, "NORMAL", offsetof(Vertex3DCompact, normal)}
+        , {VertexAttribute::Tangent, ImageFormat::R16G16_SNorm, "TANGENT", offsetof(Vertex3DCompact, tangent)}
+        , {VertexAttribute::Bitangent, ImageFormat::R16G16_SNorm, "BITANGENT", offsetof(Vertex3DCompact, bitangent)}
+    }};
+    // clang-format on
+};
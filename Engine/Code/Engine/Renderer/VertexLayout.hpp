@@ -0,0 +1,195 @@
+#pragma once
+
+#include "Engine/RHI/RHITypes.hpp"
+#include "Engine/Renderer/Vertex3D.hpp"
+#include "Engine/Renderer/Vertex3DInstanced.hpp"
+#include "Engine/Renderer/VertexPacking.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+//The field of the full-precision Vertex3D an element is filled from.
+// clang-format off
+enum class VertexAttribute {
+    Position
+    , Color
+    , TexCoords
+    , Normal
+    , Tangent
+    , Bitangent
+};
+// clang-format on
+
+//One input element of a vertex type.
+//The same description builds the input layout and drives the packing Mesh::BasicBuilder does as it emits vertices.
+struct VertexElement {
+    VertexAttribute attribute{VertexAttribute::Position};
+    ImageFormat format{ImageFormat::R32G32B32_Float};
+    const char* semantic{"POSITION"};
+    unsigned int offset{0u};
+};
+
+//A vertex type's layout at run time. The elements live in static storage, so their address identifies the layout.
+struct VertexLayoutDesc {
+    std::span<const VertexElement> elements{};
+    unsigned int stride{0u};
+};
+
+//Specialize for each vertex type with a static constexpr std::array<VertexElement, N> named elements.
+//Supported encodings per attribute:
+//  Position:                   R32G32B32_Float, R32G32_Float
+//  Color:                      R32G32B32A32_Float, R8G8B8A8_UNorm
+//  TexCoords:                  R32G32_Float, R16G16_Float
+//  Normal, Tangent, Bitangent: R32G32B32_Float, R16G16_SNorm (octahedral)
+template<typename VertexT>
+struct VertexLayout;
+
+template<>
+struct VertexLayout<Vertex3D> {
+    // clang-format off
+    static constexpr std::array<VertexElement, 6> elements{{
+        {VertexAttribute::Position, ImageFormat::R32G32B32_Float, "POSITION", offsetof(Vertex3D, position)}
+        , {VertexAttribute::Color, ImageFormat::R32G32B32A32_Float, "COLOR", offsetof(Vertex3D, color)}
+        , {VertexAttribute::TexCoords, ImageFormat::R32G32_Float, "UV", offsetof(Vertex3D, texcoords)}
+        , {VertexAttribute::Normal, ImageFormat::R32G32B32_Float, "NORMAL", offsetof(Vertex3D, normal)}
+        , {VertexAttribute::Tangent, ImageFormat::R32G32B32_Float, "TANGENT", offsetof(Vertex3D, tangent)}
+        , {VertexAttribute::Bitangent, ImageFormat::R32G32B32_Float, "BITANGENT", offsetof(Vertex3D, bitangent)}
+    }};
+    // clang-format on
+};
+
+//Per-instance data of instanced draws, bound in input slot 1 next to the Vertex3D stream.
+//The semantics differ from Vertex3D's so one vertex shader can read both.
+template<>
+struct VertexLayout<Vertex3DInstanced> {
+    // clang-format off
+    static constexpr std::array<VertexElement, 6> elements{{
+        {VertexAttribute::Position, ImageFormat::R32G32B32_Float, "INSTANCE_POSITION", offsetof(Vertex3DInstanced, position)}
+        , {VertexAttribute::Color, ImageFormat::R32G32B32A32_Float, "INSTANCE_COLOR", offsetof(Vertex3DInstanced, color)}
+        , {VertexAttribute::TexCoords, ImageFormat::R32G32_Float, "INSTANCE_UV", offsetof(Vertex3DInstanced, texcoords)}
+        , {VertexAttribute::Normal, ImageFormat::R32G32B32_Float, "INSTANCE_NORMAL", offsetof(Vertex3DInstanced, normal)}
+        , {VertexAttribute::Tangent, ImageFormat::R32G32B32_Float, "INSTANCE_TANGENT", offsetof(Vertex3DInstanced, tangent)}
+        , {VertexAttribute::Bitangent, ImageFormat::R32G32B32_Float, "INSTANCE_BITANGENT", offsetof(Vertex3DInstanced, bitangent)}
+    }};
+    // clang-format on
+};
+
+template<typename VertexT>
+[[nodiscard]] VertexLayoutDesc GetVertexLayoutDesc() noexcept {
+    return VertexLayoutDesc{std::span<const VertexElement>{VertexLayout<VertexT>::elements}, static_cast<unsigned int>(sizeof(VertexT))};
+}
+
+namespace detail {
+
+[[nodiscard]] constexpr std::size_t GetPackedSize(VertexAttribute attribute, ImageFormat format) noexcept {
+    switch(attribute) {
+    case VertexAttribute::Position:
+        return format == ImageFormat::R32G32B32_Float ? 12u : format == ImageFormat::R32G32_Float ? 8u : 0u;
+    case VertexAttribute::Color:
+        return format == ImageFormat::R32G32B32A32_Float ? 16u : format == ImageFormat::R8G8B8A8_UNorm ? 4u : 0u;
+    case VertexAttribute::TexCoords:
+        return format == ImageFormat::R32G32_Float ? 8u : format == ImageFormat::R16G16_Float ? 4u : 0u;
+    case VertexAttribute::Normal:
+    case VertexAttribute::Tangent:
+    case VertexAttribute::Bitangent:
+        return format == ImageFormat::R32G32B32_Float ? 12u : format == ImageFormat::R16G16_SNorm ? 4u : 0u;
+    default:
+        return 0u;
+    }
+}
+
+//Every element has a supported encoding and fits inside the vertex.
+template<typename VertexT>
+[[nodiscard]] constexpr bool IsValidVertexLayout() noexcept {
+    for(const auto& element : VertexLayout<VertexT>::elements) {
+        const auto size = GetPackedSize(element.attribute, element.format);
+        if(size == 0u || element.offset + size > sizeof(VertexT)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void WriteElement(std::byte* dest, const T& value) noexcept {
+    std::memcpy(dest, &value, sizeof(T));
+}
+
+template<VertexAttribute attribute, ImageFormat format>
+void PackElement(std::byte* dest, const Vertex3D& source) noexcept {
+    if constexpr(attribute == VertexAttribute::Position) {
+        if constexpr(format == ImageFormat::R32G32B32_Float) {
+            WriteElement(dest, source.position);
+        } else {
+            WriteElement(dest, std::array<float, 2>{source.position.x, source.position.y});
+        }
+    } else if constexpr(attribute == VertexAttribute::Color) {
+        if constexpr(format == ImageFormat::R32G32B32A32_Float) {
+            WriteElement(dest, source.color);
+        } else {
+            WriteElement(dest, VertexPacking::PackUNorm8x4(source.color));
+        }
+    } else if constexpr(attribute == VertexAttribute::TexCoords) {
+        if constexpr(format == ImageFormat::R32G32_Float) {
+            WriteElement(dest, source.texcoords);
+        } else {
+            WriteElement(dest, VertexPacking::PackHalf2(source.texcoords));
+        }
+    } else {
+        const auto& direction = attribute == VertexAttribute::Normal ? source.normal : attribute == VertexAttribute::Tangent ? source.tangent : source.bitangent;
+        if constexpr(format == ImageFormat::R32G32B32_Float) {
+            WriteElement(dest, direction);
+        } else {
+            WriteElement(dest, VertexPacking::PackOctahedral(direction));
+        }
+    }
+}
+
+template<typename VertexT, std::size_t... I>
+void PackElements(std::byte* dest, const Vertex3D& source, std::index_sequence<I...>) noexcept {
+    constexpr const auto& elements = VertexLayout<VertexT>::elements;
+    (PackElement<elements[I].attribute, elements[I].format>(dest + elements[I].offset, source), ...);
+}
+
+template<VertexAttribute attribute, typename VertexT, std::size_t... I>
+void PackAttributeElements(std::byte* dest, const Vertex3D& source, std::index_sequence<I...>) noexcept {
+    constexpr const auto& elements = VertexLayout<VertexT>::elements;
+    ([&] {
+        if constexpr(elements[I].attribute == attribute) {
+            PackElement<attribute, elements[I].format>(dest + elements[I].offset, source);
+        }
+    }(), ...);
+}
+
+template<typename VertexT>
+constexpr void ValidateVertexLayout() noexcept {
+    static_assert(std::is_trivially_copyable_v<VertexT>, "Packed vertex types must be trivially copyable.");
+    static_assert(IsValidVertexLayout<VertexT>(), "VertexLayout has an unsupported format or an element outside the vertex.");
+}
+
+} // namespace detail
+
+//Encodes a full-precision vertex into VertexT as its layout describes.
+//Every element is unrolled at compile time; there is no per-vertex lookup of the description.
+template<typename VertexT>
+[[nodiscard]] VertexT PackVertex(const Vertex3D& source) noexcept {
+    if constexpr(std::is_same_v<VertexT, Vertex3D>) {
+        return source;
+    } else {
+        detail::ValidateVertexLayout<VertexT>();
+        VertexT result{};
+        detail::PackElements<VertexT>(reinterpret_cast<std::byte*>(&result), source, std::make_index_sequence<VertexLayout<VertexT>::elements.size()>{});
+        return result;
+    }
+}
+
+//Re-encodes only the elements filled from attribute, leaving the rest of dest untouched.
+template<VertexAttribute attribute, typename VertexT>
+void PackVertexAttribute(VertexT& dest, const Vertex3D& source) noexcept {
+    detail::ValidateVertexLayout<VertexT>();
+    detail::PackAttributeElements<attribute, VertexT>(reinterpret_cast<std::byte*>(&dest), source, std::make_index_sequence<VertexLayout<VertexT>::elements.size()>{});
+}
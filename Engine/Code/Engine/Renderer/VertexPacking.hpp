@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector4.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+//Conversions between the full-precision vertex attributes the engine builds with
+//and the compact encodings the GPU can read directly through the input assembler.
+namespace VertexPacking {
+
+//Two IEEE 754 half-precision floats, read by an R16G16_Float element.
+using Half2 = std::array<std::uint16_t, 2>;
+//A unit vector folded onto an octahedron, read by an R16G16_SNorm element and unfolded in the shader.
+using Octahedral = std::array<std::int16_t, 2>;
+
+//Rounds to the nearest half, ties to even. Out of range values become infinity; NaN stays NaN.
+[[nodiscard]] inline std::uint16_t FloatToHalf(float value) noexcept {
+    const auto bits = std::bit_cast<std::uint32_t>(value);
+    const auto sign = static_cast<std::uint16_t>((bits >> 16u) & 0x8000u);
+    const auto abs_bits = bits & 0x7FFFFFFFu;
+    if(abs_bits >= 0x7F800000u) {
+        return static_cast<std::uint16_t>(sign | 0x7C00u | (abs_bits > 0x7F800000u ? 0x0200u : 0x0000u));
+    }
+    if(abs_bits >= 0x47800000u) {
+        return static_cast<std::uint16_t>(sign | 0x7C00u);
+    }
+    if(abs_bits < 0x38800000u) {
+        //Smaller than the smallest normal half; shift the mantissa, implicit one included, into a subnormal.
+        if(abs_bits < 0x33000000u) {
+            return sign;
+        }
+        const auto shift = 126u - (abs_bits >> 23u);
+        const auto mantissa = (abs_bits & 0x007FFFFFu) | 0x00800000u;
+        auto half = mantissa >> shift;
+        const auto remainder = mantissa & ((1u << shift) - 1u);
+        const auto halfway = 1u << (shift - 1u);
+        if(remainder > halfway || (remainder == halfway && (half & 1u))) {
+            ++half;
+        }
+        return static_cast<std::uint16_t>(sign | half);
+    }
+    //Rebias the exponent from 127 to 15 and drop 13 mantissa bits. A carry out of the mantissa correctly bumps the exponent.
+    auto half = (abs_bits - 0x38000000u) >> 13u;
+    const auto remainder = abs_bits & 0x1FFFu;
+    if(remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+        ++half;
+    }
+    return static_cast<std::uint16_t>(sign | half);
+}
+
+[[nodiscard]] inline float HalfToFloat(std::uint16_t value) noexcept {
+    const auto sign = static_cast<std::uint32_t>(value & 0x8000u) << 16u;
+    const auto exponent = (value >> 10u) & 0x1Fu;
+    const auto mantissa = static_cast<std::uint32_t>(value & 0x03FFu);
+    if(exponent == 0u) {
+        const auto magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+    if(exponent == 0x1Fu) {
+        return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13u));
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112u) << 23u) | (mantissa << 13u));
+}
+
+[[nodiscard]] inline Half2 PackHalf2(const Vector2& value) noexcept {
+    return Half2{FloatToHalf(value.x), FloatToHalf(value.y)};
+}
+
+[[nodiscard]] inline Vector2 UnpackHalf2(const Half2& value) noexcept {
+    return Vector2(HalfToFloat(value[0]), HalfToFloat(value[1]));
+}
+
+//Components are clamped to [0, 1] and rounded to the nearest byte.
+[[nodiscard]] inline Rgba PackUNorm8x4(const Vector4& color) noexcept {
+    const auto to_byte = [](float c) { return static_cast<unsigned char>(std::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f); };
+    return Rgba(to_byte(color.x), to_byte(color.y), to_byte(color.z), to_byte(color.w));
+}
+
+//The vector need not be normalized. The zero vector encodes as +Z.
+[[nodiscard]] inline Octahedral PackOctahedral(const Vector3& v) noexcept {
+    const auto sign_not_zero = [](float f) { return f < 0.0f ? -1.0f : 1.0f; };
+    const auto to_snorm = [](float f) {
+        const auto scaled = std::clamp(f, -1.0f, 1.0f) * 32767.0f;
+        return static_cast<std::int16_t>(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+    };
+    const auto l1 = std::fabs(v.x) + std::fabs(v.y) + std::fabs(v.z);
+    if(l1 == 0.0f) {
+        return Octahedral{};
+    }
+    auto x = v.x / l1;
+    auto y = v.y / l1;
+    if(v.z < 0.0f) {
+        //Fold the lower hemisphere over the diagonals.
+        const auto folded_x = (1.0f - std::fabs(y)) * sign_not_zero(x);
+        const auto folded_y = (1.0f - std::fabs(x)) * sign_not_zero(y);
+        x = folded_x;
+        y = folded_y;
+    }
+    return Octahedral{to_snorm(x), to_snorm(y)};
+}
+
+//Matches the HLSL decode: the result is normalized.
+[[nodiscard]] inline Vector3 UnpackOctahedral(const Octahedral& value) noexcept {
+    const auto sign_not_zero = [](float f) { return f < 0.0f ? -1.0f : 1.0f; };
+    auto x = (std::max)(value[0] / 32767.0f, -1.0f);
+    auto y = (std::max)(value[1] / 32767.0f, -1.0f);
+    const auto z = 1.0f - std::fabs(x) - std::fabs(y);
+    if(z < 0.0f) {
+        const auto unfolded_x = (1.0f - std::fabs(y)) * sign_not_zero(x);
+        const auto unfolded_y = (1.0f - std::fabs(x)) * sign_not_zero(y);
+        x = unfolded_x;
+        y = unfolded_y;
+    }
+    const auto length = std::sqrt(x * x + y * y + z * z);
+    return Vector3(x / length, y / length, z / length);
+}
+
+} // namespace VertexPacking
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
+#include "Engine/Renderer/VertexPacking.hpp"
+
+//16 bytes against Vertex3D's 72: a 2D position, 8-bit color and half-precision texture coordinates.
+//Reads as float3/float4/float2 in the vertex shader, so it works with the existing 2D shaders unchanged.
+struct VertexSprite2D {
+    // clang-format off
+    VertexSprite2D(const Vector2& pos = Vector2::Zero
+                  ,const Rgba& color = Rgba::White
+                  ,const Vector2& tex_coords = Vector2::Zero) noexcept
+    : position(pos)
+    , color(color)
+    , texcoords(VertexPacking::PackHalf2(tex_coords)) {
+        /* DO NOTHING */
+    }
+    // clang-format on
+    VertexSprite2D(const VertexSprite2D& other) = default;
+    VertexSprite2D(VertexSprite2D&& other) = default;
+    VertexSprite2D& operator=(const VertexSprite2D& other) = default;
+    VertexSprite2D& operator=(VertexSprite2D&& other) = default;
+    Vector2 position = Vector2::Zero;
+    Rgba color = Rgba::White;
+    VertexPacking::Half2 texcoords{};
+
+protected:
+private:
+};
+
+template<>
+struct VertexLayout<VertexSprite2D> {
+    // clang-format off
+    static constexpr std::array<VertexElement, 3> elements{{
+        {VertexAttribute::Position, ImageFormat::R32G32_Float, "POSITION", offsetof(VertexSprite2D, position)}
+        , {VertexAttribute::Color, ImageFormat::R8G8B8A8_UNorm, "COLOR", offsetof(VertexSprite2D, color)}
+        , {VertexAttribute::TexCoords, ImageFormat::R16G16_Float, "UV", offsetof(VertexSprite2D, texcoords)}
+    }};
+    // clang-format on
+};
@@ -4,6 +4,14 @@
 
 #include <string>
 
+// clang-format off
+//Where records captured with LOG_STRUCTURED end up: formatted into the text log, or written raw to a .blog file beside it for the decodelog command.
+enum class StructuredLogMode {
+    Text
+    ,Binary
+};
+// clang-format on
+
 class IFileLoggerService : public IService {
 public:
     virtual ~IFileLoggerService() noexcept {/* DO NOTHING */};
@@ -22,6 +30,7 @@ public:
     virtual void LogTagLine(const std::string& tag, const std::string& msg) noexcept = 0;
     virtual void Flush() noexcept = 0;
     virtual void SaveLog() noexcept = 0;
+    virtual void SetStructuredLogMode(StructuredLogMode mode) noexcept = 0;
 
 protected:
 private:
@@ -43,4 +52,5 @@ public:
     void LogTagLine([[maybe_unused]] const std::string& tag, [[maybe_unused]] const std::string& msg) noexcept override {}
     void Flush() noexcept override {}
     void SaveLog() noexcept override {}
+    void SetStructuredLogMode([[maybe_unused]] StructuredLogMode mode) noexcept override {}
 };
@@ -1,12 +1,14 @@
 #pragma once
 
+#include "Engine/Core/JobTypes.hpp"
+
 #include "Engine/Services/IService.hpp"
 
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
-
-enum class JobType : std::size_t;
-class Job;
+#include <iterator>
+#include <vector>
 
 class IJobSystemService : public IService {
 public:
@@ -16,8 +18,8 @@ public:
     virtual void Shutdown() noexcept = 0;
 
     virtual void SetCategorySignal(const JobType& category_id, std::condition_variable* signal) noexcept = 0;
-    [[nodiscard]] virtual Job* Create(const JobType& category, const std::function<void(void*)>& cb, void* user_data) noexcept = 0;
-    virtual void Run(const JobType& category, const std::function<void(void*)>& cb, void* user_data) noexcept = 0;
+    [[nodiscard]] virtual Job* Create(const JobType& category, const JobCallback& cb, void* user_data) noexcept = 0;
+    virtual void Run(const JobType& category, const JobCallback& cb, void* user_data) noexcept = 0;
     virtual void Dispatch(Job* job) noexcept = 0;
     virtual bool Release(Job* job) noexcept = 0;
     virtual void Wait(Job* job) noexcept = 0;
@@ -27,6 +29,22 @@ public:
     virtual void SetIsRunning(bool value = true) noexcept = 0;
 
     [[nodiscard]] virtual std::condition_variable* GetMainJobSignal() const noexcept = 0;
+    [[nodiscard]] virtual std::size_t GetWorkerCount() const noexcept = 0;
+    //Runs at most one queued generic job on the calling thread. Used to help out while waiting on other work.
+    [[nodiscard]] virtual bool TryRunPendingJob() noexcept = 0;
+
+    //Splits [first, last) into chunks of at least grain indices and runs them on the generic workers.
+    //The calling thread works on the range too and returns once every index has been processed.
+    //A grain of zero picks one from the range size and worker count.
+    virtual void ParallelFor(std::size_t first, std::size_t last, std::size_t grain, const ParallelRangeCallback& cb) noexcept = 0;
+
+    //map(first, last) -> T is called once per grain-sized chunk; the partial results are combined in index order with reduce(T, T) -> T.
+    //Pass an explicit grain for results that do not depend on the number of workers.
+    template<typename T, typename MapFn, typename ReduceFn>
+    [[nodiscard]] T ParallelReduce(std::size_t first, std::size_t last, std::size_t grain, T identity, MapFn&& map, ReduceFn&& reduce) noexcept;
+
+    template<typename RandomIt, typename Compare = std::less<>>
+    void ParallelSort(RandomIt first, RandomIt last, Compare comp = Compare{}) noexcept;
 
 protected:
 private:
@@ -40,8 +58,8 @@ public:
     void Shutdown() noexcept override {}
 
     void SetCategorySignal([[maybe_unused]] const JobType& category_id, [[maybe_unused]] std::condition_variable* signal) noexcept override {}
-    [[nodiscard]] Job* Create([[maybe_unused]] const JobType& category, [[maybe_unused]] const std::function<void(void*)>& cb, [[maybe_unused]] void* user_data) noexcept override { return nullptr; }
-    void Run([[maybe_unused]] const JobType& category, [[maybe_unused]] const std::function<void(void*)>& cb, [[maybe_unused]] void* user_data) noexcept override {}
+    [[nodiscard]] Job* Create([[maybe_unused]] const JobType& category, [[maybe_unused]] const JobCallback& cb, [[maybe_unused]] void* user_data) noexcept override { return nullptr; }
+    void Run([[maybe_unused]] const JobType& category, [[maybe_unused]] const JobCallback& cb, [[maybe_unused]] void* user_data) noexcept override {}
     void Dispatch([[maybe_unused]] Job* job) noexcept override {}
     [[nodiscard]] bool Release([[maybe_unused]] Job* job) noexcept override { return false; }
     void Wait([[maybe_unused]] Job* job) noexcept override {}
@@ -51,7 +69,88 @@ public:
     void SetIsRunning([[maybe_unused]] bool value = true) noexcept override {}
 
     [[nodiscard]] std::condition_variable* GetMainJobSignal() const noexcept override { return nullptr; }
+    [[nodiscard]] std::size_t GetWorkerCount() const noexcept override { return 0u; }
+    [[nodiscard]] bool TryRunPendingJob() noexcept override { return false; }
+
+    void ParallelFor(std::size_t first, std::size_t last, [[maybe_unused]] std::size_t grain, const ParallelRangeCallback& cb) noexcept override {
+        if(first < last) {
+            cb(first, last);
+        }
+    }
 
 protected:
 private:
 };
+
+template<typename T, typename MapFn, typename ReduceFn>
+T IJobSystemService::ParallelReduce(std::size_t first, std::size_t last, std::size_t grain, T identity, MapFn&& map, ReduceFn&& reduce) noexcept {
+    if(last <= first) {
+        return identity;
+    }
+    const auto count = last - first;
+    if(grain == 0u) {
+        grain = (std::max)(std::size_t{1u}, count / (8u * (GetWorkerCount() + 1u)));
+    }
+    const auto chunk_count = (count + grain - 1u) / grain;
+    std::vector<T> partials(chunk_count, identity);
+    struct context_t {
+        T* partials{};
+        std::remove_reference_t<MapFn>* map{};
+        std::size_t first{};
+        std::size_t last{};
+        std::size_t grain{};
+    };
+    const auto context = context_t{partials.data(), &map, first, last, grain};
+    ParallelFor(0u, chunk_count, 1u, [&context](std::size_t chunk_first, std::size_t chunk_last) {
+        for(auto chunk = chunk_first; chunk < chunk_last; ++chunk) {
+            const auto chunk_begin = context.first + chunk * context.grain;
+            const auto chunk_end = (std::min)(chunk_begin + context.grain, context.last);
+            context.partials[chunk] = std::invoke(*context.map, chunk_begin, chunk_end);
+        }
+    });
+    auto result = identity;
+    for(auto& partial : partials) {
+        result = std::invoke(reduce, std::move(result), std::move(partial));
+    }
+    return result;
+}
+
+template<typename RandomIt, typename Compare /*= std::less<>*/>
+void IJobSystemService::ParallelSort(RandomIt first, RandomIt last, Compare comp /*= Compare{}*/) noexcept {
+    constexpr std::size_t min_chunk_size = 2048u;
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+    const auto worker_count = GetWorkerCount();
+    if(worker_count == 0u || count <= min_chunk_size) {
+        std::sort(first, last, comp);
+        return;
+    }
+    //Sort independent chunks, then merge neighbouring runs pairwise until one run remains.
+    const auto chunk_count = (std::min)((worker_count + 1u) * 4u, count / min_chunk_size);
+    const auto chunk_size = (count + chunk_count - 1u) / chunk_count;
+    struct context_t {
+        RandomIt first{};
+        std::size_t count{};
+        Compare* comp{};
+    };
+    const auto context = context_t{first, count, &comp};
+    ParallelFor(0u, chunk_count, 1u, [&context, chunk_size](std::size_t chunk_first, std::size_t chunk_last) {
+        for(auto chunk = chunk_first; chunk < chunk_last; ++chunk) {
+            const auto lo = chunk * chunk_size;
+            const auto hi = (std::min)(lo + chunk_size, context.count);
+            std::sort(context.first + lo, context.first + hi, *context.comp);
+        }
+    });
+    for(auto width = chunk_size; width < count; width *= 2u) {
+        const auto pair_count = (count + 2u * width - 1u) / (2u * width);
+        ParallelFor(0u, pair_count, 1u, [&context, width](std::size_t pair_first, std::size_t pair_last) {
+            for(auto pair = pair_first; pair < pair_last; ++pair) {
+                const auto lo = pair * 2u * width;
+                const auto mid = (std::min)(lo + width, context.count);
+                const auto hi = (std::min)(lo + 2u * width, context.count);
+                if(mid < hi) {
+                    std::inplace_merge(context.first + lo, context.first + mid, context.first + hi, *context.comp);
+                }
+            }
+        });
+    }
+}
@@ -4,34 +4,43 @@
 
 #include "Engine/Core/Gif.hpp"
 #include "Engine/Core/IFont.hpp"
+#include "Engine/Core/StringId.hpp"
 
 #include "Engine/Renderer/AnimatedSprite.hpp"
+#include "Engine/Renderer/AsyncTexture.hpp"
 #include "Engine/Renderer/Camera3D.hpp"
 #include "Engine/Renderer/Flipbook.hpp"
 #include "Engine/Renderer/Shader.hpp"
 #include "Engine/Renderer/Sampler.hpp"
 #include "Engine/Renderer/Material.hpp"
 #include "Engine/Renderer/ShaderProgram.hpp"
+#include "Engine/Renderer/SpriteBatch.hpp"
+#include "Engine/Renderer/TextLayoutCache.hpp"
 #include "Engine/Renderer/RasterState.hpp"
 #include "Engine/Renderer/Vertex3D.hpp"
 #include "Engine/Renderer/Vertex3DInstanced.hpp"
 #include "Engine/Renderer/VertexBuffer.hpp"
 #include "Engine/Renderer/VertexCircleBuffer.hpp"
+#include "Engine/Renderer/VertexLayout.hpp"
 #include "Engine/Renderer/VertexBufferInstanced.hpp"
 #include "Engine/Renderer/IndexBuffer.hpp"
 #include "Engine/Renderer/ConstantBuffer.hpp"
 #include "Engine/Renderer/StructuredBuffer.hpp"
 #include "Engine/Renderer/RenderTargetStack.hpp"
 #include "Engine/Renderer/RendererTypes.hpp"
+#include "Engine/Renderer/StreamingBuffer.hpp"
 #include "Engine/Renderer/Texture.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
 
 class Rgba;
 class Frustum;
 class Camera2D;
 class SpriteSheet;
+class TextureAtlas;
 class FrameBuffer;
 
 class RHIDeviceContext;
@@ -81,10 +90,16 @@ public:
 
     [[nodiscard]] virtual Texture* CreateOrGetTexture(const std::filesystem::path& filepath, const IntVector3& dimensions) noexcept = 0;
     virtual void RegisterTexturesFromFolder(std::filesystem::path folderpath, bool recursive = false) noexcept = 0;
+    //Reads and decodes the image in the background; the returned texture is the default placeholder until it has been uploaded.
+    [[nodiscard]] virtual std::shared_ptr<AsyncTexture> CreateOrGetTextureAsync(const std::filesystem::path& filepath) noexcept = 0;
+    virtual void RegisterTexturesFromFolderAsync(std::filesystem::path folderpath, bool recursive = false) noexcept = 0;
+    //Blocks until every pending asynchronous texture has been decoded and uploaded.
+    virtual void WaitForTextureLoads() noexcept = 0;
     [[nodiscard]] virtual bool RegisterTexture(const std::string& name, std::unique_ptr<Texture> texture) noexcept = 0;
     virtual void SetTexture(Texture* texture, unsigned int registerIndex = 0) noexcept = 0;
 
     [[nodiscard]] virtual Texture* GetTexture(const std::string& nameOrFile) noexcept = 0;
+    [[nodiscard]] virtual Texture* GetTexture(const StringId& id) noexcept = 0;
 
     [[nodiscard]] virtual std::unique_ptr<Texture> CreateDepthStencil(const RHIDevice& owner, uint32_t width, uint32_t height) noexcept = 0;
     [[nodiscard]] virtual std::unique_ptr<Texture> CreateDepthStencil(const RHIDevice& owner, const IntVector2& dimensions) noexcept = 0;
@@ -129,6 +144,7 @@ public:
 
     [[nodiscard]] virtual std::shared_ptr<SpriteSheet> CreateSpriteSheet(const std::filesystem::path& filepath, unsigned int width = 1, unsigned int height = 1) noexcept = 0;
     [[nodiscard]] virtual std::shared_ptr<SpriteSheet> CreateSpriteSheet(const XMLElement& elem) noexcept = 0;
+    [[nodiscard]] virtual std::shared_ptr<SpriteSheet> CreateSpriteSheet(const TextureAtlas& atlas, const std::string& regionName, unsigned int width = 1, unsigned int height = 1) noexcept = 0;
     [[nodiscard]] virtual std::unique_ptr<AnimatedSprite> CreateAnimatedSprite(std::filesystem::path filepath) noexcept = 0;
     [[nodiscard]] virtual std::unique_ptr<AnimatedSprite> CreateAnimatedSprite(const AnimatedSpriteDesc& desc) noexcept = 0;
     [[nodiscard]] virtual std::unique_ptr<AnimatedSprite> CreateAnimatedSprite(std::shared_ptr<SpriteSheet> sheet, const IntVector2& startSpriteCoords = IntVector2::Zero) noexcept = 0;
@@ -188,6 +204,9 @@ public:
     virtual void Draw(const PrimitiveType& topology, const std::vector<VertexCircle2D>& vbo, std::size_t vertex_count) noexcept = 0;
     virtual void DrawIndexed(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo) noexcept = 0;
     virtual void DrawIndexed(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, std::size_t index_count, std::size_t startVertex = 0, std::size_t baseVertexLocation = 0) noexcept = 0;
+    //Packed vertices: vbo holds vertices laid out as layout describes, read through an input layout built from it for the current shader.
+    virtual void Draw(const PrimitiveType& topology, const VertexLayoutDesc& layout, std::span<const std::byte> vbo) noexcept = 0;
+    virtual void DrawIndexed(const PrimitiveType& topology, const VertexLayoutDesc& layout, std::span<const std::byte> vbo, const std::vector<unsigned int>& ibo, std::size_t index_count, std::size_t startVertex = 0, std::size_t baseVertexLocation = 0) noexcept = 0;
     virtual void DrawInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, std::size_t instanceCount) noexcept = 0;
     virtual void DrawInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, std::size_t instanceCount, std::size_t vertexCount) noexcept = 0;
     virtual void DrawIndexedInstanced(const PrimitiveType& topology, const std::vector<Vertex3D>& vbo, const std::vector<Vertex3DInstanced>& vbio, const std::vector<unsigned int>& ibo, std::size_t instanceCount) noexcept = 0;
@@ -233,6 +252,7 @@ public:
     virtual void ReloadMaterials() noexcept = 0;
 
     [[nodiscard]] virtual Material* GetMaterial(const std::string& nameOrFile) noexcept = 0;
+    [[nodiscard]] virtual Material* GetMaterial(const StringId& id) noexcept = 0;
     virtual void SetMaterial(Material* material) noexcept = 0;
     virtual void SetMaterial(const std::string& nameOrFile) noexcept = 0;
     virtual void ResetMaterial() noexcept = 0;
@@ -244,6 +264,7 @@ public:
     virtual void RegisterShader(std::unique_ptr<Shader> shader) noexcept = 0;
 
     [[nodiscard]] virtual Shader* GetShader(const std::string& nameOrFile) noexcept = 0;
+    [[nodiscard]] virtual Shader* GetShader(const StringId& id) noexcept = 0;
     [[nodiscard]] virtual std::string GetShaderName(const std::filesystem::path filepath) noexcept = 0;
 
     virtual void SetComputeShader(Shader* shader) noexcept = 0;
@@ -251,6 +272,7 @@ public:
 
     [[nodiscard]] virtual a2de::IFont* GetDefaultFont() noexcept = 0;
     [[nodiscard]] virtual a2de::IFont* GetFont(const std::string& nameOrFile) noexcept = 0;
+    [[nodiscard]] virtual a2de::IFont* GetFont(const StringId& id) noexcept = 0;
     [[nodiscard]] virtual a2de::IFont* GetFontById(uint16_t index) noexcept = 0;
     [[nodiscard]] virtual std::size_t GetFontId([[maybe_unused]] const std::string& nameOrFile) noexcept = 0;
     virtual void RegisterFont(std::unique_ptr<a2de::IFont> font) noexcept = 0;
@@ -276,6 +298,26 @@ public:
     virtual void SetCamera(const Camera3D& camera) noexcept = 0;
     virtual void SetCamera(const Camera2D& camera) noexcept = 0;
     [[nodiscard]] virtual Camera3D GetCamera() const noexcept = 0;
+    //Upload totals of the immediate-mode draw buffers for the last completed frame.
+    [[nodiscard]] virtual StreamingBufferStats GetStreamingStats() const noexcept = 0;
+    //Draw call counts of the sprite batch for the last completed frame, before and after merging.
+    [[nodiscard]] virtual SpriteBatchStats GetSpriteBatchStats() const noexcept = 0;
+
+    //Between Begin and End, 2D quads, sprites and text lines are queued instead of drawn, then sorted by
+    //(layer, material, texture) and merged into as few draws as possible. The queue is flushed by any other draw
+    //and by changes to the view, projection, render target, viewport or scissor, so the output matches immediate mode
+    //except that quads sharing a layer may be reordered across materials and textures.
+    //Constant buffer contents are not tracked: flush before updating a buffer queued sprites depend on.
+    //Batching is opt-in: outside a Begin/End pair every quad is drawn immediately. Present ends a batch left open.
+    virtual void BeginSpriteBatch() noexcept = 0;
+    virtual void EndSpriteBatch() noexcept = 0;
+    virtual void FlushSpriteBatch() noexcept = 0;
+    //Quads queued after this draw on top of quads in lower layers. Defaults to 0.
+    virtual void SetSpriteLayer(int layer) noexcept = 0;
+    //Draws a unit quad with the sprite's texture coordinates and texture in the current material.
+    //Sheets cut from one atlas texture batch together.
+    virtual void DrawSprite(const SpriteSheet& sheet, int spriteIndex, const Matrix4& transform, const Rgba& color = Rgba::White) noexcept = 0;
+    virtual void DrawSprite(const AnimatedSprite& sprite, const Matrix4& transform, const Rgba& color = Rgba::White) noexcept = 0;
 
     [[nodiscard]] virtual Vector2 ConvertWorldToScreenCoords(const Vector3& worldCoords) const noexcept = 0;
     [[nodiscard]] virtual Vector2 ConvertWorldToScreenCoords(const Vector2& worldCoords) const noexcept = 0;
@@ -337,6 +379,9 @@ public:
     virtual void DrawTextLine(const Matrix4& transform, const a2de::IFont* font, const std::string& text, const Rgba& color = Rgba::White) noexcept = 0;
     virtual void DrawMultilineText(const a2de::IFont* font, const std::string& text, const Rgba& color = Rgba::White) noexcept = 0;
     virtual void AppendMultiLineTextBuffer(const a2de::IFont* font, const std::string& text, const Vector2& start_position, const Rgba& color, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) noexcept = 0;
+    [[nodiscard]] virtual TextLayoutCacheStats GetTextLayoutCacheStats() const noexcept = 0;
+    //Call after a font's glyphs change, and before destroying a font that was never registered with RegisterFont.
+    virtual void InvalidateTextLayouts(const a2de::IFont* font) noexcept = 0;
 
     virtual void CopyTexture(const Texture* src, Texture* dst) const noexcept = 0;
     virtual void ResizeBuffers() noexcept = 0;
@@ -396,10 +441,14 @@ public:
 
     [[nodiscard]] Texture* CreateOrGetTexture([[maybe_unused]] const std::filesystem::path& filepath, [[maybe_unused]] const IntVector3& dimensions) noexcept override { return nullptr; }
     void RegisterTexturesFromFolder([[maybe_unused]] std::filesystem::path folderpath, [[maybe_unused]] bool recursive = false) noexcept override {}
+    [[nodiscard]] std::shared_ptr<AsyncTexture> CreateOrGetTextureAsync([[maybe_unused]] const std::filesystem::path& filepath) noexcept override { return {}; }
+    void RegisterTexturesFromFolderAsync([[maybe_unused]] std::filesystem::path folderpath, [[maybe_unused]] bool recursive = false) noexcept override {}
+    void WaitForTextureLoads() noexcept override {}
     [[nodiscard]] bool RegisterTexture([[maybe_unused]] const std::string& name, [[maybe_unused]] std::unique_ptr<Texture> texture) noexcept override { return false; }
     void SetTexture([[maybe_unused]] Texture* texture, [[maybe_unused]] unsigned int registerIndex = 0) noexcept override {}
 
     [[nodiscard]] Texture* GetTexture([[maybe_unused]] const std::string& nameOrFile) noexcept override { return nullptr; }
+    [[nodiscard]] Texture* GetTexture([[maybe_unused]] const StringId& id) noexcept override { return nullptr; }
 
     [[nodiscard]] std::unique_ptr<Texture> CreateDepthStencil([[maybe_unused]] const RHIDevice& owner, [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height) noexcept override { return {}; }
     [[nodiscard]] std::unique_ptr<Texture> CreateDepthStencil([[maybe_unused]] const RHIDevice& owner, [[maybe_unused]] const IntVector2& dimensions) noexcept override { return {};}
@@ -444,6 +493,7 @@ public:
 
     [[nodiscard]] std::shared_ptr<SpriteSheet> CreateSpriteSheet([[maybe_unused]] const std::filesystem::path& filepath, [[maybe_unused]] unsigned int width = 1, [[maybe_unused]] unsigned int height = 1) noexcept override { return {}; }
     [[nodiscard]] std::shared_ptr<SpriteSheet> CreateSpriteSheet([[maybe_unused]] const XMLElement& elem) noexcept override { return {}; }
+    [[nodiscard]] std::shared_ptr<SpriteSheet> CreateSpriteSheet([[maybe_unused]] const TextureAtlas& atlas, [[maybe_unused]] const std::string& regionName, [[maybe_unused]] unsigned int width = 1, [[maybe_unused]] unsigned int height = 1) noexcept override { return {}; }
     [[nodiscard]] std::unique_ptr<AnimatedSprite> CreateAnimatedSprite([[maybe_unused]] std::filesystem::path filepath) noexcept override { return {}; }
     [[nodiscard]] std::unique_ptr<AnimatedSprite> CreateAnimatedSprite([[maybe_unused]] const AnimatedSpriteDesc& desc) noexcept override { return {}; }
     [[nodiscard]] std::unique_ptr<AnimatedSprite> CreateAnimatedSprite([[maybe_unused]] std::shared_ptr<SpriteSheet> sheet, [[maybe_unused]] const IntVector2& startSpriteCoords = IntVector2::Zero) noexcept override { return {}; }
@@ -504,6 +554,8 @@ public:
     void Draw([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const std::vector<VertexCircle2D>& vbo, [[maybe_unused]] std::size_t vertex_count) noexcept override {}
     void DrawIndexed([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const std::vector<Vertex3D>& vbo, [[maybe_unused]] const std::vector<unsigned int>& ibo) noexcept override {}
     void DrawIndexed([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const std::vector<Vertex3D>& vbo, [[maybe_unused]] const std::vector<unsigned int>& ibo, [[maybe_unused]] std::size_t index_count, [[maybe_unused]] std::size_t startVertex = 0, [[maybe_unused]] std::size_t baseVertexLocation = 0) noexcept override {}
+    void Draw([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const VertexLayoutDesc& layout, [[maybe_unused]] std::span<const std::byte> vbo) noexcept override {}
+    void DrawIndexed([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const VertexLayoutDesc& layout, [[maybe_unused]] std::span<const std::byte> vbo, [[maybe_unused]] const std::vector<unsigned int>& ibo, [[maybe_unused]] std::size_t index_count, [[maybe_unused]] std::size_t startVertex = 0, [[maybe_unused]] std::size_t baseVertexLocation = 0) noexcept override {}
     void DrawInstanced([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const std::vector<Vertex3D>& vbo, [[maybe_unused]] const std::vector<Vertex3DInstanced>& vbio, [[maybe_unused]] std::size_t instanceCount) noexcept override {};
     void DrawInstanced([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const std::vector<Vertex3D>& vbo, [[maybe_unused]] const std::vector<Vertex3DInstanced>& vbio, [[maybe_unused]] std::size_t instanceCount, [[maybe_unused]] std::size_t vertexCount) noexcept override {};
     void DrawIndexedInstanced([[maybe_unused]] const PrimitiveType& topology, [[maybe_unused]] const std::vector<Vertex3D>& vbo, [[maybe_unused]] const std::vector<Vertex3DInstanced>& vbio, [[maybe_unused]] const std::vector<unsigned int>& ibo, [[maybe_unused]] std::size_t instanceCount) noexcept override {}
@@ -552,6 +604,7 @@ public:
     void ReloadMaterials() noexcept override {}
 
     [[nodiscard]] Material* GetMaterial([[maybe_unused]] const std::string& nameOrFile) noexcept override { return nullptr; }
+    [[nodiscard]] Material* GetMaterial([[maybe_unused]] const StringId& id) noexcept override { return nullptr; }
     void SetMaterial([[maybe_unused]] Material* material) noexcept override {}
     void SetMaterial([[maybe_unused]] const std::string& nameOrFile) noexcept override {}
     void ResetMaterial() noexcept override {}
@@ -563,6 +616,7 @@ public:
     void RegisterShader([[maybe_unused]] std::unique_ptr<Shader> shader) noexcept override {}
 
     [[nodiscard]] Shader* GetShader([[maybe_unused]] const std::string& nameOrFile) noexcept override { return nullptr; }
+    [[nodiscard]] Shader* GetShader([[maybe_unused]] const StringId& id) noexcept override { return nullptr; }
     [[nodiscard]] std::string GetShaderName([[maybe_unused]] const std::filesystem::path filepath) noexcept override { return {}; }
 
     void SetComputeShader([[maybe_unused]] Shader* shader) noexcept override {}
@@ -570,6 +624,7 @@ public:
 
     [[nodiscard]] a2de::IFont* GetDefaultFont() noexcept override { return nullptr; }
     [[nodiscard]] a2de::IFont* GetFont([[maybe_unused]] const std::string& nameOrFile) noexcept override { return nullptr; }
+    [[nodiscard]] a2de::IFont* GetFont([[maybe_unused]] const StringId& id) noexcept override { return nullptr; }
     [[nodiscard]] a2de::IFont* GetFontById([[maybe_unused]] uint16_t index) noexcept override { return nullptr; };
     [[nodiscard]] std::size_t GetFontId([[maybe_unused]] const std::string& nameOrFile) noexcept override { return 0; }
     void RegisterFont([[maybe_unused]] std::unique_ptr<a2de::IFont> font) noexcept override {}
@@ -593,6 +648,15 @@ public:
     void SetCamera([[maybe_unused]] const Camera3D& camera) noexcept override {}
     void SetCamera([[maybe_unused]] const Camera2D& camera) noexcept override {}
     [[nodiscard]] Camera3D GetCamera() const noexcept override { return {}; }
+    [[nodiscard]] StreamingBufferStats GetStreamingStats() const noexcept override { return {}; }
+    [[nodiscard]] SpriteBatchStats GetSpriteBatchStats() const noexcept override { return {}; }
+
+    void BeginSpriteBatch() noexcept override {}
+    void EndSpriteBatch() noexcept override {}
+    void FlushSpriteBatch() noexcept override {}
+    void SetSpriteLayer([[maybe_unused]] int layer) noexcept override {}
+    void DrawSprite([[maybe_unused]] const SpriteSheet& sheet, [[maybe_unused]] int spriteIndex, [[maybe_unused]] const Matrix4& transform, [[maybe_unused]] const Rgba& color = Rgba::White) noexcept override {}
+    void DrawSprite([[maybe_unused]] const AnimatedSprite& sprite, [[maybe_unused]] const Matrix4& transform, [[maybe_unused]] const Rgba& color = Rgba::White) noexcept override {}
 
     [[nodiscard]] Vector2 ConvertWorldToScreenCoords([[maybe_unused]] const Vector3& worldCoords) const noexcept override { return Vector2::Zero; }
     [[nodiscard]] Vector2 ConvertWorldToScreenCoords([[maybe_unused]] const Vector2& worldCoords) const noexcept override { return Vector2::Zero; }
@@ -655,6 +719,8 @@ public:
     void DrawTextLine([[maybe_unused]] const Matrix4& transform, [[maybe_unused]] const a2de::IFont* font, [[maybe_unused]] const std::string& text, [[maybe_unused]] const Rgba& color = Rgba::White) noexcept override {}
     void DrawMultilineText([[maybe_unused]] const a2de::IFont* font, [[maybe_unused]] const std::string& text, [[maybe_unused]] const Rgba& color = Rgba::White) noexcept override {}
     void AppendMultiLineTextBuffer([[maybe_unused]] const a2de::IFont* font, [[maybe_unused]] const std::string& text, [[maybe_unused]] const Vector2& start_position, [[maybe_unused]] const Rgba& color, [[maybe_unused]] std::vector<Vertex3D>& vbo, [[maybe_unused]] std::vector<unsigned int>& ibo) noexcept override {}
+    [[nodiscard]] TextLayoutCacheStats GetTextLayoutCacheStats() const noexcept override { return {}; }
+    void InvalidateTextLayouts([[maybe_unused]] const a2de::IFont* font) noexcept override {}
 
     void CopyTexture([[maybe_unused]] const Texture* src, [[maybe_unused]] Texture* dst) const noexcept override {}
     void ResizeBuffers() noexcept override {}
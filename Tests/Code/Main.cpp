@@ -0,0 +1,10 @@
+#include "Tests/TestHarness.hpp"
+
+#include <string_view>
+
+//Tests [name filter]
+//Exits with the number of failed tests, so a build step can treat any failure as an error.
+int main(int argc, char* argv[]) {
+    const auto filter = argc > 1 ? std::string_view{argv[1]} : std::string_view{};
+    return Tests::RunAll(filter);
+}
@@ -0,0 +1,208 @@
+#include "Engine/Audio/Audio3DEmitter.hpp"
+#include "Engine/Audio/Audio3DListener.hpp"
+#include "Engine/Audio/AudioMixer.hpp"
+#include "Engine/Audio/AudioOutput.hpp"
+#include "Engine/Audio/Wav.hpp"
+
+#include "Tests/Audio/ScopedWavFile.hpp"
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <numbers>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template<typename Sample>
+[[nodiscard]] std::vector<Sample> MakeSine(std::uint32_t sampleRate, std::uint16_t channelCount, double seconds, double frequency) noexcept {
+    const auto frame_count = static_cast<std::size_t>(sampleRate * seconds);
+    auto samples = std::vector<Sample>(frame_count * channelCount);
+    for(std::size_t i = 0u; i < frame_count; ++i) {
+        const auto value = 0.5 * std::sin(2.0 * std::numbers::pi * frequency * static_cast<double>(i) / sampleRate);
+        for(std::size_t c = 0u; c < channelCount; ++c) {
+            if constexpr(std::is_same_v<Sample, float>) {
+                samples[i * channelCount + c] = static_cast<float>(value);
+            } else {
+                samples[i * channelCount + c] = static_cast<std::int16_t>(value * 32767.0);
+            }
+        }
+    }
+    return samples;
+}
+
+[[nodiscard]] std::unique_ptr<AudioMixer> MakeMixer(const AudioMixerFormat& format) noexcept {
+    return std::make_unique<AudioMixer>(std::make_unique<NullAudioOutput>(AudioOutputPacing::Unthrottled), format, 4u);
+}
+
+[[nodiscard]] std::vector<float> Render(AudioMixer& mixer, std::size_t blockCount) noexcept {
+    auto block = std::vector<float>(mixer.GetFormat().GetBlockSampleCount());
+    auto all = std::vector<float>{};
+    for(std::size_t i = 0u; i < blockCount; ++i) {
+        mixer.MixBlock(block);
+        all.insert(all.end(), block.begin(), block.end());
+    }
+    return all;
+}
+
+//Index of the block in which voice was reported finished, or blockLimit if it never was.
+[[nodiscard]] std::size_t MixUntilFinished(AudioMixer& mixer, AudioMixer::VoiceId voice, std::size_t blockLimit) noexcept {
+    auto block = std::vector<float>(mixer.GetFormat().GetBlockSampleCount());
+    for(std::size_t i = 0u; i < blockLimit; ++i) {
+        mixer.MixBlock(block);
+        AudioMixer::VoiceId finished{};
+        while(mixer.TryPopFinishedVoice(finished)) {
+            if(finished == voice) {
+                return i;
+            }
+        }
+    }
+    return blockLimit;
+}
+
+} // namespace
+
+TEST_CASE("AudioMixer plays float and 16-bit sources at the output rate sample for sample") {
+    const auto float_samples = MakeSine<float>(48000u, 1u, 0.05, 1000.0);
+    Tests::ScopedWavFile float_file{"AudioMixerTestsFloat.wav", 48000u, 1u, std::span<const float>{float_samples}};
+    const auto pcm_samples = MakeSine<std::int16_t>(48000u, 2u, 0.05, 1000.0);
+    Tests::ScopedWavFile pcm_file{"AudioMixerTestsPcm.wav", 48000u, 2u, std::span<const std::int16_t>{pcm_samples}};
+    TEST_REQUIRE(float_file.IsWritten() && pcm_file.IsWritten());
+    FileUtils::Wav float_wav{};
+    FileUtils::Wav pcm_wav{};
+    TEST_REQUIRE(float_wav.Load(float_file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+    TEST_REQUIRE(pcm_wav.Load(pcm_file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+
+    auto mono_mixer = MakeMixer(AudioMixerFormat{48000u, 1u, 480u});
+    const auto float_voice = mono_mixer->Play(float_wav);
+    TEST_REQUIRE(float_voice != AudioMixer::invalid_voice);
+    const auto mono = Render(*mono_mixer, 6u);
+    TEST_CHECK(std::memcmp(mono.data(), float_samples.data(), float_samples.size() * sizeof(float)) == 0);
+    TEST_CHECK(std::all_of(mono.begin() + float_samples.size(), mono.end(), [](float sample) { return sample == 0.0f; }));
+    AudioMixer::VoiceId finished{};
+    TEST_CHECK(mono_mixer->TryPopFinishedVoice(finished) && finished == float_voice);
+
+    auto stereo_mixer = MakeMixer(AudioMixerFormat{48000u, 2u, 480u});
+    TEST_REQUIRE(stereo_mixer->Play(pcm_wav) != AudioMixer::invalid_voice);
+    const auto stereo = Render(*stereo_mixer, 5u);
+    bool exact = true;
+    for(std::size_t i = 0u; i < pcm_samples.size(); ++i) {
+        exact &= stereo[i] == static_cast<float>(pcm_samples[i]) / 32768.0f;
+    }
+    TEST_CHECK(exact);
+}
+
+TEST_CASE("AudioMixer resamples and pitches into a WavFileAudioOutput file") {
+    const auto samples = MakeSine<std::int16_t>(44100u, 2u, 0.5, 440.0);
+    Tests::ScopedWavFile source_file{"AudioMixerTestsSource.wav", 44100u, 2u, std::span<const std::int16_t>{samples}};
+    TEST_REQUIRE(source_file.IsWritten());
+    FileUtils::Wav source{};
+    TEST_REQUIRE(source.Load(source_file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+
+    const auto output_path = std::filesystem::current_path() / "AudioMixerTestsOutput.wav";
+    {
+        AudioMixer mixer{std::make_unique<WavFileAudioOutput>(output_path, AudioOutputPacing::Unthrottled), AudioMixerFormat{}, 4u};
+        TEST_REQUIRE(mixer.Start());
+        AudioVoiceDesc desc{};
+        desc.frequency = 2.0f;
+        const auto voice = mixer.Play(source, desc);
+        TEST_REQUIRE(voice != AudioMixer::invalid_voice);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        AudioMixer::VoiceId finished{};
+        while(!mixer.TryPopFinishedVoice(finished) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        mixer.Stop();
+        TEST_CHECK(finished == voice);
+    }
+
+    FileUtils::Wav output{};
+    const auto loaded = output.Load(output_path);
+    std::error_code ec{};
+    std::filesystem::remove(output_path, ec);
+    TEST_REQUIRE(loaded == FileUtils::Wav::WAV_SUCCESS);
+    TEST_REQUIRE(output.GetFormatChunk().samplesPerSecond == 48000u && output.GetFormatChunk().bitsPerSample == 16u);
+    const auto frame_count = output.GetDataBufferSize() / output.GetFormatChunk().dataBlockSize;
+    const auto* pcm = reinterpret_cast<const std::int16_t*>(output.GetDataBuffer());
+    int rising_crossings = 0;
+    std::size_t first_sound = frame_count;
+    std::size_t last_sound = 0u;
+    for(std::size_t i = 1u; i < frame_count; ++i) {
+        rising_crossings += pcm[2u * (i - 1u)] < 0 && pcm[2u * i] >= 0;
+        if(pcm[2u * i] != 0) {
+            first_sound = (std::min)(first_sound, i);
+            last_sound = i;
+        }
+    }
+    //Twice the rate halves the length and doubles the pitch: 0.25 s of 880 Hz.
+    TEST_CHECK(std::abs(rising_crossings - 220) <= 2);
+    TEST_CHECK(std::abs(static_cast<double>(last_sound - first_sound) / 48000.0 - 0.25) < 0.001);
+}
+
+TEST_CASE("AudioMixer ends loops at the loop end") {
+    const auto samples = MakeSine<std::int16_t>(48000u, 1u, 0.1, 500.0);
+    Tests::ScopedWavFile file{"AudioMixerTestsLoop.wav", 48000u, 1u, std::span<const std::int16_t>{samples}};
+    TEST_REQUIRE(file.IsWritten());
+    FileUtils::Wav wav{};
+    TEST_REQUIRE(wav.Load(file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+    const auto format = AudioMixerFormat{48000u, 2u, 480u};
+
+    //Blocks are 10 ms; a voice is reported in the block that plays its last frame.
+    AudioVoiceDesc whole{};
+    whole.loop_count = 2u;
+    auto mixer = MakeMixer(format);
+    TEST_CHECK(MixUntilFinished(*mixer, mixer->Play(wav, whole), 100u) == 30u);
+
+    AudioVoiceDesc then_rest{};
+    then_rest.loop_count = 2u;
+    then_rest.loop_end_seconds = 0.05f;
+    mixer = MakeMixer(format);
+    TEST_CHECK(MixUntilFinished(*mixer, mixer->Play(wav, then_rest), 100u) == 20u);
+
+    AudioVoiceDesc stop_at_end{then_rest};
+    stop_at_end.stop_at_loop_end = true;
+    mixer = MakeMixer(format);
+    TEST_CHECK(MixUntilFinished(*mixer, mixer->Play(wav, stop_at_end), 100u) == 15u);
+}
+
+TEST_CASE("AudioMixer pans sources on the listener's right into the right channel") {
+    Audio3DListener listener{};
+    Audio3DEmitter emitter{};
+    emitter.position = Vector3{10.0f, 0.0f, 0.0f};
+    const auto right = AudioMixer::CalculatePan(emitter, listener);
+    TEST_CHECK(right.gains[1] > 0.09f && right.gains[0] < 0.01f);
+    emitter.position = Vector3{-10.0f, 0.0f, 0.0f};
+    const auto left = AudioMixer::CalculatePan(emitter, listener);
+    TEST_CHECK(left.gains[0] > 0.09f && left.gains[1] < 0.01f);
+    emitter.position = Vector3{0.0f, 0.0f, 2.0f};
+    const auto ahead = AudioMixer::CalculatePan(emitter, listener);
+    TEST_CHECK(std::abs(ahead.gains[0] - ahead.gains[1]) < 1e-4f);
+
+    const auto samples = MakeSine<float>(48000u, 1u, 0.1, 500.0);
+    Tests::ScopedWavFile file{"AudioMixerTestsPan.wav", 48000u, 1u, std::span<const float>{samples}};
+    TEST_REQUIRE(file.IsWritten());
+    FileUtils::Wav wav{};
+    TEST_REQUIRE(wav.Load(file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+    auto mixer = MakeMixer(AudioMixerFormat{48000u, 2u, 480u});
+    const auto voice = mixer->Play(wav);
+    TEST_REQUIRE(voice != AudioMixer::invalid_voice);
+    mixer->SetVoicePan(voice, right);
+    //The first block slides from the default gains; the second plays at the new ones.
+    const auto stereo = Render(*mixer, 2u);
+    float left_peak = 0.0f;
+    float right_peak = 0.0f;
+    for(std::size_t i = 960u; i < stereo.size(); i += 2u) {
+        left_peak = (std::max)(left_peak, std::abs(stereo[i]));
+        right_peak = (std::max)(right_peak, std::abs(stereo[i + 1u]));
+    }
+    TEST_CHECK(right_peak > 0.04f);
+    TEST_CHECK(left_peak < right_peak * 0.1f);
+}
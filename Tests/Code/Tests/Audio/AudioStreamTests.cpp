@@ -0,0 +1,189 @@
+#include "Engine/Audio/AudioMixer.hpp"
+#include "Engine/Audio/AudioOutput.hpp"
+#include "Engine/Audio/AudioStream.hpp"
+#include "Engine/Audio/Wav.hpp"
+
+#include "Engine/Profiling/Metrics.hpp"
+
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#include "Tests/Audio/ScopedWavFile.hpp"
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::uint32_t sample_rate = 44100u;
+constexpr std::uint32_t bytes_per_frame = 4u;
+constexpr std::uint32_t ring_frames = static_cast<std::uint32_t>(AudioStream::block_count * (AudioStream::block_bytes / bytes_per_frame));
+constexpr AudioMixerFormat mix_format{sample_rate, 2u, 441u};
+
+[[nodiscard]] std::vector<std::int16_t> MakeNoise(std::uint32_t frameCount) noexcept {
+    auto samples = std::vector<std::int16_t>(static_cast<std::size_t>(frameCount) * 2u);
+    std::uint32_t seed = 12345u;
+    for(auto& sample : samples) {
+        seed = seed * 1664525u + 1013904223u;
+        sample = static_cast<std::int16_t>(seed >> 16);
+    }
+    return samples;
+}
+
+//Queues Run calls until the test decides the read has landed.
+class ManualJobSystem : public NullJobSystemService {
+public:
+    void Run([[maybe_unused]] const JobType& category, const JobCallback& cb, void* user_data) noexcept override {
+        m_pending.emplace_back(cb, user_data);
+    }
+    [[nodiscard]] bool IsRunning() const noexcept override {
+        return true;
+    }
+    void RunPending() noexcept {
+        auto jobs = std::move(m_pending);
+        m_pending.clear();
+        for(auto& [cb, user_data] : jobs) {
+            cb(user_data);
+        }
+    }
+
+private:
+    std::vector<std::pair<JobCallback, void*>> m_pending{};
+};
+
+//Provides jobs as the job system service for the lifetime of the test.
+class ScopedJobService {
+public:
+    explicit ScopedJobService(IJobSystemService& jobs) noexcept {
+        ServiceLocator::provide(jobs, m_null_jobs);
+    }
+    ~ScopedJobService() noexcept {
+        ServiceLocator::revoke<IJobSystemService>();
+    }
+
+private:
+    NullJobSystemService m_null_jobs{};
+};
+
+[[nodiscard]] std::unique_ptr<AudioMixer> MakeMixer() noexcept {
+    return std::make_unique<AudioMixer>(std::make_unique<NullAudioOutput>(AudioOutputPacing::Unthrottled), mix_format, 4u);
+}
+
+//Mixes blockCount blocks and returns them back to back.
+[[nodiscard]] std::vector<float> Render(AudioMixer& mixer, std::size_t blockCount) noexcept {
+    auto block = std::vector<float>(mix_format.GetBlockSampleCount());
+    auto all = std::vector<float>{};
+    for(std::size_t i = 0u; i < blockCount; ++i) {
+        mixer.MixBlock(block);
+        all.insert(all.end(), block.begin(), block.end());
+    }
+    return all;
+}
+
+[[nodiscard]] bool IsSilent(std::span<const float> samples) noexcept {
+    for(const auto sample : samples) {
+        if(sample != 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("AudioStream plays the same samples as the loaded wav while holding only its ring") {
+    const auto frame_count = ring_frames * 3u;
+    const auto samples = MakeNoise(frame_count);
+    Tests::ScopedWavFile file{"AudioStreamTests.wav", sample_rate, 2u, std::span<const std::int16_t>{samples}};
+    TEST_REQUIRE(file.IsWritten());
+    FileUtils::Wav wav{};
+    TEST_REQUIRE(wav.Load(file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+    TEST_CHECK(AudioStream::GetResidentBytes() < wav.GetDataBufferSize());
+
+    ManualJobSystem jobs{};
+    ScopedJobService service{jobs};
+    auto stream = AudioStream::Open(file.GetPath());
+    TEST_REQUIRE(stream != nullptr);
+    TEST_CHECK(stream->GetFrameCount() == frame_count);
+
+    auto memory_mixer = MakeMixer();
+    auto stream_mixer = MakeMixer();
+    TEST_REQUIRE(memory_mixer->Play(wav) != AudioMixer::invalid_voice);
+    TEST_REQUIRE(stream_mixer->Play(stream) != AudioMixer::invalid_voice);
+
+    const auto block_count = frame_count / mix_format.block_frames + 2u;
+    const auto expected = Render(*memory_mixer, block_count);
+    auto streamed = std::vector<float>{};
+    std::size_t max_buffered_bytes = 0u;
+    for(std::size_t i = 0u; i < block_count; ++i) {
+        jobs.RunPending();
+        max_buffered_bytes = (std::max)(max_buffered_bytes, stream->GetBufferedFrameCount() * bytes_per_frame);
+        const auto block = Render(*stream_mixer, 1u);
+        streamed.insert(streamed.end(), block.begin(), block.end());
+    }
+    TEST_CHECK(streamed == expected);
+    TEST_CHECK(max_buffered_bytes <= AudioStream::block_count * AudioStream::block_bytes);
+    AudioMixer::VoiceId voice{};
+    TEST_CHECK(memory_mixer->TryPopFinishedVoice(voice));
+    TEST_CHECK(stream_mixer->TryPopFinishedVoice(voice));
+}
+
+TEST_CASE("AudioStream without a job system plays what Start read and then ends") {
+    const auto frame_count = ring_frames * 2u;
+    const auto samples = MakeNoise(frame_count);
+    Tests::ScopedWavFile file{"AudioStreamTests.wav", sample_rate, 2u, std::span<const std::int16_t>{samples}};
+    TEST_REQUIRE(file.IsWritten());
+    FileUtils::Wav wav{};
+    TEST_REQUIRE(wav.Load(file.GetPath()) == FileUtils::Wav::WAV_SUCCESS);
+    auto stream = AudioStream::Open(file.GetPath());
+    TEST_REQUIRE(stream != nullptr);
+
+    auto memory_mixer = MakeMixer();
+    auto stream_mixer = MakeMixer();
+    TEST_REQUIRE(memory_mixer->Play(wav) != AudioMixer::invalid_voice);
+    TEST_REQUIRE(stream_mixer->Play(stream) != AudioMixer::invalid_voice);
+    //Start read on this thread, before the mixer asked for anything.
+    TEST_CHECK(stream->IsPrimed());
+
+    const auto block_count = frame_count / mix_format.block_frames;
+    const auto expected = Render(*memory_mixer, block_count);
+    const auto streamed = Render(*stream_mixer, block_count);
+    const auto ring_samples = static_cast<std::size_t>(ring_frames) * mix_format.channel_count;
+    TEST_REQUIRE(streamed.size() > ring_samples);
+    TEST_CHECK(std::equal(expected.begin(), expected.begin() + ring_samples, streamed.begin()));
+    TEST_CHECK(IsSilent(std::span<const float>{streamed}.subspan(ring_samples)));
+    AudioMixer::VoiceId voice{};
+    TEST_CHECK(stream_mixer->TryPopFinishedVoice(voice));
+}
+
+TEST_CASE("AudioStream counts underruns only after the first read lands") {
+    auto& underruns = Metrics::GetCounter("audio.stream_underruns");
+    const auto samples = MakeNoise(ring_frames * 2u);
+    Tests::ScopedWavFile file{"AudioStreamTests.wav", sample_rate, 2u, std::span<const std::int16_t>{samples}};
+    TEST_REQUIRE(file.IsWritten());
+    ManualJobSystem jobs{};
+    ScopedJobService service{jobs};
+    auto stream = AudioStream::Open(file.GetPath());
+    TEST_REQUIRE(stream != nullptr);
+    auto mixer = MakeMixer();
+    TEST_REQUIRE(mixer->Play(stream) != AudioMixer::invalid_voice);
+
+    const auto before = underruns.Get();
+    TEST_CHECK(IsSilent(Render(*mixer, 4u)));
+    TEST_CHECK(!stream->IsPrimed());
+    TEST_CHECK(underruns.Get() == before);
+
+    jobs.RunPending();
+    TEST_CHECK(stream->IsPrimed());
+    TEST_CHECK(!IsSilent(Render(*mixer, 1u)));
+    TEST_CHECK(underruns.Get() == before);
+
+    //Holding every refill back drains the ring; running dry now is a real underrun.
+    (void)Render(*mixer, ring_frames / mix_format.block_frames + 2u);
+    TEST_CHECK(underruns.Get() > before);
+}
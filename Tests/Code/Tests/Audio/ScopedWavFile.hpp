@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace Tests {
+
+//Writes samples as a .wav file in the working directory, which is a safe read path, and removes it again.
+//Samples are interleaved frames of std::int16_t PCM or float.
+class ScopedWavFile {
+public:
+    template<typename Sample>
+    ScopedWavFile(std::string_view filename, std::uint32_t sampleRate, std::uint16_t channelCount, std::span<const Sample> samples) noexcept
+    : m_path(std::filesystem::current_path() / filename) {
+        static_assert(std::is_same_v<Sample, std::int16_t> || std::is_same_v<Sample, float>);
+        constexpr std::uint16_t format_id = std::is_same_v<Sample, float> ? 3u : 1u;
+        constexpr auto bits_per_sample = static_cast<std::uint16_t>(sizeof(Sample) * 8u);
+        const auto block_align = static_cast<std::uint16_t>(channelCount * sizeof(Sample));
+        const auto data_length = static_cast<std::uint32_t>(samples.size_bytes());
+        std::ofstream file(m_path, std::ios_base::binary | std::ios_base::trunc);
+        file.write("RIFF", 4);
+        WriteValue(file, static_cast<std::uint32_t>(36u + data_length));
+        file.write("WAVEfmt ", 8);
+        WriteValue(file, std::uint32_t{16u});
+        WriteValue(file, format_id);
+        WriteValue(file, channelCount);
+        WriteValue(file, sampleRate);
+        WriteValue(file, static_cast<std::uint32_t>(sampleRate * block_align));
+        WriteValue(file, block_align);
+        WriteValue(file, bits_per_sample);
+        file.write("data", 4);
+        WriteValue(file, data_length);
+        file.write(reinterpret_cast<const char*>(samples.data()), data_length);
+        m_written = static_cast<bool>(file);
+    }
+    ScopedWavFile(const ScopedWavFile& other) = delete;
+    ScopedWavFile(ScopedWavFile&& other) = delete;
+    ScopedWavFile& operator=(const ScopedWavFile& other) = delete;
+    ScopedWavFile& operator=(ScopedWavFile&& other) = delete;
+    ~ScopedWavFile() noexcept {
+        std::error_code ec{};
+        std::filesystem::remove(m_path, ec);
+    }
+
+    [[nodiscard]] const std::filesystem::path& GetPath() const noexcept {
+        return m_path;
+    }
+    [[nodiscard]] bool IsWritten() const noexcept {
+        return m_written;
+    }
+
+private:
+    template<typename T>
+    static void WriteValue(std::ofstream& file, T value) noexcept {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::filesystem::path m_path{};
+    bool m_written{false};
+};
+
+} // namespace Tests
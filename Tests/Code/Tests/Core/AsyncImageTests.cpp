@@ -0,0 +1,118 @@
+#include "Engine/Core/AsyncImage.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <thread>
+
+namespace {
+
+//AsyncImage only reads from safe locations, so the fixture image lives in the working directory.
+class ScopedImageFile {
+public:
+    ScopedImageFile() noexcept
+    : m_path(std::filesystem::current_path() / "AsyncImageTests.png") {
+        Image image(4u, 4u);
+        m_written = image.Export(m_path);
+    }
+    ~ScopedImageFile() noexcept {
+        std::error_code ec{};
+        std::filesystem::remove(m_path, ec);
+    }
+    [[nodiscard]] const std::filesystem::path& GetPath() const noexcept {
+        return m_path;
+    }
+    [[nodiscard]] bool IsWritten() const noexcept {
+        return m_written;
+    }
+
+private:
+    std::filesystem::path m_path{};
+    bool m_written{false};
+};
+
+//Provides jobs as the job system service for the lifetime of the test.
+template<typename JobService>
+class ScopedJobService {
+public:
+    template<typename... Args>
+    explicit ScopedJobService(Args&&... args) noexcept
+    : m_jobs(std::forward<Args>(args)...) {
+        ServiceLocator::provide(*static_cast<IJobSystemService*>(&m_jobs), m_null_jobs);
+    }
+    ~ScopedJobService() noexcept {
+        ServiceLocator::revoke<IJobSystemService>();
+    }
+    [[nodiscard]] JobService& Get() noexcept {
+        return m_jobs;
+    }
+
+private:
+    JobService m_jobs;
+    NullJobSystemService m_null_jobs{};
+};
+
+//Generic worker count is relative to the core count, so this leaves the generic queues with nobody to run them.
+[[nodiscard]] int NoGenericWorkers() noexcept {
+    return -static_cast<int>(std::thread::hardware_concurrency());
+}
+
+[[nodiscard]] bool WaitForState(const AsyncImage& image, AsyncImage::State state) noexcept {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while(image.GetState() != state) {
+        if(image.IsDone() || std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("AsyncImage decodes before Load returns without a running job system") {
+    ScopedJobService<NullJobSystemService> jobs{};
+    ScopedImageFile file{};
+    TEST_REQUIRE(file.IsWritten());
+    const auto image = AsyncImage::Load(file.GetPath());
+    TEST_CHECK(image->IsReady());
+    TEST_CHECK(image->GetImage().GetDimensions().x == 4);
+}
+
+TEST_CASE("AsyncImage fails a missing file instead of waiting on it") {
+    ScopedJobService<NullJobSystemService> jobs{};
+    const auto image = AsyncImage::Load(std::filesystem::current_path() / "AsyncImageTests_missing.png");
+    TEST_CHECK(image->GetState() == AsyncImage::State::Failed);
+}
+
+TEST_CASE("AsyncImage loads through the job system") {
+    ScopedJobService<JobSystem> jobs{-1, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>()};
+    ScopedImageFile file{};
+    TEST_REQUIRE(file.IsWritten());
+    const auto image = AsyncImage::Load(file.GetPath());
+    image->Wait();
+    TEST_CHECK(image->IsReady());
+    jobs.Get().Shutdown();
+}
+
+TEST_CASE("AsyncImage fails a load whose decode was dropped by a job system shutdown") {
+    ScopedJobService<JobSystem> jobs{NoGenericWorkers(), static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>()};
+    ScopedImageFile file{};
+    TEST_REQUIRE(file.IsWritten());
+    const auto image = AsyncImage::Load(file.GetPath());
+    //The Io thread reads the file; with no generic workers the decode stays queued.
+    TEST_REQUIRE(WaitForState(*image, AsyncImage::State::Decoding));
+    jobs.Get().Shutdown();
+    TEST_CHECK(image->GetState() == AsyncImage::State::Failed);
+    //Must return rather than spin on a decode that will never run.
+    image->Wait();
+    TEST_CHECK(image->IsDone());
+}
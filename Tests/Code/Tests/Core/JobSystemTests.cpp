@@ -0,0 +1,155 @@
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+[[nodiscard]] std::unique_ptr<JobSystem> MakeJobSystem() noexcept {
+    return std::make_unique<JobSystem>(-1, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>());
+}
+
+using chunk_t = std::pair<std::size_t, std::size_t>;
+
+//Every chunk ParallelFor handed to the callback, sorted by start.
+[[nodiscard]] std::vector<chunk_t> RecordChunks(IJobSystemService& js, std::size_t first, std::size_t last, std::size_t grain) noexcept {
+    std::mutex cs{};
+    std::vector<chunk_t> chunks{};
+    js.ParallelFor(first, last, grain, [&cs, &chunks](std::size_t chunk_first, std::size_t chunk_last) {
+        std::scoped_lock<std::mutex> lock(cs);
+        chunks.emplace_back(chunk_first, chunk_last);
+    });
+    std::sort(std::begin(chunks), std::end(chunks));
+    return chunks;
+}
+
+//True when the chunks tile [first, last) exactly: no gaps, no overlaps, nothing outside.
+[[nodiscard]] bool TilesRange(const std::vector<chunk_t>& chunks, std::size_t first, std::size_t last) noexcept {
+    auto expected_first = first;
+    for(const auto& [chunk_first, chunk_last] : chunks) {
+        if(chunk_first != expected_first || chunk_last <= chunk_first) {
+            return false;
+        }
+        expected_first = chunk_last;
+    }
+    return expected_first == last;
+}
+
+[[nodiscard]] std::vector<int> MakeShuffledValues(std::size_t count) noexcept {
+    std::vector<int> values(count);
+    //Duplicates on purpose: every value appears about four times.
+    for(std::size_t i = 0u; i < count; ++i) {
+        values[i] = static_cast<int>(i / 4u);
+    }
+    std::mt19937 rng{1234u};
+    std::shuffle(std::begin(values), std::end(values), rng);
+    return values;
+}
+
+} // namespace
+
+TEST_CASE("JobSystem releases a job held across Shutdown") {
+    auto js = MakeJobSystem();
+    auto* job = js->Create(JobType::Generic, [](void*) {}, nullptr);
+    js->Shutdown();
+    TEST_CHECK(js->Release(job));
+}
+
+TEST_CASE("JobSystem creates and releases jobs after Shutdown") {
+    auto js = MakeJobSystem();
+    js->Shutdown();
+    auto* job = js->Create(JobType::Generic, [](void*) {}, nullptr);
+    TEST_REQUIRE(job != nullptr);
+    TEST_CHECK(job->state == JobState::Created);
+    TEST_CHECK(js->Release(job));
+}
+
+TEST_CASE("ParallelFor never calls back for an empty or reversed range") {
+    auto js = MakeJobSystem();
+    int calls = 0;
+    js->ParallelFor(10u, 10u, 1u, [&calls](std::size_t, std::size_t) { ++calls; });
+    js->ParallelFor(10u, 3u, 1u, [&calls](std::size_t, std::size_t) { ++calls; });
+    TEST_CHECK(calls == 0);
+}
+
+TEST_CASE("ParallelFor runs a single-element range once on the caller") {
+    auto js = MakeJobSystem();
+    const auto chunks = RecordChunks(*js, 5u, 6u, 0u);
+    TEST_REQUIRE(chunks.size() == 1u);
+    TEST_CHECK(chunks[0] == chunk_t(5u, 6u));
+}
+
+TEST_CASE("ParallelFor chunks tile the range and hold at least grain indices") {
+    auto js = MakeJobSystem();
+    constexpr std::size_t grain = 7u;
+    for(const auto count : {std::size_t{6u}, std::size_t{7u}, std::size_t{13u}, std::size_t{14u}, std::size_t{100u}, std::size_t{10'007u}}) {
+        const auto first = std::size_t{3u};
+        const auto last = first + count;
+        const auto chunks = RecordChunks(*js, first, last, grain);
+        TEST_CHECK(TilesRange(chunks, first, last));
+        if(count >= grain) {
+            const auto smallest = std::min_element(std::begin(chunks), std::end(chunks), [](const chunk_t& a, const chunk_t& b) { return a.second - a.first < b.second - b.first; });
+            TEST_CHECK(smallest->second - smallest->first >= grain);
+        } else {
+            TEST_CHECK(chunks.size() == 1u);
+        }
+    }
+    //A grain of zero picks one and still covers everything.
+    TEST_CHECK(TilesRange(RecordChunks(*js, 0u, 100'000u, 0u), 0u, 100'000u));
+}
+
+TEST_CASE("ParallelReduce returns the identity for an empty range and maps a single element") {
+    auto js = MakeJobSystem();
+    const auto sum = [](std::size_t first, std::size_t last) { return static_cast<int>(last - first); };
+    TEST_CHECK(js->ParallelReduce(4u, 4u, 1u, 42, sum, std::plus<>{}) == 42);
+    TEST_CHECK(js->ParallelReduce(4u, 5u, 1u, 0, sum, std::plus<>{}) == 1);
+}
+
+TEST_CASE("ParallelReduce combines partial results in index order") {
+    //Concatenation is associative but not commutative, so any reordering of the partials shows up in the result.
+    auto js = MakeJobSystem();
+    const auto map = [](std::size_t first, std::size_t last) {
+        auto result = std::string{};
+        for(auto i = first; i < last; ++i) {
+            result += std::to_string(i) + ',';
+        }
+        return result;
+    };
+    const auto concatenate = [](std::string a, std::string b) { return std::move(a) + std::move(b); };
+    const auto expected = map(0u, 1000u);
+    TEST_CHECK(js->ParallelReduce(0u, 1000u, 3u, std::string{}, map, concatenate) == expected);
+    TEST_CHECK(js->ParallelReduce(0u, 1000u, 0u, std::string{}, map, concatenate) == expected);
+    NullJobSystemService null_js{};
+    TEST_CHECK(null_js.ParallelReduce(0u, 1000u, 3u, std::string{}, map, concatenate) == expected);
+}
+
+TEST_CASE("ParallelSort handles empty and single-element ranges") {
+    auto js = MakeJobSystem();
+    std::vector<int> values{};
+    js->ParallelSort(std::begin(values), std::end(values));
+    TEST_CHECK(values.empty());
+    values.push_back(7);
+    js->ParallelSort(std::begin(values), std::end(values));
+    TEST_CHECK(values.size() == 1u && values[0] == 7);
+}
+
+TEST_CASE("ParallelSort matches std::sort on either side of the chunking threshold") {
+    auto js = MakeJobSystem();
+    for(const auto count : {std::size_t{2047u}, std::size_t{2048u}, std::size_t{2049u}, std::size_t{4097u}, std::size_t{100'003u}}) {
+        auto values = MakeShuffledValues(count);
+        auto expected = values;
+        std::sort(std::begin(expected), std::end(expected), std::greater<>{});
+        js->ParallelSort(std::begin(values), std::end(values), std::greater<>{});
+        TEST_CHECK(values == expected);
+    }
+}
@@ -0,0 +1,178 @@
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/TaskGraph.hpp"
+
+#include "Engine/Services/IFileLoggerService.hpp"
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//TaskGraph runs on the job system service and reports cycles through the logger service.
+class ScopedTaskGraphServices {
+public:
+    ScopedTaskGraphServices() noexcept {
+        ServiceLocator::provide(*static_cast<IJobSystemService*>(&m_jobs), m_null_jobs);
+        ServiceLocator::provide(*static_cast<IFileLoggerService*>(&m_null_logger), m_null_logger);
+    }
+    ~ScopedTaskGraphServices() noexcept {
+        m_jobs.Shutdown();
+        ServiceLocator::revoke<IFileLoggerService>();
+        ServiceLocator::revoke<IJobSystemService>();
+    }
+
+private:
+    JobSystem m_jobs{-1, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>()};
+    NullJobSystemService m_null_jobs{};
+    NullFileLoggerService m_null_logger{};
+};
+
+//Records the order tasks ran in, from whichever thread ran them.
+class RunLog {
+public:
+    void Add(const std::string& name) noexcept {
+        std::scoped_lock<std::mutex> lock(m_cs);
+        m_names.push_back(name);
+    }
+    [[nodiscard]] std::size_t IndexOf(const std::string& name) const noexcept {
+        std::scoped_lock<std::mutex> lock(m_cs);
+        return static_cast<std::size_t>(std::distance(std::cbegin(m_names), std::find(std::cbegin(m_names), std::cend(m_names), name)));
+    }
+    [[nodiscard]] std::size_t GetCount() const noexcept {
+        std::scoped_lock<std::mutex> lock(m_cs);
+        return m_names.size();
+    }
+
+private:
+    mutable std::mutex m_cs{};
+    std::vector<std::string> m_names{};
+};
+
+[[nodiscard]] std::size_t PositionInSchedule(const TaskGraph& graph, TaskGraph::TaskId id) noexcept {
+    const auto& schedule = graph.GetSchedule();
+    return static_cast<std::size_t>(std::distance(std::cbegin(schedule), std::find(std::cbegin(schedule), std::cend(schedule), id)));
+}
+
+void SpinFor(std::chrono::milliseconds duration) noexcept {
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while(std::chrono::steady_clock::now() < end) {
+        /* DO NOTHING */
+    }
+}
+
+} // namespace
+
+TEST_CASE("TaskGraph schedules readers after writers and writers after readers") {
+    ScopedTaskGraphServices services{};
+    TaskGraph graph{};
+    RunLog log{};
+    const auto a = graph.AddTask("A", [&log]() { log.Add("A"); }).Writes("x").GetId();
+    const auto b = graph.AddTask("B", [&log]() { log.Add("B"); }).Reads("x").GetId();
+    const auto c = graph.AddTask("C", [&log]() { log.Add("C"); }).Reads("x").GetId();
+    const auto d = graph.AddTask("D", [&log]() { log.Add("D"); }).Writes("x").GetId();
+    const auto e = graph.AddTask("E", [&log]() { log.Add("E"); }).Reads("y").After(b).GetId();
+    TEST_REQUIRE(graph.Compile());
+    TEST_REQUIRE(graph.GetSchedule().size() == 5u);
+    TEST_CHECK(PositionInSchedule(graph, a) < PositionInSchedule(graph, b));
+    TEST_CHECK(PositionInSchedule(graph, a) < PositionInSchedule(graph, c));
+    TEST_CHECK(PositionInSchedule(graph, b) < PositionInSchedule(graph, d));
+    TEST_CHECK(PositionInSchedule(graph, c) < PositionInSchedule(graph, d));
+    TEST_CHECK(PositionInSchedule(graph, b) < PositionInSchedule(graph, e));
+
+    graph.Run();
+    TEST_REQUIRE(log.GetCount() == 5u);
+    TEST_CHECK(log.IndexOf("A") < log.IndexOf("B"));
+    TEST_CHECK(log.IndexOf("A") < log.IndexOf("C"));
+    TEST_CHECK(log.IndexOf("B") < log.IndexOf("D"));
+    TEST_CHECK(log.IndexOf("C") < log.IndexOf("D"));
+    TEST_CHECK(log.IndexOf("B") < log.IndexOf("E"));
+}
+
+TEST_CASE("TaskGraph rejects a dependency cycle and runs nothing") {
+    ScopedTaskGraphServices services{};
+    TaskGraph graph{};
+    int runs = 0;
+    auto p = graph.AddTask("P", [&runs]() { ++runs; });
+    const auto q = graph.AddTask("Q", [&runs]() { ++runs; }).After(p.GetId()).GetId();
+    p.After(q);
+    TEST_CHECK(!graph.Compile());
+    TEST_CHECK(!graph.IsCompiled());
+    TEST_CHECK(graph.GetSchedule().empty());
+    graph.Run();
+    TEST_CHECK(runs == 0);
+}
+
+TEST_CASE("TaskGraph rejects an explicit edge that contradicts the order of two writers") {
+    //Both write x, so the second-added writer runs after the first. Asking for the opposite cannot be satisfied.
+    ScopedTaskGraphServices services{};
+    TaskGraph graph{};
+    auto first_writer = graph.AddTask("First", []() {}).Writes("x");
+    const auto second_writer = graph.AddTask("Second", []() {}).Writes("x").GetId();
+    TEST_REQUIRE(graph.Compile());
+    first_writer.After(second_writer);
+    TEST_CHECK(!graph.IsCompiled());
+    TEST_CHECK(!graph.Compile());
+}
+
+TEST_CASE("TaskGraph never runs writers of the same resource at the same time") {
+    ScopedTaskGraphServices services{};
+    TaskGraph graph{};
+    std::atomic<int> in_flight{0};
+    std::atomic<int> most_in_flight{0};
+    std::atomic<int> runs{0};
+    for(int i = 0; i < 16; ++i) {
+        graph.AddTask("Writer " + std::to_string(i), [&]() {
+            const auto now = ++in_flight;
+            auto seen = most_in_flight.load();
+            while(seen < now && !most_in_flight.compare_exchange_weak(seen, now)) {
+                /* DO NOTHING */
+            }
+            SpinFor(std::chrono::milliseconds{1});
+            --in_flight;
+            ++runs;
+        }).Writes("shared");
+    }
+    for(int frame = 0; frame < 4; ++frame) {
+        graph.Run();
+    }
+    TEST_CHECK(runs == 64);
+    TEST_CHECK(most_in_flight == 1);
+}
+
+TEST_CASE("TaskGraph runs main-thread tasks on the thread that called Run") {
+    ScopedTaskGraphServices services{};
+    TaskGraph graph{};
+    std::thread::id main_task_thread{};
+    graph.AddTask("Worker", []() { SpinFor(std::chrono::milliseconds{1}); }).Writes("x");
+    graph.AddTask("Main", [&main_task_thread]() { main_task_thread = std::this_thread::get_id(); }).Reads("x").RunOn(TaskGraph::Affinity::MainThread);
+    graph.Run();
+    TEST_CHECK(main_task_thread == std::this_thread::get_id());
+}
+
+TEST_CASE("TaskGraph critical path follows the longest chain of the last run") {
+    ScopedTaskGraphServices services{};
+    TaskGraph graph{};
+    graph.AddTask("Slow writer", []() { SpinFor(std::chrono::milliseconds{20}); }).Writes("x");
+    graph.AddTask("Slow reader", []() { SpinFor(std::chrono::milliseconds{20}); }).Reads("x");
+    graph.AddTask("Quick", []() { SpinFor(std::chrono::milliseconds{1}); }).Writes("y");
+    graph.Run();
+    const auto path = graph.GetCriticalPath();
+    TEST_REQUIRE(path.size() == 2u);
+    TEST_CHECK(path[0].name == "Slow writer");
+    TEST_CHECK(path[1].name == "Slow reader");
+    TEST_CHECK(path[0].duration.count() >= 20.0f);
+    const auto dump = graph.DumpCriticalPath();
+    TEST_CHECK(dump.find("critical path (2 of 3 tasks)") != std::string::npos);
+    TEST_CHECK(dump.find("Quick") == std::string::npos);
+}
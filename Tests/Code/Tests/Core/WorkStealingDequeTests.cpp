@@ -0,0 +1,134 @@
+#include "Engine/Core/WorkStealingDeque.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("WorkStealingDeque: owner pops newest first, thieves steal oldest first") {
+    WorkStealingDeque<int> deque{};
+    for(int i = 0; i < 4; ++i) {
+        deque.push(i);
+    }
+    TEST_CHECK(deque.size() == 4u);
+    int value = -1;
+    TEST_REQUIRE(deque.pop(value));
+    TEST_CHECK(value == 3);
+    TEST_REQUIRE(deque.steal(value));
+    TEST_CHECK(value == 0);
+    TEST_REQUIRE(deque.pop(value));
+    TEST_CHECK(value == 2);
+    TEST_REQUIRE(deque.steal(value));
+    TEST_CHECK(value == 1);
+    TEST_CHECK(deque.empty());
+    TEST_CHECK(!deque.pop(value));
+    TEST_CHECK(!deque.steal(value));
+}
+
+TEST_CASE("WorkStealingDeque: indices wrap around a small ring many times over") {
+    //Never more than three items in a four-slot ring, so every push after the first lap reuses a slot.
+    WorkStealingDeque<int> deque{4u};
+    int next_pushed = 0;
+    int next_stolen = 0;
+    bool in_order = true;
+    for(int lap = 0; lap < 1000; ++lap) {
+        while(deque.size() < 3u) {
+            deque.push(next_pushed++);
+        }
+        int value = -1;
+        if(!deque.steal(value) || value != next_stolen++) {
+            in_order = false;
+        }
+    }
+    TEST_CHECK(in_order);
+    TEST_CHECK(deque.size() == 2u);
+    int value = -1;
+    TEST_REQUIRE(deque.pop(value));
+    TEST_CHECK(value == next_pushed - 1);
+}
+
+TEST_CASE("WorkStealingDeque: growing keeps every item after the ring has wrapped") {
+    WorkStealingDeque<int> deque{4u};
+    //Move top and bottom past the end of the initial array before it has to grow.
+    for(int i = 0; i < 6; ++i) {
+        deque.push(i);
+        int value = -1;
+        (void)deque.steal(value);
+    }
+    constexpr int count = 100;
+    for(int i = 0; i < count; ++i) {
+        deque.push(i);
+    }
+    TEST_REQUIRE(deque.size() == static_cast<std::size_t>(count));
+    bool in_order = true;
+    for(int i = 0; i < count; ++i) {
+        int value = -1;
+        if(!deque.steal(value) || value != i) {
+            in_order = false;
+        }
+    }
+    TEST_CHECK(in_order);
+    TEST_CHECK(deque.empty());
+}
+
+TEST_CASE("WorkStealingDeque: concurrent steals never lose or duplicate an item") {
+    //The owner pushes and pops while thieves steal. Every item must be taken exactly once, which exercises
+    //the race for the last item between pop and steal as well as growth while thieves are reading.
+    constexpr std::size_t item_count = 200'000u;
+    constexpr std::size_t thief_count = 3u;
+    WorkStealingDeque<std::size_t> deque{16u};
+    auto taken = std::make_unique<std::atomic<unsigned int>[]>(item_count);
+    std::atomic_bool owner_done{false};
+    std::atomic<std::size_t> stolen_count{0u};
+
+    std::vector<std::thread> thieves{};
+    for(std::size_t i = 0u; i < thief_count; ++i) {
+        thieves.emplace_back([&]() {
+            std::size_t item = 0u;
+            for(;;) {
+                if(deque.steal(item)) {
+                    taken[item].fetch_add(1u, std::memory_order_relaxed);
+                    stolen_count.fetch_add(1u, std::memory_order_relaxed);
+                } else if(owner_done.load(std::memory_order_acquire) && deque.empty()) {
+                    break;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::size_t popped_count = 0u;
+    for(std::size_t i = 0u; i < item_count; ++i) {
+        deque.push(i);
+        //Pop every third push so the owner keeps running into thieves at both ends.
+        if(i % 3u == 0u) {
+            std::size_t item = 0u;
+            if(deque.pop(item)) {
+                taken[item].fetch_add(1u, std::memory_order_relaxed);
+                ++popped_count;
+            }
+        }
+    }
+    std::size_t item = 0u;
+    while(deque.pop(item)) {
+        taken[item].fetch_add(1u, std::memory_order_relaxed);
+        ++popped_count;
+    }
+    owner_done.store(true, std::memory_order_release);
+    for(auto& thief : thieves) {
+        thief.join();
+    }
+
+    TEST_CHECK(popped_count + stolen_count.load() == item_count);
+    bool each_taken_once = true;
+    for(std::size_t i = 0u; i < item_count; ++i) {
+        if(taken[i].load() != 1u) {
+            each_taken_once = false;
+        }
+    }
+    TEST_CHECK(each_taken_once);
+}
@@ -0,0 +1,102 @@
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Physics/ContactSolver.hpp"
+#include "Engine/Physics/IslandGraph.hpp"
+#include "Engine/Physics/NarrowPhase.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t stack_height = 8u;
+constexpr float gravity = 10.0f;
+constexpr float dt = 1.0f / 60.0f;
+
+//A column of unit-mass boxes on a static floor (body 0), each contact resting with no penetration.
+//Normals point up from the lower body to the upper one.
+class RestingStack {
+public:
+    RestingStack() noexcept {
+        for(std::size_t i = 1u; i <= stack_height; ++i) {
+            m_links.emplace_back(i == 1u ? IslandGraph::invalid_index : i - 1u, i);
+        }
+        m_islands.Build(stack_height + 1u, m_links, {});
+        m_cache.resize(stack_height);
+    }
+
+    //One solver step with iterationCount velocity passes. The floor holds the stack up against gravity.
+    //Returns the fastest speed at which any pair is still moving into each other afterwards.
+    float Step(int iterationCount, bool warmStart) noexcept {
+        std::vector<ContactConstraint> contacts{};
+        for(std::size_t i = 0u; i < m_links.size(); ++i) {
+            auto& c = contacts.emplace_back();
+            c.a = i;
+            c.b = i + 1u;
+            c.normal = Vector2::Y_Axis;
+            c.inverse_mass_a = i == 0u ? 0.0f : 1.0f;
+            c.inverse_mass_b = 1.0f;
+            c.cached = warmStart ? &m_cache[i] : nullptr;
+        }
+        m_velocities.assign(stack_height + 1u, Vector2{0.0f, -gravity * dt});
+        m_velocities[0] = Vector2::Zero;
+        const auto& island = m_islands.GetIslands()[m_islands.GetIslandOf(1u)];
+        ContactSolver::Prepare(contacts, m_islands, island, dt, 0.2f, 0.5f);
+        ContactSolver::WarmStart(contacts, m_islands, island, m_velocities);
+        for(int iteration = 0; iteration < iterationCount; ++iteration) {
+            ContactSolver::SolveVelocities(contacts, m_islands, island, m_velocities);
+        }
+        ContactSolver::StoreImpulses(contacts, m_islands, island);
+        auto worst = 0.0f;
+        for(const auto& c : contacts) {
+            worst = (std::max)(worst, -MathUtils::DotProduct(m_velocities[c.b] - m_velocities[c.a], c.normal));
+        }
+        return worst;
+    }
+
+    [[nodiscard]] float GetCachedNormalImpulse(std::size_t contact) const noexcept {
+        return m_cache[contact].normal_impulse;
+    }
+
+private:
+    std::vector<IslandGraph::Link> m_links{};
+    IslandGraph m_islands{};
+    std::vector<NarrowPhase::CachedContact> m_cache{};
+    std::vector<Vector2> m_velocities{};
+};
+
+} // namespace
+
+TEST_CASE("ContactSolver warm start converges a resting stack that cold starts cannot") {
+    constexpr int iterations = 4;
+    RestingStack cold{};
+    const auto cold_error = cold.Step(iterations, false);
+    //Four Gauss-Seidel passes are not enough to carry the top box's weight down eight contacts.
+    TEST_REQUIRE(cold_error > 0.01f * gravity * dt);
+    TEST_CHECK(std::abs(cold.Step(iterations, false) - cold_error) < 1e-6f);
+
+    RestingStack warm{};
+    auto warm_error = 0.0f;
+    for(int step = 0; step < 60; ++step) {
+        warm_error = warm.Step(iterations, true);
+    }
+    TEST_CHECK(warm_error < 0.01f * cold_error);
+    //The floor contact carries the whole stack and the top contact carries one box.
+    const auto box_weight = gravity * dt;
+    TEST_CHECK(std::abs(warm.GetCachedNormalImpulse(0u) - box_weight * static_cast<float>(stack_height)) < 0.01f * box_weight * static_cast<float>(stack_height));
+    TEST_CHECK(std::abs(warm.GetCachedNormalImpulse(stack_height - 1u) - box_weight) < 0.01f * box_weight);
+}
+
+TEST_CASE("ContactSolver never pulls bodies together") {
+    RestingStack stack{};
+    for(int step = 0; step < 10; ++step) {
+        (void)stack.Step(2, true);
+        for(std::size_t i = 0u; i < stack_height; ++i) {
+            TEST_CHECK(stack.GetCachedNormalImpulse(i) >= 0.0f);
+        }
+    }
+}
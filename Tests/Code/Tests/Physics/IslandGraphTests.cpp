@@ -0,0 +1,80 @@
+#include "Engine/Physics/IslandGraph.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+using Index = IslandGraph::Index;
+constexpr auto none = IslandGraph::invalid_index;
+
+[[nodiscard]] std::vector<Index> GetIslandBodies(const IslandGraph& graph, const IslandGraph::Island& island) noexcept {
+    const auto& bodies = graph.GetBodies();
+    auto result = std::vector<Index>(bodies.begin() + island.first_body, bodies.begin() + island.first_body + island.body_count);
+    std::sort(std::begin(result), std::end(result));
+    return result;
+}
+
+[[nodiscard]] std::vector<Index> GetIslandContacts(const IslandGraph& graph, const IslandGraph::Island& island) noexcept {
+    const auto& contacts = graph.GetContacts();
+    auto result = std::vector<Index>(contacts.begin() + island.first_contact, contacts.begin() + island.first_contact + island.contact_count);
+    std::sort(std::begin(result), std::end(result));
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("IslandGraph merges bodies linked by contacts and joints") {
+    //0-1-2 touch, 3 and 4 share a joint, 5 rests on something static and 6 touches nothing.
+    const auto contacts = std::vector<IslandGraph::Link>{{1u, 2u}, {0u, 1u}, {none, 5u}};
+    const auto joints = std::vector<IslandGraph::Link>{{4u, 3u}};
+    IslandGraph graph{};
+    graph.Build(7u, contacts, joints);
+    const auto& islands = graph.GetIslands();
+    TEST_REQUIRE(islands.size() == 4u);
+
+    //Islands are numbered by their lowest body whatever order the links came in.
+    TEST_CHECK(GetIslandBodies(graph, islands[0]) == (std::vector<Index>{0u, 1u, 2u}));
+    TEST_CHECK(GetIslandBodies(graph, islands[1]) == (std::vector<Index>{3u, 4u}));
+    TEST_CHECK(GetIslandBodies(graph, islands[2]) == (std::vector<Index>{5u}));
+    TEST_CHECK(GetIslandBodies(graph, islands[3]) == (std::vector<Index>{6u}));
+    for(Index body = 0u; body < 7u; ++body) {
+        const auto& island = islands[graph.GetIslandOf(body)];
+        const auto members = GetIslandBodies(graph, island);
+        TEST_CHECK(std::find(std::begin(members), std::end(members), body) != std::end(members));
+    }
+
+    TEST_CHECK(GetIslandContacts(graph, islands[0]) == (std::vector<Index>{0u, 1u}));
+    TEST_CHECK(islands[1].contact_count == 0u);
+    TEST_CHECK(islands[1].joint_count == 1u);
+    TEST_CHECK(GetIslandContacts(graph, islands[2]) == (std::vector<Index>{2u}));
+    TEST_CHECK(islands[3].contact_count == 0u && islands[3].joint_count == 0u);
+}
+
+TEST_CASE("IslandGraph keeps bodies resting on the same static body apart") {
+    //Static bodies are passed as invalid so a floor does not merge everything standing on it.
+    const auto contacts = std::vector<IslandGraph::Link>{{none, 0u}, {none, 1u}, {none, none}};
+    IslandGraph graph{};
+    graph.Build(2u, contacts, {});
+    const auto& islands = graph.GetIslands();
+    TEST_REQUIRE(islands.size() == 2u);
+    TEST_CHECK(GetIslandContacts(graph, islands[0]) == (std::vector<Index>{0u}));
+    TEST_CHECK(GetIslandContacts(graph, islands[1]) == (std::vector<Index>{1u}));
+    //A link with no valid side belongs to no island.
+    TEST_CHECK(graph.GetContacts().size() == 2u);
+}
+
+TEST_CASE("IslandGraph rebuilds from scratch") {
+    IslandGraph graph{};
+    graph.Build(3u, {{0u, 1u}, {1u, 2u}}, {});
+    TEST_REQUIRE(graph.GetIslands().size() == 1u);
+    graph.Build(3u, {}, {});
+    TEST_CHECK(graph.GetIslands().size() == 3u);
+    TEST_CHECK(graph.GetContacts().empty());
+    graph.Clear();
+    TEST_CHECK(graph.GetIslands().empty());
+    TEST_CHECK(graph.GetBodies().empty());
+}
@@ -0,0 +1,123 @@
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+#include "Engine/Physics/Collider.hpp"
+#include "Engine/Physics/PhysicsSystem.hpp"
+#include "Engine/Physics/PhysicsTypes.hpp"
+#include "Engine/Physics/RigidBody.hpp"
+
+#include "Engine/Services/IJobSystemService.hpp"
+#include "Engine/Services/ServiceLocator.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+
+namespace {
+
+constexpr auto fixed_step = TimeUtils::FPSeconds{TimeUtils::FPFrames{1}};
+
+//The solver and integration run their islands through the job system service.
+class ScopedJobSystemService {
+public:
+    ScopedJobSystemService() noexcept {
+        ServiceLocator::provide(*static_cast<IJobSystemService*>(&m_jobs), m_null_jobs);
+    }
+    ~ScopedJobSystemService() noexcept {
+        m_jobs.Shutdown();
+        ServiceLocator::revoke<IJobSystemService>();
+    }
+
+private:
+    JobSystem m_jobs{-1, static_cast<std::size_t>(JobType::Max), std::make_unique<std::condition_variable>()};
+    NullJobSystemService m_null_jobs{};
+};
+
+[[nodiscard]] PhysicsSystemDesc MakeDesc(const Vector2& gravity) noexcept {
+    auto desc = PhysicsSystemDesc{};
+    desc.gravity = gravity;
+    desc.dragK1K2 = Vector2::Zero;
+    return desc;
+}
+
+[[nodiscard]] std::unique_ptr<RigidBody> MakeCircle(const Vector2& position, float radius) noexcept {
+    auto desc = RigidBodyDesc{};
+    desc.initialPosition = Position{position};
+    desc.collider = new ColliderCircle(Position{position}, radius);
+    desc.physicsDesc.enableDrag = false;
+    return std::make_unique<RigidBody>(desc);
+}
+
+//Bodies are destroyed before the system so each can leave the store it lives in.
+struct World {
+    explicit World(const PhysicsSystemDesc& desc) noexcept
+    : system{desc} {
+        system.SetGravity(desc.gravity);
+        system.SetDragCoefficients(desc.dragK1K2);
+        system.Enable(true);
+    }
+    void Add(RigidBody& body) noexcept {
+        system.AddObject(&body);
+        system.BeginFrame();
+    }
+    PhysicsSystem system;
+};
+
+} // namespace
+
+TEST_CASE("PhysicsSystem runs one fixed step per step of accumulated time") {
+    ScopedJobSystemService services{};
+    World world{MakeDesc(Vector2{0.0f, 600.0f})};
+    auto body = MakeCircle(Vector2::Zero, 1.0f);
+    world.Add(*body);
+
+    //Half a step is not enough to run one.
+    world.system.Update(fixed_step * 0.5f);
+    TEST_CHECK(body->GetPosition().y == 0.0f);
+    world.system.Update(fixed_step * 0.5f);
+    const auto one_step = body->GetPosition().y;
+    TEST_REQUIRE(one_step > 0.0f);
+
+    //Integration does not carry velocity between steps, so each step moves the body the same distance.
+    const auto count_steps = [&](TimeUtils::FPSeconds frame) {
+        const auto before = body->GetPosition().y;
+        world.system.Update(frame);
+        return static_cast<int>(std::lround((body->GetPosition().y - before) / one_step));
+    };
+    TEST_CHECK(count_steps(fixed_step * 3.0f) == 3);
+    //A long frame runs at most max_steps_per_update steps and drops the rest instead of owing it to later frames.
+    const auto max_steps = world.system.GetWorldDescription().max_steps_per_update;
+    TEST_CHECK(count_steps(TimeUtils::FPSeconds{1.0f}) == max_steps);
+    TEST_CHECK(count_steps(fixed_step * 0.5f) == 0);
+    TEST_CHECK(count_steps(fixed_step * 0.5f) == 1);
+}
+
+TEST_CASE("PhysicsSystem puts a resting island to sleep and wakes it on contact") {
+    ScopedJobSystemService services{};
+    auto desc = MakeDesc(Vector2::Zero);
+    World world{desc};
+    auto resting = MakeCircle(Vector2{0.0f, 0.0f}, 1.0f);
+    auto far_away = MakeCircle(Vector2{400.0f, 400.0f}, 1.0f);
+    world.Add(*resting);
+    world.Add(*far_away);
+
+    //Stepping one at a time, the island must stay still for time_to_sleep before it sleeps.
+    const auto steps_to_sleep = static_cast<int>(std::ceil(desc.time_to_sleep / fixed_step.count()));
+    for(int step = 0; step < steps_to_sleep - 2; ++step) {
+        world.system.Update(fixed_step);
+    }
+    TEST_CHECK(resting->IsAwake());
+    for(int step = 0; step < 4; ++step) {
+        world.system.Update(fixed_step);
+    }
+    TEST_REQUIRE(!resting->IsAwake());
+    TEST_REQUIRE(!far_away->IsAwake());
+
+    //An awake body overlapping the sleeping one joins its island and wakes it; the distant body sleeps on.
+    auto intruder = MakeCircle(Vector2{0.5f, 0.0f}, 1.0f);
+    world.Add(*intruder);
+    world.system.Update(fixed_step);
+    TEST_CHECK(resting->IsAwake());
+    TEST_CHECK(!far_away->IsAwake());
+}
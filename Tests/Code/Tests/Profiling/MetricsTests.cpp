@@ -0,0 +1,85 @@
+#include "Engine/Profiling/Metrics.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+//The registry is process-wide, so each test uses its own metric names and starts from a Reset.
+MetricsSummary FindSummary(const std::vector<MetricsSummary>& summaries, std::string_view name) noexcept {
+    const auto found = std::find_if(std::cbegin(summaries), std::cend(summaries), [name](const MetricsSummary& summary) { return summary.name == name; });
+    return found != std::cend(summaries) ? *found : MetricsSummary{};
+}
+
+void RecordMany(MetricsHistogram& histogram, std::uint64_t value, std::size_t count) noexcept {
+    for(std::size_t i = 0u; i < count; ++i) {
+        histogram.Record(value);
+    }
+}
+
+} // namespace
+
+TEST_CASE("MetricsHistogram reports percentiles within a bucket of the recorded value") {
+    MetricsHistogram histogram{};
+    for(std::uint64_t value = 1u; value <= 1000u; ++value) {
+        histogram.Record(value);
+    }
+    TEST_CHECK(histogram.GetCount() == 1000u);
+    TEST_CHECK(histogram.GetMax() == 1000u);
+    TEST_CHECK(histogram.GetSum() == 500500u);
+    const auto p50 = static_cast<double>(histogram.GetValueAtPercentile(50.0));
+    const auto p99 = static_cast<double>(histogram.GetValueAtPercentile(99.0));
+    TEST_CHECK(p50 >= 500.0 * 0.97 && p50 <= 500.0 * 1.03);
+    TEST_CHECK(p99 >= 990.0 * 0.97 && p99 <= 990.0 * 1.03);
+    for(const auto value : {std::uint64_t{0u}, std::uint64_t{63u}, std::uint64_t{64u}, std::uint64_t{12345u}, ~std::uint64_t{0u}}) {
+        const auto index = MetricsHistogram::GetBucketIndex(value);
+        TEST_CHECK(index < MetricsHistogram::bucket_count);
+        TEST_CHECK(MetricsHistogram::GetBucketLowestValue(index) <= value);
+        TEST_CHECK(value <= MetricsHistogram::GetBucketHighestValue(index));
+    }
+}
+
+TEST_CASE("Metrics::Summarize narrows histograms to the requested frames") {
+    auto& histogram = Metrics::GetHistogram("tests.window_histogram");
+    Metrics::Reset();
+    Metrics::EndFrame();
+    RecordMany(histogram, 1000u, 100u);
+    Metrics::EndFrame();
+    RecordMany(histogram, 10u, 100u);
+    Metrics::EndFrame();
+
+    const auto last_frame = FindSummary(Metrics::Summarize(1u), "tests.window_histogram");
+    TEST_CHECK(last_frame.kind == MetricKind::Histogram);
+    TEST_CHECK(last_frame.samples == 100u);
+    TEST_CHECK(last_frame.p99 == 10.0);
+    TEST_CHECK(last_frame.max == 10.0);
+    TEST_CHECK(last_frame.mean == 10.0);
+
+    const auto both_frames = FindSummary(Metrics::Summarize(2u), "tests.window_histogram");
+    TEST_CHECK(both_frames.samples == 200u);
+    TEST_CHECK(both_frames.p50 == 10.0);
+    TEST_CHECK(both_frames.p95 >= 1000.0 * 0.97 && both_frames.p95 <= 1000.0);
+    TEST_CHECK(both_frames.max == 1000.0);
+    TEST_CHECK(both_frames.mean == 505.0);
+}
+
+TEST_CASE("Metrics::Reset drops histogram history along with the frames") {
+    auto& histogram = Metrics::GetHistogram("tests.reset_histogram");
+    Metrics::Reset();
+    Metrics::EndFrame();
+    RecordMany(histogram, 42u, 10u);
+    Metrics::EndFrame();
+    TEST_CHECK(FindSummary(Metrics::Summarize(10u), "tests.reset_histogram").samples == 10u);
+    Metrics::Reset();
+    TEST_CHECK(Metrics::GetHistorySize() == 0u);
+    TEST_CHECK(histogram.GetCount() == 0u);
+    RecordMany(histogram, 7u, 3u);
+    Metrics::EndFrame();
+    const auto after = FindSummary(Metrics::Summarize(10u), "tests.reset_histogram");
+    TEST_CHECK(after.samples == 3u);
+    TEST_CHECK(after.max == 7.0);
+}
@@ -0,0 +1,132 @@
+#include "Engine/Renderer/AtlasPacker.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+//The rectangle with its padding, which must stay on the page and clear of every other one.
+struct PaddedRect {
+    int page{};
+    int left{};
+    int top{};
+    int right{};
+    int bottom{};
+};
+
+PaddedRect GetPaddedRect(const AtlasPlacement& placement, int padding) noexcept {
+    return PaddedRect{placement.page
+                      , placement.position.x - padding
+                      , placement.position.y - padding
+                      , placement.position.x + placement.dimensions.x + padding
+                      , placement.position.y + placement.dimensions.y + padding};
+}
+
+bool Overlaps(const PaddedRect& a, const PaddedRect& b) noexcept {
+    return a.page == b.page && a.left < b.right && b.left < a.right && a.top < b.bottom && b.top < a.bottom;
+}
+
+//Every packed rectangle lies on its page and no two padded rectangles share a texel.
+bool IsLayoutValid(const AtlasPacker& packer) noexcept {
+    const auto padding = packer.GetOptions().padding;
+    const auto& pages = packer.GetPageDimensions();
+    std::vector<PaddedRect> rects{};
+    for(const auto& placement : packer.GetPlacements()) {
+        if(!placement.IsPacked()) {
+            continue;
+        }
+        if(static_cast<std::size_t>(placement.page) >= pages.size()) {
+            return false;
+        }
+        const auto rect = GetPaddedRect(placement, padding);
+        const auto& page = pages[placement.page];
+        if(rect.left < 0 || rect.top < 0 || rect.right > page.x || rect.bottom > page.y) {
+            return false;
+        }
+        for(const auto& other : rects) {
+            if(Overlaps(rect, other)) {
+                return false;
+            }
+        }
+        rects.push_back(rect);
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("AtlasPacker packs rectangles onto one page without overlapping their padding") {
+    AtlasPacker packer{AtlasPackerOptions{IntVector2{256, 256}, 2, 4u}};
+    for(int i = 0; i < 40; ++i) {
+        [[maybe_unused]] const auto id = packer.Add(IntVector2{8 + (i * 7) % 24, 8 + (i * 11) % 20});
+    }
+    TEST_REQUIRE(packer.Pack());
+    TEST_CHECK(packer.GetPageDimensions().size() == 1u);
+    TEST_CHECK(IsLayoutValid(packer));
+    TEST_CHECK(packer.GetStats().rects_packed == 40u);
+}
+
+TEST_CASE("AtlasPacker starts a new page when one fills and shrinks the last page to a power of two") {
+    AtlasPacker packer{AtlasPackerOptions{IntVector2{64, 64}, 0, 4u}};
+    for(int i = 0; i < 5; ++i) {
+        [[maybe_unused]] const auto id = packer.Add(IntVector2{32, 32});
+    }
+    TEST_REQUIRE(packer.Pack());
+    const auto& pages = packer.GetPageDimensions();
+    TEST_REQUIRE(pages.size() == 2u);
+    TEST_CHECK(pages[0] == IntVector2(64, 64));
+    TEST_CHECK(pages[1] == IntVector2(32, 32));
+    TEST_CHECK(packer.GetPlacement(4u).page == 1);
+    TEST_CHECK(IsLayoutValid(packer));
+}
+
+TEST_CASE("AtlasPacker leaves a rectangle larger than a page unpacked and packs the rest") {
+    AtlasPacker packer{AtlasPackerOptions{IntVector2{64, 64}, 1, 4u}};
+    const auto small = packer.Add(IntVector2{16, 16});
+    //Fits the page only without its padding.
+    const auto too_big = packer.Add(IntVector2{64, 8});
+    TEST_CHECK(!packer.Pack());
+    TEST_CHECK(packer.GetPlacement(small).IsPacked());
+    TEST_CHECK(!packer.GetPlacement(too_big).IsPacked());
+    TEST_CHECK(packer.GetStats().rects == 2u);
+    TEST_CHECK(packer.GetStats().rects_packed == 1u);
+}
+
+TEST_CASE("AtlasPacker stops at the page limit") {
+    AtlasPacker packer{AtlasPackerOptions{IntVector2{32, 32}, 0, 2u}};
+    for(int i = 0; i < 3; ++i) {
+        [[maybe_unused]] const auto id = packer.Add(IntVector2{32, 32});
+    }
+    TEST_CHECK(!packer.Pack());
+    TEST_CHECK(packer.GetPageDimensions().size() == 2u);
+    TEST_CHECK(packer.GetStats().rects_packed == 2u);
+    TEST_CHECK(IsLayoutValid(packer));
+}
+
+TEST_CASE("AtlasPacker reports packed area against page area") {
+    AtlasPacker packer{AtlasPackerOptions{IntVector2{64, 64}, 0, 4u}};
+    [[maybe_unused]] const auto a = packer.Add(IntVector2{32, 32});
+    [[maybe_unused]] const auto b = packer.Add(IntVector2{32, 32});
+    TEST_REQUIRE(packer.Pack());
+    const auto& stats = packer.GetStats();
+    TEST_CHECK(stats.used_texels == 2u * 32u * 32u);
+    //Side by side along the skyline, so the shrunk page is exactly full.
+    TEST_CHECK(stats.page_texels == 64u * 32u);
+    TEST_CHECK(stats.efficiency == 1.0f);
+    TEST_CHECK(stats.pages == 1u);
+}
+
+TEST_CASE("AtlasPacker discards the previous result when packing again") {
+    AtlasPacker packer{AtlasPackerOptions{IntVector2{64, 64}, 0, 4u}};
+    [[maybe_unused]] const auto first = packer.Add(IntVector2{64, 64});
+    TEST_REQUIRE(packer.Pack());
+    const auto second = packer.Add(IntVector2{64, 64});
+    TEST_REQUIRE(packer.Pack());
+    TEST_CHECK(packer.GetPageDimensions().size() == 2u);
+    TEST_CHECK(packer.GetPlacement(second).page == 1);
+    packer.Clear();
+    TEST_CHECK(packer.GetPlacements().empty());
+    TEST_CHECK(packer.GetPageDimensions().empty());
+}
@@ -0,0 +1,110 @@
+#include "Engine/Renderer/SpriteBatch.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+//The batch only compares and hands back material and texture pointers, so stand-ins that are never dereferenced will do.
+Material* FakeMaterial(std::uintptr_t id) noexcept {
+    return reinterpret_cast<Material*>(0x1000u + id * 0x100u);
+}
+
+const Texture* FakeTexture(std::uintptr_t id) noexcept {
+    return reinterpret_cast<const Texture*>(0x8000u + id * 0x100u);
+}
+
+//Tags every corner with the submission index so the built vertex buffer shows the draw order.
+SpriteBatch::Quad MakeQuad(std::size_t tag) noexcept {
+    const auto x = static_cast<float>(tag);
+    return SpriteBatch::Quad{Vertex3D{Vector3{x, 0.0f, 0.0f}}, Vertex3D{Vector3{x, 1.0f, 0.0f}}, Vertex3D{Vector3{x, 1.0f, 1.0f}}, Vertex3D{Vector3{x, 0.0f, 1.0f}}};
+}
+
+//The submission index of each quad in the built vertex buffer, in draw order.
+std::vector<std::size_t> GetDrawOrder(const SpriteBatch& batch) noexcept {
+    std::vector<std::size_t> order{};
+    const auto& vbo = batch.GetVbo();
+    for(std::size_t v = 0u; v < vbo.size(); v += 4u) {
+        order.push_back(static_cast<std::size_t>(vbo[v].position.x));
+    }
+    return order;
+}
+
+} // namespace
+
+TEST_CASE("SpriteBatch::RadixSort orders by key and keeps equal keys in submission order") {
+    const auto keys = std::vector<std::uint64_t>{0x0000000300000000u, 0x0000000100020000u, 0x0000000100010005u, 0x0000000300000000u, 0x0000000100010005u, 0x0000000100010001u};
+    auto order = std::vector<std::uint32_t>{0u, 1u, 2u, 3u, 4u, 5u};
+    auto scratch = std::vector<std::uint32_t>{};
+    SpriteBatch::RadixSort(keys, order, scratch);
+    TEST_CHECK((order == std::vector<std::uint32_t>{5u, 2u, 4u, 1u, 0u, 3u}));
+}
+
+TEST_CASE("SpriteBatch sorts by layer, then material, then texture") {
+    SpriteBatch batch{};
+    //Ids follow first appearance, so material 0 sorts before material 1 however the pointers compare.
+    TEST_REQUIRE(batch.Add(1, FakeMaterial(0u), FakeTexture(0u), MakeQuad(0u)));
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(1u), FakeTexture(1u), MakeQuad(1u)));
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(1u), FakeTexture(0u), MakeQuad(2u)));
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(1u), MakeQuad(3u)));
+    TEST_REQUIRE(batch.Add(-1, FakeMaterial(1u), FakeTexture(1u), MakeQuad(4u)));
+    batch.Build();
+    TEST_CHECK((GetDrawOrder(batch) == std::vector<std::size_t>{4u, 3u, 2u, 1u, 0u}));
+    const auto& runs = batch.GetDrawInstructions();
+    TEST_REQUIRE(runs.size() == 5u);
+    TEST_CHECK(runs[0].material == FakeMaterial(1u));
+    TEST_CHECK(runs[1].material == FakeMaterial(0u));
+    TEST_CHECK(batch.GetDrawTextures()[2] == FakeTexture(0u));
+    TEST_CHECK(batch.GetDrawTextures()[3] == FakeTexture(1u));
+}
+
+TEST_CASE("SpriteBatch merges quads sharing a key into one draw") {
+    SpriteBatch batch{};
+    for(std::size_t i = 0u; i < 3u; ++i) {
+        TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(0u), MakeQuad(i)));
+    }
+    //Interleaved with another texture: the two keys each still make a single run.
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(1u), MakeQuad(3u)));
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(0u), MakeQuad(4u)));
+    batch.Build();
+    const auto& runs = batch.GetDrawInstructions();
+    TEST_REQUIRE(runs.size() == 2u);
+    TEST_CHECK(runs[0].indexStart == 0u);
+    TEST_CHECK(runs[0].indexCount == 24u);
+    TEST_CHECK(runs[0].count == 4u);
+    TEST_CHECK(runs[1].indexStart == 24u);
+    TEST_CHECK(runs[1].indexCount == 6u);
+    TEST_CHECK(runs[1].count == 1u);
+    TEST_CHECK((GetDrawOrder(batch) == std::vector<std::size_t>{0u, 1u, 2u, 4u, 3u}));
+    TEST_CHECK(batch.GetIbo().size() == 30u);
+    TEST_CHECK(batch.GetFrameStats().draws_issued == 2u);
+}
+
+TEST_CASE("SpriteBatch keeps quads on different layers in separate draws") {
+    SpriteBatch batch{};
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(0u), MakeQuad(0u)));
+    TEST_REQUIRE(batch.Add(1, FakeMaterial(0u), FakeTexture(0u), MakeQuad(1u)));
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(0u), MakeQuad(2u)));
+    batch.Build();
+    const auto& runs = batch.GetDrawInstructions();
+    TEST_REQUIRE(runs.size() == 2u);
+    TEST_CHECK(runs[0].count == 2u);
+    TEST_CHECK(runs[1].count == 1u);
+    TEST_CHECK((GetDrawOrder(batch) == std::vector<std::size_t>{0u, 2u, 1u}));
+}
+
+TEST_CASE("SpriteBatch::Clear forgets ids, so the next batch numbers materials afresh") {
+    SpriteBatch batch{};
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(0u), MakeQuad(0u)));
+    batch.Build();
+    batch.Clear();
+    TEST_CHECK(batch.empty());
+    TEST_CHECK(batch.GetDrawInstructions().empty());
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(1u), FakeTexture(0u), MakeQuad(1u)));
+    TEST_REQUIRE(batch.Add(0, FakeMaterial(0u), FakeTexture(0u), MakeQuad(2u)));
+    batch.Build();
+    TEST_CHECK((GetDrawOrder(batch) == std::vector<std::size_t>{1u, 2u}));
+}
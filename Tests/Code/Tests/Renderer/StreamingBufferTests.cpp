@@ -0,0 +1,138 @@
+#include "Engine/Renderer/StreamingBuffer.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+//CPU-side stand-in for a dynamic GPU buffer that records how it was mapped.
+class MockStreamingTarget : public IStreamingBufferTarget {
+public:
+    explicit MockStreamingTarget(std::size_t byteWidth) noexcept
+    : bytes(byteWidth) {
+        /* DO NOTHING */
+    }
+
+    [[nodiscard]] std::size_t GetByteWidth() const noexcept override {
+        return bytes.size();
+    }
+    void Resize(std::size_t byteWidth) noexcept override {
+        bytes.assign(byteWidth, 0u);
+    }
+    [[nodiscard]] void* Map(MapMode mode) noexcept override {
+        modes.push_back(mode);
+        if(fail_maps) {
+            --fail_maps;
+            return nullptr;
+        }
+        mapped = true;
+        return bytes.data();
+    }
+    void Unmap() noexcept override {
+        mapped = false;
+    }
+
+    std::vector<std::uint8_t> bytes{};
+    std::vector<MapMode> modes{};
+    int fail_maps{0};
+    bool mapped{false};
+};
+
+struct Fixture {
+    explicit Fixture(std::size_t byteWidth) noexcept {
+        auto owned = std::make_unique<MockStreamingTarget>(byteWidth);
+        target = owned.get();
+        buffer = std::make_unique<StreamingBuffer>(std::move(owned));
+    }
+    MockStreamingTarget* target{nullptr};
+    std::unique_ptr<StreamingBuffer> buffer{};
+};
+
+std::vector<std::uint8_t> MakeBytes(std::size_t count, std::uint8_t first) noexcept {
+    auto bytes = std::vector<std::uint8_t>(count);
+    for(std::size_t i = 0u; i < count; ++i) {
+        bytes[i] = static_cast<std::uint8_t>(first + i);
+    }
+    return bytes;
+}
+
+using MapMode = IStreamingBufferTarget::MapMode;
+
+} // namespace
+
+TEST_CASE("StreamingBuffer appends with no-overwrite maps after the first discard") {
+    Fixture f{64u};
+    const auto a = MakeBytes(16u, 1u);
+    const auto b = MakeBytes(16u, 100u);
+    TEST_CHECK(f.buffer->Write(a.data(), a.size(), 1u) == 0u);
+    TEST_CHECK(f.buffer->Write(b.data(), b.size(), 1u) == 16u);
+    TEST_REQUIRE(f.target->modes.size() == 2u);
+    TEST_CHECK(f.target->modes[0] == MapMode::Discard);
+    TEST_CHECK(f.target->modes[1] == MapMode::NoOverwrite);
+    TEST_CHECK(std::memcmp(f.target->bytes.data(), a.data(), a.size()) == 0);
+    TEST_CHECK(std::memcmp(f.target->bytes.data() + 16u, b.data(), b.size()) == 0);
+    TEST_CHECK(!f.target->mapped);
+    TEST_CHECK(f.buffer->GetFrameStats().bytes_uploaded == 32u);
+    TEST_CHECK(f.buffer->GetFrameStats().discards == 1u);
+}
+
+TEST_CASE("StreamingBuffer wraps to the start with a discard when full") {
+    Fixture f{64u};
+    const auto bytes = MakeBytes(24u, 7u);
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 0u);
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 24u);
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 0u);
+    TEST_CHECK(f.target->modes.back() == MapMode::Discard);
+    TEST_CHECK(f.buffer->GetFrameStats().discards == 2u);
+    TEST_CHECK(f.buffer->GetFrameStats().resizes == 0u);
+}
+
+TEST_CASE("StreamingBuffer aligns offsets to the element stride") {
+    Fixture f{64u};
+    const auto odd = MakeBytes(3u, 0u);
+    const auto elements = std::vector<std::uint32_t>{1u, 2u, 3u};
+    TEST_CHECK(f.buffer->Write(odd.data(), odd.size(), 1u) == 0u);
+    TEST_CHECK(f.buffer->Write(elements) == 1u);
+    std::uint32_t second{};
+    std::memcpy(&second, f.target->bytes.data() + 2u * sizeof(std::uint32_t), sizeof(second));
+    TEST_CHECK(second == 2u);
+}
+
+TEST_CASE("StreamingBuffer grows when one write does not fit") {
+    Fixture f{64u};
+    const auto big = MakeBytes(100u, 0u);
+    TEST_CHECK(f.buffer->Write(big.data(), big.size(), 1u) == 0u);
+    TEST_CHECK(f.target->GetByteWidth() >= big.size());
+    TEST_CHECK(f.buffer->GetFrameStats().resizes == 1u);
+    f.buffer->BeginFrame();
+    TEST_CHECK(f.buffer->GetLastFrameStats().resizes == 1u);
+    TEST_CHECK(f.buffer->GetFrameStats().resizes == 0u);
+}
+
+TEST_CASE("StreamingBuffer returns npos when the target cannot be mapped") {
+    Fixture f{64u};
+    const auto bytes = MakeBytes(16u, 1u);
+    const auto elements = std::vector<std::uint32_t>{1u, 2u};
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 0u);
+    f.target->fail_maps = 2;
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == StreamingBuffer::npos);
+    TEST_CHECK(f.buffer->Write(elements) == StreamingBuffer::npos);
+    TEST_CHECK(f.buffer->GetFrameStats().bytes_uploaded == 16u);
+    //The next write that succeeds must not trust anything written before the failure.
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 0u);
+    TEST_CHECK(f.target->modes.back() == MapMode::Discard);
+}
+
+TEST_CASE("StreamingBuffer recreates the target after Invalidate") {
+    Fixture f{64u};
+    const auto bytes = MakeBytes(16u, 1u);
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 0u);
+    f.buffer->Invalidate();
+    TEST_CHECK(f.buffer->Write(bytes.data(), bytes.size(), 1u) == 0u);
+    TEST_CHECK(f.buffer->GetFrameStats().resizes == 1u);
+    TEST_CHECK(f.target->modes.back() == MapMode::Discard);
+}
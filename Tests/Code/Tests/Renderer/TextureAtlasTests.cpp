@@ -0,0 +1,25 @@
+#include "Engine/Renderer/TextureAtlas.hpp"
+
+#include "Tests/TestHarness.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+TEST_CASE("TextureAtlas refuses an image file that does not exist") {
+    TextureAtlas atlas{"Tests"};
+    TEST_CHECK(!atlas.Add(std::filesystem::current_path() / "TextureAtlasTests_missing.png"));
+}
+
+TEST_CASE("TextureAtlas fails to load an atlas whose page is missing") {
+    const auto xml_path = std::filesystem::current_path() / "TextureAtlasTests.xml";
+    {
+        std::ofstream xml{xml_path};
+        xml << "<atlas name=\"Tests\">\n"
+               "    <page id=\"0\" src=\"TextureAtlasTests_missing_0.png\" />\n"
+               "</atlas>\n";
+    }
+    TextureAtlas atlas{"Tests"};
+    TEST_CHECK(!atlas.LoadFromFile(xml_path));
+    std::error_code ec{};
+    std::filesystem::remove(xml_path, ec);
+}
@@ -0,0 +1,50 @@
+#include "Tests/TestHarness.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+int g_current_failures = 0;
+
+} // namespace
+
+namespace Tests {
+
+Registrar::Registrar(std::string_view name, TestFunction function) noexcept {
+    GetRegistry().push_back(TestCase{name, function});
+}
+
+std::vector<TestCase>& GetRegistry() noexcept {
+    //Function-local so registration works regardless of the order translation units are initialized in.
+    static std::vector<TestCase> registry{};
+    return registry;
+}
+
+void ReportFailure(const char* expression, const char* file, int line) noexcept {
+    ++g_current_failures;
+    std::printf("    %s(%d): check failed: %s\n", file, line, expression);
+}
+
+int RunAll(std::string_view filter /*= std::string_view{}*/) noexcept {
+    int failed = 0;
+    int run = 0;
+    for(const auto& test : GetRegistry()) {
+        if(!filter.empty() && test.name.find(filter) == std::string_view::npos) {
+            continue;
+        }
+        ++run;
+        g_current_failures = 0;
+        const auto start = std::chrono::steady_clock::now();
+        test.function();
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        std::printf("[%s] %.*s (%.1f ms)\n", g_current_failures ? "FAIL" : " OK ", static_cast<int>(test.name.size()), test.name.data(), elapsed.count());
+        if(g_current_failures) {
+            ++failed;
+        }
+    }
+    std::printf("%d of %d tests passed.\n", run - failed, run);
+    return failed;
+}
+
+} // namespace Tests
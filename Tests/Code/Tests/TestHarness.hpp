@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+//Minimal self-registering test runner for engine code that does not need a window or a GPU.
+//Each TEST_CASE adds itself to the registry during static initialization; Main runs them all.
+namespace Tests {
+
+using TestFunction = void (*)();
+
+struct TestCase {
+    std::string_view name{};
+    TestFunction function{nullptr};
+};
+
+class Registrar {
+public:
+    Registrar(std::string_view name, TestFunction function) noexcept;
+};
+
+[[nodiscard]] std::vector<TestCase>& GetRegistry() noexcept;
+void ReportFailure(const char* expression, const char* file, int line) noexcept;
+
+//Runs every test whose name contains filter and returns how many failed.
+[[nodiscard]] int RunAll(std::string_view filter = std::string_view{}) noexcept;
+
+} // namespace Tests
+
+#define TESTS_CONCAT_IMPL(a, b) a##b
+#define TESTS_CONCAT(a, b) TESTS_CONCAT_IMPL(a, b)
+
+#define TEST_CASE(name)                                                                                            \
+    static void TESTS_CONCAT(test_case_, __LINE__)();                                                              \
+    static const Tests::Registrar TESTS_CONCAT(test_registrar_, __LINE__){name, &TESTS_CONCAT(test_case_, __LINE__)}; \
+    static void TESTS_CONCAT(test_case_, __LINE__)()
+
+//Records a failure and keeps going.
+#define TEST_CHECK(expression)                                    \
+    do {                                                          \
+        if(!(expression)) {                                       \
+            Tests::ReportFailure(#expression, __FILE__, __LINE__); \
+        }                                                         \
+    } while(false)
+
+//Records a failure and leaves the test, for checks the rest of the test depends on.
+#define TEST_REQUIRE(expression)                                  \
+    do {                                                          \
+        if(!(expression)) {                                       \
+            Tests::ReportFailure(#expression, __FILE__, __LINE__); \
+            return;                                               \
+        }                                                         \
+    } while(false)